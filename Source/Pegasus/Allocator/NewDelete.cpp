@@ -81,7 +81,7 @@ void* operator new[](size_t size, Pegasus::Alloc::IAllocator* allocator, Pegasus
 
 //----------------------------------------------------------------------------------------
 
-void operator delete(void* pointer)
+void operator delete(void* pointer) throw()
 {
     // Force crash
     // Don't use this, use PG_DELETE instead
@@ -96,6 +96,7 @@ Application::Application(const ApplicationConfig& config)
     
     // Set up node managers
     mNodeManager = PG_NEW(nodeAlloc, -1, "NodeManager", Alloc::PG_MEM_PERM) Graph::NodeManager(nodeAlloc, nodeDataAlloc);
+    mNodeManager->GetScheduler()->SetNumWorkers(Graph::NodeScheduler::GetDefaultNumWorkers());
 
     Pegasus::Shader::IShaderFactory * shaderFactory = Pegasus::Render::GetRenderShaderFactory();
     Pegasus::Mesh::IMeshFactory * meshFactory = Pegasus::Render::GetRenderMeshFactory();
@@ -151,6 +152,9 @@ Application::Application(const ApplicationConfig& config)
     
     mAssetLib->SetIoManager(mIoManager); //TODO: decide here if we use the pakIoManager or the standard file system IOManager
     
+    // Reuse the node data generated by the previous runs, the files are kept next to the imported assets
+    mNodeManager->GetDataCache()->Initialize(mIoManager, "NodeCache_", 256ULL * 1024 * 1024);
+
     mRenderSystemManager = PG_NEW(coreAlloc, -1, "Render System Manager", Alloc::PG_MEM_PERM) RenderSystems::RenderSystemManager(coreAlloc, this);
 
     PG_LOG('APPL', "Startup finished");
@@ -261,6 +265,17 @@ void Application::Load()
 
 void Application::Update()
 {
+    // Reclaim the temporaries of the frame before the last one
+    Memory::FlipFrameAllocator();
+
+    // Frame boundary of the asynchronously generated node data
+    mNodeManager->BeginFrame();
+
+#if PEGASUS_ENABLE_MEMORY_STATS
+    // New frame for the allocator statistics, the counters of the previous frame stay readable
+    Memory::ResetMemoryFrameStats();
+#endif
+
     // Needed for compute/etc
     mRenderContext->Bind();
 
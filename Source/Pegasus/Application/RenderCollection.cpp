@@ -72,18 +72,15 @@ namespace Application
             }
     
             //walk the node's properties and cache them.
-            for (unsigned int i = 0; i < node->GetNumClassProperties(); ++i)
+            for (unsigned int i = 0; entryLayout != nullptr && i < node->GetNumClassProperties(); ++i)
             {
                 const PropertyGrid::PropertyRecord& record = node->GetClassPropertyRecord(i);
-                for (unsigned int propId = 0; propId < entryLayout->mProperties.GetSize(); ++propId)
+                const int* propId = entryLayout->mPropertyIndices.Find(record.name);
+                if (propId != nullptr)
                 {
-                    if (!Utils::Strcmp(record.name, entryLayout->mProperties[propId]))
-                    {
-                        mCachedInfos[propId].mValid = true;
-                        mCachedInfos[propId].mSize  = record.size;
-                        mCachedInfos[propId].mCachedAccessor = node->GetClassPropertyAccessor(static_cast<unsigned>(i));
-                        break;
-                    }
+                    mCachedInfos[*propId].mValid = true;
+                    mCachedInfos[*propId].mSize  = record.size;
+                    mCachedInfos[*propId].mCachedAccessor = node->GetClassPropertyAccessor(static_cast<unsigned>(i));
                 }
             }
         }
@@ -150,7 +147,7 @@ namespace Application
 
     
     RenderCollectionFactory::RenderCollectionFactory(Core::IApplicationContext* context, Alloc::IAllocator* alloc)
-        :mAlloc(alloc), mPropLayoutEntries(alloc), mContext(context)
+        :mAlloc(alloc), mPropLayoutEntries(alloc), mPropLayoutIndices(alloc), mContext(context)
     {
     }
 
@@ -160,11 +157,22 @@ namespace Application
 
     void RenderCollectionFactory::RegisterProperties(const BlockScript::ClassTypeDesc& classDesc)
     {
+        if (!mPropLayoutIndices.Contains(classDesc.classTypeName))
+        {
+            mPropLayoutIndices.Insert(classDesc.classTypeName, mPropLayoutEntries.GetSize());
+        }
+
         RenderCollectionFactory::PropEntries& entry = mPropLayoutEntries.PushEmpty();
         entry.mName = classDesc.classTypeName;
+        entry.mPropertyIndices.Reserve(classDesc.propertyCount);
         for (int i = 0; i < classDesc.propertyCount; ++i)
         {
-            entry.mProperties.PushEmpty() = classDesc.propertyDescriptors[i].propertyName;
+            const char* propertyName = classDesc.propertyDescriptors[i].propertyName;
+            entry.mProperties.PushEmpty() = propertyName;
+            if (!entry.mPropertyIndices.Contains(propertyName))
+            {
+                entry.mPropertyIndices.Insert(propertyName, i);
+            }
         }
     }
 
@@ -180,15 +188,8 @@ namespace Application
 
     const RenderCollectionFactory::PropEntries* RenderCollectionFactory::FindNodeLayoutEntry(const char* nodeTypeName) const
     {
-        for (unsigned int i = 0; i < mPropLayoutEntries.GetSize(); ++i)
-        {
-            const RenderCollectionFactory::PropEntries& entry = mPropLayoutEntries[i];
-            if (!Utils::Strcmp(nodeTypeName, entry.mName))
-            {
-                return &entry;
-            }
-        }
-        return nullptr;
+        const unsigned int* index = mPropLayoutIndices.Find(nodeTypeName);
+        return index != nullptr ? &mPropLayoutEntries[*index] : nullptr;
     }
 
     class RenderCollectionImpl
@@ -415,14 +416,6 @@ namespace Application
     #include "../Source/Pegasus/Application/RenderResources.inl"
     #undef RES_PROCESS
    
-    template<typename T>
-    struct GlobalCacheSlot
-    {
-        GlobalCacheSlot() {}
-        GlobalCache::CacheName mName;
-        Core::Ref<T> mObj;
-    }; 
-
     class GlobalCacheImpl
     {
     public:
@@ -434,7 +427,7 @@ namespace Application
         {
         }
     
-        #define RES_PROCESS(type, instance, metaname, hasProperties, canUpdate) Utils::Vector< GlobalCacheSlot<type> > instance;
+        #define RES_PROCESS(type, instance, metaname, hasProperties, canUpdate) Utils::HashMap< unsigned long long, Core::Ref<type> > instance;
         #include "../Source/Pegasus/Application/RenderResources.inl"
         #undef RES_PROCESS
 
@@ -449,13 +442,13 @@ namespace Application
     };
 
     template<typename T>
-    Utils::Vector<GlobalCacheSlot<T> >* GetGlobalCacheInternalContainer(GlobalCacheImpl* impl)
+    Utils::HashMap<unsigned long long, Core::Ref<T> >* GetGlobalCacheInternalContainer(GlobalCacheImpl* impl)
     {
         return nullptr;
     }
 
     #define RES_PROCESS(type, instance, metaname, hasProperties, canUpdate) \
-        template<> Utils::Vector<GlobalCacheSlot<type> >* GetGlobalCacheInternalContainer<type>(GlobalCacheImpl* impl)\
+        template<> Utils::HashMap<unsigned long long, Core::Ref<type> >* GetGlobalCacheInternalContainer<type>(GlobalCacheImpl* impl)\
         {\
             return &impl->instance;\
         }
@@ -509,22 +502,17 @@ namespace Application
     void GlobalCacheRegisterInternal(GlobalCache* cache, GlobalCache::CacheName name, T* resource)
     {
         auto* container = GetGlobalCacheInternalContainer<T>(cache->GetImpl());
-        auto& slot = container->PushEmpty();
-        slot.mName = name;
-        slot.mObj = resource;
+        container->Insert(name.v, Core::Ref<T>(resource));
     }
 
     template<typename T>
     T* GlobalCacheFindInternal(GlobalCache* cache, GlobalCache::CacheName name)
     {
         auto* container = GetGlobalCacheInternalContainer<T>(cache->GetImpl());
-        for (unsigned i = 0; i < container->GetSize(); ++i)
+        Core::Ref<T>* obj = container->Find(name.v);
+        if (obj != nullptr)
         {
-            auto& slot = (*container)[i];
-            if (slot.mName == name)
-            {
-                return slot.mObj;
-            }
+            return *obj;
         }
         return nullptr;
     }
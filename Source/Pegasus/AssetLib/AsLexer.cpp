@@ -0,0 +1,246 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AsLexer.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Hand written AssetScript lexer. Replaces the flex generated lexer.
+
+#include "Pegasus/Core/Assertion.h" 
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/AssetLib/AsLexer.h"
+#include "Pegasus/AssetLib/AssetBuilder.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/AssetLib/as.parser.hpp"
+
+using namespace Pegasus;
+using namespace Pegasus::AssetLib;
+
+#define AS_TOKEN(t) return (lval->token = t);
+
+namespace
+{
+    inline bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    //! characters allowed in unquoted strings: names, numbers and paths
+    inline bool IsWordChar(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || IsDigit(c)
+            || c == '_' || c == '-' || c == '.' || c == '\\' || c == '/';
+    }
+
+    //! \return true if the whole word is a float of the form -?[0-9]+.[0-9]+
+    bool IsFloatWord(const char* word, int length)
+    {
+        int i = word[0] == '-' ? 1 : 0;
+        int intDigits = 0;
+        while (i < length && IsDigit(word[i])) { ++i; ++intDigits; }
+        if (intDigits == 0 || i >= length || word[i] != '.')
+        {
+            return false;
+        }
+        ++i;
+        int fracDigits = 0;
+        while (i < length && IsDigit(word[i])) { ++i; ++fracDigits; }
+        return fracDigits > 0 && i == length;
+    }
+
+    //! \return true if the whole word is an integer of the form [0-9]+
+    bool IsIntWord(const char* word, int length)
+    {
+        for (int i = 0; i < length; ++i)
+        {
+            if (!IsDigit(word[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+AsLexer::AsLexer(AssetBuilder* builder)
+: mBuilder(builder),
+  mCursor(nullptr),
+  mEnd(nullptr),
+  mTerminated(false)
+{
+}
+
+void AsLexer::Begin(const char* buffer, int bufferSize)
+{
+    mCursor = buffer;
+    mEnd = buffer + bufferSize;
+    mTerminated = false;
+}
+
+int AsLexer::Lex(YYSTYPE* lval)
+{
+    const char* end = mEnd;
+    while (!mTerminated && mCursor < end)
+    {
+        const char* c = mCursor;
+        if (IsWordChar(*c))
+        {
+            while (c < end && IsWordChar(*c))
+            {
+                ++c;
+            }
+            const char* word = mCursor;
+            int length = static_cast<int>(c - word);
+            mCursor = c;
+
+            if (IsFloatWord(word, length))
+            {
+                lval->floatValue = Utils::Atof(word, length);
+                return I_FLOAT;
+            }
+            else if (IsIntWord(word, length))
+            {
+                lval->integerValue = Utils::Atoi(word, length);
+                return I_INT;
+            }
+            else
+            {
+                const char* txt = Intern(word, length);
+                if (txt == nullptr)
+                {
+                    return 0;
+                }
+                lval->identifierText = txt;
+                return IDENTIFIER;
+            }
+        }
+
+        mCursor = c + 1;
+        switch (*c)
+        {
+        case '\n':
+            mBuilder->IncLine();
+            break;
+        case '"':
+            {
+                const char* txt = CaptureString('"');
+                if (txt == nullptr)
+                {
+                    return 0;
+                }
+                lval->identifierText = txt;
+                return IDENTIFIER;
+            }
+        case '{':
+            if (mCursor < end && *mCursor == '@')
+            {
+                ++mCursor;
+                const char* txt = CaptureString('}');
+                if (txt == nullptr)
+                {
+                    return 0;
+                }
+                lval->identifierText = txt;
+                return ASSET_PATH_REFERENCE;
+            }
+            AS_TOKEN(K_LEFT_BRAC);
+        case '}': AS_TOKEN(K_RIGHT_BRAC);
+        case '[': AS_TOKEN(K_LEFT_LACE);
+        case ']': AS_TOKEN(K_RIGHT_LACE);
+        case ',': AS_TOKEN(K_COMMA);
+        case ':': AS_TOKEN(K_COLON);
+        case '#':
+            //line comment, the end of line is left so lines are still counted
+            while (mCursor < end && *mCursor != '\n')
+            {
+                ++mCursor;
+            }
+            break;
+        default:
+            //blanks and unknown characters are ignored
+            break;
+        }
+    }
+    return 0;
+}
+
+int AsLexer::LexAll()
+{
+    YYSTYPE lval;
+    int tokenCount = 0;
+    while (Lex(&lval) != 0)
+    {
+        ++tokenCount;
+    }
+    return tokenCount;
+}
+
+const char* AsLexer::CaptureString(char terminator)
+{
+    const char* begin = mCursor;
+    const char* c = begin;
+    bool hasNewLines = false;
+    while (c < mEnd && *c != terminator)
+    {
+        hasNewLines = hasNewLines || *c == '\n';
+        ++c;
+    }
+
+    if (c == mEnd)
+    {
+        PG_LOG('ERR_', "Unterminated string. Line %d", mBuilder->GetCurrentLine());
+        mTerminated = true;
+        return nullptr;
+    }
+
+    mCursor = c + 1;
+    int length = static_cast<int>(c - begin);
+    if (!hasNewLines)
+    {
+        //common case, the string is interned straight from the file buffer
+        if (length > 511)
+        {
+            PG_LOG('ERR_', "String too long, exceeding the limit. Line %d", mBuilder->GetCurrentLine());
+            mTerminated = true;
+            return nullptr;
+        }
+        return Intern(begin, length);
+    }
+
+    //new lines are dropped from strings
+    int pos = 0;
+    for (const char* s = begin; s < c; ++s)
+    {
+        if (*s != '\n')
+        {
+            if (pos >= 511)
+            {
+                PG_LOG('ERR_', "String too long, exceeding the limit. Line %d", mBuilder->GetCurrentLine());
+                mTerminated = true;
+                return nullptr;
+            }
+            mStringAccumulator[pos++] = *s;
+        }
+    }
+    return Intern(mStringAccumulator, pos);
+}
+
+const char* AsLexer::Intern(const char* str, int length)
+{
+    const char* txt = mBuilder->InternString(str, length);
+    if (txt == nullptr)
+    {
+        PG_LOG('ERR_', "String too long, exceeding the limit. Line %d", mBuilder->GetCurrentLine());
+        mTerminated = true;
+    }
+    return txt;
+}
+
+int AS_lex(YYSTYPE* lval, void* scanner)
+{
+    return static_cast<AsLexer*>(scanner)->Lex(lval);
+}
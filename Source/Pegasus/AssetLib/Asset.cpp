@@ -304,6 +304,24 @@ const char* Asset::CopyString(const char* string)
     return strAllocation;
 }
 
+const char* Asset::CopyString(const char* string, int length)
+{
+    int strSize = length + 1;
+    if (strSize > MAX_STRING_PAGE_SIZE)
+    {
+        return nullptr;
+    }
+
+    char* strAllocation = static_cast<char*>(mStringAllocator.Alloc(
+        strSize,
+        Alloc::PG_MEM_TEMP
+    ));
+
+    Utils::Memcpy(strAllocation, string, length);
+    strAllocation[length] = '\0';
+    return strAllocation;
+}
+
 void Asset::Clear()
 {
     if (mFormat == Asset::FMT_RAW)
@@ -26,6 +26,7 @@ AssetBuilder::AssetBuilder(Alloc::IAllocator* allocator)
   mObjStack(allocator),
   mObjectChildAssetQueue(allocator),
   mArrayChildAssetQueue(allocator),
+  mInternTable(allocator),
   mFinalAsset(nullptr),
   mCurrentLine(1),
   mErrorCount(0)
@@ -43,6 +44,7 @@ void AssetBuilder::Reset()
     mObjStack.Clear();
     mObjectChildAssetQueue.Clear();
     mArrayChildAssetQueue.Clear();
+    mInternTable.Reset();
     mFinalAsset = nullptr;
     mErrorCount = 0;
 }
@@ -83,6 +85,8 @@ void AssetBuilder::EndObject()
 
 void AssetBuilder::BeginCompilation(Asset* asset)
 {
+    //interned strings live in the previous asset
+    mInternTable.Reset();
     mFinalAsset = asset; 
 }
 
@@ -91,6 +95,21 @@ const char* AssetBuilder::CopyString(const char* string)
     return mFinalAsset->CopyString(string);
 }
 
+const char* AssetBuilder::InternString(const char* string, int length)
+{
+    unsigned int hash = Utils::HashStr(string, length);
+    const char* found = mInternTable.Find(string, length, hash);
+    if (found == nullptr)
+    {
+        found = mFinalAsset->CopyString(string, length);
+        if (found != nullptr)
+        {
+            mInternTable.Insert(found, length, hash);
+        }
+    }
+    return found;
+}
+
 void AssetBuilder::EnqueueChildAsset(const char* name, const char* newAssetPath)
 {
     PG_ASSERT(mObjStack.GetSize() != 0)
@@ -40,6 +40,7 @@ Pegasus::AssetLib::AssetLib::AssetLib(Alloc::IAllocator* allocator, Io::IOManage
   mIoMgr(mgr),
   mAllocator(allocator),
   mAssets(allocator),
+  mAssetsByPath(allocator),
   mFactories(allocator)
 #if PEGASUS_ENABLE_PROXIES
   ,mProxy(this)
@@ -89,6 +90,22 @@ static bool PathsAreEqual(const char* str1, const char* str2)
     return eq && *str1 == *str2;
 }
 
+unsigned int Pegasus::AssetLib::AssetLib::PathHashTraits::Hash(const char* path)
+{
+    //same djb2 as Utils::HashStr, on the characters PathsAreEqual compares
+    unsigned int hash = 5381;
+    for (; *path != '\0'; ++path)
+    {
+        hash = ((hash << 5) + hash) + toBrac(toLow(*path));
+    }
+    return hash;
+}
+
+bool Pegasus::AssetLib::AssetLib::PathHashTraits::Equal(const char* path1, const char* path2)
+{
+    return PathsAreEqual(path1, path2);
+}
+
 Pegasus::AssetLib::AssetLib::~AssetLib()
 {
     for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
@@ -160,25 +177,23 @@ extern void Bison_AssetScriptParse(const Io::FileBuffer* fileBuffer, AssetBuilde
 Io::IoError Pegasus::AssetLib::AssetLib::LoadAsset(const char* path, bool isStructured, Pegasus::AssetLib::Asset** assetOut)
 {
     //try to find it first
-    for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
+    Asset* const* loadedAsset = mAssetsByPath.Find(path);
+    if (loadedAsset != nullptr)
     {
-        if (PathsAreEqual(mAssets[i]->GetPath(), path))
+        if (isStructured != ((*loadedAsset)->GetFormat() == Pegasus::AssetLib::Asset::FMT_STRUCTURED))
         {
-            if (isStructured != (mAssets[i]->GetFormat() == Pegasus::AssetLib::Asset::FMT_STRUCTURED))
-            {
-                *assetOut = nullptr;
-                return Io::ERR_READING_FILE;
-            }
-            *assetOut = mAssets[i];
+            *assetOut = nullptr;
+            return Io::ERR_READING_FILE;
+        }
+        *assetOut = *loadedAsset;
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
-            //asset is referenced on this cateogry
-            if (mCurrentCategory != nullptr)
-            {
-                mCurrentCategory->RegisterAsset(*assetOut);
-            }
-#endif
-            return Io::ERR_NONE;
+        //asset is referenced on this cateogry
+        if (mCurrentCategory != nullptr)
+        {
+            mCurrentCategory->RegisterAsset(*assetOut);
         }
+#endif
+        return Io::ERR_NONE;
     }
 
     //not found? lets build it from a file..
@@ -188,6 +203,7 @@ Io::IoError Pegasus::AssetLib::AssetLib::LoadAsset(const char* path, bool isStru
     if (*assetOut != nullptr)
     {
         mAssets.PushEmpty() = *assetOut;
+        mAssetsByPath.Insert((*assetOut)->GetPath(), *assetOut);
     }
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     if (err == Io::ERR_NONE && mCurrentCategory != nullptr)
@@ -263,6 +279,7 @@ void Pegasus::AssetLib::AssetLib::UnloadAsset(Asset* asset)
                 asset->GetRuntimeData()->mAsset = nullptr;
             }
             mAssets.Delete(i);
+            mAssetsByPath.Remove(asset->GetPath());
             PG_DELETE(mAllocator, asset);
             return;
         }
@@ -305,19 +322,17 @@ Asset* Pegasus::AssetLib::AssetLib::CreateAsset(const char* path, bool isStructu
 {
     Asset* asset = nullptr;
     //try to find it first
-    for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
+    if (mAssetsByPath.Contains(path))
     {
-        if (PathsAreEqual(mAssets[i]->GetPath(), path))
-        {
-            PG_LOG('ERR_', "Attempting to create an asset that already exists on cache!");
-            return nullptr;  //Cant allow to override this asset
-        }
+        PG_LOG('ERR_', "Attempting to create an asset that already exists on cache!");
+        return nullptr;  //Cant allow to override this asset
     }
 
     // structured means its a json file. non structured means it does not get parsed and the file gets raw'd
     asset = PG_NEW(mAllocator, -1, "Asset", Alloc::PG_MEM_TEMP) Asset(mAllocator, this, isStructured ? Asset::FMT_STRUCTURED : Asset::FMT_RAW);
     asset->SetPath(path);
     mAssets.PushEmpty() = asset;
+    mAssetsByPath.Insert(asset->GetPath(), asset);
 
     if (!isStructured)
     {
@@ -337,12 +352,19 @@ Io::IoError Pegasus::AssetLib::AssetLib::SaveAsset(Asset* asset)
 {
     if (asset->GetFormat() == Asset::FMT_STRUCTURED)
     {
-        Utils::ByteStream bs(mAllocator);
-        asset->DumpToStream(bs);
-        Io::FileBuffer fb;
-        fb.OwnBuffer(mAllocator, static_cast<char*>(bs.GetBuffer()), bs.GetSize());
-        Io::IoError result = mIoMgr->SaveFileToBuffer(asset->GetPath(), fb);
-        fb.ForgetBuffer();
+        // Stream the text to the file, without building the whole text in memory
+        Io::FileWriter writer;
+        Io::IoError result = mIoMgr->OpenFileToWrite(asset->GetPath(), writer);
+        if (result == Io::ERR_NONE)
+        {
+            Utils::ByteStream bs(mAllocator);
+            bs.SetSink(&writer);
+            asset->DumpToStream(bs);
+            if (!bs.Flush())
+            {
+                result = Io::ERR_WRITING_FILE;
+            }
+        }
         return result;
     }
     else
@@ -88,19 +88,15 @@
 
     #include "Pegasus/Core/Assertion.h"
     #include "Pegasus/Core/Log.h"
-    #include "Pegasus/AssetLib/AsCompilerState.h"
     #include "Pegasus/AssetLib/AssetBuilder.h"
     #include "Pegasus/AssetLib/ASTree.h"
     #include "Pegasus/AssetLib/Asset.h"
     #include "Pegasus/Core/Io.h"
-    #ifndef YY_EXTRA_TYPE
-    #define YY_EXTRA_TYPE Pegasus::AssetLib::AsCompilerState*
-    #endif
 
-    #define AS_BUILDER AS_get_extra(scanner)->mBuilder
+    #define AS_BUILDER static_cast<Pegasus::AssetLib::AsLexer*>(scanner)->GetBuilder()
 
     #include "Pegasus/AssetLib/as.parser.hpp"
-    #include "Pegasus/AssetLib/as.lexer.hpp"
+    #include "Pegasus/AssetLib/AsLexer.h"
 
     using namespace Pegasus;
     using namespace Pegasus::Io;
@@ -108,8 +104,6 @@
 
 
     // Pegasus hooks
-    extern bool AS_HasNext(void* scanner);
-
     #define AS_ERROR(str) AS_BUILDER->IncErrorCount();PG_LOG('ERR_', "Asset Error: %s, around line %d", str, AS_BUILDER->GetCurrentLine())
     #define AS_parseerror(errorstr) AS_ERROR(errorstr)
     #define AS_error(scanner, errorstr)  AS_ERROR(errorstr)
@@ -119,7 +113,7 @@
     //***************************************************//
 
 /* Line 371 of yacc.c  */
-#line 123 "as.parser.cpp"
+#line 117 "as.parser.cpp"
 
 # ifndef YY_NULL
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -173,7 +167,7 @@ extern int AS_debug;
 typedef union YYSTYPE
 {
 /* Line 387 of yacc.c  */
-#line 64 "as.y"
+#line 58 "as.y"
 
     int token;
     int integerValue;
@@ -186,7 +180,7 @@ typedef union YYSTYPE
 
 
 /* Line 387 of yacc.c  */
-#line 190 "as.parser.cpp"
+#line 184 "as.parser.cpp"
 } YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define yystype YYSTYPE /* obsolescent; will be withdrawn */
@@ -213,7 +207,7 @@ int AS_parse ();
 /* Copy the second part of user declarations.  */
 
 /* Line 390 of yacc.c  */
-#line 217 "as.parser.cpp"
+#line 211 "as.parser.cpp"
 
 #ifdef short
 # undef short
@@ -1428,7 +1422,7 @@ yyreduce:
     {
         case 2:
 /* Line 1792 of yacc.c  */
-#line 100 "as.y"
+#line 94 "as.y"
     {
                 (yyval.root) = AS_BUILDER->GetBuiltAsset();
                 if ((yyval.root) == nullptr)
@@ -1445,7 +1439,7 @@ yyreduce:
 
   case 3:
 /* Line 1792 of yacc.c  */
-#line 115 "as.y"
+#line 109 "as.y"
     {
                 if ((yyvsp[(1) - (3)].objVal) == nullptr)
                 {
@@ -1462,31 +1456,31 @@ yyreduce:
 
   case 4:
 /* Line 1792 of yacc.c  */
-#line 129 "as.y"
+#line 123 "as.y"
     { (yyval.objVal) = AS_BUILDER->BeginObject(); }
     break;
 
   case 5:
 /* Line 1792 of yacc.c  */
-#line 132 "as.y"
+#line 126 "as.y"
     { (yyval.objVal) = (yyvsp[(1) - (3)].objVal); }
     break;
 
   case 6:
 /* Line 1792 of yacc.c  */
-#line 133 "as.y"
+#line 127 "as.y"
     { (yyval.objVal) = (yyvsp[(1) - (1)].objVal); }
     break;
 
   case 7:
 /* Line 1792 of yacc.c  */
-#line 134 "as.y"
+#line 128 "as.y"
     { (yyval.objVal) = nullptr; }
     break;
 
   case 8:
 /* Line 1792 of yacc.c  */
-#line 138 "as.y"
+#line 132 "as.y"
     { 
                 if ((yyvsp[(1) - (3)].arrayVal) == nullptr)
                 {
@@ -1503,13 +1497,13 @@ yyreduce:
 
   case 9:
 /* Line 1792 of yacc.c  */
-#line 152 "as.y"
+#line 146 "as.y"
     { (yyval.arrayVal) = AS_BUILDER->BeginArray(); }
     break;
 
   case 10:
 /* Line 1792 of yacc.c  */
-#line 156 "as.y"
+#line 150 "as.y"
     {
                  if ((yyval.arrayVal)->GetType() != (yyvsp[(3) - (3)].variant).mType)
                  {
@@ -1529,7 +1523,7 @@ yyreduce:
 
   case 11:
 /* Line 1792 of yacc.c  */
-#line 172 "as.y"
+#line 166 "as.y"
     {
                 (yyval.arrayVal) = AS_BUILDER->GetArray();
                 if ((yyval.arrayVal)->GetType() == Array::AS_TYPE_NULL)
@@ -1554,13 +1548,13 @@ yyreduce:
 
   case 12:
 /* Line 1792 of yacc.c  */
-#line 192 "as.y"
+#line 186 "as.y"
     { (yyval.arrayVal) = nullptr; }
     break;
 
   case 13:
 /* Line 1792 of yacc.c  */
-#line 197 "as.y"
+#line 191 "as.y"
     { 
                 (yyval.objVal) = AS_BUILDER->GetObject(); 
                 if ((yyval.objVal) == nullptr)
@@ -1597,7 +1591,7 @@ yyreduce:
 
   case 14:
 /* Line 1792 of yacc.c  */
-#line 232 "as.y"
+#line 226 "as.y"
     { 
                 (yyval.variant).mType = Array::AS_TYPE_FLOAT;
                 (yyval.variant).v.f = (yyvsp[(1) - (1)].floatValue);
@@ -1606,7 +1600,7 @@ yyreduce:
 
   case 15:
 /* Line 1792 of yacc.c  */
-#line 237 "as.y"
+#line 231 "as.y"
     {   
                 (yyval.variant).mType = Array::AS_TYPE_INT;
                 (yyval.variant).v.i = (yyvsp[(1) - (1)].integerValue);
@@ -1615,7 +1609,7 @@ yyreduce:
 
   case 16:
 /* Line 1792 of yacc.c  */
-#line 242 "as.y"
+#line 236 "as.y"
     {
                 (yyval.variant).mType = Array::AS_TYPE_STRING;
                 (yyval.variant).v.s = (yyvsp[(1) - (1)].identifierText);
@@ -1624,7 +1618,7 @@ yyreduce:
 
   case 17:
 /* Line 1792 of yacc.c  */
-#line 247 "as.y"
+#line 241 "as.y"
     {
                 (yyval.variant).mType = Array::AS_TYPE_ASSET_PATH_REF;
                 (yyval.variant).v.s = (yyvsp[(1) - (1)].identifierText);
@@ -1633,7 +1627,7 @@ yyreduce:
 
   case 18:
 /* Line 1792 of yacc.c  */
-#line 252 "as.y"
+#line 246 "as.y"
     {
                 (yyval.variant).mType = Array::AS_TYPE_OBJECT;
                 (yyval.variant).v.o = (yyvsp[(1) - (1)].objVal);
@@ -1642,7 +1636,7 @@ yyreduce:
 
   case 19:
 /* Line 1792 of yacc.c  */
-#line 257 "as.y"
+#line 251 "as.y"
     {
                 (yyval.variant).mType = Array::AS_TYPE_ARRAY;
                 (yyval.variant).v.a = (yyvsp[(1) - (1)].arrayVal);
@@ -1651,7 +1645,7 @@ yyreduce:
 
 
 /* Line 1792 of yacc.c  */
-#line 1655 "as.parser.cpp"
+#line 1649 "as.parser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -1883,26 +1877,19 @@ yyreturn:
 
 
 /* Line 2055 of yacc.c  */
-#line 263 "as.y"
+#line 257 "as.y"
 
 
 
 void Bison_AssetScriptParse(const Io::FileBuffer* fileBuffer, AssetBuilder* builder) 
 {          
-    AsCompilerState compilerState;
-    compilerState.mFileBuffer = fileBuffer;
-    compilerState.mBuilder = builder;
-
-    yyscan_t scanner;
-    AS_lex_init_extra(&compilerState, &scanner);
+    //the lexer reads straight from the file buffer memory
+    AsLexer lexer(builder);
+    lexer.Begin(fileBuffer->GetBuffer(), fileBuffer->GetFileSize());
 
     do 
     {
-	    AS_parse(scanner);
-    } while (AS_HasNext(scanner) /*&& BS_GlobalBuilder->GetErrorCount() == 0*/);
-
-    //builder->SetScanner(nullptr);
-    AS_restart(nullptr, scanner);
-    AS_lex_destroy(scanner);
+	    AS_parse(&lexer);
+    } while (lexer.HasNext() /*&& BS_GlobalBuilder->GetErrorCount() == 0*/);
 
 }
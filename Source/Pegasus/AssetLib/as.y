@@ -30,19 +30,15 @@
 
     #include "Pegasus/Core/Assertion.h"
     #include "Pegasus/Core/Log.h"
-    #include "Pegasus/AssetLib/AsCompilerState.h"
     #include "Pegasus/AssetLib/AssetBuilder.h"
     #include "Pegasus/AssetLib/ASTree.h"
     #include "Pegasus/AssetLib/Asset.h"
     #include "Pegasus/Core/Io.h"
-    #ifndef YY_EXTRA_TYPE
-    #define YY_EXTRA_TYPE Pegasus::AssetLib::AsCompilerState*
-    #endif
 
-    #define AS_BUILDER AS_get_extra(scanner)->mBuilder
+    #define AS_BUILDER static_cast<Pegasus::AssetLib::AsLexer*>(scanner)->GetBuilder()
 
     #include "Pegasus/AssetLib/as.parser.hpp"
-    #include "Pegasus/AssetLib/as.lexer.hpp"
+    #include "Pegasus/AssetLib/AsLexer.h"
 
     using namespace Pegasus;
     using namespace Pegasus::Io;
@@ -50,8 +46,6 @@
 
 
     // Pegasus hooks
-    extern bool AS_HasNext(void* scanner);
-
     #define AS_ERROR(str) AS_BUILDER->IncErrorCount();PG_LOG('ERR_', "Asset Error: %s, around line %d", str, AS_BUILDER->GetCurrentLine())
     #define AS_parseerror(errorstr) AS_ERROR(errorstr)
     #define AS_error(scanner, errorstr)  AS_ERROR(errorstr)
@@ -265,20 +259,13 @@ element  : I_FLOAT
 
 void Bison_AssetScriptParse(const Io::FileBuffer* fileBuffer, AssetBuilder* builder) 
 {          
-    AsCompilerState compilerState;
-    compilerState.mFileBuffer = fileBuffer;
-    compilerState.mBuilder = builder;
-
-    yyscan_t scanner;
-    AS_lex_init_extra(&compilerState, &scanner);
+    //the lexer reads straight from the file buffer memory
+    AsLexer lexer(builder);
+    lexer.Begin(fileBuffer->GetBuffer(), fileBuffer->GetFileSize());
 
     do 
     {
-	    AS_parse(scanner);
-    } while (AS_HasNext(scanner) /*&& BS_GlobalBuilder->GetErrorCount() == 0*/);
-
-    //builder->SetScanner(nullptr);
-    AS_restart(nullptr, scanner);
-    AS_lex_destroy(scanner);
+	    AS_parse(&lexer);
+    } while (lexer.HasNext() /*&& BS_GlobalBuilder->GetErrorCount() == 0*/);
 
 }
@@ -15,12 +15,85 @@
 #include "Pegasus/Core/Io.h"
 #include "Pegasus/BlockScript/SymbolTable.h"
 #include "Pegasus/BlockScript/BlockLib.h"
+#include "Pegasus/BlockScript/StackFrameInfo.h"
+#include "Pegasus/BlockScript/PrettyPrint.h"
 #include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
 
 #include <stdio.h>
 
 using namespace Pegasus;
 
+//reusing the vm frame code to rebuild the global frame on a hot swap
+extern void PushFrameCommand(const BlockScript::StackFrameInfo* info, BlockScript::BsVmState& state, const BlockScript::Container<BlockScript::GlobalMapEntry>* globalsInitData);
+
+//running hash of the global scope hasher. Scripts are only compiled and hot swapped on one thread.
+static unsigned int sGlobalScopeHash = 0;
+
+static int HashGlobalScopeStr(const char* str)
+{
+    sGlobalScopeHash = (sGlobalScopeHash * 33) ^ Utils::HashStr(str);
+    return 0;
+}
+
+static int HashGlobalScopeInt(int i)
+{
+    sGlobalScopeHash = (sGlobalScopeHash * 33) ^ static_cast<unsigned int>(i);
+    return 0;
+}
+
+static int HashGlobalScopeFloat(float f)
+{
+    return HashGlobalScopeInt(reinterpret_cast<int&>(f));
+}
+
+//! Pretty printer that feeds a hash instead of printing text.
+//! Function declarations are skipped, so only code running in the global scope changes the hash.
+class GlobalScopeHasher : public BlockScript::PrettyPrint
+{
+public:
+    GlobalScopeHasher() : BlockScript::PrettyPrint(HashGlobalScopeStr, HashGlobalScopeInt, HashGlobalScopeFloat) {}
+    virtual ~GlobalScopeHasher() {}
+
+private:
+    virtual void Visit(BlockScript::Ast::StmtFunDec* n)
+    {
+        //function bodies can be swapped freely
+    }
+
+    virtual void Visit(BlockScript::Ast::Imm* n)
+    {
+        //the pretty printer only prints the first component of an immediate
+        int count = n->GetTypeDesc()->GetByteSize() / sizeof(int);
+        count = count > BlockScript::Ast::gMaxAluDimensions ? BlockScript::Ast::gMaxAluDimensions : count;
+        for (int i = 0; i < count; ++i)
+        {
+            HashGlobalScopeInt(n->GetVariant().i[i]);
+        }
+    }
+};
+
+BlockScript::GlobalStateSnapshot::GlobalStateSnapshot(Alloc::IAllocator* allocator)
+: mAllocator(allocator), mEntries(allocator), mMemory(nullptr), mMemorySize(0), mMemoryCapacity(0), mGlobalScopeHash(0), mIsValid(false)
+{
+}
+
+BlockScript::GlobalStateSnapshot::~GlobalStateSnapshot()
+{
+    if (mMemory != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mMemory);
+    }
+}
+
+void BlockScript::GlobalStateSnapshot::Clear()
+{
+    mEntries.Clear();
+    mMemorySize = 0;
+    mGlobalScopeHash = 0;
+    mIsValid = false;
+}
+
 BlockScript::BlockScript::BlockScript(Alloc::IAllocator* allocator, BlockLib* runtimeLib)
 : BlockScript::BlockScriptCompiler(allocator), mRuntimeLib(runtimeLib), mLibs(allocator)
 {
@@ -59,6 +132,119 @@ void BlockScript::BlockScript::Run(BsVmState* vmState)
     mVm.Run(GetAsm(), *vmState);
 }
 
+unsigned int BlockScript::BlockScript::ComputeGlobalScopeHash()
+{
+    sGlobalScopeHash = 5381;
+    Ast::Program* program = GetAst();
+    if (program != nullptr && program->GetStmtList() != nullptr)
+    {
+        GlobalScopeHasher hasher;
+        hasher.Print(program);
+    }
+    return sGlobalScopeHash;
+}
+
+bool BlockScript::BlockScript::CaptureGlobals(BsVmState* vmState, GlobalStateSnapshot& snapshot)
+{
+    snapshot.Clear();
+
+    //globals only live while the global frame is the only frame in the stack
+    if (GetAst() == nullptr || vmState->GetExecutionState() != BsVmState::Alive || vmState->GetStackLevels() != 0)
+    {
+        return false;
+    }
+
+    const StackFrameInfo* globalFrame = mBuilder.GetSymbolTable()->GetRootGlobalFrame();
+    for (int i = 0; i < globalFrame->GetEntryCount(); ++i)
+    {
+        const StackFrameInfo::Entry& entry = globalFrame->GetEntry(i);
+        GlobalStateSnapshot::Entry& snapEntry = snapshot.mEntries.PushEmpty();
+        snapEntry.mName[0] = '\0';
+        snapEntry.mTypeName[0] = '\0';
+        Utils::Strcat(snapEntry.mName, entry.mName);
+        Utils::Strcat(snapEntry.mTypeName, entry.mType->GetName());
+        snapEntry.mOffset = entry.mOffset;
+        snapEntry.mByteSize = entry.mType->GetByteSize();
+    }
+
+    //only the variables are kept, the temporal space of the frame is not needed
+    int size = globalFrame->GetSize();
+    if (size > snapshot.mMemoryCapacity)
+    {
+        if (snapshot.mMemory != nullptr)
+        {
+            PG_DELETE_ARRAY(snapshot.mAllocator, snapshot.mMemory);
+        }
+        snapshot.mMemory = PG_NEW_ARRAY(snapshot.mAllocator, -1, "BS Global Snapshot", Alloc::PG_MEM_TEMP, char, size);
+        snapshot.mMemoryCapacity = size;
+    }
+    Utils::Memcpy(snapshot.mMemory, vmState->Ram() + vmState->GetReg(Canon::R_G), size);
+    snapshot.mMemorySize = size;
+    snapshot.mGlobalScopeHash = ComputeGlobalScopeHash();
+    snapshot.mIsValid = true;
+
+    //heap strings point to this script's literals, which are released on recompilation
+    vmState->DetachHeapStrings();
+    return true;
+}
+
+BlockScript::BlockScript::HotSwapResult BlockScript::BlockScript::HotSwap(BsVmState* vmState, const GlobalStateSnapshot& snapshot)
+{
+    if (!snapshot.IsValid() || GetAst() == nullptr || vmState->GetExecutionState() != BsVmState::Alive)
+    {
+        return HOTSWAP_FAILED;
+    }
+
+    //if the global scope changed, the globals must be recomputed by running the script again
+    if (snapshot.mGlobalScopeHash != ComputeGlobalScopeHash())
+    {
+        return HOTSWAP_FAILED;
+    }
+
+    const StackFrameInfo* globalFrame = mBuilder.GetSymbolTable()->GetRootGlobalFrame();
+    bool sameLayout = globalFrame->GetSize() == snapshot.mMemorySize && globalFrame->GetEntryCount() == static_cast<int>(snapshot.mEntries.GetSize());
+    for (int i = 0; sameLayout && i < globalFrame->GetEntryCount(); ++i)
+    {
+        const StackFrameInfo::Entry& entry = globalFrame->GetEntry(i);
+        const GlobalStateSnapshot::Entry& snapEntry = snapshot.mEntries[i];
+        sameLayout = entry.mOffset == snapEntry.mOffset &&
+                     entry.mType->GetByteSize() == snapEntry.mByteSize &&
+                     !Utils::Strcmp(entry.mName, snapEntry.mName) &&
+                     !Utils::Strcmp(entry.mType->GetName(), snapEntry.mTypeName);
+    }
+
+    //rebuild the global frame with the new compilation. The heap is kept, so string handles stored in globals stay valid.
+    //Externs get their defaults and the runtime listener is notified, just like when running the global scope.
+    vmState->ResetStack();
+    PushFrameCommand(globalFrame, *vmState, GetAsm().mGlobalsMap);
+    char* globals = vmState->Ram() + vmState->GetReg(Canon::R_G);
+
+    if (sameLayout)
+    {
+        Utils::Memcpy(globals, snapshot.mMemory, snapshot.mMemorySize);
+        return HOTSWAP_PRESERVED;
+    }
+
+    //migrate by name, globals that changed type keep the value set by the new frame
+    for (int i = 0; i < globalFrame->GetEntryCount(); ++i)
+    {
+        const StackFrameInfo::Entry& entry = globalFrame->GetEntry(i);
+        for (unsigned int s = 0; s < snapshot.mEntries.GetSize(); ++s)
+        {
+            const GlobalStateSnapshot::Entry& snapEntry = snapshot.mEntries[s];
+            if (!Utils::Strcmp(entry.mName, snapEntry.mName))
+            {
+                if (entry.mType->GetByteSize() == snapEntry.mByteSize && !Utils::Strcmp(entry.mType->GetName(), snapEntry.mTypeName))
+                {
+                    Utils::Memcpy(globals + entry.mOffset, snapshot.mMemory + snapEntry.mOffset, snapEntry.mByteSize);
+                }
+                break;
+            }
+        }
+    }
+    return HOTSWAP_MIGRATED;
+}
+
 bool BlockScript::BlockScript::ExecuteFunction(
     BsVmState* vmState,
     FunBindPoint functionBindPoint,
@@ -571,10 +571,11 @@ Exp* BlockScriptBuilder::BuildBinop (Ast::Exp* lhs, int op, Ast::Exp* rhs)
                 if (!Pegasus::Utils::Strcmp(argList->GetArgDec()->GetVar(), accessOffset->GetName()))
                 {
                     tid2 = argList->GetArgDec()->GetType();
+                    //member offsets are computed when the struct is defined, following its layout
+                    offset = argList->GetArgDec()->GetOffset();
                     PG_ASSERT(tid2 != nullptr);
                     break;
                 }
-                offset += argList->GetArgDec()->GetType()->GetByteSize();
                 argList = argList->GetTail();
             }
 
@@ -839,13 +840,8 @@ void BlockScriptBuilder::RegisterExternGlobal(Ast::Idd* var, Ast::Imm* defaultVa
 Exp*  BlockScriptBuilder::BuildStrImm(const char* strToCopy)
 {
 
+    //strings bigger than a page get their own allocation
     int len = Utils::Strlen(strToCopy);
-    if (len >= mAllocator.GetPageSize())
-    {
-        BS_ErrorDispatcher(this, "String immediate value too big.");
-        return nullptr;
-    } 
-
     char* destStr = static_cast<char*>(mAllocator.Alloc(len + 1, Pegasus::Alloc::PG_MEM_PERM));
     
     if (destStr == nullptr)
@@ -1159,6 +1155,12 @@ StmtFunDec* BlockScriptBuilder::BuildStmtFunDec(Ast::ArgList* argList, const Typ
     // record the frame for this function
     funDec->SetFrame(mCurrentFrame);
 
+    // intrinsics are declared outside of a compilation, they have no location
+    if (mFileStates.Size() > 0)
+    {
+        funDec->SetLocation(GetCurrentCompilationUnitTitle(), GetCurrentLine());
+    }
+
     mCurrentFrame->SetCreatorCategory(StackFrameInfo::FUN_BODY);
 
     
@@ -1349,13 +1351,139 @@ static void StructGenericConstructor(FunCallbackContext& ctx)
     }
 }
 
+//! Member wise constructor of std140 structs. Arguments come packed, so every member gets copied to its aligned offset.
+static void Std140StructConstructor(FunCallbackContext& ctx)
+{
+    const char* argin = static_cast<const char*>(ctx.GetRawInputBuffer());
+    char* argout = static_cast<char*>(ctx.GetRawOutputBuffer());
+    Pegasus::Utils::Memset8(argout, 0, ctx.GetOutputBufferSize());
+
+    const StmtStructDef* structDef = ctx.GetFunDesc()->GetDec()->GetReturnType()->GetStructDef();
+    PG_ASSERT(structDef != nullptr && structDef->GetLayout() == StmtStructDef::LAYOUT_STD140);
+
+    int inputOffset = 0;
+    ArgList* argList = structDef->GetArgList();
+    while (argList != nullptr && argList->GetArgDec() != nullptr)
+    {
+        const ArgDec* argDec = argList->GetArgDec();
+        int byteSize = argDec->GetType()->GetByteSize();
+        Pegasus::Utils::Memcpy(argout + argDec->GetOffset(), argin + inputOffset, byteSize);
+        inputOffset += byteSize;
+        argList = argList->GetTail();
+    }
+    PG_ASSERT(inputOffset == ctx.GetInputBufferSize());
+}
+
+//! Gets the alignment and size of a type inside of a std140 struct
+//! \return false if the type cannot be a member of a std140 struct
+static bool GetStd140Layout(const TypeDesc* type, int& outAlignment, int& outSize)
+{
+    outSize = type->GetByteSize();
+    switch (type->GetModifier())
+    {
+    case TypeDesc::M_SCALAR:
+    case TypeDesc::M_ENUM:
+        outAlignment = outSize;
+        return true;
+    case TypeDesc::M_VECTOR:
+        if (type->GetChild()->GetModifier() == TypeDesc::M_SCALAR)
+        {
+            //float2 aligns to 8 bytes, float3 and float4 to 16 bytes
+            outAlignment = type->GetModifierProperty().VectorSize == 2 ? 2 * type->GetChild()->GetByteSize() : 4 * type->GetChild()->GetByteSize();
+            return true;
+        }
+        //matrix columns are padded to 16 bytes, only float4x4 has no padding.
+        outAlignment = 16;
+        return type->GetModifierProperty().VectorSize == 4 && type->GetChild()->GetModifierProperty().VectorSize == 4;
+    case TypeDesc::M_ARRAY:
+        {
+            //array elements are padded to 16 bytes, the vm only allows elements that need no padding.
+            int childAlignment = 0;
+            int childSize = 0;
+            outAlignment = 16;
+            return GetStd140Layout(type->GetChild(), childAlignment, childSize) && (childSize & 15) == 0;
+        }
+    case TypeDesc::M_STRUCT:
+        outAlignment = 16;
+        return type->GetStructDef()->GetLayout() == StmtStructDef::LAYOUT_STD140;
+    default:
+        //object references and pointers mean nothing in gpu memory
+        return false;
+    }
+}
+
+bool BlockScriptBuilder::ParseStructLayout(StmtStructDef* structDef, Annotations* annotations)
+{
+    structDef->SetAnnotations(annotations);
+    structDef->SetLayout(StmtStructDef::LAYOUT_PACKED);
+    if (annotations == nullptr)
+    {
+        return true;
+    }
+
+    ExpList* currEl = annotations->GetExpList();
+    while (currEl != nullptr && currEl->GetExp() != nullptr)
+    {
+        //EndAnnotations guarantees that every annotation is an Idd = Imm or an Idd = StrImm
+        Binop* annotation = static_cast<Binop*>(currEl->GetExp());
+        if (Utils::Strcmp(static_cast<Idd*>(annotation->GetLhs())->GetName(), "layout"))
+        {
+            BS_ErrorDispatcher(this, "Unknown struct annotation. Structs only accept the layout annotation.");
+            return false;
+        }
+
+        const char* layout = annotation->GetRhs()->GetExpType() == StrImm::sType ? static_cast<StrImm*>(annotation->GetRhs())->GetStr() : "";
+        if (!Utils::Strcmp(layout, "std140"))
+        {
+            structDef->SetLayout(StmtStructDef::LAYOUT_STD140);
+        }
+        else if (!Utils::Strcmp(layout, "packed"))
+        {
+            structDef->SetLayout(StmtStructDef::LAYOUT_PACKED);
+        }
+        else
+        {
+            BS_ErrorDispatcher(this, "Unknown struct layout. Valid layouts are \"packed\" and \"std140\".");
+            return false;
+        }
+        currEl = currEl->GetTail();
+    }
+    return true;
+}
+
+bool BlockScriptBuilder::ComputeStructOffsets(StmtStructDef* structDef)
+{
+    bool isStd140 = structDef->GetLayout() == StmtStructDef::LAYOUT_STD140;
+    int offset = 0;
+    ArgList* argList = structDef->GetArgList();
+    while (argList != nullptr && argList->GetArgDec() != nullptr)
+    {
+        ArgDec* argDec = argList->GetArgDec();
+        if (isStd140)
+        {
+            int alignment = 0;
+            int size = 0;
+            if (!GetStd140Layout(argDec->GetType(), alignment, size))
+            {
+                BS_ErrorDispatcher(this, "Member type not allowed in a std140 struct. Use int, float, float2, float3, float4, float4x4, std140 structs or arrays of 16 byte elements.");
+                return false;
+            }
+            offset = (offset + alignment - 1) & ~(alignment - 1);
+        }
+        argDec->SetOffset(offset);
+        offset += argDec->GetType()->GetByteSize();
+        argList = argList->GetTail();
+    }
+    return true;
+}
+
 StmtEnumTypeDef* BlockScriptBuilder::BuildStmtEnumTypeDef(const TypeDesc* typeDesc)
 {
     PG_ASSERT(typeDesc != nullptr);
     return BS_NEW StmtEnumTypeDef(typeDesc);
 }
 
-StmtStructDef* BlockScriptBuilder::BuildStmtStructDef(const char* name, ArgList* definitions)
+StmtStructDef* BlockScriptBuilder::BuildStmtStructDef(const char* name, ArgList* definitions, Annotations* annotations)
 {
     PG_ASSERT(definitions != nullptr);
 
@@ -1386,6 +1514,12 @@ StmtStructDef* BlockScriptBuilder::BuildStmtStructDef(const char* name, ArgList*
     // unlink this to any parent, preventing searches on parent frames. this is now an orphan stack frame
     frameInfo->UnlinkParentStackFrame();
 
+    //member offsets must be known before the type computes its size
+    if (!ParseStructLayout(newDef, annotations) || !ComputeStructOffsets(newDef))
+    {
+        return nullptr;
+    }
+
     TypeDesc* newStructType = mSymbolTable.CreateStructType(
         name,
         newDef //register this types structural definition AST member
@@ -1429,7 +1563,7 @@ StmtStructDef* BlockScriptBuilder::BuildStmtStructDef(const char* name, ArgList*
         sMassiveCharNameContainer, //no argins names
         count, //no argcounts
         name,
-        StructGenericConstructor
+        newDef->GetLayout() == StmtStructDef::LAYOUT_STD140 ? Std140StructConstructor : StructGenericConstructor
     );
 
     //copy all the declaration info
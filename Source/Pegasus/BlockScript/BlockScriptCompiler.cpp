@@ -17,6 +17,8 @@
 #include "Pegasus/Utils/Memcpy.h"
 #include "Pegasus/Core/Io.h"
 
+#include <stdio.h>
+
 using namespace Pegasus;
 using namespace Pegasus::BlockScript;
 
@@ -25,9 +27,10 @@ using namespace Pegasus::BlockScript;
 extern void Bison_BlockScriptParse(const Io::FileBuffer* fileBuffer, BlockScript::BlockScriptBuilder* builder, BlockScript::IFileIncluder* fileIncluder, BlockScript::Container<BlockScript::Preprocessor::Definition>* definitionList);
 
 BlockScriptCompiler::BlockScriptCompiler(Alloc::IAllocator* allocator)
-: mAllocator(allocator), mAst(nullptr), mFileIncluder(nullptr), mTitle("<No-Title>")
+: mAllocator(allocator), mAst(nullptr), mFileIncluder(nullptr), mCostBudget(0), mTitle("<No-Title>")
 {
     mDefinitionList.Initialize(allocator);
+    mCostEstimator.Initialize(allocator);
     mBuilder.Initialize(mAllocator);
     mStrAllocator.Initialize(BLOCKSCRIPT_MAX_DEFINE_STR_LEN, mAllocator);
 }
@@ -44,7 +47,42 @@ bool BlockScriptCompiler::Compile(const Io::FileBuffer* fb)
 	mBuilder.EndBuild(cr);
     mAst = cr.mAst;
     mAsm = cr.mAsm;
-    return mAst != nullptr && mBuilder.GetErrorCount() == 0;
+    bool success = mAst != nullptr && mBuilder.GetErrorCount() == 0;
+    if (success && mCostBudget > 0)
+    {
+        EstimateCosts();
+    }
+    return success;
+}
+
+void BlockScriptCompiler::EstimateCosts()
+{
+    mCostEstimator.Estimate(mAst);
+
+    Container<IBlockScriptCompilerListener*>& listeners = mBuilder.GetEventListeners();
+    for (int f = 0; f < mCostEstimator.GetFunctionCount(); ++f)
+    {
+        const FunCost& cost = mCostEstimator.GetCost(f);
+        if (mCostBudget > 0 && CostEstimator::ExceedsBudget(cost, mCostBudget))
+        {
+            const Ast::StmtFunDec* funDec = mCostEstimator.GetFunction(f);
+            char message[256];
+            if (cost.mIsUnbounded)
+            {
+                sprintf_s(message, sizeof(message), "function %s has no static cost bound (recursion or nested unknown loops), frame budget is %d", funDec->GetName(), mCostBudget);
+            }
+            else
+            {
+                sprintf_s(message, sizeof(message), "function %s estimated cost %d + %d per loop iteration exceeds frame budget %d", funDec->GetName(), cost.mFixedCost, cost.mPerIterationCost, mCostBudget);
+            }
+
+            const char* title = funDec->GetCompilationUnitTitle() != nullptr ? funDec->GetCompilationUnitTitle() : mTitle;
+            for (int l = 0; l < listeners.Size(); ++l)
+            {
+                listeners[l]->OnCompilationWarning(title, funDec->GetLine(), message);
+            }
+        }
+    }
 }
 
 void BlockScriptCompiler::RegisterDefinitions(const char* definitionNames[], const char* definitionValues[], int definitionCounts)
@@ -74,6 +112,7 @@ void BlockScriptCompiler::Reset()
     mBuilder.Reset();
     mDefinitionList.Reset();
     mStrAllocator.Reset();
+    mCostEstimator.Reset();
     mAst = nullptr;
 }
 
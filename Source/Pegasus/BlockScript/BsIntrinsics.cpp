@@ -25,6 +25,10 @@
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Allocator/Alloc.h"
 
+#if PEGASUS_ARCH_IA32
+#include <xmmintrin.h>
+#endif
+
 using namespace Pegasus;
 using namespace Pegasus::BlockScript;
 using namespace Pegasus::BlockScript::Ast;
@@ -369,6 +373,305 @@ namespace Private_Math
 
 // Intrinsic functions for math
 
+//Intrinsic functions for static arrays, passed by typed stars (i.e. float4*).
+//These run as native loops over the vm ram, instead of element by element blockscript loops.
+namespace Private_Array
+{
+    //! static array bound to a typed star argument
+    template<class S>
+    struct ArrayArg
+    {
+        S*  mData;  //!< first scalar of the array, in vm ram
+        int mCount; //!< number of elements in the array
+    };
+
+    //! Reads the next typed star argument. The callback receives the ram offset of the array,
+    //! the element count is recorded in the type of the argument expression by the canonizer.
+    //! \param context the callback context
+    //! \param stream the parameter stream to read from
+    //! \param argExps the argument expression matching the argument to read, moved to the next one
+    //! \return the array argument
+    template<class S>
+    ArrayArg<S> NextArrayArgument(FunCallbackContext& context, FunParamStream& stream, const ExpList*& argExps)
+    {
+        PG_ASSERT(argExps != nullptr && argExps->GetExp() != nullptr);
+        const TypeDesc* argType = argExps->GetExp()->GetTypeDesc();
+        PG_ASSERTSTR(argType->GetModifier() == TypeDesc::M_STAR && argType->GetChild() != nullptr, "Array intrinsics only accept typed star arguments.");
+        argExps = argExps->GetTail();
+
+        int& ramOffset = stream.NextArgument<int>();
+        ArrayArg<S> arr;
+        arr.mData = reinterpret_cast<S*>(context.GetVmState()->Ram() + ramOffset);
+        arr.mCount = argType->GetModifierProperty().ArraySize;
+        return arr;
+    }
+
+    //! element wise operations, with an sse version for floats
+    struct OpAdd
+    {
+        template<class S> static S Apply(S a, S b) { return a + b; }
+#if PEGASUS_ARCH_IA32
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+#endif
+    };
+
+    struct OpMul
+    {
+        template<class S> static S Apply(S a, S b) { return a * b; }
+#if PEGASUS_ARCH_IA32
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+#endif
+    };
+
+    struct OpMin
+    {
+        template<class S> static S Apply(S a, S b) { return a < b ? a : b; }
+#if PEGASUS_ARCH_IA32
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+#endif
+    };
+
+    struct OpMax
+    {
+        template<class S> static S Apply(S a, S b) { return a > b ? a : b; }
+#if PEGASUS_ARCH_IA32
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+#endif
+    };
+
+    //! dst[i] = op(dst[i], src[i]) over a flat range of scalars
+    template<class Op, class S>
+    void Combine(S* dst, const S* src, int scalarCount)
+    {
+        for (int i = 0; i < scalarCount; ++i)
+        {
+            dst[i] = Op::Apply(dst[i], src[i]);
+        }
+    }
+
+#if PEGASUS_ARCH_IA32
+    template<class Op>
+    void Combine(float* dst, const float* src, int scalarCount)
+    {
+        //vm ram has no alignment guarantees, use unaligned loads
+        int i = 0;
+        for (; i + 4 <= scalarCount; i += 4)
+        {
+            _mm_storeu_ps(dst + i, Op::Apply(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+        }
+        for (; i < scalarCount; ++i)
+        {
+            dst[i] = Op::Apply(dst[i], src[i]);
+        }
+    }
+#endif
+
+    //! reduces the elements of an array, component wise
+    template<class Op, class S, int N>
+    void Reduce(S* result, const S* data, int count)
+    {
+        for (int c = 0; c < N; ++c)
+        {
+            result[c] = data[c];
+        }
+
+        for (int i = 1; i < count; ++i)
+        {
+            for (int c = 0; c < N; ++c)
+            {
+                result[c] = Op::Apply(result[c], data[i * N + c]);
+            }
+        }
+    }
+
+#if PEGASUS_ARCH_IA32
+    template<class Op>
+    void ReduceFloat4(float* result, const float* data, int count)
+    {
+        __m128 acc = _mm_loadu_ps(data);
+        for (int i = 1; i < count; ++i)
+        {
+            acc = Op::Apply(acc, _mm_loadu_ps(data + i * 4));
+        }
+        _mm_storeu_ps(result, acc);
+    }
+
+    template<class Op>
+    void ReduceFloat(float* result, const float* data, int count)
+    {
+        if (count < 8)
+        {
+            Reduce<Op, float, 1>(result, data, count);
+            return;
+        }
+
+        //reduce 4 lanes, then fold the lanes and the tail
+        float lanes[4];
+        int i = count & ~3;
+        ReduceFloat4<Op>(lanes, data, i / 4);
+        float r = Op::Apply(Op::Apply(lanes[0], lanes[1]), Op::Apply(lanes[2], lanes[3]));
+        for (; i < count; ++i)
+        {
+            r = Op::Apply(r, data[i]);
+        }
+        *result = r;
+    }
+#endif
+
+    template<class Op, class S, int N>
+    void ReduceDispatch(S* result, const S* data, int count)
+    {
+        Reduce<Op, S, N>(result, data, count);
+    }
+
+#if PEGASUS_ARCH_IA32
+    template<> void ReduceDispatch<OpAdd, float, 4>(float* result, const float* data, int count) { ReduceFloat4<OpAdd>(result, data, count); }
+    template<> void ReduceDispatch<OpMin, float, 4>(float* result, const float* data, int count) { ReduceFloat4<OpMin>(result, data, count); }
+    template<> void ReduceDispatch<OpMax, float, 4>(float* result, const float* data, int count) { ReduceFloat4<OpMax>(result, data, count); }
+    template<> void ReduceDispatch<OpAdd, float, 1>(float* result, const float* data, int count) { ReduceFloat<OpAdd>(result, data, count); }
+    template<> void ReduceDispatch<OpMin, float, 1>(float* result, const float* data, int count) { ReduceFloat<OpMin>(result, data, count); }
+    template<> void ReduceDispatch<OpMax, float, 1>(float* result, const float* data, int count) { ReduceFloat<OpMax>(result, data, count); }
+#endif
+
+    //! ArrayFill(arr : T*, value : T)
+    template<class S, int N>
+    void Fill(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        const ExpList* argExps = context.GetArgExps();
+        ArrayArg<S> arr = NextArrayArgument<S>(context, stream, argExps);
+        const S* value = &stream.NextArgument<S>();
+        S v[N];
+        for (int c = 0; c < N; ++c)
+        {
+            v[c] = value[c];
+        }
+
+        S* data = arr.mData;
+        for (int i = 0; i < arr.mCount; ++i)
+        {
+            for (int c = 0; c < N; ++c)
+            {
+                data[c] = v[c];
+            }
+            data += N;
+        }
+    }
+
+    //! ArrayCopy(dst : T*, src : T*), copies as many elements as the smallest array has
+    template<class S, int N>
+    void Copy(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        const ExpList* argExps = context.GetArgExps();
+        ArrayArg<S> dst = NextArrayArgument<S>(context, stream, argExps);
+        ArrayArg<S> src = NextArrayArgument<S>(context, stream, argExps);
+        int count = dst.mCount < src.mCount ? dst.mCount : src.mCount;
+        if (dst.mData != src.mData)
+        {
+            Utils::Memcpy(dst.mData, src.mData, static_cast<unsigned>(count * N * sizeof(S)));
+        }
+    }
+
+    //! ArrayAdd / ArrayMul (dst : T*, src : T*), dst[i] = dst[i] op src[i] for as many elements as the smallest array has
+    template<class Op, class S, int N>
+    void Map(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        const ExpList* argExps = context.GetArgExps();
+        ArrayArg<S> dst = NextArrayArgument<S>(context, stream, argExps);
+        ArrayArg<S> src = NextArrayArgument<S>(context, stream, argExps);
+        int count = dst.mCount < src.mCount ? dst.mCount : src.mCount;
+        Combine<Op>(dst.mData, src.mData, count * N);
+    }
+
+    //! ArrayScale(arr : T*, s : float), scales all the components of all the elements
+    template<int N>
+    void Scale(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        const ExpList* argExps = context.GetArgExps();
+        ArrayArg<float> arr = NextArrayArgument<float>(context, stream, argExps);
+        float s = stream.NextArgument<float>();
+        int scalarCount = arr.mCount * N;
+        float* data = arr.mData;
+        int i = 0;
+#if PEGASUS_ARCH_IA32
+        __m128 s4 = _mm_set1_ps(s);
+        for (; i + 4 <= scalarCount; i += 4)
+        {
+            _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), s4));
+        }
+#endif
+        for (; i < scalarCount; ++i)
+        {
+            data[i] *= s;
+        }
+    }
+
+    //! ArraySum / ArrayMin / ArrayMax (arr : T*) : T
+    template<class Op, class S, int N>
+    void Reduction(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        const ExpList* argExps = context.GetArgExps();
+        ArrayArg<S> arr = NextArrayArgument<S>(context, stream, argExps);
+        PG_ASSERT(context.GetOutputBufferSize() == static_cast<int>(sizeof(S) * N));
+        ReduceDispatch<Op, S, N>(static_cast<S*>(context.GetRawOutputBuffer()), arr.mData, arr.mCount);
+    }
+
+    //! ArrayTransform(arr : float4* | float3*, m : float4x4), arr[i] = mul(m, arr[i]).
+    //! float3 elements are transformed as points (w = 1).
+    template<int N>
+    void Transform(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        const ExpList* argExps = context.GetArgExps();
+        ArrayArg<float> arr = NextArrayArgument<float>(context, stream, argExps);
+        const Math::Mat44& m = stream.NextArgument<Math::Mat44>();
+        float* data = arr.mData;
+#if PEGASUS_ARCH_IA32
+        //transpose once, so every element is a linear combination of the matrix columns
+        __m128 c0 = _mm_loadu_ps(&m.m11);
+        __m128 c1 = _mm_loadu_ps(&m.m21);
+        __m128 c2 = _mm_loadu_ps(&m.m31);
+        __m128 c3 = _mm_loadu_ps(&m.m41);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+        for (int i = 0; i < arr.mCount; ++i, data += N)
+        {
+            __m128 r = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(data[0])), _mm_mul_ps(c1, _mm_set1_ps(data[1]))),
+                _mm_mul_ps(c2, _mm_set1_ps(data[2]))
+            );
+            if (N == 4)
+            {
+                r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(data[3])));
+                _mm_storeu_ps(data, r);
+            }
+            else
+            {
+                float res[4];
+                _mm_storeu_ps(res, _mm_add_ps(r, c3));
+                data[0] = res[0];
+                data[1] = res[1];
+                data[2] = res[2];
+            }
+        }
+#else
+        for (int i = 0; i < arr.mCount; ++i, data += N)
+        {
+            Math::Vec4 v(data[0], data[1], data[2], N == 4 ? data[3] : 1.0f);
+            Math::Vec4 r;
+            Math::Mult44_41(r, m, v);
+            for (int c = 0; c < N; ++c)
+            {
+                data[c] = r.v[c];
+            }
+        }
+#endif
+    }
+}
+
 
 static void RegisterIntrinsicTypes(BlockLib* lib)
 {
@@ -405,6 +708,11 @@ static void RegisterIntrinsicTypes(BlockLib* lib)
             static_cast<TypeDesc::AluEngine>(TypeDesc::E_FLOAT + i - 1)
         );
 
+        //float4*
+        fStr[fStrLen+1] = '*';
+        fStr[fStrLen+2] = '\0';
+        symbolTable->CreateStarType(fStr, t1);
+
         //float4x4
         mStr[mStrLen] = i + '0';
         mStr[mStrLen + 1] = 'x';
@@ -418,6 +726,11 @@ static void RegisterIntrinsicTypes(BlockLib* lib)
         );
     }
 
+    //Register the typed star types, which are pointers to static arrays. Used by the array intrinsics.
+    //The vector typed stars are registered along with their vector types.
+    symbolTable->CreateStarType("int*", intT);
+    symbolTable->CreateStarType("float*", floatT);
+
     symbolTable->CreateObjectType("string",nullptr,nullptr);
 }
 
@@ -506,6 +819,62 @@ void Pegasus::BlockScript::RegisterIntrinsics(BlockLib* lib)
     };
         
     lib->CreateIntrinsicFunctions(mathFuncs, sizeof(mathFuncs) / sizeof(mathFuncs[0])); 
+
+    const Pegasus::BlockScript::FunctionDeclarationDesc arrayFuncs[] =
+    {
+        //*funName | retType | argsTypes                        |  argNames                  | callback
+        { "ArrayFill", "int", { "float*",  "float",  nullptr }, { "arr", "value", nullptr }, Private_Array::Fill<float, 1> },
+        { "ArrayFill", "int", { "float2*", "float2", nullptr }, { "arr", "value", nullptr }, Private_Array::Fill<float, 2> },
+        { "ArrayFill", "int", { "float3*", "float3", nullptr }, { "arr", "value", nullptr }, Private_Array::Fill<float, 3> },
+        { "ArrayFill", "int", { "float4*", "float4", nullptr }, { "arr", "value", nullptr }, Private_Array::Fill<float, 4> },
+        { "ArrayFill", "int", { "int*",    "int",    nullptr }, { "arr", "value", nullptr }, Private_Array::Fill<int, 1> },
+
+        { "ArrayCopy", "int", { "float*",  "float*",  nullptr }, { "dst", "src", nullptr }, Private_Array::Copy<float, 1> },
+        { "ArrayCopy", "int", { "float2*", "float2*", nullptr }, { "dst", "src", nullptr }, Private_Array::Copy<float, 2> },
+        { "ArrayCopy", "int", { "float3*", "float3*", nullptr }, { "dst", "src", nullptr }, Private_Array::Copy<float, 3> },
+        { "ArrayCopy", "int", { "float4*", "float4*", nullptr }, { "dst", "src", nullptr }, Private_Array::Copy<float, 4> },
+        { "ArrayCopy", "int", { "int*",    "int*",    nullptr }, { "dst", "src", nullptr }, Private_Array::Copy<int, 1> },
+
+        { "ArrayAdd", "int", { "float*",  "float*",  nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpAdd, float, 1> },
+        { "ArrayAdd", "int", { "float2*", "float2*", nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpAdd, float, 2> },
+        { "ArrayAdd", "int", { "float3*", "float3*", nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpAdd, float, 3> },
+        { "ArrayAdd", "int", { "float4*", "float4*", nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpAdd, float, 4> },
+        { "ArrayAdd", "int", { "int*",    "int*",    nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpAdd, int, 1> },
+
+        { "ArrayMul", "int", { "float*",  "float*",  nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpMul, float, 1> },
+        { "ArrayMul", "int", { "float2*", "float2*", nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpMul, float, 2> },
+        { "ArrayMul", "int", { "float3*", "float3*", nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpMul, float, 3> },
+        { "ArrayMul", "int", { "float4*", "float4*", nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpMul, float, 4> },
+        { "ArrayMul", "int", { "int*",    "int*",    nullptr }, { "dst", "src", nullptr }, Private_Array::Map<Private_Array::OpMul, int, 1> },
+
+        { "ArrayScale", "int", { "float*",  "float", nullptr }, { "arr", "s", nullptr }, Private_Array::Scale<1> },
+        { "ArrayScale", "int", { "float2*", "float", nullptr }, { "arr", "s", nullptr }, Private_Array::Scale<2> },
+        { "ArrayScale", "int", { "float3*", "float", nullptr }, { "arr", "s", nullptr }, Private_Array::Scale<3> },
+        { "ArrayScale", "int", { "float4*", "float", nullptr }, { "arr", "s", nullptr }, Private_Array::Scale<4> },
+
+        { "ArraySum", "float",  { "float*",  nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpAdd, float, 1> },
+        { "ArraySum", "float2", { "float2*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpAdd, float, 2> },
+        { "ArraySum", "float3", { "float3*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpAdd, float, 3> },
+        { "ArraySum", "float4", { "float4*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpAdd, float, 4> },
+        { "ArraySum", "int",    { "int*",    nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpAdd, int, 1> },
+
+        { "ArrayMin", "float",  { "float*",  nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMin, float, 1> },
+        { "ArrayMin", "float2", { "float2*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMin, float, 2> },
+        { "ArrayMin", "float3", { "float3*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMin, float, 3> },
+        { "ArrayMin", "float4", { "float4*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMin, float, 4> },
+        { "ArrayMin", "int",    { "int*",    nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMin, int, 1> },
+
+        { "ArrayMax", "float",  { "float*",  nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMax, float, 1> },
+        { "ArrayMax", "float2", { "float2*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMax, float, 2> },
+        { "ArrayMax", "float3", { "float3*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMax, float, 3> },
+        { "ArrayMax", "float4", { "float4*", nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMax, float, 4> },
+        { "ArrayMax", "int",    { "int*",    nullptr }, { "arr", nullptr }, Private_Array::Reduction<Private_Array::OpMax, int, 1> },
+
+        { "ArrayTransform", "int", { "float4*", "float4x4", nullptr }, { "arr", "m", nullptr }, Private_Array::Transform<4> },
+        { "ArrayTransform", "int", { "float3*", "float4x4", nullptr }, { "arr", "m", nullptr }, Private_Array::Transform<3> }
+    };
+
+    lib->CreateIntrinsicFunctions(arrayFuncs, sizeof(arrayFuncs) / sizeof(arrayFuncs[0]));
 }
 
 //! internal blockscript compiler listener for intrinsics. 
@@ -0,0 +1,859 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BsLexer.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Hand written BlockScript lexer. Replaces the flex generated lexer.
+
+#include "Pegasus/BlockScript/BsLexer.h"
+#include "Pegasus/BlockScript/BlockScriptBuilder.h"
+#include "Pegasus/BlockScript/BlockScriptAst.h"
+#include "Pegasus/BlockScript/CompilerState.h"
+#include "Pegasus/BlockScript/IFileIncluder.h"
+#include "Pegasus/BlockScript/IddStrPool.h"
+#include "Pegasus/BlockScript/SymbolTable.h"
+#include "Pegasus/BlockScript/bs.parser.hpp"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+using namespace Pegasus;
+using namespace Pegasus::BlockScript;
+
+// defined in the parser
+extern void BS_ErrorDispatcher(BlockScriptBuilder* builder, const char* message);
+
+namespace
+{
+    //! Reserved words of the language
+    struct Keyword
+    {
+        const char* mText;
+        int         mLength;
+        int         mToken;
+    };
+
+    const Keyword sKeywords[] = {
+        { "if",           2,  K_IF           },
+        { "for",          3,  K_FOR          },
+        { "elif",         4,  K_ELSE_IF      },
+        { "else",         4,  K_ELSE         },
+        { "enum",         4,  K_ENUM         },
+        { "while",        5,  K_WHILE        },
+        { "return",       6,  K_RETURN       },
+        { "struct",       6,  K_STRUCT       },
+        { "sizeof",       6,  K_SIZE_OF      },
+        { "extern",       6,  K_EXTERN       },
+        { "static_array", 12, K_STATIC_ARRAY }
+    };
+
+    const int sKeywordCount = sizeof(sKeywords) / sizeof(sKeywords[0]);
+
+    inline bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    inline bool IsWordChar(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || IsDigit(c) || c == '_';
+    }
+
+    //! \return the keyword token of a word, -1 if the word is not a keyword
+    int FindKeyword(const char* word, int length)
+    {
+        for (int i = 0; i < sKeywordCount; ++i)
+        {
+            const Keyword& k = sKeywords[i];
+            if (k.mLength == length && k.mText[0] == word[0] && Utils::Strneq(k.mText, word, length))
+            {
+                return k.mToken;
+            }
+        }
+        return -1;
+    }
+
+    //! \return true if the word view is equal to a null terminated string
+    inline bool WordIs(const char* word, int length, const char* str)
+    {
+        return Utils::Strlen(str) == static_cast<unsigned>(length) && Utils::Strneq(word, str, length);
+    }
+}
+
+#define BS_TOKEN(t) return (lval->token = t);
+
+BsLexer::BsLexer(CompilerState* state, Alloc::IAllocator* allocator)
+: mState(state),
+  mSourceStack(allocator),
+  mSource(&mRoot),
+  mMode(MODE_CODE),
+  mTerminated(false),
+  mTokenStart(nullptr),
+  mTokenLength(0)
+{
+    mRoot.mCursor = nullptr;
+    mRoot.mEnd = nullptr;
+    mRoot.mDef = nullptr;
+    mTokenText[0] = '\0';
+}
+
+BsLexer::~BsLexer()
+{
+    while (PopSource()) {}
+}
+
+void BsLexer::Begin(const char* buffer, int bufferSize)
+{
+    while (PopSource()) {}
+    mRoot.mCursor = buffer;
+    mRoot.mEnd = buffer + bufferSize;
+    mRoot.mDef = nullptr;
+    mSource = &mRoot;
+    mMode = MODE_CODE;
+    mTerminated = false;
+    mTokenStart = nullptr;
+    mTokenLength = 0;
+    mTokenText[0] = '\0';
+}
+
+bool BsLexer::HasNext() const
+{
+    return !mTerminated && mRoot.mCursor < mRoot.mEnd;
+}
+
+int BsLexer::Lex(YYSTYPE* lval)
+{
+    while (!mTerminated)
+    {
+        if (mSource->mCursor >= mSource->mEnd)
+        {
+            //end of a macro or include resumes the previous buffer, end of the root file ends lexing
+            if (!PopSource())
+            {
+                return 0;
+            }
+            continue;
+        }
+
+        switch (mMode)
+        {
+        case MODE_CODE:
+            {
+                int token = LexCode(lval);
+                if (token != -1)
+                {
+                    return token;
+                }
+            }
+            break;
+        case MODE_PREPROCESSOR:
+            LexPreprocessor();
+            break;
+        case MODE_DEFINE_CAPTURE:
+            LexDefineCapture();
+            break;
+        case MODE_IGNORE_CODE:
+            LexIgnoreCode();
+            break;
+        default:
+            PG_FAILSTR("Invalid lexer mode.");
+            mTerminated = true;
+        }
+    }
+    return 0;
+}
+
+int BsLexer::LexAll()
+{
+    YYSTYPE lval;
+    int tokenCount = 0;
+    while (Lex(&lval) != 0)
+    {
+        ++tokenCount;
+    }
+    return tokenCount;
+}
+
+const char* BsLexer::GetTokenText()
+{
+    //the token is copied lazily, since only errors request it
+    if (mTokenStart != nullptr)
+    {
+        int length = mTokenLength < static_cast<int>(sizeof(mTokenText)) - 1 ? mTokenLength : static_cast<int>(sizeof(mTokenText)) - 1;
+        Utils::Memcpy(mTokenText, mTokenStart, length);
+        mTokenText[length] = '\0';
+        mTokenStart = nullptr;
+    }
+    return mTokenText;
+}
+
+int BsLexer::LexCode(YYSTYPE* lval)
+{
+    BlockScriptBuilder* builder = mState->mBuilder;
+    const char* c = mSource->mCursor;
+    const char* end = mSource->mEnd;
+
+    //skip blanks. Null characters terminate macro buffers and get skipped as well
+    while (c < end)
+    {
+        if (*c == '\n')
+        {
+            builder->IncrementLine();
+        }
+        else if (*c != ' ' && *c != '\t' && *c != '\r' && *c != '\0')
+        {
+            break;
+        }
+        ++c;
+    }
+
+    mSource->mCursor = c;
+    if (c == end)
+    {
+        return -1;
+    }
+
+    mTokenStart = c;
+    mTokenLength = 1;
+
+    if (IsWordChar(*c))
+    {
+        bool allDigits = true;
+        while (c < end && IsWordChar(*c))
+        {
+            allDigits = allDigits && IsDigit(*c);
+            ++c;
+        }
+
+        if (allDigits)
+        {
+            if (c + 1 < end && *c == '.' && IsDigit(c[1]))
+            {
+                c += 2;
+                while (c < end && IsDigit(*c))
+                {
+                    ++c;
+                }
+                mTokenLength = static_cast<int>(c - mTokenStart);
+                mSource->mCursor = c;
+                lval->floatValue = Utils::Atof(mTokenStart, mTokenLength);
+                return I_FLOAT;
+            }
+            else
+            {
+                mTokenLength = static_cast<int>(c - mTokenStart);
+                mSource->mCursor = c;
+                lval->integerValue = Utils::Atoi(mTokenStart, mTokenLength);
+                return I_INT;
+            }
+        }
+
+        mTokenLength = static_cast<int>(c - mTokenStart);
+        mSource->mCursor = c;
+        return CodeWord(lval, mTokenStart, mTokenLength);
+    }
+
+    const char next = c + 1 < end ? c[1] : '\0';
+    mSource->mCursor = c + 1;
+
+    switch (*c)
+    {
+    case '#':
+        mState->PushLexerState(MODE_CODE);
+        mMode = MODE_PREPROCESSOR;
+        return -1;
+    case '/':
+        mSource->mCursor = c;
+        if (SkipComment())
+        {
+            return -1;
+        }
+        mSource->mCursor = c + 1;
+        BS_TOKEN(O_DIV);
+    case '"':
+        if (CaptureString())
+        {
+            lval->identifierText = mState->mStringAccumulator;
+            mTokenLength = static_cast<int>(mSource->mCursor - mTokenStart);
+            return I_STRING;
+        }
+        return -1;
+    case ';': BS_TOKEN(K_SEMICOLON);
+    case '*': BS_TOKEN(O_MUL);
+    case '%': BS_TOKEN(O_MOD);
+    case '.': BS_TOKEN(O_DOT);
+    case '(': return K_L_PAREN;
+    case ')': return K_R_PAREN;
+    case '{': return K_L_BRAC;
+    case '}': return K_R_BRAC;
+    case '[': return K_L_LACE;
+    case ']': return K_R_LACE;
+    case ',': return K_COMMA;
+    case ':': return K_COL;
+    default:
+        break;
+    }
+
+    //two character operators
+    mTokenLength = 2;
+    mSource->mCursor = c + 2;
+    switch (*c)
+    {
+    case '+':
+        if (next == '+') { BS_TOKEN(O_INC); }
+        break;
+    case '-':
+        if (next == '-') { BS_TOKEN(O_DEC); }
+        if (next == '>') { BS_TOKEN(O_METHOD_CALL); }
+        break;
+    case '=':
+        if (next == '=') { BS_TOKEN(O_EQ); }
+        break;
+    case '!':
+        if (next == '=') { BS_TOKEN(O_NEQ); }
+        break;
+    case '>':
+        if (next == '=') { BS_TOKEN(O_GTE); }
+        break;
+    case '<':
+        if (next == '=') { BS_TOKEN(O_LTE); }
+        break;
+    case '&':
+        if (next == '&') { BS_TOKEN(O_LAND); }
+        break;
+    case '|':
+        if (next == '|') { BS_TOKEN(O_LOR); }
+        break;
+    case '@':
+        if (next == '(') { return K_A_PAREN; }
+        break;
+    default:
+        break;
+    }
+
+    //single character operators. Anything else is ignored.
+    mTokenLength = 1;
+    mSource->mCursor = c + 1;
+    switch (*c)
+    {
+    case '+': BS_TOKEN(O_PLUS);
+    case '-': BS_TOKEN(O_MINUS);
+    case '=': BS_TOKEN(O_SET);
+    case '>': BS_TOKEN(O_GT);
+    case '<': BS_TOKEN(O_LT);
+    default:
+        return -1;
+    }
+}
+
+int BsLexer::CodeWord(YYSTYPE* lval, const char* word, int length)
+{
+    int keyword = FindKeyword(word, length);
+    if (keyword != -1)
+    {
+        return keyword;
+    }
+
+    if (length + 1 >= IddStrPool::sCharsPerString)
+    {
+        Error("Identifier string too long!\n");
+        return -1;
+    }
+
+    BlockScriptBuilder* builder = mState->mBuilder;
+    char* str = builder->GetStringPool().Intern(word, length);
+    if (str == nullptr)
+    {
+        Error("Out of identifier memory!");
+        return -1;
+    }
+
+    const Preprocessor::Definition* preprocessorDefinition = mState->GetPreprocessor().FindDefinitionByName(str);
+    if (preprocessorDefinition != nullptr)
+    {
+        PushSource(preprocessorDefinition->mValue, preprocessorDefinition->mBufferSize, preprocessorDefinition);
+        return -1;
+    }
+
+    lval->identifierText = str;
+    return builder->GetSymbolTable()->GetTypeByName(str) != nullptr ? TYPE_IDENTIFIER : IDENTIFIER;
+}
+
+bool BsLexer::SkipComment()
+{
+    const char* c = mSource->mCursor;
+    const char* end = mSource->mEnd;
+    if (c + 1 >= end || c[0] != '/')
+    {
+        return false;
+    }
+
+    if (c[1] == '/')
+    {
+        //the end of line is left for the current mode to process
+        c += 2;
+        while (c < end && *c != '\n')
+        {
+            ++c;
+        }
+    }
+    else if (c[1] == '*')
+    {
+        c += 2;
+        while (c < end)
+        {
+            if (*c == '\n')
+            {
+                mState->mBuilder->IncrementLine();
+            }
+            else if (*c == '*' && c + 1 < end && c[1] == '/')
+            {
+                c += 2;
+                break;
+            }
+            ++c;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    mSource->mCursor = c;
+    return true;
+}
+
+bool BsLexer::CaptureString()
+{
+    const char* c = mSource->mCursor;
+    const char* end = mSource->mEnd;
+    int pos = 0;
+    while (c < end && *c != '"')
+    {
+        //new lines are dropped from string literals
+        if (*c != '\n')
+        {
+            if (pos >= 511)
+            {
+                Error("Out of string block memory! keep imm strings within 512 chars.");
+                return false;
+            }
+            mState->mStringAccumulator[pos++] = *c;
+        }
+        ++c;
+    }
+
+    if (c == end)
+    {
+        Error("Unterminated string literal.");
+        return false;
+    }
+
+    mSource->mCursor = c + 1;
+    mState->mStringAccumulator[pos] = '\0';
+    mState->mStringAccumulatorPos = pos;
+    return true;
+}
+
+void BsLexer::LexPreprocessor()
+{
+    const char* c = mSource->mCursor;
+    const char* end = mSource->mEnd;
+    while (c < end && (*c == ' ' || *c == '\t' || *c == '\r'))
+    {
+        ++c;
+    }
+
+    mSource->mCursor = c;
+    if (c == end)
+    {
+        return;
+    }
+
+    mTokenStart = c;
+    mTokenLength = 1;
+
+    if (*c == '\n')
+    {
+        mSource->mCursor = c + 1;
+        mState->mBuilder->IncrementLine();
+        EndPreprocessorLine();
+    }
+    else if (*c == '/' && SkipComment())
+    {
+        return;
+    }
+    else if (*c == '"')
+    {
+        if (mState->GetPreprocessor().GetCmd() != Preprocessor::PP_CMD_INCLUDE)
+        {
+            Error("Invalid argument for PP command");
+        }
+        else
+        {
+            mSource->mCursor = c + 1;
+            if (CaptureString())
+            {
+                const char* strImm = mState->mBuilder->AllocStrImm(mState->mStringAccumulator);
+                if (strImm != nullptr)
+                {
+                    mState->GetPreprocessor().PushCode(strImm);
+                }
+                else
+                {
+                    mTerminated = true;
+                }
+            }
+        }
+    }
+    else if (IsWordChar(*c))
+    {
+        while (c < end && IsWordChar(*c))
+        {
+            ++c;
+        }
+        mTokenLength = static_cast<int>(c - mTokenStart);
+        mSource->mCursor = c;
+        PreprocessorWord(mTokenStart, mTokenLength);
+    }
+    else
+    {
+        Error("Invalid token for preprocessor.");
+    }
+}
+
+void BsLexer::PreprocessorWord(const char* word, int length)
+{
+    Preprocessor& pp = mState->GetPreprocessor();
+    const bool hasCmd = pp.GetCmd() != Preprocessor::PP_CMD_NONE;
+
+    if (WordIs(word, length, "include"))
+    {
+        if (hasCmd)
+        {
+            Error("Can't queue preprocessor command 'include' ");
+        }
+        else
+        {
+            pp.IncludeCmd();
+        }
+    }
+    else if (WordIs(word, length, "define"))
+    {
+        if (hasCmd)
+        {
+            Error("Can't queue preprocessor command 'define' ");
+        }
+        else
+        {
+            pp.DefineCmd();
+        }
+    }
+    else if (WordIs(word, length, "ifdef") || WordIs(word, length, "ifndef"))
+    {
+        if (hasCmd)
+        {
+            Error("Can't queue preprocessor command 'if[n]def' ");
+        }
+        else
+        {
+            bool ifActive = pp.IsIfActive();
+            pp.NewState();
+            if (word[2] == 'd')
+                pp.IfDefCmd();
+            else
+                pp.IfNDefCmd();
+            pp.SetChosePath(false);
+            pp.SetIfActive(ifActive);
+        }
+    }
+    else if (WordIs(word, length, "else") || WordIs(word, length, "elif"))
+    {
+        const bool isElse = word[2] == 's';
+        if (hasCmd || pp.StateCount() < 2)
+        {
+            Error(isElse ? "Can't queue preprocessor command 'else' " : "Can't queue preprocessor command 'elif' ");
+        }
+        else
+        {
+            bool chosePrevIfStmt = pp.ChosePath(); //was a previous condition true?
+            pp.PopState();
+            bool isActive = pp.IsIfActive();
+            pp.NewState();
+            if (isElse)
+                pp.ElseCmd();
+            else
+                pp.ElseIfCmd();
+            pp.SetChosePath(chosePrevIfStmt);
+            pp.SetIfActive(!chosePrevIfStmt && isActive);
+        }
+    }
+    else if (WordIs(word, length, "endif"))
+    {
+        if (hasCmd)
+        {
+            Error("Can't queue preprocessor command 'endif' ");
+        }
+        else
+        {
+            pp.EndIfCmd();
+        }
+    }
+    else if (
+                pp.GetCmd() != Preprocessor::PP_CMD_DEFINE &&
+                pp.GetCmd() != Preprocessor::PP_CMD_IF_DEF &&
+                pp.GetCmd() != Preprocessor::PP_CMD_IF_N_DEF &&
+                pp.GetCmd() != Preprocessor::PP_CMD_ELSEIF
+            )
+    {
+        Error("Invalid identifier token for preprocessor command.");
+    }
+    else if (length + 1 >= IddStrPool::sCharsPerString)
+    {
+        Error("Identifier string too long!\n");
+    }
+    else
+    {
+        char* str = mState->mBuilder->GetStringPool().Intern(word, length);
+        if (str == nullptr)
+        {
+            Error("Out of identifier memory!");
+        }
+        else
+        {
+            pp.PushString(str);
+            if (pp.GetCmd() == Preprocessor::PP_CMD_DEFINE)
+            {
+                mState->mStringAccumulatorPos = 0;
+                mState->mStringAccumulator[0] = '\0';
+                mMode = MODE_DEFINE_CAPTURE;
+            }
+        }
+    }
+}
+
+void BsLexer::EndPreprocessorLine()
+{
+    Preprocessor& pp = mState->GetPreprocessor();
+    Preprocessor::Cmd cmd = pp.GetCmd();
+    if (cmd == Preprocessor::PP_CMD_IF_DEF
+     || cmd == Preprocessor::PP_CMD_IF_N_DEF
+     || cmd == Preprocessor::PP_CMD_ELSEIF)
+    {
+        const char* preprocessorDefine = pp.GetStringArg();
+        pp.NoneCmd();
+
+        if (preprocessorDefine == nullptr)
+        {
+            Error("Invalid argument for PP command");
+            return;
+        }
+
+        if (pp.IsIfActive() && !pp.ChosePath())
+        {
+            bool shouldNegate = cmd == Preprocessor::PP_CMD_IF_N_DEF;
+            bool isDefined = pp.FindDefinitionByName(preprocessorDefine) != nullptr;
+            bool shouldChoosePath = (!shouldNegate && isDefined) || (shouldNegate && !isDefined);
+            if (shouldChoosePath)
+            {
+                pp.SetChosePath(true);
+                PopMode();
+            }
+            else
+            {
+                pp.SetIfActive(false);
+                mMode = MODE_IGNORE_CODE;
+            }
+        }
+        else
+        {
+            mMode = MODE_IGNORE_CODE;
+        }
+    }
+    else if (cmd == Preprocessor::PP_CMD_ELSE)
+    {
+        pp.NoneCmd();
+        if (pp.IsIfActive() && !pp.ChosePath())
+        {
+            PopMode();
+        }
+        else
+        {
+            pp.SetIfActive(false);
+            mMode = MODE_IGNORE_CODE;
+        }
+    }
+    else if (cmd == Preprocessor::PP_CMD_ENDIF)
+    {
+        if (pp.StateCount() <= 1)
+        {
+            Error("Can't queue endif preprocessor command");
+        }
+        else
+        {
+            pp.PopState();
+            pp.NoneCmd();
+            if (pp.IsIfActive())
+            {
+                PopMode();
+            }
+            else
+            {
+                mMode = MODE_IGNORE_CODE;
+            }
+        }
+    }
+    else
+    {
+        const char* msg = nullptr;
+        if (!pp.FlushCommand(&msg))
+        {
+            Error(msg);
+        }
+        else
+        {
+            if (pp.HasIncludeBuffer())
+            {
+                const Preprocessor::Definition* includeDef = pp.GetIncludeDefinition();
+                PushSource(includeDef->mValue, includeDef->mBufferSize, includeDef);
+                mState->mBuilder->PushFile(includeDef->mIncludePathName);
+            }
+
+            if (pp.IsIfActive())
+            {
+                PopMode();
+            }
+            else
+            {
+                mMode = MODE_IGNORE_CODE;
+            }
+        }
+    }
+}
+
+void BsLexer::LexDefineCapture()
+{
+    CompilerState* state = mState;
+    const char* c = mSource->mCursor;
+    const char* end = mSource->mEnd;
+    while (c < end && *c != '\n')
+    {
+        if (state->mStringAccumulatorPos >= 511)
+        {
+            Error("Out of string block memory! keep macro strings within 512 chars.");
+            return;
+        }
+        else if (*c != ' ')
+        {
+            state->mStringAccumulator[state->mStringAccumulatorPos++] = *c;
+        }
+        ++c;
+    }
+
+    mSource->mCursor = c;
+    if (c == end)
+    {
+        //the define continues on the buffer underneath, if any
+        return;
+    }
+
+    mSource->mCursor = c + 1;
+    state->mBuilder->IncrementLine();
+    if (state->mStringAccumulatorPos >= 511)
+    {
+        Error("Out of string block memory! keep macro strings within 512 chars.");
+        return;
+    }
+
+    Preprocessor& pp = state->GetPreprocessor();
+    state->mStringAccumulator[state->mStringAccumulatorPos++] = '\0';
+    const char* copiedString = state->mBuilder->AllocStrImm(state->mStringAccumulator);
+    pp.PushCode(copiedString);
+    state->mStringAccumulatorPos = 0;
+    const char* msg = nullptr;
+    if (!pp.FlushCommand(&msg))
+    {
+        Error(msg);
+    }
+    else if (pp.IsIfActive())
+    {
+        PopMode();
+    }
+    else
+    {
+        mMode = MODE_IGNORE_CODE;
+    }
+}
+
+void BsLexer::LexIgnoreCode()
+{
+    const char* c = mSource->mCursor;
+    const char* end = mSource->mEnd;
+    while (c < end)
+    {
+        if (*c == '#')
+        {
+            mMode = MODE_PREPROCESSOR;
+            ++c;
+            break;
+        }
+        else if (*c == '\n')
+        {
+            mState->mBuilder->IncrementLine();
+        }
+        ++c;
+    }
+    mSource->mCursor = c;
+}
+
+void BsLexer::PushSource(const char* buffer, int bufferSize, const Preprocessor::Definition* def)
+{
+    Source& s = mSourceStack.PushEmpty();
+    s.mCursor = buffer;
+    s.mEnd = buffer + bufferSize;
+    s.mDef = def;
+    mSource = &s;
+}
+
+bool BsLexer::PopSource()
+{
+    if (mSourceStack.GetSize() == 0)
+    {
+        return false;
+    }
+
+    const Preprocessor::Definition* def = mSourceStack[mSourceStack.GetSize() - 1].mDef;
+    if (def != nullptr && def->mIsInclude)
+    {
+        //the last token might point to the buffer about to be closed
+        GetTokenText();
+        mState->mBuilder->PopFile();
+        if (def->mValue != nullptr)
+        {
+            mState->GetPreprocessor().GetFileIncluder()->Close(def->mValue);
+        }
+    }
+
+    mSourceStack.Pop();
+    mSource = mSourceStack.GetSize() == 0 ? &mRoot : &mSourceStack[mSourceStack.GetSize() - 1];
+    return true;
+}
+
+void BsLexer::Error(const char* message)
+{
+    BS_ErrorDispatcher(mState->mBuilder, message);
+    mTerminated = true;
+}
+
+void BsLexer::PopMode()
+{
+    mMode = static_cast<Mode>(mState->PopLexerState());
+}
+
+int BS_lex(YYSTYPE* lval, void* scanner)
+{
+    return static_cast<BsLexer*>(scanner)->Lex(lval);
+}
@@ -23,6 +23,7 @@
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Utils/Memcpy.h"
 #include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/String.h"
 #include "Pegasus/BlockScript/ExpressionEngine.h"
 #include "Pegasus/Math/Vector.h"
 
@@ -467,7 +468,8 @@ BsVmState::BsVmState()
     mStackLevels(-1),
     mUserContext(nullptr),
     mRuntimeListener(nullptr),
-    mExecutionState(BsVmState::Alive)
+    mExecutionState(BsVmState::Alive),
+    mDetachedHeapSize(0)
 {
     Reset();
 }
@@ -476,6 +478,7 @@ void BsVmState::Initialize(Alloc::IAllocator* allocator)
 {
     mAllocator = allocator;
     mHeapContainer.Initialize(allocator);
+    mDetachedStrings.Initialize(allocator);
     Grow(BS_VM_PAGE_SIZE); // try to grow 512 bytes initially
     mRamSize = 0; //reset ram, and keep the page open.
     mStackLevels = -1; //-1 means no stack has been set
@@ -483,6 +486,13 @@ void BsVmState::Initialize(Alloc::IAllocator* allocator)
 }
 
 void BsVmState::Reset()
+{
+    ResetStack();
+    mHeapContainer.Reset();
+    FreeDetachedStrings();
+}
+
+void BsVmState::ResetStack()
 {
     mExecutionState = BsVmState::Alive;
     mRamSize = 0;
@@ -491,7 +501,36 @@ void BsVmState::Reset()
     {
         mR[i] = 0;
     }
-    mHeapContainer.Reset();
+}
+
+void BsVmState::DetachHeapStrings()
+{
+    //elements below mDetachedHeapSize were detached already on a previous call
+    for (int i = mDetachedHeapSize; i < mHeapContainer.Size(); ++i)
+    {
+        HeapElement& el = mHeapContainer[i];
+        if (el.mObject != nullptr)
+        {
+            //the only heap objects are string literals, see InsertDataToHeap
+            const char* str = static_cast<const char*>(el.mObject);
+            int len = Utils::Strlen(str) + 1;
+            char* copy = PG_NEW_ARRAY(mAllocator, -1, "BS VM Heap String", Alloc::PG_MEM_TEMP, char, len);
+            Utils::Memcpy(copy, str, len);
+            mDetachedStrings.PushEmpty() = copy;
+            el.mObject = copy;
+        }
+    }
+    mDetachedHeapSize = mHeapContainer.Size();
+}
+
+void BsVmState::FreeDetachedStrings()
+{
+    for (int i = 0; i < mDetachedStrings.Size(); ++i)
+    {
+        PG_DELETE_ARRAY(mAllocator, mDetachedStrings[i]);
+    }
+    mDetachedStrings.Reset();
+    mDetachedHeapSize = 0;
 }
 
 void BsVmState::Grow(int byteCount)
@@ -520,6 +559,7 @@ void BsVmState::Shrink(int byteCount)
 
 BsVmState::~BsVmState()
 {
+    FreeDetachedStrings();
     if (mRam != nullptr)
     {
         PG_DELETE_ARRAY(mAllocator, mRam);
@@ -911,6 +911,17 @@ void Canonizer::ProcessFunctionExpressionList(FunCall* funCall)
             const TypeDesc* theType = argList->GetArgDec()->GetType();
             if (theType->GetModifier() == TypeDesc::M_STAR)
             {
+                //typed stars record the array size in the temporal type, so the callback knows the element count
+                const TypeDesc* argType = n->GetExp()->GetTypeDesc();
+                if (theType->GetChild() != nullptr && argType->GetModifier() == TypeDesc::M_ARRAY)
+                {
+                    theType = mSymbolTable->CreateStarType(
+                        theType->GetName(),
+                        const_cast<TypeDesc*>(theType->GetChild()),
+                        argType->GetModifierProperty().ArraySize
+                    );
+                }
+
                 //move the pointer of whatever rebuilt expression was generated to our actual call                
                 Idd* tmp = AllocateTemporal(theType);
                 PushCanon(CANON_NEW LoadAddr(Canon::R_C, mRebuiltExpression));
@@ -30,26 +30,3 @@ int CompilerState::PopLexerState()
 {
     return mLexerStack.Pop();
 }
-
-void  CompilerState::PushDefineStack(void* bufferId, const BlockScript::Preprocessor::Definition* def)
-{
-    CompilerState::DefineBufferEl& el = *(new(&(mDefineBufferStack.PushEmpty()))CompilerState::DefineBufferEl); 
-    el.mBufferPosition = 0;
-    el.mLexerBufferId = bufferId;
-    el.mDef = def;
-}
-
-int   CompilerState::GetDefineStackCount() const
-{
-    return mDefineBufferStack.GetSize();
-}
-
-CompilerState::DefineBufferEl* CompilerState::GetDefineStackTop()
-{
-    return &mDefineBufferStack[mDefineBufferStack.GetSize() - 1];
-}
-
-void*  CompilerState::PopDefineStack()
-{
-    return mDefineBufferStack.Pop().mLexerBufferId;
-}
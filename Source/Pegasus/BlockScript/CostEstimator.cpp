@@ -0,0 +1,511 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CostEstimator.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Static cost estimation of blockscript functions. Costs are measured in canon
+//!         instructions, with native calls weighted by a per function cost table.
+
+#include "Pegasus/BlockScript/CostEstimator.h"
+#include "Pegasus/BlockScript/BlockScriptAst.h"
+#include "Pegasus/BlockScript/FunDesc.h"
+#include "Pegasus/BlockScript/TypeDesc.h"
+#include "Pegasus/BlockScript/bs.parser.hpp"
+#include "Pegasus/Utils/String.h"
+
+using namespace Pegasus;
+using namespace Pegasus::BlockScript;
+using namespace Pegasus::BlockScript::Ast;
+
+//costs saturate here, so nested loops do not overflow
+static const int sMaxCost = 0x3fffffff;
+
+//default cost of native functions, in canon instructions. Anything not listed costs sDefaultNativeCost.
+static const struct DefaultNativeCost
+{
+    const char* mName;
+    int mCost;
+} sDefaultNativeCosts[] = {
+    //constructors and cheap math
+    { "float2", 1 },
+    { "float3", 1 },
+    { "float4", 1 },
+    { "dot",    2 },
+    { "cross",  2 },
+    { "lerp",   2 },
+    { "sin",    4 },
+    { "cos",    4 },
+    { "mul",    8 },
+    { "float4x4", 4 },
+    { "float3x3", 3 },
+    { "float2x2", 2 },
+    //array intrinsics, native loops over the whole array
+    { "ArrayFill",      8 },
+    { "ArrayCopy",      8 },
+    { "ArrayAdd",       8 },
+    { "ArrayMul",       8 },
+    { "ArrayScale",     8 },
+    { "ArraySum",       8 },
+    { "ArrayMin",       8 },
+    { "ArrayMax",       8 },
+    { "ArrayTransform", 16 },
+    //render api, these go down to the gpu driver
+    { "Draw",            64 },
+    { "Clear",           32 },
+    { "SetRenderTarget", 32 },
+    { "SetRenderTargets", 32 },
+    { "SetDefaultRenderTarget", 32 },
+    { "SetProgram",      16 },
+    { "SetMesh",         16 },
+    { "SetUniformBuffer", 16 },
+    { "SetUniformTexture", 16 },
+    { "SetUniformTextureRenderTarget", 16 },
+    { "SetBuffer",       16 },
+    { "SetViewport",     8 },
+    { "SetRasterizerState", 8 },
+    { "SetBlendingState",   8 },
+    { "echo", 16 }
+};
+
+static int SatAdd(int a, int b)
+{
+    return a > sMaxCost - b ? sMaxCost : a + b;
+}
+
+static int SatMul(int a, int b)
+{
+    if (a == 0 || b == 0)
+    {
+        return 0;
+    }
+    return a > sMaxCost / b ? sMaxCost : a * b;
+}
+
+//cost of running a then b
+static FunCost Seq(const FunCost& a, const FunCost& b)
+{
+    FunCost r;
+    r.mFixedCost = SatAdd(a.mFixedCost, b.mFixedCost);
+    r.mPerIterationCost = SatAdd(a.mPerIterationCost, b.mPerIterationCost);
+    r.mIsUnbounded = a.mIsUnbounded || b.mIsUnbounded;
+    return r;
+}
+
+//cost of running a or b
+static FunCost Max(const FunCost& a, const FunCost& b)
+{
+    FunCost r;
+    r.mFixedCost = a.mFixedCost > b.mFixedCost ? a.mFixedCost : b.mFixedCost;
+    r.mPerIterationCost = a.mPerIterationCost > b.mPerIterationCost ? a.mPerIterationCost : b.mPerIterationCost;
+    r.mIsUnbounded = a.mIsUnbounded || b.mIsUnbounded;
+    return r;
+}
+
+static FunCost Instructions(int count)
+{
+    FunCost r;
+    r.mFixedCost = count;
+    return r;
+}
+
+//cost of a loop running a known amount of times
+static FunCost Repeat(const FunCost& iteration, int tripCount)
+{
+    FunCost r;
+    r.mFixedCost = SatMul(iteration.mFixedCost, tripCount);
+    r.mPerIterationCost = SatMul(iteration.mPerIterationCost, tripCount);
+    r.mIsUnbounded = iteration.mIsUnbounded;
+    return r;
+}
+
+//cost of a loop with an unknown trip count
+static FunCost RepeatUnknown(const FunCost& iteration)
+{
+    FunCost r;
+    r.mPerIterationCost = SatAdd(iteration.mFixedCost, iteration.mPerIterationCost);
+    //a loop with an unknown trip count inside of another one grows with N^2, which this cost can't express
+    r.mIsUnbounded = iteration.mIsUnbounded || iteration.mPerIterationCost > 0;
+    return r;
+}
+
+CostEstimator::CostEstimator()
+{
+}
+
+CostEstimator::~CostEstimator()
+{
+}
+
+void CostEstimator::Initialize(Alloc::IAllocator* alloc)
+{
+    mFunctions.Initialize(alloc);
+    mNativeCosts.Initialize(alloc);
+}
+
+void CostEstimator::SetNativeCost(const char* funName, int cost)
+{
+    for (int i = 0; i < mNativeCosts.Size(); ++i)
+    {
+        if (!Utils::Strcmp(mNativeCosts[i].mName, funName))
+        {
+            mNativeCosts[i].mCost = cost;
+            return;
+        }
+    }
+    NativeCostEntry& entry = mNativeCosts.PushEmpty();
+    entry.mName = funName;
+    entry.mCost = cost;
+}
+
+int CostEstimator::GetNativeCost(const char* funName) const
+{
+    for (int i = 0; i < mNativeCosts.Size(); ++i)
+    {
+        if (!Utils::Strcmp(mNativeCosts[i].mName, funName))
+        {
+            return mNativeCosts[i].mCost;
+        }
+    }
+
+    for (unsigned int i = 0; i < sizeof(sDefaultNativeCosts) / sizeof(sDefaultNativeCosts[0]); ++i)
+    {
+        if (!Utils::Strcmp(sDefaultNativeCosts[i].mName, funName))
+        {
+            return sDefaultNativeCosts[i].mCost;
+        }
+    }
+
+    return sDefaultNativeCost;
+}
+
+void CostEstimator::Reset()
+{
+    mFunctions.Reset();
+}
+
+void CostEstimator::Estimate(Program* program)
+{
+    Reset();
+    if (program != nullptr)
+    {
+        Eval(program);
+    }
+}
+
+bool CostEstimator::ExceedsBudget(const FunCost& cost, int budget)
+{
+    if (cost.mIsUnbounded)
+    {
+        return true;
+    }
+    int total = SatAdd(cost.mFixedCost, SatMul(cost.mPerIterationCost, sAssumedTripCount));
+    return total > budget;
+}
+
+FunCost CostEstimator::Eval(Node* node)
+{
+    mResult = FunCost();
+    if (node != nullptr)
+    {
+        node->Access(this);
+    }
+    return mResult;
+}
+
+FunCost CostEstimator::EvalFunction(const StmtFunDec* funDec)
+{
+    if (funDec == nullptr || funDec->GetStmtList() == nullptr)
+    {
+        return FunCost();
+    }
+
+    for (int i = 0; i < mFunctions.Size(); ++i)
+    {
+        FunctionEntry& entry = mFunctions[i];
+        if (entry.mFunDec == funDec)
+        {
+            if (entry.mState == FUNCTION_IN_PROGRESS)
+            {
+                //recursion, there is no static bound
+                FunCost recursive;
+                recursive.mIsUnbounded = true;
+                return recursive;
+            }
+            return entry.mCost;
+        }
+    }
+
+    int index = mFunctions.Size();
+    FunctionEntry& newEntry = mFunctions.PushEmpty();
+    newEntry.mFunDec = funDec;
+    newEntry.mState = FUNCTION_IN_PROGRESS;
+
+    //push frame + body
+    FunCost cost = Seq(Instructions(1), Eval(funDec->GetStmtList()));
+
+    FunctionEntry& entry = mFunctions[index];
+    entry.mCost = cost;
+    entry.mState = FUNCTION_DONE;
+    return cost;
+}
+
+int CostEstimator::GetTripCount(StmtFor* forLoop)
+{
+    Exp* init = forLoop->GetInit();
+    Exp* cond = forLoop->GetCond();
+    Exp* update = forLoop->GetUpdate();
+    if (init == nullptr || cond == nullptr || update == nullptr ||
+        init->GetExpType() != Binop::sType || cond->GetExpType() != Binop::sType)
+    {
+        return -1;
+    }
+
+    //init must be i = <int immediate>
+    Binop* initBinop = static_cast<Binop*>(init);
+    if (initBinop->GetOp() != O_SET ||
+        initBinop->GetLhs()->GetExpType() != Idd::sType ||
+        initBinop->GetRhs()->GetExpType() != Imm::sType ||
+        initBinop->GetRhs()->GetTypeDesc()->GetAluEngine() != TypeDesc::E_INT)
+    {
+        return -1;
+    }
+    const char* var = static_cast<Idd*>(initBinop->GetLhs())->GetName();
+    long long start = static_cast<Imm*>(initBinop->GetRhs())->GetVariant().i[0];
+
+    //condition must be i <op> <int immediate>
+    Binop* condBinop = static_cast<Binop*>(cond);
+    if (condBinop->GetLhs()->GetExpType() != Idd::sType ||
+        Utils::Strcmp(static_cast<Idd*>(condBinop->GetLhs())->GetName(), var) ||
+        condBinop->GetRhs()->GetExpType() != Imm::sType ||
+        condBinop->GetRhs()->GetTypeDesc()->GetAluEngine() != TypeDesc::E_INT)
+    {
+        return -1;
+    }
+    long long end = static_cast<Imm*>(condBinop->GetRhs())->GetVariant().i[0];
+
+    //update must be ++i, i++, --i, i--, i = i + <int immediate> or i = i - <int immediate>
+    long long step = 0;
+    if (update->GetExpType() == Unop::sType)
+    {
+        Unop* unop = static_cast<Unop*>(update);
+        if (unop->GetExp()->GetExpType() == Idd::sType && !Utils::Strcmp(static_cast<Idd*>(unop->GetExp())->GetName(), var))
+        {
+            step = unop->GetOp() == O_INC ? 1 : (unop->GetOp() == O_DEC ? -1 : 0);
+        }
+    }
+    else if (update->GetExpType() == Binop::sType)
+    {
+        Binop* set = static_cast<Binop*>(update);
+        if (set->GetOp() == O_SET &&
+            set->GetLhs()->GetExpType() == Idd::sType &&
+            !Utils::Strcmp(static_cast<Idd*>(set->GetLhs())->GetName(), var) &&
+            set->GetRhs()->GetExpType() == Binop::sType)
+        {
+            Binop* inc = static_cast<Binop*>(set->GetRhs());
+            if (inc->GetLhs()->GetExpType() == Idd::sType &&
+                !Utils::Strcmp(static_cast<Idd*>(inc->GetLhs())->GetName(), var) &&
+                inc->GetRhs()->GetExpType() == Imm::sType &&
+                inc->GetRhs()->GetTypeDesc()->GetAluEngine() == TypeDesc::E_INT)
+            {
+                long long imm = static_cast<Imm*>(inc->GetRhs())->GetVariant().i[0];
+                step = inc->GetOp() == O_PLUS ? imm : (inc->GetOp() == O_MINUS ? -imm : 0);
+            }
+        }
+    }
+
+    if (step == 0)
+    {
+        return -1;
+    }
+
+    long long count = -1;
+    switch (condBinop->GetOp())
+    {
+    case O_LT:
+        count = step > 0 ? (end > start ? (end - start + step - 1) / step : 0) : -1;
+        break;
+    case O_LTE:
+        count = step > 0 ? (end >= start ? (end - start) / step + 1 : 0) : -1;
+        break;
+    case O_GT:
+        count = step < 0 ? (start > end ? (start - end - step - 1) / -step : 0) : -1;
+        break;
+    case O_GTE:
+        count = step < 0 ? (start >= end ? (start - end) / -step + 1 : 0) : -1;
+        break;
+    case O_NEQ:
+        count = ((end - start) % step == 0 && (end - start) / step >= 0) ? (end - start) / step : -1;
+        break;
+    default:
+        count = -1;
+    }
+
+    return count > sMaxCost ? sMaxCost : static_cast<int>(count);
+}
+
+void CostEstimator::Visit(Program* n)
+{
+    //functions get visited through their declarations, the global scope cost is not of interest
+    Eval(n->GetStmtList());
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(Exp* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(ExpList* n)
+{
+    FunCost cost;
+    for (ExpList* tail = n; tail != nullptr && tail->GetExp() != nullptr; tail = tail->GetTail())
+    {
+        cost = Seq(cost, Eval(tail->GetExp()));
+    }
+    mResult = cost;
+}
+
+void CostEstimator::Visit(Stmt* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(StmtList* n)
+{
+    FunCost cost;
+    for (StmtList* tail = n; tail != nullptr && tail->GetStmt() != nullptr; tail = tail->GetTail())
+    {
+        cost = Seq(cost, Eval(tail->GetStmt()));
+    }
+    mResult = cost;
+}
+
+void CostEstimator::Visit(ArgDec* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(ArgList* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(Idd* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(Binop* n)
+{
+    FunCost lhs = Eval(n->GetLhs());
+    FunCost rhs = Eval(n->GetRhs());
+    mResult = Seq(Seq(lhs, rhs), Instructions(1));
+}
+
+void CostEstimator::Visit(Unop* n)
+{
+    mResult = Seq(Eval(n->GetExp()), Instructions(1));
+}
+
+void CostEstimator::Visit(ArrayConstructor* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(FunCall* n)
+{
+    //every argument is evaluated and copied to the new frame, then the call and return
+    FunCost cost = Instructions(2);
+    for (ExpList* tail = n->GetArgs(); tail != nullptr && tail->GetExp() != nullptr; tail = tail->GetTail())
+    {
+        cost = Seq(cost, Seq(Eval(tail->GetExp()), Instructions(1)));
+    }
+
+    const FunDesc* desc = n->GetDesc();
+    if (desc != nullptr && desc->IsCallback())
+    {
+        cost = Seq(cost, Instructions(GetNativeCost(n->GetName())));
+    }
+    else if (desc != nullptr)
+    {
+        cost = Seq(cost, EvalFunction(desc->GetDec()));
+    }
+    mResult = cost;
+}
+
+void CostEstimator::Visit(Imm* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(StrImm* n)
+{
+    //insertion to the heap
+    mResult = Instructions(1);
+}
+
+void CostEstimator::Visit(StmtExp* n)
+{
+    mResult = Eval(n->GetExp());
+}
+
+void CostEstimator::Visit(StmtFunDec* n)
+{
+    EvalFunction(n);
+    //a declaration costs nothing where it is declared
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(StmtIfElse* n)
+{
+    //condition and jump, then the most expensive of the body or the rest of the chain
+    FunCost cond = n->GetExp() != nullptr ? Seq(Eval(n->GetExp()), Instructions(1)) : FunCost();
+    FunCost body = Eval(n->GetStmtList());
+    FunCost tail = Eval(n->GetTail());
+    mResult = Seq(cond, Max(body, tail));
+}
+
+void CostEstimator::Visit(StmtWhile* n)
+{
+    FunCost cond = Seq(Eval(n->GetExp()), Instructions(1));
+    FunCost iteration = Seq(Seq(cond, Eval(n->GetStmtList())), Instructions(1));
+    //the last condition check always happens
+    mResult = Seq(cond, RepeatUnknown(iteration));
+}
+
+void CostEstimator::Visit(StmtFor* n)
+{
+    FunCost init = Eval(n->GetInit());
+    FunCost cond = Seq(Eval(n->GetCond()), Instructions(1));
+    FunCost body = Eval(n->GetStmtList());
+    FunCost update = Eval(n->GetUpdate());
+    FunCost iteration = Seq(Seq(Seq(cond, body), update), Instructions(1));
+
+    int tripCount = GetTripCount(n);
+    FunCost loop = tripCount >= 0 ? Repeat(iteration, tripCount) : RepeatUnknown(iteration);
+    mResult = Seq(Seq(init, loop), cond);
+}
+
+void CostEstimator::Visit(StmtReturn* n)
+{
+    mResult = Seq(Eval(n->GetExp()), Instructions(1));
+}
+
+void CostEstimator::Visit(StmtStructDef* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(StmtEnumTypeDef* n)
+{
+    mResult = FunCost();
+}
+
+void CostEstimator::Visit(Annotations* n)
+{
+    mResult = FunCost();
+}
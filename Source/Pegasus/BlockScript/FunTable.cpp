@@ -20,6 +20,8 @@ using namespace Pegasus::BlockScript;
 using namespace Pegasus::BlockScript::Ast;
 
 FunTable::FunTable()
+: mNames(nullptr),
+  mFirstOverloads(nullptr)
 {
 }
 
@@ -30,18 +32,30 @@ FunTable::~FunTable()
 void FunTable::Initialize(Alloc::IAllocator* alloc)
 {
     mContainer.Initialize(alloc);
+    mNextOverloads.Initialize(alloc);
+    mNames.SetAllocator(alloc);
+    mFirstOverloads.SetAlloc(alloc);
 }
 
 void FunTable::Reset()
 {
     mContainer.Reset();
+    mNextOverloads.Reset();
+    mFirstOverloads.Clear();
+    mNames.Clear();
 }
 
-FunDesc* FunTable::Find(Ast::FunCall* funCall)
+int FunTable::FindFirstOverload(const char* name) const
 {
-    int sz = mContainer.Size();
+    //the text is hashed and compared to the interned names, without interning it
+    const int* index = mFirstOverloads.Find(name);
+    return index != nullptr ? *index : -1;
+}
 
-    for (int i = 0; i < sz; ++i)
+FunDesc* FunTable::Find(Ast::FunCall* funCall)
+{
+    //only the overloads of the same name can be compatible
+    for (int i = FindFirstOverload(funCall->GetName()); i != -1; i = mNextOverloads[i])
     {
         FunDesc& candidate = mContainer[i];
         if (candidate.IsCompatible(funCall))
@@ -58,7 +72,8 @@ FunDesc* FunTable::Insert(StmtFunDec* funDec)
 {
     int sz = mContainer.Size();
     FunDesc* foundDeclaration = nullptr;
-    for (int i = 0; i < sz; ++i)
+    int lastOverload = -1;
+    for (int i = FindFirstOverload(funDec->GetName()); i != -1; i = mNextOverloads[i])
     {
         FunDesc& candidate = mContainer[i];
         if (
@@ -76,6 +91,7 @@ FunDesc* FunTable::Insert(StmtFunDec* funDec)
                 foundDeclaration = &candidate;
             }
         }
+        lastOverload = i;
     }
 
     // no declaration found. Its ok! lets just register its implementation then :)
@@ -83,6 +99,15 @@ FunDesc* FunTable::Insert(StmtFunDec* funDec)
     {
         foundDeclaration = &(mContainer.PushEmpty());
         foundDeclaration->SetGuid(sz);
+        mNextOverloads.PushEmpty() = -1;
+        if (lastOverload == -1)
+        {
+            mFirstOverloads.Insert(mNames.Intern(funDec->GetName()), sz);
+        }
+        else
+        {
+            mNextOverloads[lastOverload] = sz;
+        }
     }
 
     foundDeclaration->Initialize(funDec);
@@ -13,13 +13,16 @@
 #include "Pegasus/BlockScript/IddStrPool.h"
 #include "Pegasus/Allocator/IAllocator.h"
 #include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Memcpy.h"
 
 using namespace Pegasus;
 using namespace Pegasus::BlockScript;
 
 IddStrPool::IddStrPool()
 : mAllocator(nullptr),
-  mStringCount(0)
+  mStringCount(0),
+  mInternTable(nullptr)
 {
 }
 
@@ -32,6 +35,7 @@ void IddStrPool::Initialize(Alloc::IAllocator* allocator)
 {
     PG_ASSERT(mStringCount == 0);
     mAllocator = allocator;
+    mInternTable.SetAllocator(allocator);
 }
 
 void IddStrPool::Clear()
@@ -42,6 +46,7 @@ void IddStrPool::Clear()
         mAllocator->Delete(mPages[i]);
     }
     mStringCount = 0;
+    mInternTable.Reset();
 }
 
 //lazily allocate a page (a set of strings) when required.
@@ -68,6 +73,27 @@ char* IddStrPool::AllocateString()
     }
 }
 
+char* IddStrPool::Intern(const char* str, int length)
+{
+    PG_ASSERT(length < sCharsPerString);
+    unsigned int hash = Utils::HashStr(str, length);
+    const char* found = mInternTable.Find(str, length, hash);
+    if (found != nullptr)
+    {
+        //pooled strings are handed out as mutable to match AllocateString
+        return const_cast<char*>(found);
+    }
+
+    char* newStr = AllocateString();
+    if (newStr != nullptr)
+    {
+        Utils::Memcpy(newStr, str, length);
+        newStr[length] = '\0';
+        mInternTable.Insert(newStr, length, hash);
+    }
+    return newStr;
+}
+
 void IddStrPool::AllocatePage()
 {
     if (GetPageCount() < sMaxPages)
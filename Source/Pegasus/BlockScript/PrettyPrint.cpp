@@ -592,6 +592,10 @@ void PrettyPrint::Visit(StmtEnumTypeDef* enumDef)
 
 void PrettyPrint::Visit(StmtStructDef* structDef)
 {
+    if (structDef->GetAnnotations() != nullptr)
+    {
+        Indent(); structDef->GetAnnotations()->Access(this); mStr("\n");
+    }
     Indent();mStr("struct\n"); mStr(structDef->GetName());
     Indent();mStr("{");
     ArgList* argList = structDef->GetArgList();
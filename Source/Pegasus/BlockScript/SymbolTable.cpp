@@ -191,6 +191,18 @@ TypeDesc* SymbolTable::CreateStarType()
     );
 }
 
+TypeDesc* SymbolTable::CreateStarType(const char* name, TypeDesc* childType, int count)
+{
+    TypeDesc::ModifierProperty modProp;
+    modProp.ArraySize = count;
+    return InternalCreateType(
+        TypeDesc::M_STAR,
+        name,
+        childType,
+        modProp
+    );
+}
+
 TypeDesc* SymbolTable::CreateArrayType(const char* name, TypeDesc* childType, int count)
 {
     TypeDesc::ModifierProperty modProp; 
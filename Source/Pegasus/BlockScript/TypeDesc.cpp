@@ -50,8 +50,22 @@ void TypeDesc::SetName(const char * typeName)
 
 bool TypeDesc::Equals(const TypeDesc* other) const
 {
-    return  other->mModifier == TypeDesc::M_STAR || mModifier == TypeDesc::M_STAR ||  //star means any type, so accept it
-            (
+    if (other->mModifier == TypeDesc::M_STAR || mModifier == TypeDesc::M_STAR)
+    {
+        const TypeDesc* star = mModifier == TypeDesc::M_STAR ? this : other;
+        const TypeDesc* target = star == this ? other : this;
+        if (star->mChild == nullptr)
+        {
+            return true; //star means any type, so accept it
+        }
+
+        //typed star (i.e. float4*), only accepts static arrays of its child type
+        return target->mChild != nullptr &&
+               (target->mModifier == TypeDesc::M_ARRAY || target->mModifier == TypeDesc::M_STAR) &&
+               star->mChild->Equals(target->mChild);
+    }
+
+    return  (
                 !Utils::Strcmp(mName, other->mName) &&
                 CmpStructProperty(other) &&
                 CmpEnumProperty(other) &&
@@ -166,6 +180,18 @@ bool TypeDesc::ComputeSize()
                 }
                 argList = argList->GetTail();                    
             }
+
+            if (structDef->GetLayout() == Ast::StmtStructDef::LAYOUT_STD140)
+            {
+                //members are aligned, the struct is padded to a multiple of 16 bytes
+                totalSize = 0;
+                for (argList = structDef->GetArgList(); argList != nullptr && argList->GetArgDec() != nullptr; argList = argList->GetTail())
+                {
+                    int memberEnd = argList->GetArgDec()->GetOffset() + argList->GetArgDec()->GetType()->GetByteSize();
+                    totalSize = memberEnd > totalSize ? memberEnd : totalSize;
+                }
+                totalSize = (totalSize + 15) & ~15;
+            }
             mByteSize = totalSize;
         }
         return true;
@@ -26,6 +26,8 @@ void TypeTable::Initialize(Alloc::IAllocator* alloc)
 {
     PG_ASSERT(mTypeDescPool.Size() == 0);
     mTypeDescPool.Initialize(alloc);
+    mNextTypeWithName.Initialize(alloc);
+    mFirstTypeWithName.SetAlloc(alloc);
     mEnumNodePool.Initialize(alloc);
     mPropertyNodePool.Initialize(alloc);
 }
@@ -33,6 +35,8 @@ void TypeTable::Initialize(Alloc::IAllocator* alloc)
 void TypeTable::Shutdown()
 {
     mTypeDescPool.Reset();
+    mNextTypeWithName.Reset();
+    mFirstTypeWithName.Clear();
     mEnumNodePool.Reset();
     mPropertyNodePool.Reset();
 }
@@ -50,26 +54,23 @@ TypeDesc* TypeTable::CreateType(
 )
 {
     PG_ASSERT(modifier != TypeDesc::M_INVALID);
-    int s = mTypeDescPool.Size();
+    int lastWithName = -1;
     if (modifier != TypeDesc::M_ARRAY)
     {
-        for (int i = 0; i < s; ++i)
+        //only the types with the same name can match
+        for (int i = FindFirstTypeIndex(name); i != -1; i = mNextTypeWithName[i])
         {
             TypeDesc* t = &mTypeDescPool[i];
             PG_ASSERT(t->GetModifier() != TypeDesc::M_INVALID);
             if (
-                !Utils::Strcmp(name, t->GetName())
+                    modifier == t->GetModifier() &&
+                    child == t->GetChild() &&
+                    modifierProperty == t->GetModifierProperty()
                )
             {
-                if (
-                        modifier == t->GetModifier() &&
-                        child == t->GetChild() &&
-                        modifierProperty == t->GetModifierProperty()
-                   )
-                {
-                    return t;
-                }
+                return t;
             }
+            lastWithName = i;
         }
     }
 
@@ -85,6 +86,19 @@ TypeDesc* TypeTable::CreateType(
     newDesc.SetPropertyNode(propertyNode);
     newDesc.SetPropertyCallback(getPropCallback);
 
+    mNextTypeWithName.PushEmpty() = -1;
+    if (modifier != TypeDesc::M_ARRAY)
+    {
+        if (lastWithName == -1)
+        {
+            mFirstTypeWithName.Insert(newDesc.GetName(), idx);
+        }
+        else
+        {
+            mNextTypeWithName[lastWithName] = idx;
+        }
+    }
+
     int newSize = 0;
     bool success = newDesc.ComputeSize();
     PG_ASSERTSTR(success, "Fail computing size for type!");
@@ -93,31 +107,23 @@ TypeDesc* TypeTable::CreateType(
     return &newDesc;
 }
 
+int TypeTable::FindFirstTypeIndex(const char* name) const
+{
+    const int* index = mFirstTypeWithName.Find(name);
+    return index != nullptr ? *index : -1;
+}
+
 const TypeDesc* TypeTable::GetTypeByName(const char* name) const
 {
-    int s = mTypeDescPool.Size();
-    for (int i = 0; i < s; ++i)
-    {
-        if(!Utils::Strcmp(name, mTypeDescPool[i].GetName()) && mTypeDescPool[i].GetModifier() != TypeDesc::M_ARRAY)
-        {
-            return &(mTypeDescPool[i]);
-        }
-    }
-    return nullptr;
+    int i = FindFirstTypeIndex(name);
+    return i != -1 ? &(mTypeDescPool[i]) : nullptr;
 }
 
 //!TODO: figure out how to recycle this code, and respect const correctness
 TypeDesc* TypeTable::GetTypeForPatching(const char* name)
 {
-    int s = mTypeDescPool.Size();
-    for (int i = 0; i < s; ++i)
-    {
-        if(!Utils::Strcmp(name, mTypeDescPool[i].GetName()) && mTypeDescPool[i].GetModifier() != TypeDesc::M_ARRAY)
-        {
-            return &(mTypeDescPool[i]);
-        }
-    }
-    return nullptr;
+    int i = FindFirstTypeIndex(name);
+    return i != -1 ? &(mTypeDescPool[i]) : nullptr;
 }
 
 bool TypeTable::FindEnumByName(const char* name, const EnumNode** outEnumNode, const TypeDesc** outEnumType) const
@@ -87,10 +87,6 @@
     #pragma warning(disable : 4065)
 
     #include "Pegasus/BlockScript/CompilerState.h"
-    #ifndef YY_EXTRA_TYPE
-    #define YY_EXTRA_TYPE Pegasus::BlockScript::CompilerState*
-    #endif
-
     #include "Pegasus/BlockScript/BlockScriptBuilder.h"
     #include "Pegasus/BlockScript/EventListeners.h"
     #include "Pegasus/BlockScript/BlockScriptAst.h"
@@ -100,12 +96,12 @@
     #include "Pegasus/BlockScript/TypeDesc.h"
     #include "Pegasus/BlockScript/IFileIncluder.h"
     #include "Pegasus/BlockScript/bs.parser.hpp"
-    #include "Pegasus/BlockScript/bs.lexer.hpp"
+    #include "Pegasus/BlockScript/BsLexer.h"
     #include "Pegasus/Memory/MemoryManager.h"
     
     #include "Pegasus/Core/Io.h"
 
-    #define BS_GlobalBuilder BS_get_extra(scanner)->mBuilder
+    #define BS_GlobalBuilder static_cast<Pegasus::BlockScript::BsLexer*>(scanner)->GetCompilerState()->mBuilder
     #define BS_BUILD(r, exp) if ((r = BS_GlobalBuilder->exp) == nullptr) YYERROR ;
     #define BS_CHECKLIST(l) if (l == nullptr) {BS_parseerror("Empty list element, syntax error."); YYERROR;}
 
@@ -117,16 +113,14 @@
     #include <stdio.h>
 
     // Pegasus hooks
-    extern bool BS_HasNext(void* scanner);
-
     void BS_ErrorDispatcher(BlockScriptBuilder* builder, const char* message) 
     {
         builder->IncErrorCount();
-        yyscan_t scanner = builder->GetScanner();
+        BsLexer* lexer = static_cast<BsLexer*>(builder->GetScanner());
         Container<IBlockScriptCompilerListener*>& listeners = builder->GetEventListeners();
         for (int i = 0; i < listeners.Size(); ++i)
         {
-            listeners[i]->OnCompilationError(builder->GetCurrentCompilationUnitTitle(), builder->GetCurrentLine(), message, scanner ? BS_get_text(scanner) : "");
+            listeners[i]->OnCompilationError(builder->GetCurrentCompilationUnitTitle(), builder->GetCurrentLine(), message, lexer ? lexer->GetTokenText() : "");
         }
     }
 
@@ -138,7 +132,7 @@
     //***************************************************//
 
 /* Line 371 of yacc.c  */
-#line 142 "bs.parser.cpp"
+#line 136 "bs.parser.cpp"
 
 # ifndef YY_NULL
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -232,7 +226,7 @@ extern int BS_debug;
 typedef union YYSTYPE
 {
 /* Line 387 of yacc.c  */
-#line 86 "bs.y"
+#line 80 "bs.y"
 
     int    token;
     int    integerValue;
@@ -247,7 +241,7 @@ typedef union YYSTYPE
 
 
 /* Line 387 of yacc.c  */
-#line 251 "bs.parser.cpp"
+#line 245 "bs.parser.cpp"
 } YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define yystype YYSTYPE /* obsolescent; will be withdrawn */
@@ -274,7 +268,7 @@ int BS_parse ();
 /* Copy the second part of user declarations.  */
 
 /* Line 390 of yacc.c  */
-#line 278 "bs.parser.cpp"
+#line 272 "bs.parser.cpp"
 
 #ifdef short
 # undef short
@@ -494,16 +488,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  49
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   835
+#define YYLAST   868
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  53
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  27
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  84
+#define YYNRULES  85
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  201
+#define YYNSTATES  207
 
 /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
 #define YYUNDEFTOK  2
@@ -554,14 +548,14 @@ static const yytype_uint8 yytranslate[] =
 static const yytype_uint16 yyprhs[] =
 {
        0,     0,     3,     5,     8,    10,    11,    14,    20,    24,
-      31,    35,    38,    46,    58,    65,    72,    81,    83,    87,
-      89,    92,    94,    96,    98,   106,   113,   114,   116,   122,
-     127,   128,   130,   134,   136,   140,   142,   144,   146,   151,
-     155,   157,   158,   160,   162,   167,   172,   177,   179,   181,
-     184,   187,   194,   201,   205,   209,   213,   217,   221,   225,
-     229,   233,   237,   241,   245,   249,   253,   257,   261,   266,
-     269,   274,   278,   281,   284,   285,   287,   291,   293,   294,
-     299,   301,   305,   308,   309
+      31,    35,    38,    46,    58,    65,    73,    80,    89,    91,
+      95,    97,   100,   102,   104,   106,   114,   121,   122,   124,
+     130,   135,   136,   138,   142,   144,   148,   150,   152,   154,
+     159,   163,   165,   166,   168,   170,   175,   180,   185,   187,
+     189,   192,   195,   202,   209,   213,   217,   221,   225,   229,
+     233,   237,   241,   245,   249,   253,   257,   261,   265,   269,
+     274,   277,   282,   286,   289,   292,   293,   295,   299,   301,
+     302,   307,   309,   313,   316,   317
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
@@ -573,46 +567,47 @@ static const yytype_int8 yyrhs[] =
       -1,    20,    74,    11,    -1,    66,    70,    -1,    62,    12,
       74,    13,    14,    55,    15,    -1,    63,    12,    75,    11,
       75,    11,    75,    13,    14,    55,    15,    -1,    57,     5,
-      14,    78,    15,    11,    -1,    24,     5,    14,    69,    15,
-      11,    -1,     8,    12,    74,    60,    55,    15,    64,    67,
-      -1,    23,    -1,    59,    72,    13,    -1,    28,    -1,    13,
-      14,    -1,    77,    -1,    21,    -1,    22,    -1,    64,    65,
-      12,    74,    60,    55,    15,    -1,    65,    12,    74,    60,
-      55,    15,    -1,    -1,     9,    -1,    61,     5,    12,    76,
-      13,    -1,    68,    14,    55,    15,    -1,    -1,    10,    -1,
-      69,    18,     5,    -1,     5,    -1,    14,    55,    15,    -1,
-      11,    -1,     4,    -1,     3,    -1,    26,    12,    77,    13,
-      -1,    72,    18,    74,    -1,    74,    -1,    -1,     5,    -1,
-      73,    -1,     5,    12,    72,    13,    -1,     6,    12,    72,
-      13,    -1,    25,    37,    77,    36,    -1,     7,    -1,    71,
-      -1,    45,    74,    -1,    46,    74,    -1,    74,    47,     5,
-      12,    72,    13,    -1,    74,    47,     6,    12,    72,    13,
-      -1,    74,    42,    74,    -1,    74,    29,    74,    -1,    74,
-      30,    74,    -1,    74,    31,    74,    -1,    74,    32,    74,
-      -1,    74,    33,    74,    -1,    74,    34,    74,    -1,    74,
-      35,    74,    -1,    74,    40,    74,    -1,    74,    41,    74,
-      -1,    74,    37,    74,    -1,    74,    36,    74,    -1,    74,
-      39,    74,    -1,    74,    38,    74,    -1,    74,    43,    73,
-      -1,    74,    16,    74,    17,    -1,    30,    74,    -1,    12,
-      77,    13,    74,    -1,    12,    74,    13,    -1,    74,    45,
-      -1,    74,    46,    -1,    -1,    74,    -1,    76,    18,    79,
-      -1,    79,    -1,    -1,    77,    16,     4,    17,    -1,     6,
-      -1,    78,    79,    11,    -1,    79,    11,    -1,    -1,     5,
-      19,    77,    -1
+      14,    78,    15,    11,    -1,    58,    57,     5,    14,    78,
+      15,    11,    -1,    24,     5,    14,    69,    15,    11,    -1,
+       8,    12,    74,    60,    55,    15,    64,    67,    -1,    23,
+      -1,    59,    72,    13,    -1,    28,    -1,    13,    14,    -1,
+      77,    -1,    21,    -1,    22,    -1,    64,    65,    12,    74,
+      60,    55,    15,    -1,    65,    12,    74,    60,    55,    15,
+      -1,    -1,     9,    -1,    61,     5,    12,    76,    13,    -1,
+      68,    14,    55,    15,    -1,    -1,    10,    -1,    69,    18,
+       5,    -1,     5,    -1,    14,    55,    15,    -1,    11,    -1,
+       4,    -1,     3,    -1,    26,    12,    77,    13,    -1,    72,
+      18,    74,    -1,    74,    -1,    -1,     5,    -1,    73,    -1,
+       5,    12,    72,    13,    -1,     6,    12,    72,    13,    -1,
+      25,    37,    77,    36,    -1,     7,    -1,    71,    -1,    45,
+      74,    -1,    46,    74,    -1,    74,    47,     5,    12,    72,
+      13,    -1,    74,    47,     6,    12,    72,    13,    -1,    74,
+      42,    74,    -1,    74,    29,    74,    -1,    74,    30,    74,
+      -1,    74,    31,    74,    -1,    74,    32,    74,    -1,    74,
+      33,    74,    -1,    74,    34,    74,    -1,    74,    35,    74,
+      -1,    74,    40,    74,    -1,    74,    41,    74,    -1,    74,
+      37,    74,    -1,    74,    36,    74,    -1,    74,    39,    74,
+      -1,    74,    38,    74,    -1,    74,    43,    73,    -1,    74,
+      16,    74,    17,    -1,    30,    74,    -1,    12,    77,    13,
+      74,    -1,    12,    74,    13,    -1,    74,    45,    -1,    74,
+      46,    -1,    -1,    74,    -1,    76,    18,    79,    -1,    79,
+      -1,    -1,    77,    16,     4,    17,    -1,     6,    -1,    78,
+      79,    11,    -1,    79,    11,    -1,    -1,     5,    19,    77,
+      -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   189,   189,   192,   201,   202,   205,   206,   207,   208,
-     223,   224,   225,   229,   233,   234,   251,   272,   275,   278,
-     282,   285,   288,   291,   294,   308,   312,   315,   320,   323,
-     324,   327,   330,   339,   346,   347,   350,   351,   352,   359,
-     368,   369,   372,   375,   376,   377,   378,   379,   380,   381,
-     382,   383,   384,   385,   386,   387,   388,   389,   390,   391,
-     392,   393,   394,   395,   396,   397,   398,   399,   400,   401,
-     402,   403,   404,   405,   408,   409,   412,   421,   422,   425,
-     464,   479,   488,   489,   492
+       0,   183,   183,   186,   195,   196,   199,   200,   201,   202,
+     217,   218,   219,   223,   227,   228,   229,   246,   267,   270,
+     273,   277,   280,   283,   286,   289,   303,   307,   310,   315,
+     318,   319,   322,   325,   334,   341,   342,   345,   346,   347,
+     354,   363,   364,   367,   370,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
+     396,   397,   398,   399,   400,   403,   404,   407,   416,   417,
+     420,   459,   474,   483,   484,   487
 };
 #endif
 
@@ -657,28 +652,28 @@ static const yytype_uint16 yytoknum[] =
 static const yytype_uint8 yyr1[] =
 {
        0,    53,    54,    55,    55,    55,    56,    56,    56,    56,
-      56,    56,    56,    56,    56,    56,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    64,    64,    65,    66,    67,
-      67,    68,    69,    69,    70,    70,    71,    71,    71,    72,
-      72,    72,    73,    74,    74,    74,    74,    74,    74,    74,
+      56,    56,    56,    56,    56,    56,    56,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    64,    64,    65,    66,
+      67,    67,    68,    69,    69,    70,    70,    71,    71,    71,
+      72,    72,    72,    73,    74,    74,    74,    74,    74,    74,
       74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
       74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
-      74,    74,    74,    74,    75,    75,    76,    76,    76,    77,
-      77,    78,    78,    78,    79
+      74,    74,    74,    74,    74,    75,    75,    76,    76,    76,
+      77,    77,    78,    78,    78,    79
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
 static const yytype_uint8 yyr2[] =
 {
        0,     2,     1,     2,     1,     0,     2,     5,     3,     6,
-       3,     2,     7,    11,     6,     6,     8,     1,     3,     1,
-       2,     1,     1,     1,     7,     6,     0,     1,     5,     4,
-       0,     1,     3,     1,     3,     1,     1,     1,     4,     3,
-       1,     0,     1,     1,     4,     4,     4,     1,     1,     2,
-       2,     6,     6,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     4,     2,
-       4,     3,     2,     2,     0,     1,     3,     1,     0,     4,
-       1,     3,     2,     0,     3
+       3,     2,     7,    11,     6,     7,     6,     8,     1,     3,
+       1,     2,     1,     1,     1,     7,     6,     0,     1,     5,
+       4,     0,     1,     3,     1,     3,     1,     1,     1,     4,
+       3,     1,     0,     1,     1,     4,     4,     4,     1,     1,
+       2,     2,     6,     6,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     4,
+       2,     4,     3,     2,     2,     0,     1,     3,     1,     0,
+       4,     1,     3,     2,     0,     3
 };
 
 /* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
@@ -686,71 +681,71 @@ static const yytype_uint8 yyr2[] =
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       5,    37,    36,    42,    80,    47,     0,     0,     0,    22,
-      23,    17,     0,     0,     0,     0,    19,     0,     0,     0,
-       0,     2,     4,     0,     0,    41,     0,     0,     0,     0,
-      48,    43,     0,    21,    41,    41,     0,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    69,    49,    50,     1,
-       3,     0,     0,     0,     0,    40,     0,     0,    74,    35,
-       5,    11,     6,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    72,
-      73,     0,     0,     0,     0,     0,    71,     0,    10,     0,
-      80,     0,     0,     0,    83,     0,     8,    18,     0,    78,
-       0,    75,     0,     0,     0,    54,    55,    56,    57,    58,
-      59,    60,    64,    63,    66,    65,    61,    62,    53,    67,
-       0,     0,     0,    44,    45,     0,     5,    70,    33,     0,
-      46,    38,     0,     0,     0,     0,     0,    39,     0,    77,
-       0,    74,    34,    68,    41,    41,    79,    20,     0,     0,
-       0,     7,     0,     0,     0,    82,     0,    28,     0,     5,
-       0,     0,     0,    26,    15,    32,    84,    14,    81,     9,
-      76,     0,    74,    51,    52,    27,    30,     0,    12,     0,
-      31,     0,    16,     0,     0,     0,     0,     5,     0,     5,
-       0,     0,     5,     0,     5,    29,     0,    13,     0,    25,
-      24
+       5,    38,    37,    43,    81,    48,     0,     0,     0,    23,
+      24,    18,     0,     0,     0,     0,    20,     0,     0,     0,
+       0,     2,     4,     0,     0,    42,     0,     0,     0,     0,
+      49,    44,     0,    22,    42,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,    43,     0,    70,    50,    51,     1,
+       3,     0,     0,     0,     0,     0,    41,     0,     0,    75,
+      36,     5,    11,     6,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      73,    74,     0,     0,     0,     0,     0,    72,     0,    10,
+       0,    81,     0,     0,     0,    84,     0,     0,     8,    19,
+       0,    79,     0,    76,     0,     0,     0,    55,    56,    57,
+      58,    59,    60,    61,    65,    64,    67,    66,    62,    63,
+      54,    68,     0,     0,     0,    45,    46,     0,     5,    71,
+      34,     0,    47,    39,     0,     0,     0,     0,     0,    84,
+      40,     0,    78,     0,    75,    35,    69,    42,    42,    80,
+      21,     0,     0,     0,     7,     0,     0,     0,    83,     0,
+       0,    29,     0,     5,     0,     0,     0,    27,    16,    33,
+      85,    14,    82,     9,     0,    77,     0,    75,    52,    53,
+      28,    31,     0,    15,    12,     0,    32,     0,    17,     0,
+       0,     0,     0,     5,     0,     5,     0,     0,     5,     0,
+       5,    30,     0,    13,     0,    26,    25
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    20,    21,    22,    23,    24,    25,   126,    26,    27,
-      28,   176,   177,    29,   182,   183,   129,    61,    30,    54,
-      31,    32,   102,   138,    33,   134,   135
+      -1,    20,    21,    22,    23,    24,    25,   128,    26,    27,
+      28,   181,   182,    29,   188,   189,   131,    62,    30,    55,
+      31,    32,   104,   141,    33,   136,   137
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -150
+#define YYPACT_NINF -172
 static const yytype_int16 yypact[] =
 {
-     374,  -150,  -150,    -4,     3,  -150,    18,   106,   402,  -150,
-    -150,  -150,    19,    38,    43,    72,  -150,   402,   402,   402,
-      81,   374,  -150,    83,    94,   402,    91,    92,    95,    12,
-    -150,  -150,   420,    87,   402,   402,   402,   587,    77,     3,
-     453,   100,   102,   102,  -150,    84,     5,     5,     5,  -150,
-    -150,   109,    72,   486,    34,   717,   115,   402,   402,  -150,
-     374,  -150,  -150,   402,   402,   402,   402,   402,   402,   402,
-     402,   402,   402,   402,   402,   402,   402,   402,    72,  -150,
-    -150,    48,   124,    58,    61,   622,  -150,   402,  -150,   128,
-    -150,     9,    89,   402,   130,   104,  -150,  -150,   402,   130,
-     657,   717,   131,   178,   689,   -12,   -12,   564,    -3,   394,
-     769,   769,   788,   788,   788,   788,   125,   125,   745,  -150,
-     132,   137,   149,  -150,  -150,   155,   374,     5,  -150,   107,
-    -150,  -150,   519,   157,    17,   163,   402,   717,    65,  -150,
-     173,   402,  -150,  -150,   402,   402,  -150,  -150,   206,   177,
-     184,  -150,   102,   180,   181,  -150,   552,  -150,   130,   374,
-     183,    71,    74,   186,  -150,  -150,    87,  -150,  -150,  -150,
-    -150,   234,   402,  -150,  -150,  -150,    85,   185,  -150,   194,
-    -150,   203,  -150,   182,   402,   202,   402,   374,   622,   374,
-     622,   262,   374,   290,   374,  -150,   318,  -150,   346,  -150,
-    -150
+     383,  -172,  -172,    28,    35,  -172,    42,   411,   428,  -172,
+    -172,  -172,    81,    55,    85,    96,  -172,   428,   428,   428,
+     107,   383,  -172,   125,    73,   428,   128,   123,   131,    10,
+    -172,  -172,   448,   130,   428,   428,   428,   615,    40,    35,
+     481,   134,   138,   138,  -172,   103,   -11,   -11,   -11,  -172,
+    -172,   137,    96,   148,   514,    37,   745,   154,   428,   428,
+    -172,   383,  -172,  -172,   428,   428,   428,   428,   428,   428,
+     428,   428,   428,   428,   428,   428,   428,   428,   428,    96,
+    -172,  -172,   109,   156,    70,    71,   650,  -172,   428,  -172,
+     162,  -172,     6,    78,   428,   163,   132,   161,  -172,  -172,
+     428,   163,   685,   745,   165,   187,   717,   -12,   -12,    -2,
+      59,   821,   126,   126,    79,    79,    79,    79,   773,   773,
+     797,  -172,   166,   167,   160,  -172,  -172,   172,   383,   -11,
+    -172,    98,  -172,  -172,   547,   169,    11,   170,   428,   163,
+     745,   110,  -172,   182,   428,  -172,  -172,   428,   428,  -172,
+    -172,   215,   186,   175,  -172,   138,   189,   190,  -172,   580,
+      34,  -172,   163,   383,   192,   114,   116,   195,  -172,  -172,
+     130,  -172,  -172,  -172,   194,  -172,   243,   428,  -172,  -172,
+    -172,   129,   204,  -172,  -172,   185,  -172,   212,  -172,   211,
+     428,   214,   428,   383,   650,   383,   650,   271,   383,   299,
+     383,  -172,   327,  -172,   355,  -172,  -172
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -150,  -150,   -44,   -18,  -150,  -150,  -150,  -149,  -150,  -150,
-    -150,  -150,    41,  -150,  -150,  -150,  -150,  -150,  -150,   -28,
-      -6,    -7,  -136,  -150,    -5,  -150,   -85
+    -172,  -172,   -46,   -15,   202,  -172,  -172,  -171,  -172,  -172,
+    -172,  -172,    25,  -172,  -172,  -172,  -172,  -172,  -172,   -27,
+      -6,    -7,  -141,  -172,    -5,    90,   -88
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
@@ -759,184 +754,190 @@ static const yytype_int16 yypgoto[] =
 #define YYTABLE_NINF -1
 static const yytype_uint8 yytable[] =
 {
-      37,    40,    38,    50,    63,   160,    83,    84,    34,    45,
-      46,    47,    48,    63,   139,    35,   103,    53,    55,    66,
-      67,    63,   133,    59,    41,    82,    60,    55,    55,    85,
-      36,    78,   153,    79,    80,    81,   179,    91,    92,   192,
-      78,   194,    79,    80,    81,   130,    95,    97,    78,   154,
-     100,   101,    98,   120,   121,    43,   104,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
-     118,   123,   119,   170,   124,    42,    98,    44,   157,    98,
-     127,    49,   148,   158,   173,    50,   132,   174,    51,    98,
-      87,   137,    98,    82,   175,   180,    56,     1,     2,     3,
-      39,     5,   131,    82,    57,    82,     7,    58,    90,     1,
-       2,     3,     4,     5,    89,   171,   161,   162,     7,    13,
-      14,    52,   149,    94,    17,   150,    93,    99,   122,   156,
-      50,    13,    14,   128,   101,   133,    17,    55,    55,    18,
-      19,    63,   141,   191,   144,   193,   136,   166,   196,   145,
-     198,    18,    19,    50,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,   101,   146,    77,    78,   147,
-      79,    80,    81,    50,   155,    50,   152,   188,    50,   190,
-      50,     1,     2,     3,     4,     5,     6,   159,   164,   165,
-       7,   167,   168,   142,   172,   175,   187,   184,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,   185,    17,     1,
-       2,     3,     4,     5,     6,   186,   189,   181,     7,     0,
-       0,   163,     0,    18,    19,     0,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,     0,    17,     1,     2,     3,
-       4,     5,     6,     0,     0,     0,     7,     0,     0,   178,
-       0,    18,    19,     0,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,     0,    17,     1,     2,     3,     4,     5,
-       6,     0,     0,     0,     7,     0,     0,   195,     0,    18,
-      19,     0,     8,     9,    10,    11,    12,    13,    14,    15,
-      16,     0,    17,     1,     2,     3,     4,     5,     6,     0,
-       0,     0,     7,     0,     0,   197,     0,    18,    19,     0,
-       8,     9,    10,    11,    12,    13,    14,    15,    16,     0,
-      17,     1,     2,     3,     4,     5,     6,     0,     0,     0,
-       7,     0,     0,   199,     0,    18,    19,     0,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,     0,    17,     1,
-       2,     3,     4,     5,     6,     0,     0,     0,     7,     0,
-       0,   200,     0,    18,    19,     0,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,     0,    17,     1,     2,     3,
-       4,     5,     6,     0,     0,     0,     7,     0,     0,     0,
-       0,    18,    19,     0,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,     0,    17,     1,     2,     3,    39,     5,
-      63,     0,     0,     0,     7,     0,     0,     0,     0,    18,
-      19,     0,     0,    64,    65,    66,    67,    13,    14,     0,
-       0,    62,    17,     0,     0,     0,    63,    78,     0,    79,
-      80,    81,     0,     0,     0,     0,     0,    18,    19,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    88,    79,    80,    81,     0,    63,
+      37,    40,    38,   164,    64,    64,    50,    84,    85,    45,
+      46,    47,    48,   142,    64,   105,   135,    54,    56,    67,
+      68,    60,    83,   198,    61,   200,   156,    56,    56,    86,
+      68,    79,    79,    80,    81,    82,   185,    92,    93,   135,
+      34,    79,   132,    80,    81,    82,    96,    35,   157,   174,
+      99,   102,   103,    88,    36,   100,    83,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   157,   121,   175,    64,     1,     2,     3,    39,
+       5,   129,   151,   125,   126,     7,    41,   134,   100,   100,
+      50,   133,    42,   140,    83,    64,    11,    43,    13,    14,
+      52,    44,    79,    17,    80,    81,    82,    49,    65,    66,
+      67,    68,    69,   152,   122,   123,   153,   176,    18,    19,
+     165,   166,    79,   161,    80,    81,    82,   178,   162,   179,
+      51,   159,   100,    57,   100,    58,    50,   103,   180,   186,
+      56,    56,    64,    59,    91,    94,    83,   197,    90,   199,
+     170,    95,   202,    97,   204,    65,    66,    67,    68,    69,
+     124,    50,    72,    73,    74,    75,   101,   130,   135,    79,
+     103,    80,    81,    82,   138,   139,   144,   149,   147,   148,
+     169,   158,    50,   194,    50,   196,   150,    50,   155,    50,
+       1,     2,     3,     4,     5,     6,   163,   168,   191,     7,
+     171,   172,   145,   177,   180,   183,   187,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,   190,    17,     1,     2,
+       3,     4,     5,     6,   192,   193,    53,     7,   195,   160,
+     167,     0,    18,    19,     0,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,     0,    17,     1,     2,     3,     4,
+       5,     6,     0,     0,     0,     7,     0,     0,   184,     0,
+      18,    19,     0,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,     0,    17,     1,     2,     3,     4,     5,     6,
+       0,     0,     0,     7,     0,     0,   201,     0,    18,    19,
+       0,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+       0,    17,     1,     2,     3,     4,     5,     6,     0,     0,
+       0,     7,     0,     0,   203,     0,    18,    19,     0,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,     0,    17,
+       1,     2,     3,     4,     5,     6,     0,     0,     0,     7,
+       0,     0,   205,     0,    18,    19,     0,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,     0,    17,     1,     2,
+       3,     4,     5,     6,     0,     0,     0,     7,     0,     0,
+     206,     0,    18,    19,     0,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,     0,    17,     1,     2,     3,     4,
+       5,     6,     0,     0,     0,     7,     0,     0,     0,     0,
+      18,    19,     0,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,     0,    17,     1,     2,     3,     4,     5,     0,
+       0,     0,     0,     7,     0,     0,     0,     0,    18,    19,
+       0,     1,     2,     3,    39,     5,    13,    14,     0,     0,
+       7,    17,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    13,    14,     0,    18,    19,    17,    63,
+       0,     0,     0,     0,    64,     0,     0,     0,     0,     0,
+       0,     0,     0,    18,    19,     0,     0,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    89,    80,    81,    82,     0,    64,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    77,    78,    96,    79,    80,
-      81,     0,    63,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    64,    65,    66,    67,    68,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    98,    80,    81,    82,     0,
+      64,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,   154,    80,
+      81,    82,     0,    64,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    65,    66,    67,    68,
       69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-     151,    79,    80,    81,     0,    63,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    64,    65,
+      79,   173,    80,    81,    82,     0,    64,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    65,
       66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,   169,    79,    80,    81,     0,    63,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,    67,    79,    80,    81,
-      86,     0,     0,    63,     0,     0,     0,    78,     0,    79,
-      80,    81,     0,     0,     0,     0,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,     0,    79,    80,    81,   125,     0,     0,    63,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,     0,    79,    80,    81,
-     140,     0,     0,    63,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,     0,    79,    80,    81,    63,   143,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    64,    65,
+      76,    77,    78,    79,     0,    80,    81,    82,    87,     0,
+       0,    64,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,     0,
+      80,    81,    82,   127,     0,     0,    64,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    65,
       66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    63,    79,    80,    81,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,    63,    79,    80,    81,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    63,     0,     0,    78,     0,
-      79,    80,    81,     0,     0,     0,     0,     0,    64,    65,
-      66,    67,    68,     0,    63,    71,    72,    73,    74,     0,
-       0,     0,    78,     0,    79,    80,    81,    64,    65,    66,
-      67,    68,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    78,     0,    79,    80,    81
+      76,    77,    78,    79,     0,    80,    81,    82,   143,     0,
+       0,    64,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,     0,
+      80,    81,    82,    64,   146,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    64,    80,    81,    82,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    64,
+      80,    81,    82,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    64,     0,    78,    79,     0,    80,    81,
+      82,     0,     0,     0,     0,     0,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    64,     0,     0,
+      79,     0,    80,    81,    82,     0,     0,     0,     0,     0,
+      65,    66,    67,    68,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    79,     0,    80,    81,    82
 };
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-150)))
+  (!!((Yystate) == (-172)))
 
 #define yytable_value_is_error(Yytable_value) \
   YYID (0)
 
 static const yytype_int16 yycheck[] =
 {
-       7,     8,     7,    21,    16,   141,    34,    35,    12,    15,
-      17,    18,    19,    16,    99,    12,    60,    24,    25,    31,
-      32,    16,     5,    11,     5,    16,    14,    34,    35,    36,
-      12,    43,    15,    45,    46,    47,   172,    42,    43,   188,
-      43,   190,    45,    46,    47,    36,    52,    13,    43,   134,
-      57,    58,    18,     5,     6,    12,    63,    64,    65,    66,
+       7,     8,     7,   144,    16,    16,    21,    34,    35,    15,
+      17,    18,    19,   101,    16,    61,     5,    24,    25,    31,
+      32,    11,    16,   194,    14,   196,    15,    34,    35,    36,
+      32,    43,    43,    45,    46,    47,   177,    42,    43,     5,
+      12,    43,    36,    45,    46,    47,    52,    12,   136,    15,
+      13,    58,    59,    13,    12,    18,    16,    64,    65,    66,
       67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
-      77,    13,    78,   158,    13,    37,    18,     5,    13,    18,
-      87,     0,   126,    18,    13,   103,    93,    13,     5,    18,
-      13,    98,    18,    16,     9,    10,     5,     3,     4,     5,
-       6,     7,    13,    16,    12,    16,    12,    12,     6,     3,
-       4,     5,     6,     7,    14,   159,   144,   145,    12,    25,
-      26,    27,    15,    14,    30,    18,    42,    12,     4,   136,
-     148,    25,    26,     5,   141,     5,    30,   144,   145,    45,
-      46,    16,    11,   187,    12,   189,    42,   152,   192,    12,
-     194,    45,    46,   171,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,   172,    17,    42,    43,    14,
-      45,    46,    47,   191,    11,   193,    19,   184,   196,   186,
-     198,     3,     4,     5,     6,     7,     8,    14,    11,     5,
-      12,    11,    11,    15,    11,     9,    14,    12,    20,    21,
-      22,    23,    24,    25,    26,    27,    28,    13,    30,     3,
-       4,     5,     6,     7,     8,    12,    14,   176,    12,    -1,
-      -1,    15,    -1,    45,    46,    -1,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    -1,    30,     3,     4,     5,
-       6,     7,     8,    -1,    -1,    -1,    12,    -1,    -1,    15,
-      -1,    45,    46,    -1,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    -1,    30,     3,     4,     5,     6,     7,
-       8,    -1,    -1,    -1,    12,    -1,    -1,    15,    -1,    45,
-      46,    -1,    20,    21,    22,    23,    24,    25,    26,    27,
-      28,    -1,    30,     3,     4,     5,     6,     7,     8,    -1,
-      -1,    -1,    12,    -1,    -1,    15,    -1,    45,    46,    -1,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    -1,
-      30,     3,     4,     5,     6,     7,     8,    -1,    -1,    -1,
-      12,    -1,    -1,    15,    -1,    45,    46,    -1,    20,    21,
-      22,    23,    24,    25,    26,    27,    28,    -1,    30,     3,
-       4,     5,     6,     7,     8,    -1,    -1,    -1,    12,    -1,
-      -1,    15,    -1,    45,    46,    -1,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    -1,    30,     3,     4,     5,
-       6,     7,     8,    -1,    -1,    -1,    12,    -1,    -1,    -1,
-      -1,    45,    46,    -1,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    -1,    30,     3,     4,     5,     6,     7,
-      16,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    45,
-      46,    -1,    -1,    29,    30,    31,    32,    25,    26,    -1,
-      -1,    11,    30,    -1,    -1,    -1,    16,    43,    -1,    45,
-      46,    47,    -1,    -1,    -1,    -1,    -1,    45,    46,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    11,    45,    46,    47,    -1,    16,
+      77,    78,   160,    79,   162,    16,     3,     4,     5,     6,
+       7,    88,   128,    13,    13,    12,     5,    94,    18,    18,
+     105,    13,    37,   100,    16,    16,    23,    12,    25,    26,
+      27,     5,    43,    30,    45,    46,    47,     0,    29,    30,
+      31,    32,    33,    15,     5,     6,    18,   163,    45,    46,
+     147,   148,    43,    13,    45,    46,    47,    13,    18,    13,
+       5,   138,    18,     5,    18,    12,   151,   144,     9,    10,
+     147,   148,    16,    12,     6,    42,    16,   193,    14,   195,
+     155,    14,   198,     5,   200,    29,    30,    31,    32,    33,
+       4,   176,    36,    37,    38,    39,    12,     5,     5,    43,
+     177,    45,    46,    47,    42,    14,    11,    17,    12,    12,
+       5,    11,   197,   190,   199,   192,    14,   202,    19,   204,
+       3,     4,     5,     6,     7,     8,    14,    11,    13,    12,
+      11,    11,    15,    11,     9,    11,   181,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    12,    30,     3,     4,
+       5,     6,     7,     8,    12,    14,    24,    12,    14,   139,
+      15,    -1,    45,    46,    -1,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    -1,    30,     3,     4,     5,     6,
+       7,     8,    -1,    -1,    -1,    12,    -1,    -1,    15,    -1,
+      45,    46,    -1,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    -1,    30,     3,     4,     5,     6,     7,     8,
+      -1,    -1,    -1,    12,    -1,    -1,    15,    -1,    45,    46,
+      -1,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      -1,    30,     3,     4,     5,     6,     7,     8,    -1,    -1,
+      -1,    12,    -1,    -1,    15,    -1,    45,    46,    -1,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    -1,    30,
+       3,     4,     5,     6,     7,     8,    -1,    -1,    -1,    12,
+      -1,    -1,    15,    -1,    45,    46,    -1,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    -1,    30,     3,     4,
+       5,     6,     7,     8,    -1,    -1,    -1,    12,    -1,    -1,
+      15,    -1,    45,    46,    -1,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    -1,    30,     3,     4,     5,     6,
+       7,     8,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,
+      45,    46,    -1,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    -1,    30,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    45,    46,
+      -1,     3,     4,     5,     6,     7,    25,    26,    -1,    -1,
+      12,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    25,    26,    -1,    45,    46,    30,    11,
+      -1,    -1,    -1,    -1,    16,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    46,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    11,    45,    46,    47,    -1,    16,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    11,    45,    46,
-      47,    -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      11,    45,    46,    47,    -1,    16,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    11,    45,    46,    47,    -1,    16,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      16,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    32,    45,    46,    47,
-      13,    -1,    -1,    16,    -1,    -1,    -1,    43,    -1,    45,
-      46,    47,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    -1,    45,    46,    47,    13,    -1,    -1,    16,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    -1,    45,    46,    47,
-      13,    -1,    -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    11,    45,    46,    47,    -1,
+      16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    11,    45,
+      46,    47,    -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
       33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    -1,    45,    46,    47,    16,    17,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    16,    45,    46,    47,    -1,    -1,    -1,
+      43,    11,    45,    46,    47,    -1,    16,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    -1,    45,    46,    47,    13,    -1,
+      -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    -1,
+      45,    46,    47,    13,    -1,    -1,    16,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    -1,    45,    46,    47,    13,    -1,
+      -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    -1,
+      45,    46,    47,    16,    17,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
       33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
       43,    16,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    16,    -1,    -1,    43,    -1,
-      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    29,    30,
-      31,    32,    33,    -1,    16,    36,    37,    38,    39,    -1,
-      -1,    -1,    43,    -1,    45,    46,    47,    29,    30,    31,
-      32,    33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    43,    -1,    45,    46,    47
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    16,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    16,    -1,    42,    43,    -1,    45,    46,
+      47,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    16,    -1,    -1,
+      43,    -1,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    31,    32,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    43,    -1,    45,    46,    47
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -948,22 +949,22 @@ static const yytype_uint8 yystos[] =
       54,    55,    56,    57,    58,    59,    61,    62,    63,    66,
       71,    73,    74,    77,    12,    12,    12,    74,    77,     6,
       74,     5,    37,    12,     5,    73,    74,    74,    74,     0,
-      56,     5,    27,    74,    72,    74,     5,    12,    12,    11,
-      14,    70,    11,    16,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    45,
-      46,    47,    16,    72,    72,    74,    13,    13,    11,    14,
-       6,    77,    77,    42,    14,    73,    11,    13,    18,    12,
-      74,    74,    75,    55,    74,    74,    74,    74,    74,    74,
-      74,    74,    74,    74,    74,    74,    74,    74,    74,    73,
-       5,     6,     4,    13,    13,    13,    60,    74,     5,    69,
-      36,    13,    74,     5,    78,    79,    42,    74,    76,    79,
-      13,    11,    15,    17,    12,    12,    17,    14,    55,    15,
-      18,    11,    19,    15,    79,    11,    74,    13,    18,    14,
-      75,    72,    72,    15,    11,     5,    77,    11,    11,    11,
-      79,    55,    11,    13,    13,     9,    64,    65,    15,    75,
-      10,    65,    67,    68,    12,    13,    12,    14,    74,    14,
-      74,    55,    60,    55,    60,    15,    55,    15,    55,    15,
-      15
+      56,     5,    27,    57,    74,    72,    74,     5,    12,    12,
+      11,    14,    70,    11,    16,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      45,    46,    47,    16,    72,    72,    74,    13,    13,    11,
+      14,     6,    77,    77,    42,    14,    73,     5,    11,    13,
+      18,    12,    74,    74,    75,    55,    74,    74,    74,    74,
+      74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
+      74,    73,     5,     6,     4,    13,    13,    13,    60,    74,
+       5,    69,    36,    13,    74,     5,    78,    79,    42,    14,
+      74,    76,    79,    13,    11,    15,    17,    12,    12,    17,
+      14,    55,    15,    18,    11,    19,    15,    79,    11,    74,
+      78,    13,    18,    14,    75,    72,    72,    15,    11,     5,
+      77,    11,    11,    11,    15,    79,    55,    11,    13,    13,
+       9,    64,    65,    11,    15,    75,    10,    65,    67,    68,
+      12,    13,    12,    14,    74,    14,    74,    55,    60,    55,
+      60,    15,    55,    15,    55,    15,    15
 };
 
 #define yyerrok		(yyerrstatus = 0)
@@ -1784,13 +1785,13 @@ yyreduce:
     {
         case 2:
 /* Line 1792 of yacc.c  */
-#line 189 "bs.y"
+#line 183 "bs.y"
     { BS_BUILD((yyval.vProgram), CreateProgram()); (yyval.vProgram)->SetStmtList((yyvsp[(1) - (1)].vStmtList)); }
     break;
 
   case 3:
 /* Line 1792 of yacc.c  */
-#line 192 "bs.y"
+#line 186 "bs.y"
     { 
                     (yyval.vStmtList) = (yyvsp[(1) - (2)].vStmtList);
                     BS_CHECKLIST((yyvsp[(1) - (2)].vStmtList));
@@ -1804,37 +1805,37 @@ yyreduce:
 
   case 4:
 /* Line 1792 of yacc.c  */
-#line 201 "bs.y"
+#line 195 "bs.y"
     { (yyval.vStmtList) = BS_GlobalBuilder->CreateStmtList(); (yyval.vStmtList)->SetStmt((yyvsp[(1) - (1)].vStmt)); }
     break;
 
   case 5:
 /* Line 1792 of yacc.c  */
-#line 202 "bs.y"
+#line 196 "bs.y"
     { (yyval.vStmtList) = BS_GlobalBuilder->CreateStmtList(); }
     break;
 
   case 6:
 /* Line 1792 of yacc.c  */
-#line 205 "bs.y"
+#line 199 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildStmtExp((yyvsp[(1) - (2)].vExp))); }
     break;
 
   case 7:
 /* Line 1792 of yacc.c  */
-#line 206 "bs.y"
+#line 200 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildExternVariable((yyvsp[(2) - (5)].vExp),(yyvsp[(4) - (5)].vExp))); }
     break;
 
   case 8:
 /* Line 1792 of yacc.c  */
-#line 207 "bs.y"
+#line 201 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildDeclarationWithAnnotation((yyvsp[(1) - (3)].vAnnotations), (yyvsp[(2) - (3)].vExp))); }
     break;
 
   case 9:
 /* Line 1792 of yacc.c  */
-#line 209 "bs.y"
+#line 203 "bs.y"
     {
                 StmtExp* declaration = nullptr;
                 BS_BUILD(declaration, BuildExternVariable((yyvsp[(3) - (6)].vExp), (yyvsp[(5) - (6)].vExp)));
@@ -1853,19 +1854,19 @@ yyreduce:
 
   case 10:
 /* Line 1792 of yacc.c  */
-#line 223 "bs.y"
+#line 217 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildStmtReturn((yyvsp[(2) - (3)].vExp))); }
     break;
 
   case 11:
 /* Line 1792 of yacc.c  */
-#line 224 "bs.y"
+#line 218 "bs.y"
     {BS_BUILD((yyval.vStmt), BindFunImplementation((yyvsp[(1) - (2)].vStmtFunDec), (yyvsp[(2) - (2)].vStmtList)));}
     break;
 
   case 12:
 /* Line 1792 of yacc.c  */
-#line 226 "bs.y"
+#line 220 "bs.y"
     { 
                BS_BUILD((yyval.vStmt), BuildStmtWhile((yyvsp[(3) - (7)].vExp), (yyvsp[(6) - (7)].vStmtList)));
         }
@@ -1873,7 +1874,7 @@ yyreduce:
 
   case 13:
 /* Line 1792 of yacc.c  */
-#line 230 "bs.y"
+#line 224 "bs.y"
     {
                BS_BUILD((yyval.vStmt), BuildStmtFor((yyvsp[(3) - (11)].vExp),(yyvsp[(5) - (11)].vExp),(yyvsp[(7) - (11)].vExp),(yyvsp[(10) - (11)].vStmtList)));
         }
@@ -1881,13 +1882,19 @@ yyreduce:
 
   case 14:
 /* Line 1792 of yacc.c  */
-#line 233 "bs.y"
+#line 227 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildStmtStructDef((yyvsp[(2) - (6)].identifierText), (yyvsp[(4) - (6)].vArgList))); }
     break;
 
   case 15:
 /* Line 1792 of yacc.c  */
-#line 235 "bs.y"
+#line 228 "bs.y"
+    { BS_BUILD((yyval.vStmt), BuildStmtStructDef((yyvsp[(3) - (7)].identifierText), (yyvsp[(5) - (7)].vArgList), (yyvsp[(1) - (7)].vAnnotations))); }
+    break;
+
+  case 16:
+/* Line 1792 of yacc.c  */
+#line 230 "bs.y"
     { 
             if (BS_GlobalBuilder->GetSymbolTable()->GetTypeByName((yyvsp[(2) - (6)].identifierText)) == nullptr)
             {
@@ -1906,9 +1913,9 @@ yyreduce:
         }
     break;
 
-  case 16:
+  case 17:
 /* Line 1792 of yacc.c  */
-#line 252 "bs.y"
+#line 247 "bs.y"
     { 
                     if ((yyvsp[(8) - (8)].vStmtIfElse) != nullptr && (yyvsp[(7) - (8)].vStmtIfElse) != nullptr)
                     {
@@ -1929,51 +1936,51 @@ yyreduce:
                  }
     break;
 
-  case 17:
+  case 18:
 /* Line 1792 of yacc.c  */
-#line 272 "bs.y"
+#line 267 "bs.y"
     { BS_BUILD((yyval.vFrameInfo), StartNewFrame()); }
     break;
 
-  case 18:
+  case 19:
 /* Line 1792 of yacc.c  */
-#line 275 "bs.y"
+#line 270 "bs.y"
     {  BS_BUILD((yyval.vAnnotations), EndAnnotations((yyvsp[(1) - (3)].vAnnotations), (yyvsp[(2) - (3)].vExpList))); }
     break;
 
-  case 19:
+  case 20:
 /* Line 1792 of yacc.c  */
-#line 278 "bs.y"
+#line 273 "bs.y"
     { BS_BUILD((yyval.vAnnotations), BeginAnnotations()); }
     break;
 
-  case 20:
+  case 21:
 /* Line 1792 of yacc.c  */
-#line 282 "bs.y"
+#line 277 "bs.y"
     { BS_BUILD((yyval.vFrameInfo), StartNewFrame()); }
     break;
 
-  case 21:
+  case 22:
 /* Line 1792 of yacc.c  */
-#line 285 "bs.y"
+#line 280 "bs.y"
     { (yyval.vTypeDesc) = (yyvsp[(1) - (1)].vTypeDesc); if ((yyval.vTypeDesc) == nullptr) { BS_parseerror("Syntax error. Invalid function type.");YYERROR; }; if (!BS_GlobalBuilder->StartNewFunction((yyval.vTypeDesc))) {BS_parseerror("cannot declare function within a function"); YYERROR;} }
     break;
 
-  case 22:
+  case 23:
 /* Line 1792 of yacc.c  */
-#line 288 "bs.y"
+#line 283 "bs.y"
     { BS_GlobalBuilder->StartNewFrame(); }
     break;
 
-  case 23:
+  case 24:
 /* Line 1792 of yacc.c  */
-#line 291 "bs.y"
+#line 286 "bs.y"
     { BS_GlobalBuilder->StartNewFrame(); }
     break;
 
-  case 24:
+  case 25:
 /* Line 1792 of yacc.c  */
-#line 295 "bs.y"
+#line 290 "bs.y"
     {
                         (yyval.vStmtIfElse) = (yyvsp[(1) - (7)].vStmtIfElse);
                         BS_CHECKLIST((yyvsp[(1) - (7)].vStmtIfElse));
@@ -1989,55 +1996,55 @@ yyreduce:
                     }
     break;
 
-  case 25:
+  case 26:
 /* Line 1792 of yacc.c  */
-#line 309 "bs.y"
+#line 304 "bs.y"
     {
                         (yyval.vStmtIfElse) = BS_GlobalBuilder->BuildStmtIfElse((yyvsp[(3) - (6)].vExp), (yyvsp[(5) - (6)].vStmtList), nullptr, (yyvsp[(4) - (6)].vFrameInfo));
                    }
     break;
 
-  case 26:
+  case 27:
 /* Line 1792 of yacc.c  */
-#line 312 "bs.y"
+#line 307 "bs.y"
     { (yyval.vStmtIfElse) = nullptr; }
     break;
 
-  case 27:
+  case 28:
 /* Line 1792 of yacc.c  */
-#line 315 "bs.y"
+#line 310 "bs.y"
     { //pop previous frame
                               BS_GlobalBuilder->PopFrame();  
                             }
     break;
 
-  case 28:
+  case 29:
 /* Line 1792 of yacc.c  */
-#line 320 "bs.y"
+#line 315 "bs.y"
     {BS_BUILD((yyval.vStmtFunDec), BuildStmtFunDec((yyvsp[(4) - (5)].vArgList), (yyvsp[(1) - (5)].vTypeDesc), (yyvsp[(2) - (5)].identifierText)));}
     break;
 
-  case 29:
+  case 30:
 /* Line 1792 of yacc.c  */
-#line 323 "bs.y"
+#line 318 "bs.y"
     { BS_BUILD((yyval.vStmtIfElse), BuildStmtIfElse(nullptr, (yyvsp[(3) - (4)].vStmtList), nullptr, (yyvsp[(1) - (4)].vFrameInfo))); }
     break;
 
-  case 30:
+  case 31:
 /* Line 1792 of yacc.c  */
-#line 324 "bs.y"
+#line 319 "bs.y"
     { (yyval.vStmtIfElse) = nullptr; }
     break;
 
-  case 31:
+  case 32:
 /* Line 1792 of yacc.c  */
-#line 327 "bs.y"
+#line 322 "bs.y"
     { BS_GlobalBuilder->PopFrame(); BS_BUILD((yyval.vFrameInfo), StartNewFrame()); }
     break;
 
-  case 32:
+  case 33:
 /* Line 1792 of yacc.c  */
-#line 330 "bs.y"
+#line 325 "bs.y"
     {
                 Pegasus::BlockScript::EnumNode* enumNode = BS_GlobalBuilder->GetSymbolTable()->NewEnumNode(); 
                 enumNode->mIdd = (yyvsp[(3) - (3)].identifierText);
@@ -2049,9 +2056,9 @@ yyreduce:
           }
     break;
 
-  case 33:
+  case 34:
 /* Line 1792 of yacc.c  */
-#line 339 "bs.y"
+#line 334 "bs.y"
     {
                 Pegasus::BlockScript::EnumNode* enumNode = BS_GlobalBuilder->GetSymbolTable()->NewEnumNode(); 
                 enumNode->mIdd = (yyvsp[(1) - (1)].identifierText);
@@ -2059,42 +2066,42 @@ yyreduce:
           }
     break;
 
-  case 34:
+  case 35:
 /* Line 1792 of yacc.c  */
-#line 346 "bs.y"
+#line 341 "bs.y"
     { (yyval.vStmtList) = (yyvsp[(2) - (3)].vStmtList); }
     break;
 
-  case 35:
+  case 36:
 /* Line 1792 of yacc.c  */
-#line 347 "bs.y"
+#line 342 "bs.y"
     { (yyval.vStmtList) = nullptr; }
     break;
 
-  case 36:
+  case 37:
 /* Line 1792 of yacc.c  */
-#line 350 "bs.y"
+#line 345 "bs.y"
     { BS_BUILD((yyval.vExp), BuildImmInt((yyvsp[(1) - (1)].integerValue))); }
     break;
 
-  case 37:
+  case 38:
 /* Line 1792 of yacc.c  */
-#line 351 "bs.y"
+#line 346 "bs.y"
     { BS_BUILD((yyval.vExp), BuildImmFloat((yyvsp[(1) - (1)].floatValue))); }
     break;
 
-  case 38:
+  case 39:
 /* Line 1792 of yacc.c  */
-#line 353 "bs.y"
+#line 348 "bs.y"
     {
             //figure out size at compile time!
             BS_BUILD((yyval.vExp), BuildImmInt((yyvsp[(3) - (4)].vTypeDesc)->GetByteSize()));
           }
     break;
 
-  case 39:
+  case 40:
 /* Line 1792 of yacc.c  */
-#line 359 "bs.y"
+#line 354 "bs.y"
     {
                 (yyval.vExpList) = (yyvsp[(1) - (3)].vExpList);
                 BS_CHECKLIST((yyvsp[(1) - (3)].vExpList));
@@ -2106,225 +2113,225 @@ yyreduce:
          }
     break;
 
-  case 40:
-/* Line 1792 of yacc.c  */
-#line 368 "bs.y"
-    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); (yyval.vExpList)->SetExp((yyvsp[(1) - (1)].vExp)); }
-    break;
-
   case 41:
 /* Line 1792 of yacc.c  */
-#line 369 "bs.y"
-    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); }
+#line 363 "bs.y"
+    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); (yyval.vExpList)->SetExp((yyvsp[(1) - (1)].vExp)); }
     break;
 
   case 42:
 /* Line 1792 of yacc.c  */
-#line 372 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildIdd((yyvsp[(1) - (1)].identifierText))); }
+#line 364 "bs.y"
+    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); }
     break;
 
   case 43:
 /* Line 1792 of yacc.c  */
-#line 375 "bs.y"
-    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+#line 367 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildIdd((yyvsp[(1) - (1)].identifierText))); }
     break;
 
   case 44:
 /* Line 1792 of yacc.c  */
-#line 376 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildFunCall((yyvsp[(3) - (4)].vExpList), (yyvsp[(1) - (4)].identifierText))); }
+#line 370 "bs.y"
+    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
     break;
 
   case 45:
 /* Line 1792 of yacc.c  */
-#line 377 "bs.y"
+#line 371 "bs.y"
     { BS_BUILD((yyval.vExp), BuildFunCall((yyvsp[(3) - (4)].vExpList), (yyvsp[(1) - (4)].identifierText))); }
     break;
 
   case 46:
 /* Line 1792 of yacc.c  */
-#line 378 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildStaticArrayDec((yyvsp[(3) - (4)].vTypeDesc))); }
+#line 372 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildFunCall((yyvsp[(3) - (4)].vExpList), (yyvsp[(1) - (4)].identifierText))); }
     break;
 
   case 47:
 /* Line 1792 of yacc.c  */
-#line 379 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildStrImm((yyvsp[(1) - (1)].identifierText))); }
+#line 373 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildStaticArrayDec((yyvsp[(3) - (4)].vTypeDesc))); }
     break;
 
   case 48:
 /* Line 1792 of yacc.c  */
-#line 380 "bs.y"
-    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+#line 374 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildStrImm((yyvsp[(1) - (1)].identifierText))); }
     break;
 
   case 49:
 /* Line 1792 of yacc.c  */
-#line 381 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
+#line 375 "bs.y"
+    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
     break;
 
   case 50:
 /* Line 1792 of yacc.c  */
-#line 382 "bs.y"
+#line 376 "bs.y"
     { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
     break;
 
   case 51:
 /* Line 1792 of yacc.c  */
-#line 383 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildMethodCall((yyvsp[(1) - (6)].vExp), (yyvsp[(3) - (6)].identifierText), (yyvsp[(5) - (6)].vExpList))); }
+#line 377 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
     break;
 
   case 52:
 /* Line 1792 of yacc.c  */
-#line 384 "bs.y"
+#line 378 "bs.y"
     { BS_BUILD((yyval.vExp), BuildMethodCall((yyvsp[(1) - (6)].vExp), (yyvsp[(3) - (6)].identifierText), (yyvsp[(5) - (6)].vExpList))); }
     break;
 
   case 53:
 /* Line 1792 of yacc.c  */
-#line 385 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
+#line 379 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildMethodCall((yyvsp[(1) - (6)].vExp), (yyvsp[(3) - (6)].identifierText), (yyvsp[(5) - (6)].vExpList))); }
     break;
 
   case 54:
 /* Line 1792 of yacc.c  */
-#line 386 "bs.y"
+#line 380 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 55:
 /* Line 1792 of yacc.c  */
-#line 387 "bs.y"
+#line 381 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 56:
 /* Line 1792 of yacc.c  */
-#line 388 "bs.y"
+#line 382 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 57:
 /* Line 1792 of yacc.c  */
-#line 389 "bs.y"
+#line 383 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 58:
 /* Line 1792 of yacc.c  */
-#line 390 "bs.y"
+#line 384 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 59:
 /* Line 1792 of yacc.c  */
-#line 391 "bs.y"
+#line 385 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 60:
 /* Line 1792 of yacc.c  */
-#line 392 "bs.y"
+#line 386 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 61:
 /* Line 1792 of yacc.c  */
-#line 393 "bs.y"
+#line 387 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 62:
 /* Line 1792 of yacc.c  */
-#line 394 "bs.y"
+#line 388 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 63:
 /* Line 1792 of yacc.c  */
-#line 395 "bs.y"
+#line 389 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 64:
 /* Line 1792 of yacc.c  */
-#line 396 "bs.y"
+#line 390 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 65:
 /* Line 1792 of yacc.c  */
-#line 397 "bs.y"
+#line 391 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 66:
 /* Line 1792 of yacc.c  */
-#line 398 "bs.y"
+#line 392 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 67:
 /* Line 1792 of yacc.c  */
-#line 399 "bs.y"
+#line 393 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 68:
 /* Line 1792 of yacc.c  */
-#line 400 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (4)].vExp), O_ACCESS, (yyvsp[(3) - (4)].vExp))); }
+#line 394 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 69:
 /* Line 1792 of yacc.c  */
-#line 401 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
+#line 395 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (4)].vExp), O_ACCESS, (yyvsp[(3) - (4)].vExp))); }
     break;
 
   case 70:
 /* Line 1792 of yacc.c  */
-#line 402 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildExplicitCast((yyvsp[(4) - (4)].vExp), (yyvsp[(2) - (4)].vTypeDesc))); }
+#line 396 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
     break;
 
   case 71:
 /* Line 1792 of yacc.c  */
-#line 403 "bs.y"
-    { (yyval.vExp) = (yyvsp[(2) - (3)].vExp); }
+#line 397 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildExplicitCast((yyvsp[(4) - (4)].vExp), (yyvsp[(2) - (4)].vTypeDesc))); }
     break;
 
   case 72:
 /* Line 1792 of yacc.c  */
-#line 404 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildUnopPost((yyvsp[(1) - (2)].vExp), (yyvsp[(2) - (2)].token))); }
+#line 398 "bs.y"
+    { (yyval.vExp) = (yyvsp[(2) - (3)].vExp); }
     break;
 
   case 73:
 /* Line 1792 of yacc.c  */
-#line 405 "bs.y"
+#line 399 "bs.y"
     { BS_BUILD((yyval.vExp), BuildUnopPost((yyvsp[(1) - (2)].vExp), (yyvsp[(2) - (2)].token))); }
     break;
 
   case 74:
 /* Line 1792 of yacc.c  */
-#line 408 "bs.y"
-    { (yyval.vExp) = nullptr; }
+#line 400 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildUnopPost((yyvsp[(1) - (2)].vExp), (yyvsp[(2) - (2)].token))); }
     break;
 
   case 75:
 /* Line 1792 of yacc.c  */
-#line 409 "bs.y"
-    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+#line 403 "bs.y"
+    { (yyval.vExp) = nullptr; }
     break;
 
   case 76:
 /* Line 1792 of yacc.c  */
-#line 412 "bs.y"
+#line 404 "bs.y"
+    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+    break;
+
+  case 77:
+/* Line 1792 of yacc.c  */
+#line 407 "bs.y"
     {
                 (yyval.vArgList) = (yyvsp[(1) - (3)].vArgList);
                 BS_CHECKLIST((yyvsp[(1) - (3)].vArgList));
@@ -2336,21 +2343,21 @@ yyreduce:
          }
     break;
 
-  case 77:
+  case 78:
 /* Line 1792 of yacc.c  */
-#line 421 "bs.y"
+#line 416 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); (yyval.vArgList)->SetArgDec((yyvsp[(1) - (1)].vArgDec)); }
     break;
 
-  case 78:
+  case 79:
 /* Line 1792 of yacc.c  */
-#line 422 "bs.y"
+#line 417 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); }
     break;
 
-  case 79:
+  case 80:
 /* Line 1792 of yacc.c  */
-#line 425 "bs.y"
+#line 420 "bs.y"
     { 
 				Pegasus::BlockScript::TypeDesc* resultType = nullptr;
 				if ((yyvsp[(1) - (4)].vTypeDesc)->GetModifier() != Pegasus::BlockScript::TypeDesc::M_ARRAY)
@@ -2392,9 +2399,9 @@ yyreduce:
               }
     break;
 
-  case 80:
+  case 81:
 /* Line 1792 of yacc.c  */
-#line 464 "bs.y"
+#line 459 "bs.y"
     {                
                 TypeDesc* typeDesc = BS_GlobalBuilder->GetTypeByName((yyvsp[(1) - (1)].identifierText));
                 if (typeDesc != nullptr)
@@ -2410,9 +2417,9 @@ yyreduce:
             }
     break;
 
-  case 81:
+  case 82:
 /* Line 1792 of yacc.c  */
-#line 479 "bs.y"
+#line 474 "bs.y"
     {
                 (yyval.vArgList) = (yyvsp[(1) - (3)].vArgList);
                 BS_CHECKLIST((yyvsp[(1) - (3)].vArgList));
@@ -2424,27 +2431,27 @@ yyreduce:
          }
     break;
 
-  case 82:
+  case 83:
 /* Line 1792 of yacc.c  */
-#line 488 "bs.y"
+#line 483 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); (yyval.vArgList)->SetArgDec((yyvsp[(1) - (2)].vArgDec)); }
     break;
 
-  case 83:
+  case 84:
 /* Line 1792 of yacc.c  */
-#line 489 "bs.y"
+#line 484 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); }
     break;
 
-  case 84:
+  case 85:
 /* Line 1792 of yacc.c  */
-#line 492 "bs.y"
+#line 487 "bs.y"
     { BS_BUILD((yyval.vArgDec), BuildArgDec((yyvsp[(1) - (3)].identifierText), (yyvsp[(3) - (3)].vTypeDesc))); }
     break;
 
 
 /* Line 1792 of yacc.c  */
-#line 2448 "bs.parser.cpp"
+#line 2455 "bs.parser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2676,21 +2683,17 @@ yyreturn:
 
 
 /* Line 2055 of yacc.c  */
-#line 495 "bs.y"
+#line 490 "bs.y"
          
 
 //***************************************************//
 //              Let the insanity end                 //
 //***************************************************//
 
-extern void BS_restart(FILE* f);
-
-
 void Bison_BlockScriptParse(const FileBuffer* fileBuffer, BlockScriptBuilder* builder, IFileIncluder* fileIncluder, Container<Preprocessor::Definition>* defList) 
 {          
     CompilerState compilerState(builder->GetAllocator());
     compilerState.mBuilder = builder;
-    compilerState.mFileBuffer = fileBuffer;
     compilerState.GetPreprocessor().SetFileIncluder(fileIncluder);
 
     //add definitions pre-added
@@ -2702,18 +2705,17 @@ void Bison_BlockScriptParse(const FileBuffer* fileBuffer, BlockScriptBuilder* bu
         }
     }
 
-    yyscan_t scanner;
-    BS_lex_init_extra(&compilerState, &scanner);
-    builder->SetScanner(scanner);
+    //the lexer reads straight from the file buffer memory
+    BsLexer lexer(&compilerState, builder->GetAllocator());
+    lexer.Begin(fileBuffer->GetBuffer(), fileBuffer->GetFileSize());
+    builder->SetScanner(&lexer);
 
     do 
     {
-	    BS_parse(scanner);
-    } while (BS_HasNext(scanner) && BS_GlobalBuilder->GetErrorCount() == 0);
+	    BS_parse(&lexer);
+    } while (lexer.HasNext() && builder->GetErrorCount() == 0);
 
     builder->SetScanner(nullptr);
-    BS_restart(nullptr, scanner);
-    BS_lex_destroy(scanner);
 
 }
 
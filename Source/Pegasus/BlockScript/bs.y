@@ -29,10 +29,6 @@
     #pragma warning(disable : 4065)
 
     #include "Pegasus/BlockScript/CompilerState.h"
-    #ifndef YY_EXTRA_TYPE
-    #define YY_EXTRA_TYPE Pegasus::BlockScript::CompilerState*
-    #endif
-
     #include "Pegasus/BlockScript/BlockScriptBuilder.h"
     #include "Pegasus/BlockScript/EventListeners.h"
     #include "Pegasus/BlockScript/BlockScriptAst.h"
@@ -42,12 +38,12 @@
     #include "Pegasus/BlockScript/TypeDesc.h"
     #include "Pegasus/BlockScript/IFileIncluder.h"
     #include "Pegasus/BlockScript/bs.parser.hpp"
-    #include "Pegasus/BlockScript/bs.lexer.hpp"
+    #include "Pegasus/BlockScript/BsLexer.h"
     #include "Pegasus/Memory/MemoryManager.h"
     
     #include "Pegasus/Core/Io.h"
 
-    #define BS_GlobalBuilder BS_get_extra(scanner)->mBuilder
+    #define BS_GlobalBuilder static_cast<Pegasus::BlockScript::BsLexer*>(scanner)->GetCompilerState()->mBuilder
     #define BS_BUILD(r, exp) if ((r = BS_GlobalBuilder->exp) == nullptr) YYERROR ;
     #define BS_CHECKLIST(l) if (l == nullptr) {BS_parseerror("Empty list element, syntax error."); YYERROR;}
 
@@ -59,16 +55,14 @@
     #include <stdio.h>
 
     // Pegasus hooks
-    extern bool BS_HasNext(void* scanner);
-
     void BS_ErrorDispatcher(BlockScriptBuilder* builder, const char* message) 
     {
         builder->IncErrorCount();
-        yyscan_t scanner = builder->GetScanner();
+        BsLexer* lexer = static_cast<BsLexer*>(builder->GetScanner());
         Container<IBlockScriptCompilerListener*>& listeners = builder->GetEventListeners();
         for (int i = 0; i < listeners.Size(); ++i)
         {
-            listeners[i]->OnCompilationError(builder->GetCurrentCompilationUnitTitle(), builder->GetCurrentLine(), message, scanner ? BS_get_text(scanner) : "");
+            listeners[i]->OnCompilationError(builder->GetCurrentCompilationUnitTitle(), builder->GetCurrentLine(), message, lexer ? lexer->GetTokenText() : "");
         }
     }
 
@@ -81,7 +75,7 @@
 %}
 
 // expect 172 reduce/shift warnings due to grammar ambiguity
-%expect 172
+%expect 173
 
 %union {
     int    token;
@@ -231,6 +225,7 @@ stmt    : exp K_SEMICOLON { BS_BUILD($$, BuildStmtExp($1)); }
                BS_BUILD($$, BuildStmtFor($3,$5,$7,$10));
         }
         | struct_keyword IDENTIFIER K_L_BRAC struct_def_list K_R_BRAC K_SEMICOLON { BS_BUILD($$, BuildStmtStructDef($2, $4)); }
+        | annotation_list struct_keyword IDENTIFIER K_L_BRAC struct_def_list K_R_BRAC K_SEMICOLON { BS_BUILD($$, BuildStmtStructDef($3, $5, $1)); }
         | K_ENUM IDENTIFIER K_L_BRAC enum_list K_R_BRAC K_SEMICOLON 
         { 
             if (BS_GlobalBuilder->GetSymbolTable()->GetTypeByName($2) == nullptr)
@@ -498,14 +493,10 @@ arg_dec : IDENTIFIER K_COL type_desc { BS_BUILD($$, BuildArgDec($1, $3)); }
 //              Let the insanity end                 //
 //***************************************************//
 
-extern void BS_restart(FILE* f);
-
-
 void Bison_BlockScriptParse(const FileBuffer* fileBuffer, BlockScriptBuilder* builder, IFileIncluder* fileIncluder, Container<Preprocessor::Definition>* defList) 
 {          
     CompilerState compilerState(builder->GetAllocator());
     compilerState.mBuilder = builder;
-    compilerState.mFileBuffer = fileBuffer;
     compilerState.GetPreprocessor().SetFileIncluder(fileIncluder);
 
     //add definitions pre-added
@@ -517,18 +508,17 @@ void Bison_BlockScriptParse(const FileBuffer* fileBuffer, BlockScriptBuilder* bu
         }
     }
 
-    yyscan_t scanner;
-    BS_lex_init_extra(&compilerState, &scanner);
-    builder->SetScanner(scanner);
+    //the lexer reads straight from the file buffer memory
+    BsLexer lexer(&compilerState, builder->GetAllocator());
+    lexer.Begin(fileBuffer->GetBuffer(), fileBuffer->GetFileSize());
+    builder->SetScanner(&lexer);
 
     do 
     {
-	    BS_parse(scanner);
-    } while (BS_HasNext(scanner) && BS_GlobalBuilder->GetErrorCount() == 0);
+	    BS_parse(&lexer);
+    } while (lexer.HasNext() && builder->GetErrorCount() == 0);
 
     builder->SetScanner(nullptr);
-    BS_restart(nullptr, scanner);
-    BS_lex_destroy(scanner);
 
 }
 
@@ -19,6 +19,17 @@
 #include "Pegasus/BlockScript/Container.h"
 #include "Pegasus/BlockScript/BlockScriptManager.h"
 #include "Pegasus/BlockScript/EventListeners.h"
+#include "Pegasus/BlockScript/BlockScriptBuilder.h"
+#include "Pegasus/BlockScript/CompilerState.h"
+#include "Pegasus/BlockScript/BsLexer.h"
+#include "Pegasus/BlockScript/CostEstimator.h"
+#include "Pegasus/AssetLib/AssetLib.h"
+#include "Pegasus/AssetLib/Asset.h"
+#include "Pegasus/AssetLib/AssetBuilder.h"
+#include "Pegasus/AssetLib/AsLexer.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
 #include <stdio.h>
 
 using namespace Pegasus::Io;
@@ -35,6 +46,11 @@ public:
     {
         printf("[%s:%d]: '%s'\n", compilationUnitTitle, line ,errorMessage);
     }
+
+    virtual void OnCompilationWarning(const char* compilationUnitTitle, int line, const char* warningMessage)
+    {
+        printf("[%s:%d]: warning: '%s'\n", compilationUnitTitle, line, warningMessage);
+    }
     
     virtual void OnCompilationEnd(bool success)
     {}
@@ -82,12 +98,18 @@ public:
     bool printAst;
     bool runScript;
     bool requestHelp;
+    bool benchmarkLexer;
+    bool printCosts;
+    int  costBudget;
     char* fileToParse;
     Options() : 
         printAssembly(false),
         printAst(false),
         runScript(true),
         requestHelp(false),
+        benchmarkLexer(false),
+        printCosts(false),
+        costBudget(0),
         fileToParse(nullptr)
     {
     }
@@ -121,6 +143,15 @@ bool ParseCommandLineOptions(char** argv, int argc, Options& output)
             {
                 output.requestHelp = true;
             }
+            else if (candidate[1] == 'l')
+            {
+                output.benchmarkLexer = true;
+            }
+            else if (candidate[1] == 'c')
+            {
+                output.printCosts = true;
+                output.costBudget = candidate[2] != '\0' ? Pegasus::Utils::Atoi(candidate + 2) : 0;
+            }
             else
             {
                 return false;
@@ -151,6 +182,170 @@ void printHelp()
     printf("-a print assembly.\n");
     printf("-t print the abstract syntax tree.\n");
     printf("-n Do not attempt to run the program.\n");
+    printf("-l run the lexer throughput benchmark on generated scripts (no script required).\n");
+    printf("-c[budget] print the estimated cost of every function, in canon instructions.\n");
+    printf("           If a budget is passed (i.e. -c5000) functions exceeding it are reported as warnings.\n");
+}
+
+//! Prints the estimated cost of every function compiled
+void PrintCosts(Pegasus::BlockScript::BlockScript* bs, int budget)
+{
+    Pegasus::BlockScript::CostEstimator* estimator = bs->GetCostEstimator();
+    if (budget <= 0)
+    {
+        //no budget set, the compiler did not run the estimation
+        estimator->Estimate(bs->GetAst());
+    }
+
+    printf("\n----------------- COST ------------------\n");
+    for (int i = 0; i < estimator->GetFunctionCount(); ++i)
+    {
+        const Pegasus::BlockScript::Ast::StmtFunDec* funDec = estimator->GetFunction(i);
+        const Pegasus::BlockScript::FunCost& cost = estimator->GetCost(i);
+        printf("%-32s %8d", funDec->GetName(), cost.mFixedCost);
+        if (cost.mPerIterationCost > 0)
+        {
+            printf(" + N * %d", cost.mPerIterationCost);
+        }
+        if (cost.mIsUnbounded)
+        {
+            printf(" (unbounded)");
+        }
+        if (budget > 0 && Pegasus::BlockScript::CostEstimator::ExceedsBudget(cost, budget))
+        {
+            printf(" [over budget]");
+        }
+        printf("\n");
+    }
+}
+
+//! Block of code repeated to generate the blockscript lexer benchmark
+static const char* sBenchmarkScriptBlock =
+    "#define BENCH_COUNT 128\n"
+    "// generated block for the lexer benchmark\n"
+    "struct Vertex { position : float4; normal : float3; uv : float2; };\n"
+    "/* multi line comment,\n"
+    "   skipped by the lexer */\n"
+    "enum Mode { MODE_A, MODE_B };\n"
+    "extern gLightCount = 4;\n"
+    "vec_length(v : float3) : float\n"
+    "{\n"
+    "    return sqrt(v.x * v.x + v.y * v.y + v.z * v.z);\n"
+    "}\n"
+    "bench_loop(vertices : static_array<Vertex, 16>) : int\n"
+    "{\n"
+    "    acc = 0.0;\n"
+    "    for (i = 0; i < BENCH_COUNT; ++i)\n"
+    "    {\n"
+    "        if (i % 2 == 0 && gLightCount != 3) { acc = acc + 1.25 * vertices[i % 16].uv.x; }\n"
+    "        elif (i >= 64 || i <= 8) { acc = acc - sizeof(Vertex); }\n"
+    "        else { acc -> reset(); }\n"
+    "    }\n"
+    "    print_str(\"benchmark string literal\");\n"
+    "    return 0;\n"
+    "}\n";
+
+//! Block of text repeated to generate the asset script lexer benchmark
+static const char* sBenchmarkAssetBlock =
+    "{\n"
+    "    # generated block for the lexer benchmark\n"
+    "    \"name\" : \"benchmark_asset\",\n"
+    "    \"position\" : [1.5, -2.25, 3.0, 128],\n"
+    "    \"texture\" : {@Textures/Benchmark/albedo.pas},\n"
+    "    \"path\" : Shaders/Benchmark/lighting.ps,\n"
+    "    \"flags\" : [enabled, visible, cast_shadows],\n"
+    "    \"child\" : { \"count\" : 42, \"scale\" : 0.5 }\n"
+    "},\n";
+
+//! Fills a buffer of the requested size by repeating a block of text
+static char* GenerateBenchmarkText(const char* block, int targetSize, int& outSize)
+{
+    int blockSize = static_cast<int>(Pegasus::Utils::Strlen(block));
+    int blockCount = targetSize / blockSize;
+    outSize = blockCount * blockSize;
+    char* buffer = PG_NEW_ARRAY(GetGlobalAllocator(), -1, "Lexer Benchmark", Pegasus::Alloc::PG_MEM_TEMP, char, outSize);
+    for (int i = 0; i < blockCount; ++i)
+    {
+        Pegasus::Utils::Memcpy(buffer + i * blockSize, block, blockSize);
+    }
+    return buffer;
+}
+
+static void PrintThroughput(const char* name, int tokenCount, int byteCount, double seconds)
+{
+    double mb = static_cast<double>(byteCount) / (1024.0 * 1024.0);
+    printf("%s: %d tokens, %.2f MB in %.4f s -> %.2f MB/s\n", name, tokenCount, mb, seconds, seconds > 0.0 ? mb / seconds : 0.0);
+}
+
+//! Measures the throughput of the BlockScript and AssetScript lexers on large generated texts.
+//! The best time of several runs is reported.
+void RunLexerBenchmark()
+{
+    const int targetSize = 32 * 1024 * 1024;
+    const int runs = 5;
+    Pegasus::Core::InitializePegasusTime();
+
+    {
+        int size = 0;
+        char* script = GenerateBenchmarkText(sBenchmarkScriptBlock, targetSize, size);
+        Pegasus::BlockScript::BlockScriptBuilder builder;
+        builder.Initialize(GetGlobalAllocator());
+        builder.AddEventListener(&gCompilerEventListener);
+
+        double bestTime = 0.0;
+        int tokenCount = 0;
+        for (int r = 0; r < runs; ++r)
+        {
+            builder.BeginBuild("LexerBenchmark.bs");
+            Pegasus::BlockScript::CompilerState compilerState(GetGlobalAllocator());
+            compilerState.mBuilder = &builder;
+            Pegasus::BlockScript::BsLexer lexer(&compilerState, GetGlobalAllocator());
+            lexer.Begin(script, size);
+            builder.SetScanner(&lexer);
+
+            Pegasus::Core::UpdatePegasusTime();
+            double beginTime = Pegasus::Core::GetPegasusTime();
+            tokenCount = lexer.LexAll();
+            Pegasus::Core::UpdatePegasusTime();
+            double elapsed = Pegasus::Core::GetPegasusTime() - beginTime;
+            bestTime = (r == 0 || elapsed < bestTime) ? elapsed : bestTime;
+
+            builder.SetScanner(nullptr);
+            builder.Reset();
+        }
+        PrintThroughput("BlockScript lexer", tokenCount, size, bestTime);
+        PG_DELETE_ARRAY(GetGlobalAllocator(), script);
+    }
+
+    {
+        int size = 0;
+        char* assetText = GenerateBenchmarkText(sBenchmarkAssetBlock, targetSize, size);
+        Pegasus::Io::IOManager ioMgr("");
+        Pegasus::AssetLib::AssetLib assetLib(GetGlobalAllocator(), &ioMgr);
+        Pegasus::AssetLib::AssetBuilder builder(GetGlobalAllocator());
+
+        double bestTime = 0.0;
+        int tokenCount = 0;
+        for (int r = 0; r < runs; ++r)
+        {
+            Pegasus::AssetLib::Asset* asset = assetLib.CreateAsset("LexerBenchmark.pas", true);
+            builder.BeginCompilation(asset);
+            Pegasus::AssetLib::AsLexer lexer(&builder);
+            lexer.Begin(assetText, size);
+
+            Pegasus::Core::UpdatePegasusTime();
+            double beginTime = Pegasus::Core::GetPegasusTime();
+            tokenCount = lexer.LexAll();
+            Pegasus::Core::UpdatePegasusTime();
+            double elapsed = Pegasus::Core::GetPegasusTime() - beginTime;
+            bestTime = (r == 0 || elapsed < bestTime) ? elapsed : bestTime;
+
+            builder.Reset();
+            assetLib.UnloadAsset(asset);
+        }
+        PrintThroughput("AssetScript lexer", tokenCount, size, bestTime);
+        PG_DELETE_ARRAY(GetGlobalAllocator(), assetText);
+    }
 }
 
 
@@ -179,6 +374,10 @@ int main(int argc, char* argv[])
         {
             printHelp();
         }
+        else if (opts.benchmarkLexer)
+        {
+            RunLexerBenchmark();
+        }
         else
         {
             err = mgr.OpenFileToBuffer(
@@ -193,6 +392,7 @@ int main(int argc, char* argv[])
             {
                 Pegasus::BlockScript::BlockScript* bs = bsManager.CreateBlockScript();
                 bs->AddCompilerEventListener(&gCompilerEventListener);
+                bs->SetCostBudget(opts.costBudget);
                 bool res = bs->Compile(&fb);
 	
                 if (!res)
@@ -222,6 +422,11 @@ int main(int argc, char* argv[])
                         printf("\n");
                     }
 
+                    if (opts.printCosts)
+                    {
+                        PrintCosts(bs, opts.costBudget);
+                    }
+
                     if (opts.runScript)
                     {
                         bs->Run(&vmState);
@@ -9,6 +9,7 @@
 
 #include "Pegasus/BlockScript/BlockScriptAst.h"
 #include "Pegasus/BlockScript/BlockScript.h"
+#include "Pegasus/BlockScript/EventListeners.h"
 #include "Pegasus/BlockScript/FunCallback.h"
 #include "Pegasus/BlockScript/PrettyPrint.h"
 #include "Pegasus/Utils/ByteStream.h"
@@ -20,6 +21,9 @@
 #include "Pegasus/Core/Assertion.h"
 #include "Pegasus/BlockScript/Container.h"
 #include "Pegasus/BlockScript/BlockScriptManager.h"
+#include "Pegasus/BlockScript/BlockLib.h"
+#include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/Utils/Memcpy.h"
 
 #include <sstream>
 #include <string>
@@ -112,7 +116,8 @@ const struct TestScript { const char* script; const char* output; } gTestScripts
     { "Branching.bs",      "OutputBranching.txt" },    
     { "Loops.bs",          "OutputLoops.txt" },
     { "2dArray.bs",        "Output2dArray.txt" },
-    { "Math.bs",           "OutputMath.txt" }
+    { "Math.bs",           "OutputMath.txt" },
+    { "ArrayOps.bs",       "OutputArrayOps.txt" }
 };
 //
 
@@ -120,6 +125,42 @@ const struct TestScript { const char* script; const char* output; } gTestScripts
 // **** C++ Library Tests ****
 // Add here all the tests that will require an extra library to be linked (library coming from c++)
 // **** **** ****
+typedef void (*RegisterLibFun)(BlockLib* lib);
+void RegisterNullRenderLib(BlockLib* lib);
+
+const struct LibTestScript { const char* script; const char* output; RegisterLibFun registerLib; } gLibTestScripts[] = {
+    { "UniformBlocks.bs",  "OutputUniformBlocks.txt", RegisterNullRenderLib }
+};
+/////
+
+// **** Cost Estimator Tests ****
+// Add here the functions of the cost script, with their cost in canon instructions.
+// The script is compiled with the budget below and sin weighted to gCostSinWeight.
+// **** **** ****
+const char* gCostScript = "Costs.bs";
+const int gCostBudget = 64;
+const int gCostSinWeight = 10;
+
+const struct CostTest { const char* function; int fixedCost; int perIterationCost; bool isUnbounded; bool overBudget; } gCostTests[] = {
+    { "Add",       3,  0, false, false }, // binop, return and frame push
+    { "Shade",     21, 0, false, false }, // dot weighted 2 by the default table, sin by gCostSinWeight
+    { "Sum",       53, 0, false, false }, // 8 iterations of 6 instructions, trip count resolved statically
+    { "Countdown", 4,  5, false, true  }, // 4 + 16 assumed iterations * 5 is over budget
+    { "Factorial", 0,  0, true,  true  }, // recursion
+    { "Caller",    65, 0, false, true  }  // includes the costs of Add and Sum
+};
+/////
+
+// **** Hot Swap Tests ****
+// The hot swap script is run and its counter bumped from 15 to 25 by a function call, so running the global scope again would be noticed.
+// It is then recompiled from each of the scripts below and hot swapped. If the globals are kept, GetValue() returns the value below.
+// **** **** ****
+const char* gHotSwapScript = "HotSwap.bs";
+
+const struct HotSwapTest { const char* script; Pegasus::BlockScript::BlockScript::HotSwapResult result; int value; } gHotSwapTests[] = {
+    { "HotSwapFunction.bs", Pegasus::BlockScript::BlockScript::HOTSWAP_PRESERVED, 27 }, // the new body of GetValue returns counter + 2
+    { "HotSwapGlobal.bs",   Pegasus::BlockScript::BlockScript::HOTSWAP_FAILED,    0  }  // scale changed, the globals have to be computed again
+};
 /////
 
 // **** BlockScript Fun call tests ****
@@ -190,10 +231,49 @@ int printfloat(float f)
     return 0;
 }
 
-bool RunTest(IOManager& ioMgr, const char* script, const char* outputFile, bool dumpOutput = false)
+//! Null render backend, stands in for SetBuffer. Dumps the bytes a script uploads to a uniform buffer
+//! so uniform block layouts can be checked without a gpu.
+void NullUpload(FunCallbackContext& context)
+{
+    FunParamStream stream(context);
+    int& ramRef = stream.NextArgument<int>(); //the first parameter is a *, so we get its offset in memory
+    int& byteSize = stream.NextArgument<int>();
+    const char* block = context.GetVmState()->Ram() + ramRef;
+
+    char buff[64];
+    sprintf_s(buff, 64, "upload %d bytes", byteSize);
+    gSs->Append(buff, Strlen(buff));
+    appendnl();
+    for (int offset = 0; offset + static_cast<int>(sizeof(unsigned int)) <= byteSize; offset += sizeof(unsigned int))
+    {
+        unsigned int word;
+        Memcpy(&word, block + offset, sizeof(word));
+        sprintf_s(buff, 64, "%3d: %08x", offset, word);
+        gSs->Append(buff, Strlen(buff));
+        appendnl();
+    }
+    stream.SubmitReturn(byteSize);
+}
+
+void RegisterNullRenderLib(BlockLib* lib)
+{
+    const FunctionDeclarationDesc funDescs[] = {
+        { "NullUpload", "int", { "*", "int", nullptr }, { "block", "byteSize", nullptr }, NullUpload }
+    };
+    lib->CreateIntrinsicFunctions(funDescs, sizeof(funDescs) / sizeof(funDescs[0]));
+}
+
+bool RunTest(IOManager& ioMgr, const char* script, const char* outputFile, bool dumpOutput = false, RegisterLibFun registerLib = nullptr)
 {
     Pegasus::BlockScript::BlockScriptManager bsManager(GetGlobalAllocator());
     Pegasus::BlockScript::BlockScript* bs = bsManager.CreateBlockScript();
+    BlockLib* lib = nullptr;
+    if (registerLib != nullptr)
+    {
+        lib = bsManager.CreateBlockLib("TestLib");
+        registerLib(lib);
+        bs->IncludeLib(lib);
+    }
     FileBuffer filebuffer;
     IoError err = ioMgr.OpenFileToBuffer(script, filebuffer, true, GetGlobalAllocator());
     bool result = false;
@@ -246,11 +326,181 @@ bool RunTest(IOManager& ioMgr, const char* script, const char* outputFile, bool
     }
 
     bsManager.DestroyBlockScript(bs);
+    if (lib != nullptr)
+    {
+        bsManager.DestroyBlockLib(lib);
+    }
     return result;
     
 }
 
 
+//! Counts the budget warnings of a compilation
+class CostWarningListener : public IBlockScriptCompilerListener
+{
+public:
+    CostWarningListener() : mWarningCount(0) {}
+
+    virtual void OnCompilationBegin() {}
+
+    virtual void OnCompilationError(const char* compilationUnitTitle, int line, const char* errorMessage, const char* token)
+    {
+        cout << "[" << compilationUnitTitle << ":" << line << "]: " << errorMessage << std::endl;
+    }
+
+    virtual void OnCompilationWarning(const char* compilationUnitTitle, int line, const char* warningMessage)
+    {
+        ++mWarningCount;
+    }
+
+    virtual void OnCompilationEnd(bool success) {}
+
+    int mWarningCount;
+};
+
+bool RunCostTest(IOManager& ioMgr)
+{
+    Pegasus::BlockScript::BlockScriptManager bsManager(GetGlobalAllocator());
+    Pegasus::BlockScript::BlockScript* bs = bsManager.CreateBlockScript();
+    CostWarningListener listener;
+    bs->AddCompilerEventListener(&listener);
+    bs->SetCostBudget(gCostBudget);
+    bs->GetCostEstimator()->SetNativeCost("sin", gCostSinWeight);
+
+    FileBuffer filebuffer;
+    IoError err = ioMgr.OpenFileToBuffer(gCostScript, filebuffer, true, GetGlobalAllocator());
+    bool result = false;
+    if (err == Pegasus::Io::ERR_NONE)
+    {
+        if (bs->Compile(&filebuffer))
+        {
+            result = true;
+            int expectedWarnings = 0;
+            const CostEstimator* estimator = bs->GetCostEstimator();
+            for (int t = 0; t < sizeof(gCostTests)/sizeof(gCostTests[0]); ++t)
+            {
+                const CostTest& test = gCostTests[t];
+                expectedWarnings += test.overBudget ? 1 : 0;
+                int f = 0;
+                while (f < estimator->GetFunctionCount() && Strcmp(estimator->GetFunction(f)->GetName(), test.function))
+                {
+                    ++f;
+                }
+
+                if (f == estimator->GetFunctionCount())
+                {
+                    cout << "No cost computed for " << test.function << std::endl;
+                    result = false;
+                    continue;
+                }
+
+                //the cost of unbounded functions has no meaning
+                const FunCost& cost = estimator->GetCost(f);
+                if (cost.mIsUnbounded != test.isUnbounded ||
+                    (!test.isUnbounded && (cost.mFixedCost != test.fixedCost || cost.mPerIterationCost != test.perIterationCost)) ||
+                    CostEstimator::ExceedsBudget(cost, gCostBudget) != test.overBudget)
+                {
+                    cout << "Unexpected cost for " << test.function << ": " << cost.mFixedCost << " + N * " << cost.mPerIterationCost
+                         << (cost.mIsUnbounded ? " (unbounded)" : "") << std::endl;
+                    result = false;
+                }
+            }
+
+            if (listener.mWarningCount != expectedWarnings)
+            {
+                cout << "Expected " << expectedWarnings << " budget warnings, got " << listener.mWarningCount << std::endl;
+                result = false;
+            }
+        }
+        else
+        {
+            cout << "Compilation Error." << std::endl;
+        }
+    }
+    else
+    {
+        cout << "Unable to open script file: " << gCostScript << std::endl;
+    }
+
+    bsManager.DestroyBlockScript(bs);
+    return result;
+}
+
+
+//! Calls a function of a script without arguments, returning an int
+bool CallIntFunction(Pegasus::BlockScript::BlockScript* bs, BsVmState& vmState, const char* function, int& outValue)
+{
+    FunBindPoint bindPoint = bs->GetFunctionBindPoint(function, nullptr, 0);
+    return bindPoint != FUN_INVALID_BIND_POINT && bs->ExecuteFunction(&vmState, bindPoint, nullptr, 0, &outValue, sizeof(outValue));
+}
+
+bool RunHotSwapTest(IOManager& ioMgr)
+{
+    Pegasus::BlockScript::BlockScriptManager bsManager(GetGlobalAllocator());
+    Pegasus::BlockScript::BlockScript* bs = bsManager.CreateBlockScript();
+    Pegasus::BlockScript::BsVmState vmState;
+    vmState.Initialize(GetGlobalAllocator());
+    GlobalStateSnapshot snapshot(GetGlobalAllocator());
+
+    bool result = true;
+    for (int t = 0; result && t < sizeof(gHotSwapTests)/sizeof(gHotSwapTests[0]); ++t)
+    {
+        const HotSwapTest& test = gHotSwapTests[t];
+
+        //the script is compiled from file buffers that stay alive while the script is
+        FileBuffer filebuffer;
+        FileBuffer newFilebuffer;
+        if (ioMgr.OpenFileToBuffer(gHotSwapScript, filebuffer, true, GetGlobalAllocator()) != Pegasus::Io::ERR_NONE ||
+            ioMgr.OpenFileToBuffer(test.script, newFilebuffer, true, GetGlobalAllocator()) != Pegasus::Io::ERR_NONE)
+        {
+            cout << "Unable to open script file: " << test.script << std::endl;
+            result = false;
+            break;
+        }
+
+        bs->Reset();
+        vmState.Reset();
+        int value = 0;
+        if (!bs->Compile(&filebuffer))
+        {
+            cout << "Compilation Error." << std::endl;
+            result = false;
+            break;
+        }
+        bs->Run(&vmState);
+        if (!CallIntFunction(bs, vmState, "Bump", value) || value != 25 || !bs->CaptureGlobals(&vmState, snapshot))
+        {
+            cout << "Unable to capture the globals of " << gHotSwapScript << std::endl;
+            result = false;
+            break;
+        }
+
+        bs->Reset();
+        if (!bs->Compile(&newFilebuffer))
+        {
+            cout << "Compilation Error." << std::endl;
+            result = false;
+            break;
+        }
+
+        Pegasus::BlockScript::BlockScript::HotSwapResult swapResult = bs->HotSwap(&vmState, snapshot);
+        if (swapResult != test.result)
+        {
+            cout << "Unexpected hot swap result for " << test.script << ": " << swapResult << std::endl;
+            result = false;
+        }
+        else if (swapResult != Pegasus::BlockScript::BlockScript::HOTSWAP_FAILED && (!CallIntFunction(bs, vmState, "GetValue", value) || value != test.value))
+        {
+            cout << "Unexpected value after the hot swap of " << test.script << ": " << value << std::endl;
+            result = false;
+        }
+    }
+
+    bsManager.DestroyBlockScript(bs);
+    return result;
+}
+
+
 int main(int argc, const char** argv)
 {
 #if PEGASUS_ENABLE_ASSERT
@@ -307,6 +557,30 @@ int main(int argc, const char** argv)
             cout << " Result: " << ( res ? "Pass" : "Fail")  <<  std::endl;
             cout << std::endl;
         }
+
+        for (int i = 0; i < sizeof(gLibTestScripts)/sizeof(gLibTestScripts[0]); ++i)
+        {
+            cout << " Testing: " << gLibTestScripts[i].script  << std::endl;
+            bool res = RunTest(mgr, gLibTestScripts[i].script, gLibTestScripts[i].output, false, gLibTestScripts[i].registerLib);
+            passTests += res ? 1 : 0;
+            ++total;
+            cout << " Result: " << ( res ? "Pass" : "Fail")  <<  std::endl;
+            cout << std::endl;
+        }
+
+        cout << " Testing: " << gCostScript << " (costs)" << std::endl;
+        bool costRes = RunCostTest(mgr);
+        passTests += costRes ? 1 : 0;
+        ++total;
+        cout << " Result: " << ( costRes ? "Pass" : "Fail")  <<  std::endl;
+        cout << std::endl;
+
+        cout << " Testing: " << gHotSwapScript << " (hot swap)" << std::endl;
+        bool hotSwapRes = RunHotSwapTest(mgr);
+        passTests += hotSwapRes ? 1 : 0;
+        ++total;
+        cout << " Result: " << ( hotSwapRes ? "Pass" : "Fail")  <<  std::endl;
+        cout << std::endl;
     }
 
     if (gCmdLineOpts.mSingleScript == nullptr)
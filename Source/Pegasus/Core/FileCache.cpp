@@ -0,0 +1,458 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FileCache.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Size bounded cache of binary blobs on disk, keyed by 64 bit hashes
+
+#include "Pegasus/Core/FileCache.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Utils/String.h"
+
+namespace Pegasus {
+namespace Io {
+
+//! Identifier of the blob files ('PGCB')
+static const unsigned int sBlobMagic = 0x50474342;
+
+//! Identifier of the index file ('PGCI')
+static const unsigned int sIndexMagic = 0x50474349;
+
+//! Version of the file layouts, the files of other versions are ignored
+static const unsigned int sFileVersion = 1;
+
+//! Header of a blob file, followed by the blob
+struct BlobHeader
+{
+    unsigned int mMagic;
+    unsigned int mVersion;
+    unsigned long long mKey;
+    int mPayloadSize;
+    int mPadding;
+};
+
+//! Header of the index file, followed by the entries
+struct IndexHeader
+{
+    unsigned int mMagic;
+    unsigned int mVersion;
+    unsigned int mNumEntries;
+    unsigned int mEntrySize;
+    unsigned long long mUseCounter;
+};
+
+//----------------------------------------------------------------------------------------
+
+FileCache::FileCache(Alloc::IAllocator* allocator)
+:   mAllocator(allocator),
+    mIoManager(nullptr),
+    mMaxSize(0),
+    mSize(0),
+    mUseCounter(0),
+    mEntries(allocator),
+    mBusyKeys(allocator),
+    mIndexDirty(false)
+{
+    PG_ASSERTSTR(allocator != nullptr, "Invalid allocator given to the file cache");
+    mPrefix[0] = '\0';
+}
+
+//----------------------------------------------------------------------------------------
+
+FileCache::~FileCache()
+{
+    Shutdown();
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::Initialize(IOManager* ioManager, const char* prefix, unsigned long long maxSize)
+{
+    PG_ASSERTSTR(ioManager != nullptr, "Invalid IO manager given to the file cache");
+    PG_ASSERTSTR(prefix != nullptr && Utils::Strlen(prefix) < MAX_PREFIX_LENGTH, "Invalid prefix given to the file cache");
+    Shutdown();
+
+    Core::ScopedLock lock(mLock);
+    mIoManager = ioManager;
+    mPrefix[0] = '\0';
+    Utils::Strcat(mPrefix, prefix);
+    mMaxSize = maxSize;
+    mSize = 0;
+    mUseCounter = 0;
+    mEntries.Clear();
+    mIndexDirty = false;
+
+    // Reuse the files of the last run
+    char path[IOManager::MAX_FILEPATH_LENGTH];
+    GetIndexPath(path);
+    FileBuffer indexBuffer;
+    if (mIoManager->OpenFileToBuffer(path, indexBuffer, true, mAllocator) == ERR_NONE)
+    {
+        const int fileSize = indexBuffer.GetFileSize();
+        const IndexHeader* header = reinterpret_cast<const IndexHeader*>(indexBuffer.GetBuffer());
+        if (   fileSize >= static_cast<int>(sizeof(IndexHeader))
+            && header->mMagic == sIndexMagic
+            && header->mVersion == sFileVersion
+            && header->mEntrySize == sizeof(Entry)
+            && fileSize == static_cast<int>(sizeof(IndexHeader) + header->mNumEntries * sizeof(Entry)))
+        {
+            const Entry* entries = reinterpret_cast<const Entry*>(header + 1);
+            mEntries.Reserve(header->mNumEntries);
+            for (unsigned int e = 0; e < header->mNumEntries; ++e)
+            {
+                mEntries.PushEmpty() = entries[e];
+                mSize += entries[e].mSize;
+            }
+            mUseCounter = header->mUseCounter;
+        }
+        else
+        {
+            PG_LOG('FILE', "Invalid file cache index \"%s\", the cache starts empty", path);
+        }
+        indexBuffer.DestroyBuffer();
+    }
+
+    // The budget may have been lowered since the last run
+    Evict();
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::Shutdown()
+{
+    Core::ScopedLock lock(mLock);
+    if (mIoManager != nullptr)
+    {
+        SaveIndexLocked();
+        mEntries.Clear();
+        mSize = 0;
+        mIoManager = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+const char* FileCache::Load(unsigned long long key, FileBuffer& fileBuffer, Alloc::IAllocator* alloc, int& payloadSize)
+{
+    IOManager* ioManager = nullptr;
+    char path[IOManager::MAX_FILEPATH_LENGTH];
+    {
+        Core::ScopedLock lock(mLock);
+        const int index = FindEntry(key);
+        if ((index < 0) || IsKeyBusy(key))
+        {
+            return nullptr;
+        }
+
+        // The entry becomes the most recently used before the read, so the eviction keeps it
+        mEntries[index].mLastUse = ++mUseCounter;
+        mIndexDirty = true;
+        mBusyKeys.Push(key);
+        ioManager = mIoManager;
+        GetFilePath(key, path);
+    }
+
+    // The file is read without the lock, the other entries stay available meanwhile
+    const bool opened = (ioManager->OpenFileToBuffer(path, fileBuffer, true, alloc) == ERR_NONE);
+    const int fileSize = opened ? fileBuffer.GetFileSize() : 0;
+    const BlobHeader* header = opened ? reinterpret_cast<const BlobHeader*>(fileBuffer.GetBuffer()) : nullptr;
+    const bool valid = opened
+                    && fileSize >= static_cast<int>(sizeof(BlobHeader))
+                    && header->mMagic == sBlobMagic
+                    && header->mVersion == sFileVersion
+                    && header->mKey == key
+                    && header->mPayloadSize == fileSize - static_cast<int>(sizeof(BlobHeader));
+
+    Core::ScopedLock lock(mLock);
+    ReleaseKey(key);
+    const int index = FindEntry(key);
+    if (!opened)
+    {
+        // The file has been deleted outside of the cache, there is no file to delete
+        if (index >= 0)
+        {
+            mSize -= mEntries[index].mSize;
+            mEntries.Delete(index);
+            mIndexDirty = true;
+        }
+        return nullptr;
+    }
+
+    if (!valid)
+    {
+        PG_LOG('FILE', "Invalid file cache entry \"%s\", the entry is removed", path);
+        fileBuffer.DestroyBuffer();
+        if (index >= 0)
+        {
+            RemoveEntry(index);
+        }
+        return nullptr;
+    }
+
+    payloadSize = header->mPayloadSize;
+    return reinterpret_cast<const char*>(header + 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool FileCache::Store(unsigned long long key, const Utils::ByteStream& payload)
+{
+    IOManager* ioManager = nullptr;
+    char path[IOManager::MAX_FILEPATH_LENGTH];
+    {
+        Core::ScopedLock lock(mLock);
+        if ((mIoManager == nullptr) || IsKeyBusy(key))
+        {
+            return false;
+        }
+
+        // The previous blob is not loaded while its file is written again
+        const int index = FindEntry(key);
+        if (index >= 0)
+        {
+            mSize -= mEntries[index].mSize;
+            mEntries.Delete(index);
+            mIndexDirty = true;
+        }
+        mBusyKeys.Push(key);
+        ioManager = mIoManager;
+        GetFilePath(key, path);
+    }
+
+    BlobHeader header;
+    header.mMagic = sBlobMagic;
+    header.mVersion = sFileVersion;
+    header.mKey = key;
+    header.mPayloadSize = payload.GetSize();
+    header.mPadding = 0;
+
+    // The chunks are written in place without the lock, the payload is never joined
+    FileWriter writer;
+    bool written = (ioManager->OpenFileToWrite(path, writer) == ERR_NONE);
+    written = written && writer.Write(&header, sizeof(header));
+    for (int c = 0; written && c < payload.GetChunkCount(); ++c)
+    {
+        int chunkSize = 0;
+        const void* chunk = payload.GetChunk(c, chunkSize);
+        written = writer.Write(chunk, chunkSize);
+    }
+    writer.Close();
+    if (!written)
+    {
+        PG_LOG('FILE', "Unable to write the file cache entry \"%s\"", path);
+        ioManager->RemoveFile(path);
+    }
+
+    Core::ScopedLock lock(mLock);
+    ReleaseKey(key);
+    if (!written)
+    {
+        return false;
+    }
+
+    Entry& entry = mEntries.PushEmpty();
+    entry.mKey = key;
+    entry.mLastUse = ++mUseCounter;
+    entry.mSize = static_cast<unsigned int>(sizeof(header)) + static_cast<unsigned int>(header.mPayloadSize);
+    entry.mPadding = 0;
+    mSize += entry.mSize;
+    mIndexDirty = true;
+
+    // The new entry is the most recently used, it is only evicted if larger than the budget
+    Evict();
+    return FindEntry(key) >= 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::Remove(unsigned long long key)
+{
+    Core::ScopedLock lock(mLock);
+    const int index = FindEntry(key);
+    if (index >= 0)
+    {
+        RemoveEntry(index);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::Clear()
+{
+    Core::ScopedLock lock(mLock);
+    while (mEntries.GetSize() > 0)
+    {
+        RemoveEntry(mEntries.GetSize() - 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool FileCache::SaveIndex()
+{
+    Core::ScopedLock lock(mLock);
+    return SaveIndexLocked();
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long FileCache::GetSize() const
+{
+    Core::ScopedLock lock(mLock);
+    return mSize;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int FileCache::GetNumEntries() const
+{
+    Core::ScopedLock lock(mLock);
+    return mEntries.GetSize();
+}
+
+//----------------------------------------------------------------------------------------
+
+int FileCache::FindEntry(unsigned long long key) const
+{
+    for (unsigned int e = 0; e < mEntries.GetSize(); ++e)
+    {
+        if (mEntries[e].mKey == key)
+        {
+            return static_cast<int>(e);
+        }
+    }
+    return -1;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool FileCache::IsKeyBusy(unsigned long long key) const
+{
+    for (unsigned int k = 0; k < mBusyKeys.GetSize(); ++k)
+    {
+        if (mBusyKeys[k] == key)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::ReleaseKey(unsigned long long key)
+{
+    for (unsigned int k = 0; k < mBusyKeys.GetSize(); ++k)
+    {
+        if (mBusyKeys[k] == key)
+        {
+            mBusyKeys.Delete(k);
+            return;
+        }
+    }
+    PG_FAILSTR("The file cache key %llx is not being accessed", key);
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::RemoveEntry(unsigned int index)
+{
+    char path[IOManager::MAX_FILEPATH_LENGTH];
+    GetFilePath(mEntries[index].mKey, path);
+    mIoManager->RemoveFile(path);
+
+    mSize -= mEntries[index].mSize;
+    mEntries.Delete(index);
+    mIndexDirty = true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::Evict()
+{
+    while (mSize > mMaxSize && mEntries.GetSize() > 0)
+    {
+        unsigned int oldest = 0;
+        for (unsigned int e = 1; e < mEntries.GetSize(); ++e)
+        {
+            if (mEntries[e].mLastUse < mEntries[oldest].mLastUse)
+            {
+                oldest = e;
+            }
+        }
+        RemoveEntry(oldest);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool FileCache::SaveIndexLocked()
+{
+    if (mIoManager == nullptr || !mIndexDirty)
+    {
+        return mIoManager != nullptr;
+    }
+
+    IndexHeader header;
+    header.mMagic = sIndexMagic;
+    header.mVersion = sFileVersion;
+    header.mNumEntries = mEntries.GetSize();
+    header.mEntrySize = sizeof(Entry);
+    header.mUseCounter = mUseCounter;
+
+    char path[IOManager::MAX_FILEPATH_LENGTH];
+    GetIndexPath(path);
+    FileWriter writer;
+    bool written = (mIoManager->OpenFileToWrite(path, writer) == ERR_NONE);
+    written = written && writer.Write(&header, sizeof(header));
+    if (written && header.mNumEntries > 0)
+    {
+        written = writer.Write(&mEntries[0], static_cast<int>(header.mNumEntries * sizeof(Entry)));
+    }
+    writer.Close();
+
+    if (!written)
+    {
+        PG_LOG('FILE', "Unable to write the file cache index \"%s\"", path);
+        return false;
+    }
+    mIndexDirty = false;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::GetFilePath(unsigned long long key, char* path) const
+{
+    static const char sHexDigits[] = "0123456789abcdef";
+    char keyName[17];
+    for (int d = 0; d < 16; ++d)
+    {
+        keyName[d] = sHexDigits[(key >> (60 - 4 * d)) & 0xF];
+    }
+    keyName[16] = '\0';
+
+    path[0] = '\0';
+    Utils::Strcat(path, mPrefix);
+    Utils::Strcat(path, keyName);
+    Utils::Strcat(path, ".pgc");
+}
+
+//----------------------------------------------------------------------------------------
+
+void FileCache::GetIndexPath(char* path) const
+{
+    path[0] = '\0';
+    Utils::Strcat(path, mPrefix);
+    Utils::Strcat(path, "index.pgc");
+}
+
+
+}   // namespace Io
+}   // namespace Pegasus
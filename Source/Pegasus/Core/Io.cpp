@@ -135,6 +135,37 @@ Pegasus::Io::IoError NativeSaveBufferToFile(const char* path, const Pegasus::Io:
     return Pegasus::Io::ERR_NONE;
 }
 
+void* NativeOpenFileToWrite(const char* path)
+{
+    HANDLE fileHandle = CreateFile(
+                            path,
+                            GENERIC_WRITE,
+                            0,
+                            NULL,
+                            CREATE_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                            NULL
+                        );
+    return fileHandle == INVALID_HANDLE_VALUE ? nullptr : fileHandle;
+}
+
+bool NativeWriteFile(void* handle, const void* buffer, int size)
+{
+    DWORD bytesWritten = 0;
+    BOOL res = WriteFile(static_cast<HANDLE>(handle), buffer, static_cast<DWORD>(size), &bytesWritten, NULL);
+    return res && bytesWritten == static_cast<DWORD>(size);
+}
+
+void NativeCloseFile(void* handle)
+{
+    CloseHandle(static_cast<HANDLE>(handle));
+}
+
+bool NativeRemoveFile(const char* path)
+{
+    return DeleteFileA(path) != FALSE;
+}
+
 #else
     #error No native implementation for IO functions in current platform!
 #endif //platform selection
@@ -270,6 +301,104 @@ Pegasus::Io::IoError Pegasus::Io::IOManager::SaveFileToBuffer(const char* relati
 
 //----------------------------------------------------------------------------------------
 
+Pegasus::Io::IoError Pegasus::Io::IOManager::OpenFileToWrite(const char* relativePath, Pegasus::Io::FileWriter& writer)
+{
+    char pathBuffer[MAX_FILEPATH_LENGTH];
+
+    // Configure the path
+    pathBuffer[0] = '\0';
+    PG_ASSERTSTR(Pegasus::Utils::Strlen(relativePath) < MAX_FILEPATH_LENGTH, "Path str is too little! be prepared for some mem stomps!");
+    Pegasus::Utils::Strcat(pathBuffer, mRootDirectory);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+    Pegasus::Utils::Strcat(pathBuffer, relativePath);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+
+    writer.Close();
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    writer.mHandle = internal::NativeOpenFileToWrite(pathBuffer);
+#else
+    FILE * fileHandle = nullptr;
+    fopen_s(&fileHandle, pathBuffer, "wb");
+    writer.mHandle = fileHandle;
+#endif
+    if (writer.mHandle == nullptr)
+    {
+        PG_LOG('FILE', "IO Error (open for writing): %s", pathBuffer);
+        return Pegasus::Io::ERR_OPENING_FILE;
+    }
+    return Pegasus::Io::ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+Pegasus::Io::IoError Pegasus::Io::IOManager::RemoveFile(const char* relativePath)
+{
+    char pathBuffer[MAX_FILEPATH_LENGTH];
+
+    // Configure the path
+    pathBuffer[0] = '\0';
+    PG_ASSERTSTR(Pegasus::Utils::Strlen(relativePath) < MAX_FILEPATH_LENGTH, "Path str is too little! be prepared for some mem stomps!");
+    Pegasus::Utils::Strcat(pathBuffer, mRootDirectory);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+    Pegasus::Utils::Strcat(pathBuffer, relativePath);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    const bool removed = internal::NativeRemoveFile(pathBuffer);
+#else
+    const bool removed = (remove(pathBuffer) == 0);
+#endif
+    if (!removed)
+    {
+        PG_LOG('FILE', "IO Error (remove): %s", pathBuffer);
+        return Pegasus::Io::ERR_FILE_NOT_FOUND;
+    }
+    return Pegasus::Io::ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+Pegasus::Io::FileWriter::FileWriter()
+:   mHandle(nullptr)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+Pegasus::Io::FileWriter::~FileWriter()
+{
+    Close();
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Pegasus::Io::FileWriter::Write(const void* buffer, int size)
+{
+    PG_ASSERTSTR(mHandle != nullptr, "Writing to a file writer without any open file");
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    return internal::NativeWriteFile(mHandle, buffer, size);
+#else
+    return static_cast<int>(fwrite(buffer, 1, size, static_cast<FILE*>(mHandle))) == size;
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void Pegasus::Io::FileWriter::Close()
+{
+    if (mHandle != nullptr)
+    {
+#if PEGASUS_USE_NATIVE_IO_CALLS
+        internal::NativeCloseFile(mHandle);
+#else
+        fclose(static_cast<FILE*>(mHandle));
+#endif
+        mHandle = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 Pegasus::Io::FileBuffer::FileBuffer()
 :   mAllocator(nullptr),
     mBuffer(nullptr), 
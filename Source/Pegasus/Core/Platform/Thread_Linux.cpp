@@ -0,0 +1,178 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread_Linux.cpp
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Threads and synchronization primitives of the operating system (Linux implementation)
+
+#include "Pegasus/Core/Thread.h"
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#if PEGASUS_PLATFORM_LINUX
+
+#include "Pegasus/Core/Assertion.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace Pegasus {
+namespace Core {
+
+static_assert(sizeof(pthread_t) <= sizeof(unsigned long long), "The storage of Thread is too small for pthread_t");
+static_assert(sizeof(pthread_mutex_t) <= sizeof(unsigned long long) * 8, "The storage of Mutex is too small for pthread_mutex_t");
+static_assert(sizeof(pthread_cond_t) <= sizeof(unsigned long long) * 8, "The storage of ConditionVariable is too small for pthread_cond_t");
+
+//! Native entry point of the threads, calling the entry point given to Thread::Start()
+struct ThreadEntry
+{
+    static void* Run(void* thread)
+    {
+        Thread* t = static_cast<Thread*>(thread);
+        t->mFunc(t->mUserData);
+        return nullptr;
+    }
+};
+
+//----------------------------------------------------------------------------------------
+
+Thread::Thread()
+:   mFunc(nullptr),
+    mUserData(nullptr),
+    mHandle(0),
+    mRunning(false)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+Thread::~Thread()
+{
+    PG_ASSERTSTR(!mRunning, "A thread has to be joined before being destroyed");
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Thread::Start(ThreadFunc func, void* userData)
+{
+    PG_ASSERTSTR(func != nullptr, "Invalid entry point given to a thread");
+    if (mRunning || (func == nullptr))
+    {
+        return false;
+    }
+
+    mFunc = func;
+    mUserData = userData;
+    pthread_t handle;
+    if (pthread_create(&handle, nullptr, ThreadEntry::Run, this) != 0)
+    {
+        PG_FAILSTR("Unable to start a thread");
+        return false;
+    }
+
+    mHandle = static_cast<unsigned long long>(handle);
+    mRunning = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Thread::Join()
+{
+    if (mRunning)
+    {
+        pthread_join(static_cast<pthread_t>(mHandle), nullptr);
+        mHandle = 0;
+        mRunning = false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int Thread::GetNumHardwareThreads()
+{
+    const long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+    return (numProcessors > 0) ? static_cast<unsigned int>(numProcessors) : 1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Thread::YieldCurrentThread()
+{
+    sched_yield();
+}
+
+//----------------------------------------------------------------------------------------
+
+Mutex::Mutex()
+{
+    pthread_mutex_init(reinterpret_cast<pthread_mutex_t*>(mNative), nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+Mutex::~Mutex()
+{
+    pthread_mutex_destroy(reinterpret_cast<pthread_mutex_t*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Lock()
+{
+    pthread_mutex_lock(reinterpret_cast<pthread_mutex_t*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Unlock()
+{
+    pthread_mutex_unlock(reinterpret_cast<pthread_mutex_t*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::ConditionVariable()
+{
+    pthread_cond_init(reinterpret_cast<pthread_cond_t*>(mNative), nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::~ConditionVariable()
+{
+    pthread_cond_destroy(reinterpret_cast<pthread_cond_t*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Wait(Mutex& mutex)
+{
+    pthread_cond_wait(reinterpret_cast<pthread_cond_t*>(mNative),
+                      reinterpret_cast<pthread_mutex_t*>(mutex.mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::NotifyOne()
+{
+    pthread_cond_signal(reinterpret_cast<pthread_cond_t*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::NotifyAll()
+{
+    pthread_cond_broadcast(reinterpret_cast<pthread_cond_t*>(mNative));
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_LINUX
@@ -0,0 +1,182 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread_Win32.cpp
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Threads and synchronization primitives of the operating system (Win32 implementation)
+
+#include "Pegasus/Core/Thread.h"
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Core/Assertion.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <process.h>
+
+namespace Pegasus {
+namespace Core {
+
+static_assert(sizeof(SRWLOCK) <= sizeof(unsigned long long) * 8, "The storage of Mutex is too small for SRWLOCK");
+static_assert(sizeof(CONDITION_VARIABLE) <= sizeof(unsigned long long) * 8, "The storage of ConditionVariable is too small for CONDITION_VARIABLE");
+
+//! Native entry point of the threads, calling the entry point given to Thread::Start()
+struct ThreadEntry
+{
+    static unsigned int __stdcall Run(void* thread)
+    {
+        Thread* t = static_cast<Thread*>(thread);
+        t->mFunc(t->mUserData);
+        return 0;
+    }
+};
+
+//----------------------------------------------------------------------------------------
+
+Thread::Thread()
+:   mFunc(nullptr),
+    mUserData(nullptr),
+    mHandle(0),
+    mRunning(false)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+Thread::~Thread()
+{
+    PG_ASSERTSTR(!mRunning, "A thread has to be joined before being destroyed");
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Thread::Start(ThreadFunc func, void* userData)
+{
+    PG_ASSERTSTR(func != nullptr, "Invalid entry point given to a thread");
+    if (mRunning || (func == nullptr))
+    {
+        return false;
+    }
+
+    // _beginthreadex rather than CreateThread, so the C runtime is initialized for the thread
+    mFunc = func;
+    mUserData = userData;
+    const uintptr_t handle = _beginthreadex(nullptr, 0, ThreadEntry::Run, this, 0, nullptr);
+    if (handle == 0)
+    {
+        PG_FAILSTR("Unable to start a thread");
+        return false;
+    }
+
+    mHandle = static_cast<unsigned long long>(handle);
+    mRunning = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Thread::Join()
+{
+    if (mRunning)
+    {
+        HANDLE handle = reinterpret_cast<HANDLE>(static_cast<uintptr_t>(mHandle));
+        WaitForSingleObject(handle, INFINITE);
+        CloseHandle(handle);
+        mHandle = 0;
+        mRunning = false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int Thread::GetNumHardwareThreads()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors > 0) ? static_cast<unsigned int>(info.dwNumberOfProcessors) : 1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Thread::YieldCurrentThread()
+{
+    SwitchToThread();
+}
+
+//----------------------------------------------------------------------------------------
+
+Mutex::Mutex()
+{
+    InitializeSRWLock(reinterpret_cast<SRWLOCK*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+Mutex::~Mutex()
+{
+    // Slim reader/writer locks do not need to be destroyed
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Lock()
+{
+    AcquireSRWLockExclusive(reinterpret_cast<SRWLOCK*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Unlock()
+{
+    ReleaseSRWLockExclusive(reinterpret_cast<SRWLOCK*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::ConditionVariable()
+{
+    InitializeConditionVariable(reinterpret_cast<CONDITION_VARIABLE*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::~ConditionVariable()
+{
+    // Condition variables do not need to be destroyed
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Wait(Mutex& mutex)
+{
+    SleepConditionVariableSRW(reinterpret_cast<CONDITION_VARIABLE*>(mNative),
+                              reinterpret_cast<SRWLOCK*>(mutex.mNative),
+                              INFINITE, 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::NotifyOne()
+{
+    WakeConditionVariable(reinterpret_cast<CONDITION_VARIABLE*>(mNative));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::NotifyAll()
+{
+    WakeAllConditionVariable(reinterpret_cast<CONDITION_VARIABLE*>(mNative));
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
@@ -24,15 +24,15 @@ RefCounted::RefCounted(Alloc::IAllocator* allocator)
 
 RefCounted::~RefCounted()
 {
-    PG_ASSERTSTR(mRefCount == 0, "Trying to destroy a Node that still has owners (mRefCount == %d)", mRefCount);
+    PG_ASSERTSTR(mRefCount == 0, "Trying to destroy a Node that still has owners (mRefCount == %d)", GetRefCount());
 }
 
 void RefCounted::Release()
 {
-    PG_ASSERTSTR(mRefCount > 0, "Invalid reference counter (%d), it should have a positive value", mRefCount);
-    --mRefCount;
+    PG_ASSERTSTR(GetRefCount() > 0, "Invalid reference counter (%d), it should have a positive value", GetRefCount());
 
-    if (mRefCount <= 0)
+    // Single atomic decrement, only the last owner sees the counter reaching 0
+    if (--mRefCount <= 0)
     {
         PG_DELETE(mAllocator, this);
     }
@@ -0,0 +1,178 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ExecutionPlan.cpp
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Graph of nodes flattened into an array of execution records in topological order
+
+#include "Pegasus/Graph/ExecutionPlan.h"
+#include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Core/Assertion.h"
+
+namespace Pegasus {
+namespace Graph {
+
+//! Record index of a node being sorted, to detect cycles
+static const int sRecordInProgress = -1;
+
+//----------------------------------------------------------------------------------------
+
+ExecutionPlan::ExecutionPlan(Alloc::IAllocator* allocator)
+:   mNodeManager(nullptr),
+    mTopologyVersion(0),
+    mRecords(allocator),
+    mInputRecords(allocator),
+    mUpdated(allocator),
+    mRecordIndices(allocator),
+    mStack(allocator)
+{
+    PG_ASSERTSTR(allocator != nullptr, "Invalid allocator given to the execution plan");
+}
+
+//----------------------------------------------------------------------------------------
+
+ExecutionPlan::~ExecutionPlan()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void ExecutionPlan::Compile(NodeIn root)
+{
+    // The root can be the current root, keep it alive while clearing
+    NodeRef rootNode = root;
+    Clear();
+    if (rootNode == nullptr)
+    {
+        PG_FAILSTR("Invalid root node given to the execution plan");
+        return;
+    }
+
+    mRoot = rootNode;
+    mNodeManager = rootNode->mManager;
+    mTopologyVersion = (mNodeManager != nullptr) ? mNodeManager->GetTopologyVersion() : 0;
+
+    // Depth-first traversal, a node gets its record once all its inputs have one
+    StackEntry& rootEntry = mStack.PushEmpty();
+    rootEntry.mNode = &(*rootNode);
+    rootEntry.mNextInput = 0;
+    mRecordIndices.Insert(rootEntry.mNode, sRecordInProgress);
+
+    while (mStack.GetSize() > 0)
+    {
+        Node* node = mStack[mStack.GetSize() - 1].mNode;
+        const unsigned int numInputs = node->GetNumInputs();
+        const unsigned int nextInput = mStack[mStack.GetSize() - 1].mNextInput;
+        if (nextInput < numInputs)
+        {
+            ++mStack[mStack.GetSize() - 1].mNextInput;
+
+            // Raw pointer, the input is kept alive by the node
+            Node* input = &(*node->mInputs[nextInput]);
+            const int* recordIndex = mRecordIndices.Find(input);
+            if (recordIndex == nullptr)
+            {
+                mRecordIndices.Insert(input, sRecordInProgress);
+                StackEntry& entry = mStack.PushEmpty();
+                entry.mNode = input;
+                entry.mNextInput = 0;
+            }
+            else
+            {
+                PG_ASSERTSTR(*recordIndex != sRecordInProgress, "Cycle found in a graph, the node \"%s\" depends on itself", input->GetName());
+            }
+        }
+        else
+        {
+            Record& record = mRecords.PushEmpty();
+            record.mNode = node;
+            record.mFirstInput = mInputRecords.GetSize();
+            record.mNumInputs = numInputs;
+            for (unsigned int i = 0; i < numInputs; ++i)
+            {
+                mInputRecords.PushEmpty() = static_cast<unsigned int>(*mRecordIndices.Find(&(*node->mInputs[i])));
+            }
+            mUpdated.PushEmpty() = 0;
+
+            mRecordIndices.Insert(node, static_cast<int>(mRecords.GetSize() - 1));
+            mStack.Pop();
+        }
+    }
+
+    // The scratch data is only needed by the next compilation
+    mRecordIndices.Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void ExecutionPlan::Clear()
+{
+    mRoot = nullptr;
+    mNodeManager = nullptr;
+    mTopologyVersion = 0;
+    mRecords.Clear();
+    mInputRecords.Clear();
+    mUpdated.Clear();
+    mRecordIndices.Clear();
+    mStack.Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+bool ExecutionPlan::IsUpToDate() const
+{
+    return IsCompiled()
+        && ((mNodeManager == nullptr) || (mNodeManager->GetTopologyVersion() == mTopologyVersion));
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataReturn ExecutionPlan::Execute(bool& updated)
+{
+    if (!IsCompiled())
+    {
+        PG_FAILSTR("The execution plan has to be compiled before being executed");
+        return nullptr;
+    }
+
+    if (!IsUpToDate())
+    {
+        Compile(mRoot);
+    }
+
+    const unsigned int numRecords = mRecords.GetSize();
+    for (unsigned int r = 0; r < numRecords; ++r)
+    {
+        const Record& record = mRecords[r];
+        bool inputUpdated = false;
+        for (unsigned int i = 0; i < record.mNumInputs; ++i)
+        {
+            inputUpdated = inputUpdated || (mUpdated[mInputRecords[record.mFirstInput + i]] != 0);
+        }
+
+        // Same behavior as GetUpdatedData(): a node is generated again when an input has been during the same call.
+        // The data of the root is always requested, it could have been evicted
+        Node* node = record.mNode;
+        bool nodeUpdated = inputUpdated;
+        if (inputUpdated)
+        {
+            node->InvalidateData();
+        }
+        if (inputUpdated || node->IsDataDirty() || (r == numRecords - 1))
+        {
+            (void) node->GetUpdatedDataFromInputs(nodeUpdated);
+        }
+        mUpdated[r] = nodeUpdated ? 1 : 0;
+    }
+
+    updated = updated || (mUpdated[numRecords - 1] != 0);
+    return mRoot->GetData();
+}
+
+
+}   // namespace Graph
+}   // namespace Pegasus
@@ -35,10 +35,17 @@ GeneratorNode::GeneratorNode(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator
 
 bool GeneratorNode::Update()
 {
-    if (IsDataAllocated() && IsPropertyGridDirty())
+    // Nothing has changed since the last visit
+    if (!BeginUpdate())
     {
-        // If the property grid has members that are updated, invalidate the data
-        GetData()->Invalidate();
+        return IsDataDirty();
+    }
+
+    if (IsPropertyGridDirty())
+    {
+        // If the property grid has members that are updated, invalidate the data,
+        // including the data evicted by the memory budget
+        InvalidateData();
     }
 
     // Validate the property grid to track any subsequent changes
@@ -53,7 +60,9 @@ bool GeneratorNode::Update()
 
 NodeDataReturn GeneratorNode::GetUpdatedData(bool & updated)
 {
-    // If the data has not been allocated, allocate it now
+    // If the data has not been allocated, allocate it now.
+    // Data evicted by the memory budget is generated again the same way
+    const bool evicted = IsDataEvicted();
     if (!IsDataAllocated())
     {
         CreateData();
@@ -61,21 +70,31 @@ NodeDataReturn GeneratorNode::GetUpdatedData(bool & updated)
     PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being updated");
 
     // If the data is dirty, re-generate it
+    bool regenerated = false;
     if (IsDataDirty())
     {
         // No need to re-invalidate the GPU data, it is automatically invalidated
         // when the node data is invalidated
 
-        // Generate the node data using the generator-specific code
-        GenerateData();
+        // Generate the node data using the generator-specific code, or load it from the node data cache
+        GenerateCachedData();
 
         // Validate the node data, the GPU node data is still dirty
         GetData()->Validate();
 
-        updated = true;
+        // The content of evicted data is unchanged, the dependent nodes do not need an update
+        if (evicted)
+        {
+            regenerated = true;
+        }
+        else
+        {
+            updated = true;
+        }
     }
     PG_ASSERTSTR(!IsDataDirty(), "Node data is supposed to be up-to-date at this point");
 
+    TouchData(regenerated);
     return GetData();
 }
 
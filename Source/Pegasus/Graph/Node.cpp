@@ -11,9 +11,12 @@
 
 #include "Pegasus/Graph/Node.h"
 #include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Graph/NodeDataBudget.h"
 #include "Pegasus/AssetLib/Asset.h"
 #include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/Core/FileCache.h"
 #include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/HashMap.h"
 
 using namespace Pegasus::AssetLib;
 
@@ -31,6 +34,14 @@ Node::Node(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocato
 ,   mNodeAllocator(nodeAllocator)
 ,   mNodeDataAllocator(nodeDataAllocator)
 ,   mNumInputs(0)
+,   mDataCache(nullptr)
+,   mDataBudget(nullptr)
+,   mDataEvicted(false)
+,   mNumOutputs(0)
+,   mDependents(nodeAllocator)
+,   mUpdatePending(true)
+,   mManager(nullptr)
+,   mAsyncJob(nullptr)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -38,6 +49,9 @@ Node::Node(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocato
     BEGIN_INIT_PROPERTIES(Node)
     END_INIT_PROPERTIES()
 
+    mContentHash.store(0);
+    mContentHashValid.store(false);
+
     PG_ASSERTSTR(nodeAllocator != nullptr, "Invalid node allocator given to a Node");
     PG_ASSERTSTR(nodeDataAllocator != nullptr, "Invalid node data allocator given to a Node");
 
@@ -138,6 +152,7 @@ void Node::CreateData()
         if (newData != nullptr)
         {
             mData = newData;
+            mDataEvicted = false;
         }
         else
         {
@@ -161,6 +176,263 @@ void Node::InvalidateData()
     {
         mData->Invalidate();
     }
+
+    // An evicted node is not up-to-date anymore, its data has to be generated
+    mDataEvicted = false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::SetDirty()
+{
+    InvalidateData();
+    RequestUpdate();
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Node::BeginUpdate()
+{
+    if (!mUpdatePending)
+    {
+        return false;
+    }
+
+    mUpdatePending = false;
+    if (mManager != nullptr)
+    {
+        mManager->RecordNodeVisit();
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::RequestUpdate()
+{
+    if (!mUpdatePending || mContentHashValid.load())
+    {
+        mUpdatePending = true;
+        mContentHashValid.store(false);
+        for (unsigned int d = 0; d < mDependents.GetSize(); ++d)
+        {
+            mDependents[d]->RequestUpdate();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::OnPropertyGridInvalidated()
+{
+    RequestUpdate();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::OnPropertyGridWrite()
+{
+    // The worker thread reads the properties until the completion
+    if ((mAsyncJob != nullptr) && (mManager != nullptr))
+    {
+        mManager->GetScheduler()->WaitForAsyncJob(mAsyncJob);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::AddDependent(Node* dependent)
+{
+    mDependents.Push(dependent);
+    if (mManager != nullptr)
+    {
+        mManager->RecordTopologyChange();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::RemoveDependent(Node* dependent)
+{
+    for (unsigned int d = 0; d < mDependents.GetSize(); ++d)
+    {
+        if (mDependents[d] == dependent)
+        {
+            mDependents.Delete(d);
+            if (mManager != nullptr)
+            {
+                mManager->RecordTopologyChange();
+            }
+            return;
+        }
+    }
+    PG_FAILSTR("The node \"%s\" is not registered as a dependent of the node \"%s\"", dependent->GetName(), GetName());
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::ReleaseData()
+{
+    mData = nullptr;
+    mDataEvicted = false;
+    if (mDataBudget != nullptr)
+    {
+        mDataBudget->Remove(this);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::TouchData(bool regenerated)
+{
+    if ((mDataBudget != nullptr) && IsDataCacheable() && IsDataAllocated())
+    {
+        const unsigned int size = mData->GetMemorySize();
+        if (regenerated)
+        {
+            mDataBudget->RecordRegeneration(size);
+        }
+        mDataBudget->Touch(this, size);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Node::IsDataEvictable() const
+{
+    // A data referenced elsewhere (by an output node showing it meanwhile for example) would not be freed
+    return    IsDataAllocated()
+           && !mData->IsDirty()
+           && (mNumOutputs == 0)
+           && (mData->GetRefCount() == 1)
+           && (mData->GetNodeGPUData() == nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::EvictData()
+{
+    PG_ASSERTSTR(IsDataAllocated() && !mData->IsDirty(), "Only the up-to-date data of the node \"%s\" can be evicted", GetName());
+    mData = nullptr;
+    mDataEvicted = true;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Combine the value of a property with a content hash
+//! \param record Record of the property
+//! \param accessor Accessor of the property
+//! \param hash Content hash so far
+//! \return Hash combined with the value of the property
+static unsigned long long HashProperty(const PropertyGrid::PropertyRecord & record,
+                                       const PropertyGrid::PropertyReadAccessor & accessor,
+                                       unsigned long long hash)
+{
+    // The name does not change the generated data
+    if (Utils::Strcmp(record.name, "Name") == 0)
+    {
+        return hash;
+    }
+
+    char value[128];
+    if (record.size <= 0 || record.size > static_cast<int>(sizeof(value)))
+    {
+        PG_FAILSTR("Property %s cannot be hashed, its size is %d bytes", record.name, record.size);
+        return hash;
+    }
+    accessor.Read(value, record.size);
+
+    // Only the meaningful bytes are hashed, the others are not initialized.
+    // Enumerations are hashed by value, their name pointer changes across runs
+    int size = record.size;
+    const void* bytes = value;
+    int enumValue = 0;
+    if (record.type == PropertyGrid::PROPERTYTYPE_STRING64)
+    {
+        size = Utils::Strlen(value);
+    }
+    else if (record.type == PropertyGrid::PROPERTYTYPE_CUSTOM_ENUM)
+    {
+        enumValue = reinterpret_cast<const PropertyGrid::BaseEnumType*>(value)->GetValue();
+        bytes = &enumValue;
+        size = sizeof(enumValue);
+    }
+
+    hash = Utils::HashBytes64(record.name, Utils::Strlen(record.name), hash);
+    return Utils::HashBytes64(bytes, size, hash);
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long Node::ComputeContentHash() const
+{
+    if (mContentHashValid.load())
+    {
+        return mContentHash.load();
+    }
+
+    const char* className = GetClassInstanceName();
+    unsigned long long hash = Utils::HashBytes64(className, Utils::Strlen(className));
+
+    for (unsigned int p = 0; p < GetNumClassProperties(); ++p)
+    {
+        hash = HashProperty(GetClassPropertyRecord(p), GetClassReadPropertyAccessor(p), hash);
+    }
+    for (unsigned int p = 0; p < GetNumObjectProperties(); ++p)
+    {
+        hash = HashProperty(GetObjectPropertyRecord(p), GetObjectReadPropertyAccessor(p), hash);
+    }
+
+    hash = HashContent(hash);
+
+    // The order of the inputs matters, each input is hashed with its position
+    for (unsigned int i = 0; i < mNumInputs; ++i)
+    {
+        const unsigned long long inputHash = mInputs[i]->ComputeContentHash();
+        hash = Utils::HashBytes64(&inputHash, sizeof(inputHash), hash);
+    }
+    hash = Utils::HashBytes64(&mNumInputs, sizeof(mNumInputs), hash);
+
+    mContentHash.store(hash);
+    mContentHashValid.store(true);
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::GenerateCachedData()
+{
+    PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being generated");
+    if ((mDataCache == nullptr) || !mDataCache->IsEnabled() || !IsDataCacheable())
+    {
+        GenerateData();
+        return;
+    }
+
+    const unsigned long long hash = ComputeContentHash();
+    {
+        Io::FileBuffer fileBuffer;
+        int payloadSize = 0;
+        const char* payload = mDataCache->Load(hash, fileBuffer, mNodeDataAllocator, payloadSize);
+        if (payload != nullptr)
+        {
+            if (mData->Deserialize(payload, payloadSize))
+            {
+                return;
+            }
+
+            // Written by a different layout of the data, generated again below
+            mDataCache->Remove(hash);
+        }
+    }
+
+    GenerateData();
+
+    Utils::ByteStream stream(mNodeDataAllocator);
+    if (mData->Serialize(stream))
+    {
+        (void) mDataCache->Store(hash, stream);
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -187,12 +459,10 @@ void Node::AddInput(const Pegasus::Core::Ref<Node> & inputNode)
 
     mInputs[mNumInputs] = inputNode;
     ++mNumInputs;
+    inputNode->AddDependent(this);
 
     // Since an input node has been added, that means the node data is dirty
-    if (mData != nullptr)
-    {
-        mData->Invalidate();
-    }
+    SetDirty();
 }
 
 //----------------------------------------------------------------------------------------
@@ -225,13 +495,15 @@ void Node::ReplaceInput(unsigned int index, const Pegasus::Core::Ref<Node> & inp
     if (inputNode != mInputs[index])
     {
         // Replace the node (releases the previous node)
+        if (mInputs[index] != nullptr)
+        {
+            mInputs[index]->RemoveDependent(this);
+        }
         mInputs[index] = inputNode;
+        inputNode->AddDependent(this);
 
         // Since an input node has been changed, that means the node data is dirty
-        if (mData != nullptr)
-        {
-            mData->Invalidate();
-        }
+        SetDirty();
     }
 }
 
@@ -258,6 +530,7 @@ void Node::RemoveInput(const Pegasus::Core::Ref<Node> & inputNode)
                 OnRemoveInput((unsigned int)i);
 
                 // Remove the input node
+                mInputs[i]->RemoveDependent(this);
                 mInputs[i] = nullptr;
                 --mNumInputs;
 
@@ -274,9 +547,9 @@ void Node::RemoveInput(const Pegasus::Core::Ref<Node> & inputNode)
     }
 
     // If an input node has been removed, that means the node data is dirty
-    if (nodeFound && (mData != nullptr))
+    if (nodeFound)
     {
-        mData->Invalidate();
+        SetDirty();
     }
 
     PG_ASSERTSTR(nodeFound, "Trying to remove an input node from the current node, but the input node has not been found");
@@ -295,6 +568,7 @@ void Node::RemoveAllInputs()
             OnRemoveInput((unsigned int)i);
 
             // Remove the input node
+            mInputs[i]->RemoveDependent(this);
             mInputs[i] = nullptr;
         }
         else
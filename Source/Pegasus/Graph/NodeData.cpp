@@ -35,10 +35,10 @@ NodeData::~NodeData()
 
 void NodeData::Release()
 {
-    PG_ASSERTSTR(mRefCount > 0, "Invalid reference counter (%d), it should have a positive value", mRefCount);
-    --mRefCount;
+    PG_ASSERTSTR(GetRefCount() > 0, "Invalid reference counter (%d), it should have a positive value", GetRefCount());
 
-    if (mRefCount <= 0)
+    // Single atomic decrement, only the last owner sees the counter reaching 0
+    if (--mRefCount <= 0)
     {
         //! \todo The destructor is called explicitly here because PG_DELETE does not do it.
         //!       This should be replaced by implicit destructors
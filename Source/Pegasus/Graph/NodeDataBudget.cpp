@@ -0,0 +1,206 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataBudget.cpp
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Memory budget of the node data kept by the intermediate nodes of the graphs
+
+#include "Pegasus/Graph/NodeDataBudget.h"
+#include "Pegasus/Graph/Node.h"
+#include "Pegasus/Utils/Memset.h"
+
+namespace Pegasus {
+namespace Graph {
+
+NodeDataBudget::NodeDataBudget(Alloc::IAllocator* allocator)
+:   mEntries(allocator),
+    mOldest(nullptr),
+    mNewest(nullptr),
+    mMaxSize(0),
+    mEvictionBlocked(false)
+{
+    PG_ASSERTSTR(allocator != nullptr, "Invalid allocator given to the node data budget");
+    Utils::Memset8(&mStats, 0, sizeof(mStats));
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataBudget::~NodeDataBudget()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::SetBudget(unsigned long long maxSize)
+{
+    Core::ScopedLock lock(mLock);
+    mMaxSize = maxSize;
+    mEvictionBlocked = false;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long NodeDataBudget::GetBudget() const
+{
+    Core::ScopedLock lock(mLock);
+    return mMaxSize;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::Touch(Node* node, unsigned int size)
+{
+    PG_ASSERTSTR(node != nullptr, "Invalid node given to the node data budget");
+    Core::ScopedLock lock(mLock);
+
+    bool inserted = false;
+    Entry& entry = mEntries.FindOrInsert(node, &inserted);
+    if (inserted)
+    {
+        entry.mSize = 0;
+        LinkNewest(node, entry);
+        ++mStats.mNumNodes;
+    }
+    else if (mNewest != node)
+    {
+        Unlink(entry);
+        LinkNewest(node, entry);
+    }
+
+    mStats.mResidentSize += size;
+    mStats.mResidentSize -= entry.mSize;
+    entry.mSize = size;
+    mEvictionBlocked = false;
+
+    if (mStats.mResidentSize > mStats.mPeakResidentSize)
+    {
+        mStats.mPeakResidentSize = mStats.mResidentSize;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::Remove(Node* node)
+{
+    Core::ScopedLock lock(mLock);
+    const Entry* entry = mEntries.Find(node);
+    if (entry != nullptr)
+    {
+        Unlink(*entry);
+        mStats.mResidentSize -= entry->mSize;
+        --mStats.mNumNodes;
+        mEntries.Remove(node);
+        mEvictionBlocked = false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::RecordRegeneration(unsigned int size)
+{
+    Core::ScopedLock lock(mLock);
+    mStats.mRegeneratedSize += size;
+    ++mStats.mNumRegenerations;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::Evict()
+{
+    Core::ScopedLock lock(mLock);
+    if ((mMaxSize == 0) || mEvictionBlocked)
+    {
+        return;
+    }
+
+    // From the least recently used data, skipping the data in use
+    Node* node = mOldest;
+    while ((node != nullptr) && (mStats.mResidentSize > mMaxSize))
+    {
+        const Entry* entry = mEntries.Find(node);
+        Node* const newer = entry->mNewer;
+        if (node->IsDataEvictable())
+        {
+            const unsigned int size = entry->mSize;
+            Unlink(*entry);
+            node->EvictData();
+            mStats.mResidentSize -= size;
+            mStats.mEvictedSize += size;
+            --mStats.mNumNodes;
+            ++mStats.mNumEvictions;
+            mEntries.Remove(node);
+        }
+        node = newer;
+    }
+
+    // All the remaining data is in use, the list is not walked again until a node is touched or removed
+    mEvictionBlocked = (mStats.mResidentSize > mMaxSize);
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataBudget::Stats NodeDataBudget::GetStats() const
+{
+    Core::ScopedLock lock(mLock);
+    return mStats;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::ResetStats()
+{
+    Core::ScopedLock lock(mLock);
+    mStats.mPeakResidentSize = mStats.mResidentSize;
+    mStats.mEvictedSize = 0;
+    mStats.mRegeneratedSize = 0;
+    mStats.mNumEvictions = 0;
+    mStats.mNumRegenerations = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::LinkNewest(Node* node, Entry& entry)
+{
+    entry.mOlder = mNewest;
+    entry.mNewer = nullptr;
+    if (mNewest != nullptr)
+    {
+        mEntries.Find(mNewest)->mNewer = node;
+    }
+    else
+    {
+        mOldest = node;
+    }
+    mNewest = node;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataBudget::Unlink(const Entry& entry)
+{
+    if (entry.mOlder != nullptr)
+    {
+        mEntries.Find(entry.mOlder)->mNewer = entry.mNewer;
+    }
+    else
+    {
+        mOldest = entry.mNewer;
+    }
+
+    if (entry.mNewer != nullptr)
+    {
+        mEntries.Find(entry.mNewer)->mOlder = entry.mOlder;
+    }
+    else
+    {
+        mNewest = entry.mOlder;
+    }
+}
+
+
+}   // namespace Graph
+}   // namespace Pegasus
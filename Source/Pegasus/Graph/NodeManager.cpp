@@ -21,7 +21,16 @@ namespace Graph {
 NodeManager::NodeManager(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
 :   mNodeAllocator(nodeAllocator),
     mNodeDataAllocator(nodeDataAllocator),
-    mNumRegisteredNodes(0)
+    mNumRegisteredNodes(0),
+    mRegisteredNodeIndices(nodeAllocator),
+    mDataCache(nodeAllocator),
+    mDataBudget(nodeAllocator),
+    mScheduler(nodeAllocator),
+    mFrameIndex(0),
+    mAsyncGenerationEnabled(true),
+    mNumVisitedNodes(0),
+    mNumVisitedNodesLastFrame(0),
+    mTopologyVersion(0)
 {
     PG_ASSERTSTR(nodeAllocator != nullptr, "Invalid node allocator given to the NodeManager");
     PG_ASSERTSTR(nodeDataAllocator != nullptr, "Invalid node data allocator given to the NodeManager");
@@ -70,6 +79,10 @@ void NodeManager::RegisterNode(const char * className, Node::CreateNodeFunc crea
     strncpy(entry.className, className, MAX_CLASS_NAME_LENGTH);
 #endif  // PEGASUS_COMPILER_MSVC
     entry.createNodeFunc = createNodeFunc;
+    if (!mRegisteredNodeIndices.Contains(entry.className))
+    {
+        mRegisteredNodeIndices.Insert(entry.className, mNumRegisteredNodes);
+    }
     ++mNumRegisteredNodes;
 }
 
@@ -82,7 +95,14 @@ NodeReturn NodeManager::CreateNode(const char * className)
     {
         NodeEntry & entry = mRegisteredNodes[registeredNodeIndex];
         PG_ASSERT(entry.createNodeFunc != nullptr);
-        return entry.createNodeFunc(this, mNodeAllocator, mNodeDataAllocator);
+        NodeReturn node = entry.createNodeFunc(this, mNodeAllocator, mNodeDataAllocator);
+        if (node != nullptr)
+        {
+            node->mDataCache = &mDataCache;
+            node->mDataBudget = &mDataBudget;
+            node->mManager = this;
+        }
+        return node;
     }
     else
     {
@@ -101,6 +121,21 @@ NodeReturn NodeManager::CreateNode(const char * className)
 
 //----------------------------------------------------------------------------------------
 
+void NodeManager::BeginFrame()
+{
+    ++mFrameIndex;
+    mNumVisitedNodesLastFrame = mNumVisitedNodes;
+    mNumVisitedNodes = 0;
+
+    // The evicted data could still be read by a worker thread otherwise
+    if (mScheduler.IsIdle())
+    {
+        mDataBudget.Evict();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 unsigned int NodeManager::GetRegisteredNodeIndex(const char * className) const
 {
     if (className == nullptr)
@@ -109,18 +144,14 @@ unsigned int NodeManager::GetRegisteredNodeIndex(const char * className) const
         return mNumRegisteredNodes;
     }
 
-    unsigned int index;
-    for (index = 0; index < mNumRegisteredNodes; ++index)
+    const unsigned int* index = mRegisteredNodeIndices.Find(className);
+    if (index != nullptr)
     {
-        if (Pegasus::Utils::Strcmp(mRegisteredNodes[index].className, className) == 0)
-        {
-            // Node found
-            return index;
-        }
+        // Node found
+        return *index;
     }
 
     // Node not found
-    PG_ASSERT(index == mNumRegisteredNodes);
     return mNumRegisteredNodes;
 }
 
@@ -0,0 +1,480 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeScheduler.cpp
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Scheduler generating the dirty node data of a graph, independent nodes in parallel
+
+#include "Pegasus/Graph/NodeScheduler.h"
+#include "Pegasus/Memory/MemoryManager.h"
+
+namespace Pegasus {
+namespace Graph {
+
+//! Task index of a node being added, to detect cycles
+static const int sTaskInProgress = -2;
+
+//----------------------------------------------------------------------------------------
+
+NodeScheduler::NodeScheduler(Alloc::IAllocator* allocator)
+:   mAllocator(allocator),
+    mTasks(allocator),
+    mDependents(allocator),
+    mTaskIndices(allocator),
+    mWorkerQueue(allocator),
+    mMainThreadQueue(allocator),
+    mAsyncQueue(allocator),
+    mNumCompletedTasks(0),
+    mNumRunningAsyncJobs(0),
+    mNumWorkers(0),
+    mStopWorkers(false)
+{
+    PG_ASSERTSTR(allocator != nullptr, "Invalid allocator given to the NodeScheduler");
+    mGenerating.store(false);
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeScheduler::~NodeScheduler()
+{
+    StopWorkers();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::SetNumWorkers(unsigned int numWorkers)
+{
+    PG_ASSERTSTR(!mGenerating.load(), "The worker threads of the node scheduler cannot change during a generation");
+    if (numWorkers > MAX_NUM_WORKERS)
+    {
+        PG_FAILSTR("Too many worker threads requested for the node scheduler (%d), the maximum is %d", numWorkers, MAX_NUM_WORKERS);
+        numWorkers = MAX_NUM_WORKERS;
+    }
+
+    StopWorkers();
+    for (unsigned int w = 0; w < numWorkers; ++w)
+    {
+        if (!mWorkers[w].Start(&NodeScheduler::WorkerEntry, this))
+        {
+            numWorkers = w;
+            break;
+        }
+    }
+    mNumWorkers = numWorkers;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NodeScheduler::GetDefaultNumWorkers()
+{
+    const unsigned int numThreads = Core::Thread::GetNumHardwareThreads();
+    const unsigned int numWorkers = numThreads > 1 ? numThreads - 1 : 0;
+    return numWorkers < MAX_NUM_WORKERS ? numWorkers : MAX_NUM_WORKERS;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NodeScheduler::GenerateData(Node* node, bool& updated)
+{
+    PG_ASSERTSTR(node != nullptr, "Invalid node given to the node scheduler");
+    if (node == nullptr || mNumWorkers == 0)
+    {
+        return false;
+    }
+
+    // Nothing has changed since the last generation, the graph is left to the serial evaluation
+    // that only returns the data, rather than being visited here
+    if (!node->IsDataDirty() && !node->IsUpdatePending())
+    {
+        return false;
+    }
+
+    // A node generated by the scheduler can ask for a generation (output nodes do).
+    // Its inputs are up-to-date at that point, so the serial evaluation is enough
+    bool expected = false;
+    if (!mGenerating.compare_exchange_strong(expected, true))
+    {
+        return false;
+    }
+
+    // Gather the dirty nodes, the up-to-date subgraphs are left out
+    const int rootTask = AddTask(node);
+    if (rootTask >= 0)
+    {
+        // Link each task to the tasks depending on it
+        const unsigned int numTasks = mTasks.GetSize();
+        unsigned int numDependents = 0;
+        for (unsigned int t = 0; t < numTasks; ++t)
+        {
+            const Task& task = mTasks[t];
+            for (unsigned int i = 0; i < task.mNumInputs; ++i)
+            {
+                if (task.mInputs[i] >= 0)
+                {
+                    ++mTasks[task.mInputs[i]].mNumDependents;
+                }
+            }
+        }
+        for (unsigned int t = 0; t < numTasks; ++t)
+        {
+            mTasks[t].mFirstDependent = numDependents;
+            numDependents += mTasks[t].mNumDependents;
+            mTasks[t].mNumDependents = 0;
+        }
+        mDependents.Reserve(numDependents);
+        for (unsigned int d = 0; d < numDependents; ++d)
+        {
+            mDependents.PushEmpty();
+        }
+        for (unsigned int t = 0; t < numTasks; ++t)
+        {
+            const Task& task = mTasks[t];
+            for (unsigned int i = 0; i < task.mNumInputs; ++i)
+            {
+                if (task.mInputs[i] >= 0)
+                {
+                    Task& inputTask = mTasks[task.mInputs[i]];
+                    mDependents[inputTask.mFirstDependent + inputTask.mNumDependents++] = t;
+                }
+            }
+        }
+
+        // Generate the nodes, the calling thread runs its own tasks and helps the workers
+        {
+            Core::ScopedLock lock(mLock);
+            mNumCompletedTasks = 0;
+            for (unsigned int t = 0; t < numTasks; ++t)
+            {
+                if (mTasks[t].mNumPendingInputs == 0)
+                {
+                    (mTasks[t].mMainThread ? mMainThreadQueue : mWorkerQueue).Push(t);
+                }
+            }
+            mCondition.NotifyAll();
+
+            while (mNumCompletedTasks < numTasks)
+            {
+                Utils::Vector<unsigned int>& queue = mMainThreadQueue.GetSize() > 0 ? mMainThreadQueue : mWorkerQueue;
+                if (queue.GetSize() > 0)
+                {
+                    const unsigned int taskIndex = queue.Pop();
+                    mLock.Unlock();
+                    RunTask(taskIndex);
+                    mLock.Lock();
+                    CompleteTask(taskIndex);
+                }
+                else
+                {
+                    mCondition.Wait(mLock);
+                }
+            }
+        }
+
+        updated = updated || mTasks[rootTask].mUpdated;
+    }
+
+    mTasks.Clear();
+    mDependents.Clear();
+    mTaskIndices.Clear();
+    mGenerating.store(false);
+
+    // Without any task, such as for an evicted root, the serial evaluation generates the data
+    return rootTask >= 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::GenerateDataAsync(NodeAsyncJob* job, Node* node)
+{
+    PG_ASSERTSTR(job != nullptr && node != nullptr, "Invalid asynchronous job given to the node scheduler");
+    PG_ASSERTSTR(job->mNode == nullptr, "The asynchronous job of the node \"%s\" is already pending", node->GetName());
+
+    Core::ScopedLock lock(mLock);
+    job->mNode = node;
+    job->mCompleted.store(false);
+
+    if (mNumWorkers == 0)
+    {
+        RunAsyncJob(job);
+        return;
+    }
+
+    mAsyncQueue.Push(job);
+    mCondition.NotifyAll();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::WaitForAsyncJob(NodeAsyncJob* job)
+{
+    PG_ASSERTSTR(job != nullptr, "Invalid asynchronous job given to the node scheduler");
+    if (job->mNode == nullptr)
+    {
+        return;
+    }
+
+    Core::ScopedLock lock(mLock);
+
+    // A job still queued is generated right away rather than waiting for a worker
+    for (unsigned int j = 0; j < mAsyncQueue.GetSize(); ++j)
+    {
+        if (mAsyncQueue[j] == job)
+        {
+            mAsyncQueue.Delete(j);
+            RunAsyncJob(job);
+            return;
+        }
+    }
+
+    while (!job->mCompleted.load())
+    {
+        mCondition.Wait(mLock);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NodeScheduler::IsIdle()
+{
+    Core::ScopedLock lock(mLock);
+    return !mGenerating.load() && (mAsyncQueue.GetSize() == 0) && (mNumRunningAsyncJobs == 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+int NodeScheduler::AddTask(Node* node)
+{
+    // The changes are pushed to the dependent nodes (see Node::SetDirty()), so the inputs
+    // of a node neither dirty nor scheduled are up-to-date, the subgraph is left out
+    if (!node->IsDataDirty() && !node->IsUpdatePending())
+    {
+        return -1;
+    }
+
+    const int* existingTask = mTaskIndices.Find(node);
+    if (existingTask != nullptr)
+    {
+        PG_ASSERTSTR(*existingTask != sTaskInProgress, "Cycle found in a graph, the node \"%s\" depends on itself", node->GetName());
+        return *existingTask;
+    }
+    mTaskIndices.Insert(node, sTaskInProgress);
+
+    // The inputs are added first, a node has to be updated if its data is dirty or if an input has to be
+    int inputTasks[Node::MAX_NUM_INPUTS];
+    const unsigned int numInputs = node->GetNumInputs();
+    bool dirty = node->IsDataDirty();
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+        // Raw pointer, the input is kept alive by the node during the generation
+        inputTasks[i] = AddTask(&(*node->GetInput(i)));
+        dirty = dirty || (inputTasks[i] >= 0);
+    }
+
+    int taskIndex = -1;
+    if (dirty)
+    {
+        // The data of the evicted inputs is up-to-date but has to be generated again first
+        for (unsigned int i = 0; i < numInputs; ++i)
+        {
+            if ((inputTasks[i] < 0) && node->GetInput(i)->IsDataEvicted())
+            {
+                inputTasks[i] = AddEvictedTask(&(*node->GetInput(i)));
+            }
+        }
+
+        taskIndex = static_cast<int>(mTasks.GetSize());
+        Task& task = mTasks.PushEmpty();
+        task.mNode = node;
+        task.mNumInputs = numInputs;
+        task.mFirstDependent = 0;
+        task.mNumDependents = 0;
+        task.mNumPendingInputs = 0;
+        task.mMainThread = !node->IsGenerationThreadSafe();
+        task.mUpdated = false;
+        for (unsigned int i = 0; i < numInputs; ++i)
+        {
+            task.mInputs[i] = inputTasks[i];
+            task.mNumPendingInputs += (inputTasks[i] >= 0) ? 1 : 0;
+        }
+    }
+
+    mTaskIndices.Insert(node, taskIndex);
+    return taskIndex;
+}
+
+//----------------------------------------------------------------------------------------
+
+int NodeScheduler::AddEvictedTask(Node* node)
+{
+    const int* existingTask = mTaskIndices.Find(node);
+    if (existingTask != nullptr && *existingTask >= 0)
+    {
+        return *existingTask;
+    }
+
+    // The inputs of an up-to-date node are up-to-date, only the evicted ones need a task
+    int inputTasks[Node::MAX_NUM_INPUTS];
+    const unsigned int numInputs = node->GetNumInputs();
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+        Node* input = &(*node->GetInput(i));
+        inputTasks[i] = input->IsDataEvicted() ? AddEvictedTask(input) : -1;
+    }
+
+    const int taskIndex = static_cast<int>(mTasks.GetSize());
+    Task& task = mTasks.PushEmpty();
+    task.mNode = node;
+    task.mNumInputs = numInputs;
+    task.mFirstDependent = 0;
+    task.mNumDependents = 0;
+    task.mNumPendingInputs = 0;
+    task.mMainThread = !node->IsGenerationThreadSafe();
+    task.mUpdated = false;
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+        task.mInputs[i] = inputTasks[i];
+        task.mNumPendingInputs += (inputTasks[i] >= 0) ? 1 : 0;
+    }
+
+    mTaskIndices.Insert(node, taskIndex);
+    return taskIndex;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::RunTask(unsigned int taskIndex)
+{
+    // The input tasks are completed, their results were published by the lock
+    Task& task = mTasks[taskIndex];
+    bool inputUpdated = false;
+    for (unsigned int i = 0; i < task.mNumInputs; ++i)
+    {
+        if (task.mInputs[i] >= 0)
+        {
+            inputUpdated = inputUpdated || mTasks[task.mInputs[i]].mUpdated;
+        }
+    }
+
+    // The serial evaluation regenerates a node when an input has been regenerated during the same call.
+    // The inputs are up-to-date now, so the node is invalidated to get the same result
+    if (inputUpdated)
+    {
+        task.mNode->InvalidateData();
+    }
+
+    // The inputs are not visited again, the dependency graph has updated them already
+    bool updated = inputUpdated;
+    (void) task.mNode->GetUpdatedDataFromInputs(updated);
+    task.mUpdated = updated;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::CompleteTask(unsigned int taskIndex)
+{
+    const Task& task = mTasks[taskIndex];
+    for (unsigned int d = 0; d < task.mNumDependents; ++d)
+    {
+        const unsigned int dependentIndex = mDependents[task.mFirstDependent + d];
+        Task& dependent = mTasks[dependentIndex];
+
+        // A node using the same input several times depends on it once per use
+        if (--dependent.mNumPendingInputs == 0)
+        {
+            (dependent.mMainThread ? mMainThreadQueue : mWorkerQueue).Push(dependentIndex);
+        }
+    }
+
+    ++mNumCompletedTasks;
+    mCondition.NotifyAll();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::RunAsyncJob(NodeAsyncJob* job)
+{
+    ++mNumRunningAsyncJobs;
+    mLock.Unlock();
+    bool updated = false;
+    (void) job->mNode->GetUpdatedData(updated);
+    mLock.Lock();
+    --mNumRunningAsyncJobs;
+
+    job->mCompleted.store(true);
+    mCondition.NotifyAll();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::WorkerEntry(void* scheduler)
+{
+    static_cast<NodeScheduler*>(scheduler)->WorkerLoop();
+
+    // The slots the worker cached in the slab allocators are out of reach once the thread is gone
+    Memory::ReleaseThreadCaches();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::WorkerLoop()
+{
+    Core::ScopedLock lock(mLock);
+    for (;;)
+    {
+        while (!mStopWorkers && mWorkerQueue.GetSize() == 0 && mAsyncQueue.GetSize() == 0)
+        {
+            mCondition.Wait(mLock);
+        }
+        if (mStopWorkers)
+        {
+            return;
+        }
+
+        // The graph tasks first, the calling thread is waiting for them
+        if (mWorkerQueue.GetSize() > 0)
+        {
+            const unsigned int taskIndex = mWorkerQueue.Pop();
+            mLock.Unlock();
+            RunTask(taskIndex);
+            mLock.Lock();
+            CompleteTask(taskIndex);
+        }
+        else
+        {
+            RunAsyncJob(mAsyncQueue.Pop());
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeScheduler::StopWorkers()
+{
+    {
+        Core::ScopedLock lock(mLock);
+        mStopWorkers = true;
+    }
+    mCondition.NotifyAll();
+
+    for (unsigned int w = 0; w < mNumWorkers; ++w)
+    {
+        mWorkers[w].Join();
+    }
+    mNumWorkers = 0;
+
+    // The jobs left in the queue would never complete otherwise
+    Core::ScopedLock lock(mLock);
+    mStopWorkers = false;
+    while (mAsyncQueue.GetSize() > 0)
+    {
+        RunAsyncJob(mAsyncQueue.Pop());
+    }
+}
+
+
+}   // namespace Graph
+}   // namespace Pegasus
@@ -46,15 +46,22 @@ bool OperatorNode::Update()
                    numInputs, minNumInputs, maxNumInputs);
         return IsDataDirty();
     }
+
+    // Nothing has changed since the last visit, neither in this node nor in its inputs
+    if (!BeginUpdate())
+    {
+        return IsDataDirty();
+    }
     
-    // Update every input node and check if any has the dirty flag set
+    // Update every input node and check if any has the dirty flag set.
+    // The inputs that have not changed return right away
     bool dirtyFlagSet = false;
     for (unsigned i = 0; i < numInputs; ++i)
     {
         dirtyFlagSet |= GetInput(i)->Update();
     }
 
-    if (IsDataAllocated() && IsPropertyGridDirty())
+    if ((IsDataAllocated() || IsDataEvicted()) && IsPropertyGridDirty())
     {
         // If the property grid has members that are updated, invalidate the data
         dirtyFlagSet = true;
@@ -81,7 +88,43 @@ bool OperatorNode::Update()
     
 NodeDataReturn OperatorNode::GetUpdatedData(bool & updated)
 {
-    // Check the number of inputs
+    if (!IsNumInputsValid())
+    {
+        return GetData();
+    }
+
+    // Get the updated data for every input. The evicted inputs are up-to-date,
+    // they are generated again only if the current data has to be
+    bool inputUpdated = false;
+    const unsigned int numInputs = GetNumInputs();
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+        if (!GetInput(i)->IsDataEvicted())
+        {
+            (void) GetInput(i)->GetUpdatedData(inputUpdated);
+        }
+    }
+
+    return GenerateUpdatedData(inputUpdated, updated);
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataReturn OperatorNode::GetUpdatedDataFromInputs(bool & updated)
+{
+    if (!IsNumInputsValid())
+    {
+        return GetData();
+    }
+
+    // The caller has invalidated the data if an input has been updated
+    return GenerateUpdatedData(false, updated);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool OperatorNode::IsNumInputsValid() const
+{
     const unsigned int minNumInputs = GetMinNumInputNodes();
     const unsigned int maxNumInputs = GetMaxNumInputNodes();
     PG_ASSERTSTR(maxNumInputs >= minNumInputs, "Invalid boundaries for the number of inputs (%d,%d), the max should be >= to the min", minNumInputs, maxNumInputs);
@@ -90,40 +133,62 @@ NodeDataReturn OperatorNode::GetUpdatedData(bool & updated)
     {
         PG_FAILSTR("Invalid number of inputs for a node (%d), it should be between %d and %d",
                    numInputs, minNumInputs, maxNumInputs);
-        return GetData();
+        return false;
     }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
 
-    // If the data has not been allocated, allocate it now
+NodeDataReturn OperatorNode::GenerateUpdatedData(bool inputUpdated, bool & updated)
+{
+    // If the data has not been allocated, allocate it now.
+    // Data evicted by the memory budget is generated again the same way
+    const bool evicted = IsDataEvicted();
     if (!IsDataAllocated())
     {
         CreateData();
     }
     PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being updated");
 
-    // Get the updated data for every input
-    bool inputUpdated = false;
-    for (unsigned int i = 0; i < numInputs; ++i)
-    {
-        (void) GetInput(i)->GetUpdatedData(inputUpdated);
-    }
-
     // If any input has been updated or if the data is dirty, re-generate them
+    bool regenerated = false;
     if (inputUpdated || IsDataDirty())
     {
+        // The content of the evicted inputs is unchanged, they do not count as updated
+        bool inputRegenerated = false;
+        const unsigned int numInputs = GetNumInputs();
+        for (unsigned int i = 0; i < numInputs; ++i)
+        {
+            if (GetInput(i)->IsDataEvicted())
+            {
+                (void) GetInput(i)->GetUpdatedData(inputRegenerated);
+            }
+        }
+
         // If an input has been updated but the current data is not dirty,
         // re-invalidate the operator data so the GPU data dirty flag is set
         GetData()->Invalidate();
 
-        // Generate the node data using the operator-specific code
-        GenerateData();
+        // Generate the node data using the operator-specific code, or load it from the node data cache
+        GenerateCachedData();
 
         // Validate the node data, the GPU node data is still dirty
         GetData()->Validate();
 
-        updated = true;
+        // The content of evicted data is unchanged, the dependent nodes do not need an update
+        if (evicted && !inputUpdated)
+        {
+            regenerated = true;
+        }
+        else
+        {
+            updated = true;
+        }
     }
     PG_ASSERTSTR(!IsDataDirty(), "Node data is supposed to be up-to-date at this point");
 
+    TouchData(regenerated);
     return GetData();
 }
 
@@ -10,6 +10,7 @@
 //! \brief	Base output node class, for the root of the graphs
 
 #include "Pegasus/Graph/OutputNode.h"
+#include "Pegasus/Graph/NodeManager.h"
 #include "Pegasus/AssetLib/Asset.h"
 
 namespace Pegasus {
@@ -22,7 +23,8 @@ END_IMPLEMENT_PROPERTIES(OutputNode)
 //----------------------------------------------------------------------------------------
 
 OutputNode::OutputNode(NodeManager* nodeManager, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
-:   Node(nodeAllocator, nodeDataAllocator), AssetLib::RuntimeAssetObject(this), mNodeManager(nodeManager)
+:   Node(nodeAllocator, nodeDataAllocator), AssetLib::RuntimeAssetObject(this), mNodeManager(nodeManager),
+    mAsyncGeneration(false), mRequestFrameIndex(0), mPlan(nodeAllocator)
 {
     BEGIN_INIT_PROPERTIES(OutputNode)
     END_INIT_PROPERTIES()
@@ -39,9 +41,21 @@ bool OutputNode::Update()
     // Check that no data is allocated
     PG_ASSERTSTR(!IsDataAllocated(), "Invalid output node, it should not contain NodeData");
 
+    // The graph belongs to the worker thread until the pending data is completed
+    if (IsDataPending())
+    {
+        return true;
+    }
+
     // Check that the input node is defined
     if (GetNumInputs() == 1)
     {
+        // Nothing has changed in the graph since the last visit
+        if (!BeginUpdate())
+        {
+            return GetInput(0)->IsDataDirty();
+        }
+
         // Update the input node and return its dirty state
         return GetInput(0)->Update();
     }
@@ -63,8 +77,67 @@ NodeDataReturn OutputNode::GetUpdatedData(bool & updated)
     // Check that the input node is defined
     if (GetNumInputs() == 1)
     {
-        // Redirect the updated data from the input node
-        return GetInput(0)->GetUpdatedData(updated);
+        NodeRef inputNode = GetInput(0);
+
+        // The completed data is swapped in at the first request of a frame only,
+        // so every request of a frame gets the same data
+        if (IsDataPending())
+        {
+            if (!CanGenerateAsync())
+            {
+                CompleteAsyncGeneration();
+                updated = true;
+            }
+            else if (mAsyncJob.mCompleted.load() && (mRequestFrameIndex != mNodeManager->GetFrameIndex()))
+            {
+                SwapAsyncData();
+                updated = true;
+            }
+            else
+            {
+                mRequestFrameIndex = mNodeManager->GetFrameIndex();
+                return mFrontData;
+            }
+        }
+
+        // Only the dirty graphs are handed to the worker threads, the clean ones go through the plan,
+        // which returns the data without recursion. The changes are pushed to the dependent nodes,
+        // so the input node is dirty or scheduled whenever any node of the graph is
+        const bool inputDirty = inputNode->IsDataDirty() || inputNode->IsUpdatePending();
+
+        // A dirty graph with data to show meanwhile is generated on a worker thread,
+        // into a new buffer for the input node
+        if (inputDirty && CanGenerateAsync() && inputNode->IsDataAllocated())
+        {
+            mRequestFrameIndex = mNodeManager->GetFrameIndex();
+
+            bool dirty = false;
+            bool threadSafe = true;
+            InspectGraph(&(*inputNode), dirty, threadSafe);
+            if (dirty && threadSafe)
+            {
+                mFrontData = inputNode->GetData();
+                inputNode->ReleaseData();
+                SetGraphAsyncJob(&(*inputNode), &mAsyncJob);
+                mNodeManager->GetScheduler()->GenerateDataAsync(&mAsyncJob, &(*inputNode));
+                return mFrontData;
+            }
+        }
+
+        // Generate the independent dirty nodes of the graph in parallel if possible,
+        // the input data is then up-to-date and the graph is not traversed again
+        if (inputDirty && (mNodeManager != nullptr) && mNodeManager->GetScheduler()->GenerateData(&(*inputNode), updated))
+        {
+            return inputNode->GetData();
+        }
+
+        // Redirect the updated data from the input node, evaluating its graph
+        // linearly from the compiled plan rather than recursively
+        if (!mPlan.IsCompiled())
+        {
+            mPlan.Compile(inputNode);
+        }
+        return mPlan.Execute(updated);
     }
     else
     {
@@ -81,10 +154,40 @@ NodeDataReturn OutputNode::GetUpdatedData()
     return GetUpdatedData(updated);
 }
 
+//----------------------------------------------------------------------------------------
+
+void OutputNode::SetAsyncGeneration(bool async)
+{
+    if (!async)
+    {
+        CompleteAsyncGeneration();
+    }
+    mAsyncGeneration = async;
+}
+
+//----------------------------------------------------------------------------------------
+
+void OutputNode::CompleteAsyncGeneration()
+{
+    if (IsDataPending())
+    {
+        mNodeManager->GetScheduler()->WaitForAsyncJob(&mAsyncJob);
+        SwapAsyncData();
+    }
+}
+
 //----------------------------------------------------------------------------------------
     
 OutputNode::~OutputNode()
 {
+    // Swapping the data here would call OnAsyncDataSwapped() of a destroyed derived class
+    PG_ASSERTSTR(!IsDataPending(), "The asynchronous generation of the output node \"%s\" has to be completed by the derived class destructor", GetName());
+
+    // The base destructor removes the input without calling OnRemoveInput() of the output node
+    if (GetNumInputs() > 0)
+    {
+        --GetInput(0)->mNumOutputs;
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -114,6 +217,12 @@ void OutputNode::AddInput(NodeIn inputNode)
     }
 
     Node::AddInput(inputNode);
+
+    // The data shown by an output node is never evicted by the memory budget
+    if (GetNumInputs() > 0)
+    {
+        ++GetInput(0)->mNumOutputs;
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -132,13 +241,74 @@ void OutputNode::ReplaceInput(unsigned int index, const Pegasus::Core::Ref<Node>
         return;
     }
 
+    CompleteAsyncGeneration();
+    mPlan.Clear();
+    --GetInput(0)->mNumOutputs;
     Node::ReplaceInput(0, inputNode);
+    ++GetInput(0)->mNumOutputs;
 }
 
 //----------------------------------------------------------------------------------------
 
 void OutputNode::OnRemoveInput(unsigned int index)
 {
+    // The input node is generated by a worker thread until completion
+    CompleteAsyncGeneration();
+    mPlan.Clear();
+    --GetInput(index)->mNumOutputs;
+}
+
+//----------------------------------------------------------------------------------------
+
+void OutputNode::OnAsyncDataSwapped(NodeData* previousData)
+{
+    // Empty default behavior
+}
+
+//----------------------------------------------------------------------------------------
+
+bool OutputNode::CanGenerateAsync() const
+{
+    return mAsyncGeneration
+        && (mNodeManager != nullptr)
+        && mNodeManager->IsAsyncGenerationEnabled()
+        && (mNodeManager->GetScheduler()->GetNumWorkers() > 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+void OutputNode::SwapAsyncData()
+{
+    PG_ASSERTSTR(mAsyncJob.mCompleted.load(), "The data of the output node \"%s\" is swapped before being completed", GetName());
+
+    NodeDataRef previousData = mFrontData;
+    mFrontData = nullptr;
+    SetGraphAsyncJob(mAsyncJob.mNode, nullptr);
+    mAsyncJob.mNode = nullptr;
+    OnAsyncDataSwapped(&(*previousData));
+}
+
+//----------------------------------------------------------------------------------------
+
+void OutputNode::InspectGraph(const Node* node, bool& dirty, bool& threadSafe)
+{
+    dirty = dirty || node->IsDataDirty();
+    threadSafe = threadSafe && node->IsGenerationThreadSafe();
+    for (unsigned int i = 0; (i < node->GetNumInputs()) && threadSafe; ++i)
+    {
+        InspectGraph(&(*node->GetInput(i)), dirty, threadSafe);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void OutputNode::SetGraphAsyncJob(Node* node, NodeAsyncJob* job)
+{
+    node->mAsyncJob = job;
+    for (unsigned int i = 0; i < node->GetNumInputs(); ++i)
+    {
+        SetGraphAsyncJob(&(*node->GetInput(i)), job);
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -16,16 +16,21 @@
 using namespace Pegasus;
 using namespace Pegasus::Memory;
 
-//increase the page list 10 elements at a time
-const int BlockAllocator::sPageIncrement = 10;
+//initial capacity of the page list, doubled every time it is full
+const int BlockAllocator::sInitialPageListCount = 16;
 
 BlockAllocator::BlockAllocator() : 
     mAllocator(nullptr), 
-    mMemoryPages(nullptr),
     mMemoryPageListCount(0),
     mMemoryPageListSize(0),
-    mMemorySize(0),
-    mPageSize(0)
+    mMemoryPages(nullptr),
+    mPageSize(0),
+    mCurrentPage(0),
+    mPageOffset(0),
+    mLastAllocation(nullptr),
+    mLastOffset(0),
+    mRetainedBudget(sDefaultRetainedBudget),
+    mBigAllocations(nullptr)
 {
 }
 
@@ -49,40 +54,12 @@ void* BlockAllocator::Alloc(
         unsigned int line
 )
 {
-    int size = static_cast<int>(tsize);
-    PG_ASSERTSTR(size < mPageSize, "Cannot allocate size greater than the page size! Memory trashing to follow.");
-    int newMemSize = mMemorySize + size;
-	int targetPage = newMemSize / mPageSize;
-    if (targetPage >= mMemoryPageListCount)
-    {
-        PG_ASSERT(targetPage == mMemoryPageListCount);
-        int newPagesCount = mMemoryPageListCount + sPageIncrement;
-        char ** newList = static_cast<char**>(mAllocator->Alloc(static_cast<size_t>(newPagesCount * sizeof(char*)), Alloc::PG_MEM_PERM, -1, "Page Vector", __FILE__, __LINE__));            
-		if (mMemoryPages != nullptr)
-		{
-			Utils::Memcpy(newList, mMemoryPages, static_cast<unsigned>(mMemoryPageListCount * sizeof(char*)));
-			mAllocator->Delete(mMemoryPages);
-		}
-        mMemoryPages = newList;
-        mMemoryPageListCount = newPagesCount;
-    }
-
-    if (targetPage >= mMemoryPageListSize)
+    //no padding, the containers rely on consecutive allocations being packed
+    if (tsize > static_cast<size_t>(mPageSize))
     {
-        PG_ASSERT(mMemoryPageListSize <= mMemoryPageListCount);
-        PG_ASSERT(targetPage == mMemoryPageListSize);        
-        mMemoryPages[targetPage] = static_cast<char*>(mAllocator->Alloc(static_cast<size_t>(mPageSize), Alloc::PG_MEM_PERM, -1, "Page Vector", __FILE__, __LINE__));
-        ++mMemoryPageListSize;
+        return AllocBig(tsize, 1);
     }
-
-	
-    int prevPage = (mMemorySize / mPageSize);
-	bool isUnaligned = (((mMemorySize + size) % mPageSize) != 0) && (prevPage != targetPage);
-    int currentOffset = mMemorySize % mPageSize;
-    int offset = isUnaligned ? 0 : currentOffset ;
-	int actualPage = isUnaligned ? targetPage : prevPage;
-    mMemorySize = newMemSize + (isUnaligned ? mPageSize - currentOffset : 0);
-    return mMemoryPages[actualPage] + offset;
+    return AllocFromPages(static_cast<int>(tsize), 1);
 }
 
 void* BlockAllocator::AllocAlign(
@@ -95,18 +72,176 @@ void* BlockAllocator::AllocAlign(
     unsigned int line
 )
 {
-    PG_FAILSTR("Alloc Align not supported in BlockAllocator!");
-	return nullptr;
+    PG_ASSERTSTR(align != 0 && (align & (align - 1)) == 0, "Alignment has to be a power of 2");
+    if (size + align - 1 > static_cast<size_t>(mPageSize))
+    {
+        return AllocBig(size, align);
+    }
+    return AllocFromPages(static_cast<int>(size), static_cast<int>(align));
+}
+
+void* BlockAllocator::AllocFromPages(int size, int align)
+{
+    if (mCurrentPage == mMemoryPageListSize && !NewPage())
+    {
+        return nullptr;
+    }
+
+    size_t base = reinterpret_cast<size_t>(mMemoryPages[mCurrentPage]);
+    int offset = static_cast<int>(((base + mPageOffset + align - 1) & ~static_cast<size_t>(align - 1)) - base);
+    if (offset + size > mPageSize)
+    {
+        //move to the next page, reusing the pages retained by Reset
+        ++mCurrentPage;
+        mPageOffset = 0;
+        if (mCurrentPage == mMemoryPageListSize && !NewPage())
+        {
+            --mCurrentPage;
+            return nullptr;
+        }
+        base = reinterpret_cast<size_t>(mMemoryPages[mCurrentPage]);
+        offset = static_cast<int>(((base + align - 1) & ~static_cast<size_t>(align - 1)) - base);
+    }
+
+    mLastOffset = mPageOffset;
+    mPageOffset = offset + size;
+    mLastAllocation = mMemoryPages[mCurrentPage] + offset;
+    return mLastAllocation;
+}
+
+void* BlockAllocator::AllocBig(size_t size, Alloc::Alignment align)
+{
+    //the header goes right before the returned memory
+    size_t headerSize = (sizeof(BigAllocation) + align - 1) & ~(align - 1);
+    void* block = mAllocator->AllocAlign(size + headerSize, align, Alloc::PG_MEM_TEMP, -1, "Block Allocator Big Allocation", __FILE__, __LINE__);
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    char* mem = static_cast<char*>(block) + headerSize;
+    BigAllocation* bigAllocation = reinterpret_cast<BigAllocation*>(mem) - 1;
+    bigAllocation->mBlock = block;
+    bigAllocation->mPrev = nullptr;
+    bigAllocation->mNext = mBigAllocations;
+    if (mBigAllocations != nullptr)
+    {
+        mBigAllocations->mPrev = bigAllocation;
+    }
+    mBigAllocations = bigAllocation;
+    return mem;
+}
+
+bool BlockAllocator::NewPage()
+{
+    PG_ASSERT(mMemoryPageListSize <= mMemoryPageListCount);
+    if (mMemoryPageListSize == mMemoryPageListCount)
+    {
+        int newPagesCount = mMemoryPageListCount == 0 ? sInitialPageListCount : mMemoryPageListCount * 2;
+        char ** newList = static_cast<char**>(mAllocator->Alloc(static_cast<size_t>(newPagesCount * sizeof(char*)), Alloc::PG_MEM_PERM, -1, "Page Vector", __FILE__, __LINE__));            
+        if (newList == nullptr)
+        {
+            return false;
+        }
+        if (mMemoryPages != nullptr)
+        {
+            Utils::Memcpy(newList, mMemoryPages, static_cast<unsigned>(mMemoryPageListSize * sizeof(char*)));
+            mAllocator->Delete(mMemoryPages);
+        }
+        mMemoryPages = newList;
+        mMemoryPageListCount = newPagesCount;
+    }
+
+    char* page = static_cast<char*>(mAllocator->Alloc(static_cast<size_t>(mPageSize), Alloc::PG_MEM_PERM, -1, "Page Vector", __FILE__, __LINE__));
+    if (page == nullptr)
+    {
+        return false;
+    }
+    mMemoryPages[mMemoryPageListSize++] = page;
+    return true;
 }
 
 void BlockAllocator::Delete(void* ptr)
 {
-    PG_FAILSTR("Atomic deletions not allowed in the greedy Ast Allocator!");
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    if (ptr == mLastAllocation)
+    {
+        //the last allocation goes back to the page
+        mPageOffset = mLastOffset;
+        mLastAllocation = nullptr;
+        return;
+    }
+
+    for (BigAllocation* bigAllocation = mBigAllocations; bigAllocation != nullptr; bigAllocation = bigAllocation->mNext)
+    {
+        if (bigAllocation + 1 == ptr)
+        {
+            if (bigAllocation->mPrev != nullptr)
+            {
+                bigAllocation->mPrev->mNext = bigAllocation->mNext;
+            }
+            else
+            {
+                mBigAllocations = bigAllocation->mNext;
+            }
+            if (bigAllocation->mNext != nullptr)
+            {
+                bigAllocation->mNext->mPrev = bigAllocation->mPrev;
+            }
+            mAllocator->Delete(bigAllocation->mBlock);
+            return;
+        }
+    }
+
+    //any other allocation from the pages is released by Reset
+}
+
+void BlockAllocator::Rewind(int page, int offset)
+{
+    PG_ASSERT(page >= 0 && offset >= 0 && offset <= mPageSize);
+    PG_ASSERTSTR(page < mCurrentPage || (page == mCurrentPage && offset <= mPageOffset), "Can only rewind to a previous allocation point!");
+    mCurrentPage = page;
+    mPageOffset = offset;
+    mLastAllocation = nullptr;
 }
 
 void BlockAllocator::Reset()
 {
-    mMemorySize = 0;
+    FreeBigAllocations();
+
+    //give back the pages above the budget, keeping at least one page
+    if (mPageSize > 0)
+    {
+        int retainedPages = mRetainedBudget / mPageSize;
+        if (retainedPages < 1)
+        {
+            retainedPages = 1;
+        }
+        while (mMemoryPageListSize > retainedPages)
+        {
+            mAllocator->Delete(mMemoryPages[--mMemoryPageListSize]);
+        }
+    }
+
+    mCurrentPage = 0;
+    mPageOffset = 0;
+    mLastAllocation = nullptr;
+}
+
+void BlockAllocator::FreeBigAllocations()
+{
+    BigAllocation* bigAllocation = mBigAllocations;
+    while (bigAllocation != nullptr)
+    {
+        BigAllocation* next = bigAllocation->mNext;
+        mAllocator->Delete(bigAllocation->mBlock);
+        bigAllocation = next;
+    }
+    mBigAllocations = nullptr;
 }
 
 void BlockAllocator::FreeMemory()
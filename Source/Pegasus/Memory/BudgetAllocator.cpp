@@ -0,0 +1,180 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BudgetAllocator.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Allocator decorator enforcing a memory budget, with a soft limit asking the
+//!         owners of the memory to evict their caches, and a hard limit failure policy.
+
+#include "Pegasus/Memory/BudgetAllocator.h"
+
+namespace Pegasus {
+namespace Memory {
+
+//! True while the current thread runs a budget callback, the allocations of the callback do not send events
+static PEGASUS_THREAD_LOCAL bool sInBudgetCallback = false;
+
+//----------------------------------------------------------------------------------------
+
+BudgetAllocator::BudgetAllocator(Alloc::IAllocator* allocator)
+    : mAllocator(allocator),
+      mSoftLimit(0),
+      mHardLimit(0),
+      mPolicy(BUDGET_POLICY_ASSERT),
+      mCallback(nullptr),
+      mUserData(nullptr)
+{
+    PG_ASSERT(sizeof(AllocationHeader) == 16);
+    mLiveBytes.store(0);
+    mSoftArmed.store(true);
+}
+
+//----------------------------------------------------------------------------------------
+
+BudgetAllocator::~BudgetAllocator()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void* BudgetAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    if (!Charge(size))
+    {
+        return nullptr;
+    }
+
+    char* block = static_cast<char*>(mAllocator->Alloc(size + sizeof(AllocationHeader), flags, category, debugText, file, line));
+    if (block == nullptr)
+    {
+        Discharge(size);
+        return nullptr;
+    }
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(block);
+    header->mSize = size;
+    header->mOffset = sizeof(AllocationHeader);
+    return header + 1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void* BudgetAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    if (!Charge(size))
+    {
+        return nullptr;
+    }
+
+    // The header fits in the padding, which keeps the returned memory aligned
+    const size_t offset = align > sizeof(AllocationHeader) ? align : sizeof(AllocationHeader);
+    char* block = static_cast<char*>(mAllocator->AllocAlign(size + offset, align, flags, category, debugText, file, line));
+    if (block == nullptr)
+    {
+        Discharge(size);
+        return nullptr;
+    }
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(block + offset) - 1;
+    header->mSize = size;
+    header->mOffset = offset;
+    return block + offset;
+}
+
+//----------------------------------------------------------------------------------------
+
+void BudgetAllocator::Delete(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    const AllocationHeader* header = static_cast<const AllocationHeader*>(ptr) - 1;
+    const size_t size = static_cast<size_t>(header->mSize);
+    mAllocator->Delete(static_cast<char*>(ptr) - header->mOffset);
+    Discharge(size);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BudgetAllocator::SetLimits(size_t softLimit, size_t hardLimit, BudgetPolicy policy)
+{
+    PG_ASSERTSTR(hardLimit == 0 || softLimit <= hardLimit, "The soft limit of a budget has to be under its hard limit");
+    mSoftLimit = softLimit;
+    mHardLimit = hardLimit;
+    mPolicy = policy;
+    mSoftArmed.store(softLimit == 0 || GetLiveBytes() <= softLimit);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BudgetAllocator::SetCallback(BudgetCallback callback, void* userData)
+{
+    mCallback = callback;
+    mUserData = userData;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool BudgetAllocator::Charge(size_t size)
+{
+    size_t liveBytes = mLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    if (mHardLimit != 0 && liveBytes > mHardLimit)
+    {
+        // Give the owners a chance to free memory before applying the policy
+        mLiveBytes.fetch_sub(size, std::memory_order_relaxed);
+        Notify(BUDGET_EVENT_HARD_LIMIT, size);
+        liveBytes = mLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        if (liveBytes > mHardLimit)
+        {
+            if (mPolicy == BUDGET_POLICY_FAIL)
+            {
+                mLiveBytes.fetch_sub(size, std::memory_order_relaxed);
+                return false;
+            }
+            else if (mPolicy == BUDGET_POLICY_ASSERT)
+            {
+                PG_FAILSTR("Memory budget exceeded! Allocating anyway.");
+            }
+        }
+    }
+
+    if (mSoftLimit != 0 && liveBytes > mSoftLimit && mSoftArmed.exchange(false, std::memory_order_relaxed))
+    {
+        Notify(BUDGET_EVENT_SOFT_LIMIT, size);
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void BudgetAllocator::Discharge(size_t size)
+{
+    const size_t liveBytes = mLiveBytes.fetch_sub(size, std::memory_order_relaxed) - size;
+    if (mSoftLimit != 0 && liveBytes <= mSoftLimit && !mSoftArmed.load(std::memory_order_relaxed))
+    {
+        mSoftArmed.store(true, std::memory_order_relaxed);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BudgetAllocator::Notify(BudgetEvent event, size_t size)
+{
+    BudgetCallback callback = mCallback;
+    if (callback != nullptr && !sInBudgetCallback)
+    {
+        sInBudgetCallback = true;
+        callback(event, GetLiveBytes(), size, mUserData);
+        sInBudgetCallback = false;
+    }
+}
+
+
+}   // namespace Memory
+}   // namespace Pegasus
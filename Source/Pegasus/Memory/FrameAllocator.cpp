@@ -0,0 +1,229 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FrameAllocator.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Double buffered linear allocator for the temporaries of a frame.
+//!         Allocation is a pointer bump, and the memory is reclaimed in bulk by Flip().
+
+#include "Pegasus/Memory/FrameAllocator.h"
+#include "Pegasus/Memory/MemoryStats.h"
+#include <stdlib.h>
+#include <string.h>
+
+namespace Pegasus {
+namespace Memory {
+
+//! value of AllocationHeader::mMagic
+static const unsigned int sAllocationMagic = 0xF4A3E000;
+
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+static const size_t sAllocationHeaderSize = 16;
+#else
+static const size_t sAllocationHeaderSize = 0;
+#endif
+
+//----------------------------------------------------------------------------------------
+
+FrameAllocator::FrameAllocator(unsigned int allocId, size_t pageSize)
+    : mAllocId(allocId),
+      mPageSize(pageSize),
+      mCurrent(0),
+      mFrame(0)
+{
+    PG_ASSERT(sizeof(AllocationHeader) == 16);
+    mLock.clear();
+
+    for (int i = 0; i < 2; ++i)
+    {
+        mBuffers[i].mPages = nullptr;
+        mBuffers[i].mBytes = 0;
+        mBuffers[i].mAllocationCount = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+FrameAllocator::~FrameAllocator()
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        Page* page = mBuffers[i].mPages;
+        while (page != nullptr)
+        {
+            Page* next = page->mNext;
+            free(page);
+            page = next;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void* FrameAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    return AllocAlign(size, 16, flags, category, debugText, file, line);
+}
+
+//----------------------------------------------------------------------------------------
+
+void* FrameAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    PG_ASSERTSTR(align != 0 && (align & (align - 1)) == 0, "Alignment has to be a power of 2");
+
+    Lock();
+
+    Buffer& buffer = mBuffers[mCurrent];
+    Page* page = buffer.mPages;
+    size_t base = 0;
+    size_t ret = 0;
+    size_t used = 0;
+    if (page != nullptr)
+    {
+        base = reinterpret_cast<size_t>(page + 1);
+        ret = (base + page->mUsed + sAllocationHeaderSize + align - 1) & ~(align - 1);
+        used = ret + size - base;
+    }
+
+    if (page == nullptr || used > page->mSize)
+    {
+        // The first page of a frame has the default size, overflow pages are chained and merged on reset
+        size_t pageSize = size + sAllocationHeaderSize + align;
+        if (pageSize < mPageSize)
+        {
+            pageSize = mPageSize;
+        }
+
+        Page* newPage = NewPage(pageSize);
+        if (newPage == nullptr)
+        {
+            Unlock();
+            return nullptr;
+        }
+        newPage->mNext = page;
+        buffer.mPages = newPage;
+        page = newPage;
+
+        base = reinterpret_cast<size_t>(page + 1);
+        ret = (base + sAllocationHeaderSize + align - 1) & ~(align - 1);
+        used = ret + size - base;
+    }
+
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+    // The free memory is poisoned. Anything else means a pointer from a previous frame was written to
+    const unsigned char* freeMemory = reinterpret_cast<const unsigned char*>(base + page->mUsed);
+    for (size_t i = 0; i < used - page->mUsed; ++i)
+    {
+        PG_ASSERTSTR(freeMemory[i] == sPoisonValue, "Frame allocation written after its frame was reset!  Memory corruption may follow...");
+    }
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(ret) - 1;
+    header->mMagic = sAllocationMagic;
+    header->mFrame = mFrame;
+    header->mSize = static_cast<unsigned int>(size);
+    header->mPad = 0;
+#endif
+
+    const size_t bytes = used - page->mUsed;
+    page->mUsed = used;
+    buffer.mBytes += bytes;
+    ++buffer.mAllocationCount;
+
+    Unlock();
+
+#if PEGASUS_ENABLE_MEMORY_STATS
+    RecordAllocation(mAllocId, bytes, size);
+#endif
+
+    return reinterpret_cast<void*>(ret);
+}
+
+//----------------------------------------------------------------------------------------
+
+void FrameAllocator::Delete(void* ptr)
+{
+    // Nothing to release, the memory is reclaimed in bulk by Flip()
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+    if (ptr != nullptr)
+    {
+        // Reclaimed memory is poisoned, so a stale pointer also fails the magic check
+        const AllocationHeader* header = static_cast<const AllocationHeader*>(ptr) - 1;
+        PG_ASSERTSTR(header->mMagic == sAllocationMagic, "Pointer is not a frame allocation, or it survived a frame reset!  Memory corruption may follow...");
+        PG_ASSERTSTR(mFrame - header->mFrame <= 1, "Frame allocation survived a frame reset!  Memory corruption may follow...");
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void FrameAllocator::Flip()
+{
+    Lock();
+    ++mFrame;
+    mCurrent ^= 1;
+    ResetBuffer(mBuffers[mCurrent]);
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+FrameAllocator::Page* FrameAllocator::NewPage(size_t size)
+{
+    Page* page = static_cast<Page*>(malloc(sizeof(Page) + size));
+    if (page != nullptr)
+    {
+        page->mNext = nullptr;
+        page->mSize = size;
+        page->mUsed = 0;
+
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+        memset(page + 1, sPoisonValue, size);
+#endif
+    }
+    return page;
+}
+
+//----------------------------------------------------------------------------------------
+
+void FrameAllocator::ResetBuffer(Buffer& buffer)
+{
+#if PEGASUS_ENABLE_MEMORY_STATS
+    if (buffer.mAllocationCount != 0)
+    {
+        RecordFree(mAllocId, buffer.mBytes, buffer.mAllocationCount);
+    }
+#endif
+
+    Page* page = buffer.mPages;
+    if (page != nullptr && page->mNext != nullptr)
+    {
+        // The buffer overflowed, replace its pages with a single page big enough for the whole frame
+        size_t totalSize = 0;
+        while (page != nullptr)
+        {
+            Page* next = page->mNext;
+            totalSize += page->mSize;
+            free(page);
+            page = next;
+        }
+        buffer.mPages = NewPage(totalSize);
+    }
+    else if (page != nullptr)
+    {
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+        memset(page + 1, sPoisonValue, page->mUsed);
+#endif
+        page->mUsed = 0;
+    }
+
+    buffer.mBytes = 0;
+    buffer.mAllocationCount = 0;
+}
+
+
+}   // namespace Memory
+}   // namespace Pegasus
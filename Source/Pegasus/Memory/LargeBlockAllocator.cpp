@@ -0,0 +1,414 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LargeBlockAllocator.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Arena for the large buffers of the node data (texture layers, mesh streams),
+//!         carved out of 2MB chunks mapped with huge pages when available.
+
+#include "Pegasus/Memory/LargeBlockAllocator.h"
+#include "Pegasus/Memory/MemoryStats.h"
+#include <stdlib.h>
+
+namespace Pegasus {
+namespace Memory {
+
+//! Smallest free block left when splitting a block, smaller remainders stay in the allocated block
+static const size_t sMinSplitSize = 4096;
+
+//----------------------------------------------------------------------------------------
+
+//! \return the number of huge pages in the address space
+static inline size_t GetHugePageCount()
+{
+    // 48 bits of user address space on 64 bits platforms
+    return sizeof(void*) == 8 ? (size_t(1) << (48 - 21)) : (size_t(1) << (32 - 21));
+}
+
+//----------------------------------------------------------------------------------------
+
+LargeBlockAllocator::LargeBlockAllocator(unsigned int allocId, Alloc::IAllocator* smallAllocator, size_t threshold)
+    : mAllocId(allocId),
+      mSmallAllocator(smallAllocator),
+      mThreshold(threshold),
+      mChunks(nullptr),
+      mFreeBlocks(nullptr),
+      mChunkCount(0),
+      mHugePageChunkCount(0),
+      mEmptyChunkCount(0),
+      mLiveBlocks(0),
+      mMappedBytes(0)
+{
+    PG_ASSERT(sizeof(BlockHeader) == sBlockAlignment);
+    PG_ASSERT(sizeof(Chunk) == sBlockAlignment);
+    PG_ASSERTSTR(smallAllocator != nullptr, "The large block allocator needs an allocator for the small allocations");
+    mLock.clear();
+
+    // Zeroed pages, only the ones holding used entries get committed
+    const size_t leafCount = GetHugePageCount() >> sChunkMapLeafBits;
+    mChunkMap = static_cast<std::atomic<std::atomic<unsigned char>*>*>(calloc(leafCount, sizeof(std::atomic<std::atomic<unsigned char>*>)));
+    PG_ASSERTSTR(mChunkMap != nullptr, "Cannot allocate the chunk map of the large block allocator");
+}
+
+//----------------------------------------------------------------------------------------
+
+LargeBlockAllocator::~LargeBlockAllocator()
+{
+    // Static allocators can be destroyed before the last objects are freed,
+    // in which case the chunks are left to the process teardown
+    if (mLiveBlocks == 0)
+    {
+        while (mChunks != nullptr)
+        {
+            ReleaseChunk(mChunks);
+        }
+
+        const size_t leafCount = GetHugePageCount() >> sChunkMapLeafBits;
+        for (size_t l = 0; l < leafCount; ++l)
+        {
+            free(mChunkMap[l].load(std::memory_order_relaxed));
+        }
+        free(mChunkMap);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void* LargeBlockAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    if (size < mThreshold)
+    {
+        return mSmallAllocator->Alloc(size, flags, category, debugText, file, line);
+    }
+
+    const size_t blockSize = ((size + sBlockAlignment - 1) & ~(sBlockAlignment - 1)) + sizeof(BlockHeader);
+    BlockHeader* block = nullptr;
+
+    if (blockSize > sHugePageSize - sizeof(Chunk))
+    {
+        // Larger than a chunk, mapped on its own and given back as soon as it is deleted
+        const size_t chunkSize = (blockSize + sizeof(Chunk) + sHugePageSize - 1) & ~(sHugePageSize - 1);
+        Lock();
+        Chunk* chunk = NewChunk(chunkSize, true);
+        if (chunk == nullptr)
+        {
+            Unlock();
+            return nullptr;
+        }
+        block = reinterpret_cast<BlockHeader*>(chunk + 1);
+    }
+    else
+    {
+        Lock();
+
+        // First fit. The free blocks are large and few, the list stays short
+        block = mFreeBlocks;
+        while (block != nullptr && block->mSize < blockSize)
+        {
+            block = block->mNextFree;
+        }
+
+        if (block == nullptr)
+        {
+            Chunk* chunk = NewChunk(sHugePageSize, false);
+            if (chunk == nullptr)
+            {
+                Unlock();
+                return nullptr;
+            }
+            block = reinterpret_cast<BlockHeader*>(chunk + 1);
+            PushFree(block);
+            ++mEmptyChunkCount;
+        }
+
+        if (IsWholeChunk(block))
+        {
+            --mEmptyChunkCount;
+        }
+        RemoveFree(block);
+
+        // Split, the remainder stays free
+        if (block->mSize - blockSize >= sMinSplitSize)
+        {
+            BlockHeader* remainder = reinterpret_cast<BlockHeader*>(reinterpret_cast<char*>(block) + blockSize);
+            remainder->mSize = block->mSize - blockSize;
+            remainder->mPrevSize = blockSize;
+            remainder->mChunk = block->mChunk;
+            block->mSize = blockSize;
+
+            BlockHeader* next = GetNextBlock(remainder);
+            if (next != nullptr)
+            {
+                next->mPrevSize = remainder->mSize;
+            }
+            PushFree(remainder);
+        }
+    }
+
+    block->mFree = 0;
+    block->mRequested = size;
+    ++mLiveBlocks;
+#if PEGASUS_ENABLE_MEMORY_STATS
+    const size_t bytes = block->mSize;
+#endif
+    Unlock();
+
+#if PEGASUS_ENABLE_MEMORY_STATS
+    RecordAllocation(mAllocId, bytes, size);
+#endif
+    return block + 1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void* LargeBlockAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    if (size < mThreshold)
+    {
+        return mSmallAllocator->AllocAlign(size, align, flags, category, debugText, file, line);
+    }
+
+    PG_ASSERTSTR(align <= sBlockAlignment, "The large block allocator only aligns to 64 bytes");
+    return Alloc(size, flags, category, debugText, file, line);
+}
+
+//----------------------------------------------------------------------------------------
+
+void LargeBlockAllocator::Delete(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    // The blocks never start in a different huge page than their chunk header
+    if (!OwnsChunk(reinterpret_cast<size_t>(ptr) & ~(sHugePageSize - 1)))
+    {
+        mSmallAllocator->Delete(ptr);
+        return;
+    }
+
+    BlockHeader* block = static_cast<BlockHeader*>(ptr) - 1;
+    PG_ASSERTSTR(block->mFree == 0, "Large block deleted twice!  Memory corruption may follow...");
+
+#if PEGASUS_ENABLE_MEMORY_STATS
+    RecordFree(mAllocId, block->mSize);
+#endif
+
+    Lock();
+    --mLiveBlocks;
+    block->mFree = 1;
+
+    Chunk* chunk = block->mChunk;
+    if (chunk->mDedicated != 0)
+    {
+        ReleaseChunk(chunk);
+        Unlock();
+        return;
+    }
+
+    // Coalescing with the free neighbors
+    BlockHeader* next = GetNextBlock(block);
+    if (next != nullptr && next->mFree != 0)
+    {
+        RemoveFree(next);
+        block->mSize += next->mSize;
+    }
+    if (block->mPrevSize != 0)
+    {
+        BlockHeader* prev = reinterpret_cast<BlockHeader*>(reinterpret_cast<char*>(block) - block->mPrevSize);
+        if (prev->mFree != 0)
+        {
+            RemoveFree(prev);
+            prev->mSize += block->mSize;
+            block = prev;
+        }
+    }
+    next = GetNextBlock(block);
+    if (next != nullptr)
+    {
+        next->mPrevSize = block->mSize;
+    }
+
+    if (IsWholeChunk(block) && mEmptyChunkCount >= sMaxRetainedChunks)
+    {
+        ReleaseChunk(chunk);
+    }
+    else
+    {
+        PushFree(block);
+        if (IsWholeChunk(block))
+        {
+            ++mEmptyChunkCount;
+        }
+    }
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void LargeBlockAllocator::Trim()
+{
+    Lock();
+    BlockHeader* block = mFreeBlocks;
+    while (block != nullptr)
+    {
+        BlockHeader* nextFree = block->mNextFree;
+        if (IsWholeChunk(block))
+        {
+            RemoveFree(block);
+            ReleaseChunk(block->mChunk);
+            --mEmptyChunkCount;
+        }
+        block = nextFree;
+    }
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+LargeBlockAllocator::Chunk* LargeBlockAllocator::NewChunk(size_t size, bool dedicated)
+{
+    bool hugePages = false;
+    Chunk* chunk = static_cast<Chunk*>(MapPages(size, hugePages));
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+    if (!MapChunk(chunk, 1))
+    {
+        UnmapPages(chunk, size, hugePages);
+        return nullptr;
+    }
+
+    chunk->mSize = size;
+    chunk->mHugePages = hugePages ? 1 : 0;
+    chunk->mDedicated = dedicated ? 1 : 0;
+    chunk->mPrev = nullptr;
+    chunk->mNext = mChunks;
+    if (mChunks != nullptr)
+    {
+        mChunks->mPrev = chunk;
+    }
+    mChunks = chunk;
+
+    BlockHeader* block = reinterpret_cast<BlockHeader*>(chunk + 1);
+    block->mSize = size - sizeof(Chunk);
+    block->mPrevSize = 0;
+    block->mChunk = chunk;
+    block->mFree = 1;
+
+    ++mChunkCount;
+    mHugePageChunkCount += chunk->mHugePages;
+    mMappedBytes += size;
+    return chunk;
+}
+
+//----------------------------------------------------------------------------------------
+
+void LargeBlockAllocator::ReleaseChunk(Chunk* chunk)
+{
+    MapChunk(chunk, 0);
+    if (chunk->mPrev != nullptr)
+    {
+        chunk->mPrev->mNext = chunk->mNext;
+    }
+    else
+    {
+        mChunks = chunk->mNext;
+    }
+    if (chunk->mNext != nullptr)
+    {
+        chunk->mNext->mPrev = chunk->mPrev;
+    }
+
+    --mChunkCount;
+    mHugePageChunkCount -= chunk->mHugePages;
+    mMappedBytes -= chunk->mSize;
+    UnmapPages(chunk, chunk->mSize, chunk->mHugePages != 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+void LargeBlockAllocator::PushFree(BlockHeader* block)
+{
+    block->mFree = 1;
+    block->mPrevFree = nullptr;
+    block->mNextFree = mFreeBlocks;
+    if (mFreeBlocks != nullptr)
+    {
+        mFreeBlocks->mPrevFree = block;
+    }
+    mFreeBlocks = block;
+}
+
+//----------------------------------------------------------------------------------------
+
+void LargeBlockAllocator::RemoveFree(BlockHeader* block)
+{
+    if (block->mPrevFree != nullptr)
+    {
+        block->mPrevFree->mNextFree = block->mNextFree;
+    }
+    else
+    {
+        mFreeBlocks = block->mNextFree;
+    }
+    if (block->mNextFree != nullptr)
+    {
+        block->mNextFree->mPrevFree = block->mPrevFree;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+LargeBlockAllocator::BlockHeader* LargeBlockAllocator::GetNextBlock(BlockHeader* block) const
+{
+    char* next = reinterpret_cast<char*>(block) + block->mSize;
+    char* end = reinterpret_cast<char*>(block->mChunk) + block->mChunk->mSize;
+    return next < end ? reinterpret_cast<BlockHeader*>(next) : nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool LargeBlockAllocator::IsWholeChunk(const BlockHeader* block) const
+{
+    return block->mSize == block->mChunk->mSize - sizeof(Chunk);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool LargeBlockAllocator::MapChunk(const Chunk* chunk, unsigned char value)
+{
+    const size_t hugePage = reinterpret_cast<size_t>(chunk) / sHugePageSize;
+    std::atomic<unsigned char>* leaf = mChunkMap[hugePage >> sChunkMapLeafBits].load(std::memory_order_relaxed);
+    if (leaf == nullptr)
+    {
+        leaf = static_cast<std::atomic<unsigned char>*>(calloc(size_t(1) << sChunkMapLeafBits, sizeof(std::atomic<unsigned char>)));
+        if (leaf == nullptr)
+        {
+            return false;
+        }
+        mChunkMap[hugePage >> sChunkMapLeafBits].store(leaf, std::memory_order_release);
+    }
+    leaf[hugePage & ((size_t(1) << sChunkMapLeafBits) - 1)].store(value, std::memory_order_release);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool LargeBlockAllocator::OwnsChunk(size_t base) const
+{
+    // The chunk of a live block was added before the block was returned,
+    // and is only removed once the block is deleted
+    const size_t hugePage = base / sHugePageSize;
+    const std::atomic<unsigned char>* leaf = mChunkMap[hugePage >> sChunkMapLeafBits].load(std::memory_order_acquire);
+    return leaf != nullptr && leaf[hugePage & ((size_t(1) << sChunkMapLeafBits) - 1)].load(std::memory_order_acquire) != 0;
+}
+
+}   // namespace Memory
+}   // namespace Pegasus
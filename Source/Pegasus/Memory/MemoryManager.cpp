@@ -10,76 +10,220 @@
 //! \brief  Memory manager, to manage a set of allocators for an application.
 
 #include "Pegasus/Memory/MemoryManager.h"
-#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Memory/SlabAllocator.h"
+#include "Pegasus/Memory/FrameAllocator.h"
+#include "Pegasus/Memory/LargeBlockAllocator.h"
+#include "Pegasus/Memory/BudgetAllocator.h"
+#include "Pegasus/Memory/TrackingAllocator.h"
 
 namespace Pegasus {
 namespace Memory {
 
 // Global allocator
-//! \todo Real allocator / heap management...
+// Categories made of small, fixed size, high churn objects opt into the size class slabs.
+// The node data also holds the large payloads (texture layers, mesh streams), served by an arena of huge pages.
+// The other categories use the system heap directly.
 static MallocFreeAllocator sGlobalAllocator(0);
-static MallocFreeAllocator sCoreAllocator(1);
+static SlabAllocator       sCoreAllocator(1);
 static MallocFreeAllocator sRenderAllocator(2);
-static MallocFreeAllocator sNodeAllocator(3);
-static MallocFreeAllocator sNodeDataAllocator(4);
-static MallocFreeAllocator sPropertyPointerAllocator(5);
-static MallocFreeAllocator sTimelineAllocator(6);
+static SlabAllocator       sNodeAllocator(3);
+static SlabAllocator       sNodeDataSlabAllocator(4);
+static LargeBlockAllocator sNodeDataAllocator(4, &sNodeDataSlabAllocator);
+static SlabAllocator       sPropertyPointerAllocator(5);
+static SlabAllocator       sTimelineAllocator(6);
 static MallocFreeAllocator sWindowAllocator(7);
+static FrameAllocator      sFrameAllocator(8);
+
+// Budgets of the allocators, unlimited until configured.
+// The frame allocator is left out, its allocations are not deleted
+static BudgetAllocator sBudgetGlobalAllocator(&sGlobalAllocator);
+static BudgetAllocator sBudgetCoreAllocator(&sCoreAllocator);
+static BudgetAllocator sBudgetRenderAllocator(&sRenderAllocator);
+static BudgetAllocator sBudgetNodeAllocator(&sNodeAllocator);
+static BudgetAllocator sBudgetNodeDataAllocator(&sNodeDataAllocator);
+static BudgetAllocator sBudgetPropertyPointerAllocator(&sPropertyPointerAllocator);
+static BudgetAllocator sBudgetTimelineAllocator(&sTimelineAllocator);
+static BudgetAllocator sBudgetWindowAllocator(&sWindowAllocator);
+
+//! Budget of each memory category, nullptr for the categories without budget
+static BudgetAllocator* sBudgetAllocators[MEMORY_CATEGORY_COUNT] = {
+    &sBudgetGlobalAllocator,
+    &sBudgetCoreAllocator,
+    &sBudgetRenderAllocator,
+    &sBudgetNodeAllocator,
+    &sBudgetNodeDataAllocator,
+    &sBudgetPropertyPointerAllocator,
+    &sBudgetTimelineAllocator,
+    &sBudgetWindowAllocator,
+    nullptr
+};
+
+#if PEGASUS_ENABLE_ALLOCATION_TRACKING
+// Call site tracking of the allocators, on top of the budgets
+static TrackingAllocator sTrackedGlobalAllocator(&sBudgetGlobalAllocator);
+static TrackingAllocator sTrackedCoreAllocator(&sBudgetCoreAllocator);
+static TrackingAllocator sTrackedRenderAllocator(&sBudgetRenderAllocator);
+static TrackingAllocator sTrackedNodeAllocator(&sBudgetNodeAllocator);
+static TrackingAllocator sTrackedNodeDataAllocator(&sBudgetNodeDataAllocator);
+static TrackingAllocator sTrackedPropertyPointerAllocator(&sBudgetPropertyPointerAllocator);
+static TrackingAllocator sTrackedTimelineAllocator(&sBudgetTimelineAllocator);
+static TrackingAllocator sTrackedWindowAllocator(&sBudgetWindowAllocator);
+#define PEGASUS_TRACKED_ALLOCATOR(allocator) (&sTracked##allocator)
+#else
+#define PEGASUS_TRACKED_ALLOCATOR(allocator) (&sBudget##allocator)
+#endif
+
+//! Names of the memory categories, the index of a category is the ID of its allocator
+static const char* sMemoryCategoryNames[MEMORY_CATEGORY_COUNT] = {
+    "Global",
+    "Core",
+    "Render",
+    "Node",
+    "NodeData",
+    "PropertyPointer",
+    "Timeline",
+    "Window",
+    "Frame"
+};
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetGlobalAllocator()
 {
-    return &sGlobalAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(GlobalAllocator);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetCoreAllocator()
 {
-    return &sCoreAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(CoreAllocator);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetRenderAllocator()
 {
-    return &sRenderAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(RenderAllocator);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetNodeAllocator()
 {
-    return &sNodeAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(NodeAllocator);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetNodeDataAllocator()
 {
-    return &sNodeDataAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(NodeDataAllocator);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetPropertyPointerAllocator()
 {
-    return &sPropertyPointerAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(PropertyPointerAllocator);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetTimelineAllocator()
 {
-    return &sTimelineAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(TimelineAllocator);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetWindowAllocator()
 {
-    return &sWindowAllocator;
+    return PEGASUS_TRACKED_ALLOCATOR(WindowAllocator);
+}
+
+//----------------------------------------------------------------------------------------
+
+Alloc::IAllocator* GetFrameAllocator()
+{
+    return &sFrameAllocator;
+}
+
+//----------------------------------------------------------------------------------------
+
+void FlipFrameAllocator()
+{
+    sFrameAllocator.Flip();
+}
+
+//----------------------------------------------------------------------------------------
+
+void ReleaseThreadCaches()
+{
+    sCoreAllocator.ReleaseThreadCache();
+    sNodeAllocator.ReleaseThreadCache();
+    sNodeDataSlabAllocator.ReleaseThreadCache();
+    sPropertyPointerAllocator.ReleaseThreadCache();
+    sTimelineAllocator.ReleaseThreadCache();
+}
+
+//----------------------------------------------------------------------------------------
+
+const char* GetMemoryCategoryName(MemoryCategory category)
+{
+    PG_ASSERT(category >= 0 && category < MEMORY_CATEGORY_COUNT);
+    return sMemoryCategoryNames[category];
+}
+
+//----------------------------------------------------------------------------------------
+
+void GetMemoryStats(MemoryCategory category, MemoryStats& stats)
+{
+    PG_ASSERT(category >= 0 && category < MEMORY_CATEGORY_COUNT);
+    GetAllocatorStats(static_cast<unsigned int>(category), stats);
+}
+
+//----------------------------------------------------------------------------------------
+
+void SetMemoryBudget(MemoryCategory category, size_t softLimit, size_t hardLimit, BudgetPolicy policy)
+{
+    PG_ASSERT(category >= 0 && category < MEMORY_CATEGORY_COUNT);
+    PG_ASSERTSTR(sBudgetAllocators[category] != nullptr, "This memory category does not support budgets");
+    if (sBudgetAllocators[category] != nullptr)
+    {
+        sBudgetAllocators[category]->SetLimits(softLimit, hardLimit, policy);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void SetMemoryBudgetCallback(MemoryCategory category, BudgetCallback callback, void* userData)
+{
+    PG_ASSERT(category >= 0 && category < MEMORY_CATEGORY_COUNT);
+    PG_ASSERTSTR(sBudgetAllocators[category] != nullptr, "This memory category does not support budgets");
+    if (sBudgetAllocators[category] != nullptr)
+    {
+        sBudgetAllocators[category]->SetCallback(callback, userData);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+size_t GetMemoryBudgetUsage(MemoryCategory category)
+{
+    PG_ASSERT(category >= 0 && category < MEMORY_CATEGORY_COUNT);
+    return sBudgetAllocators[category] != nullptr ? sBudgetAllocators[category]->GetLiveBytes() : 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void ResetMemoryFrameStats()
+{
+    ResetAllocatorFrameStats();
+#if PEGASUS_ENABLE_ALLOCATION_TRACKING
+    ResetAllocationSiteFrame();
+#endif
 }
 
 
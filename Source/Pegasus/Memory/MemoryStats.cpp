@@ -0,0 +1,242 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MemoryStats.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Allocator statistics. Counters are written per thread without synchronization,
+//!         and aggregated when they are read.
+
+#include "Pegasus/Memory/MemoryStats.h"
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <new>
+
+namespace Pegasus {
+namespace Memory {
+
+int GetMemoryHistogramBucket(size_t size)
+{
+    int bucket = 0;
+    while (size >= 16 && bucket < sMemoryHistogramBucketCount - 1)
+    {
+        size >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+#if PEGASUS_ENABLE_MEMORY_STATS
+
+//! Counters of an allocator for a single thread.
+//! Only the owner thread writes them, so updates are a relaxed load and store, without any lock prefix.
+//! The readers see values at most a few allocations old.
+//! Byte and allocation counts are deltas, a thread freeing memory allocated by another goes negative.
+struct ThreadAllocatorCounters
+{
+    std::atomic<intptr_t>     mLiveBytes;
+    std::atomic<int>          mLiveAllocations;
+    std::atomic<unsigned int> mAllocations; //!< allocations ever made, wraps around
+    std::atomic<unsigned int> mFrees;       //!< frees ever made, wraps around
+    std::atomic<unsigned int> mHistogram[sMemoryHistogramBucketCount];
+};
+
+//! Counters of all the allocators for a single thread.
+//! Blocks are never freed, the counters of a dead thread still contribute to the totals.
+struct ThreadMemoryStats
+{
+    ThreadAllocatorCounters mCounters[sMaxMemoryStatsIds];
+    ThreadMemoryStats* mNext; //!< next block in the list of all the threads
+};
+
+//! List of the counter blocks of all the threads, blocks are only ever pushed
+static std::atomic<ThreadMemoryStats*> sThreadStatsList;
+
+//! Counter block of the current thread, nullptr until its first allocation
+static PEGASUS_THREAD_LOCAL ThreadMemoryStats* sThreadStats = nullptr;
+
+//! Lock protecting the aggregated state below, taken by the readers only
+static std::atomic_flag sAggregateLock = ATOMIC_FLAG_INIT;
+
+//! Aggregated state, per allocator
+static long long    sPeakBytes[sMaxMemoryStatsIds];
+static unsigned int sFrameBaseAllocations[sMaxMemoryStatsIds];
+static unsigned int sFrameBaseFrees[sMaxMemoryStatsIds];
+static unsigned int sLastFrameAllocations[sMaxMemoryStatsIds];
+static unsigned int sLastFrameFrees[sMaxMemoryStatsIds];
+
+//----------------------------------------------------------------------------------------
+
+template <typename T>
+static inline void AddCounter(std::atomic<T>& counter, T value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------
+
+static ThreadMemoryStats* GetThreadStats()
+{
+    ThreadMemoryStats* stats = sThreadStats;
+    if (stats == nullptr)
+    {
+        // The block comes from the system heap, the allocators cannot be used to allocate their own stats
+        void* mem = calloc(1, sizeof(ThreadMemoryStats));
+        if (mem == nullptr)
+        {
+            return nullptr;
+        }
+        stats = new (mem) ThreadMemoryStats;
+
+        ThreadMemoryStats* head = sThreadStatsList.load(std::memory_order_relaxed);
+        do
+        {
+            stats->mNext = head;
+        }
+        while (!sThreadStatsList.compare_exchange_weak(head, stats, std::memory_order_release, std::memory_order_relaxed));
+
+        sThreadStats = stats;
+    }
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------
+
+void RecordAllocation(unsigned int allocId, size_t bytes, size_t requestedSize)
+{
+    ThreadMemoryStats* stats = GetThreadStats();
+    if (allocId < sMaxMemoryStatsIds && stats != nullptr)
+    {
+        ThreadAllocatorCounters& counters = stats->mCounters[allocId];
+        AddCounter<intptr_t>(counters.mLiveBytes, static_cast<intptr_t>(bytes));
+        AddCounter<int>(counters.mLiveAllocations, 1);
+        AddCounter<unsigned int>(counters.mAllocations, 1);
+        AddCounter<unsigned int>(counters.mHistogram[GetMemoryHistogramBucket(requestedSize)], 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void RecordFree(unsigned int allocId, size_t bytes, unsigned int count)
+{
+    ThreadMemoryStats* stats = GetThreadStats();
+    if (allocId < sMaxMemoryStatsIds && stats != nullptr)
+    {
+        ThreadAllocatorCounters& counters = stats->mCounters[allocId];
+        AddCounter<intptr_t>(counters.mLiveBytes, -static_cast<intptr_t>(bytes));
+        AddCounter<int>(counters.mLiveAllocations, -static_cast<int>(count));
+        AddCounter<unsigned int>(counters.mFrees, count);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Sums the counters of all the threads, and updates the peak. Expects the aggregate lock to be held
+static void Aggregate(unsigned int allocId, MemoryStats& stats, unsigned int& allocations, unsigned int& frees)
+{
+    intptr_t liveBytes = 0;
+    memset(&stats, 0, sizeof(MemoryStats));
+    allocations = 0;
+    frees = 0;
+
+    for (ThreadMemoryStats* thread = sThreadStatsList.load(std::memory_order_acquire); thread != nullptr; thread = thread->mNext)
+    {
+        const ThreadAllocatorCounters& counters = thread->mCounters[allocId];
+        liveBytes += counters.mLiveBytes.load(std::memory_order_relaxed);
+        stats.mLiveAllocations += counters.mLiveAllocations.load(std::memory_order_relaxed);
+        allocations += counters.mAllocations.load(std::memory_order_relaxed);
+        frees += counters.mFrees.load(std::memory_order_relaxed);
+        for (int b = 0; b < sMemoryHistogramBucketCount; ++b)
+        {
+            stats.mHistogram[b] += counters.mHistogram[b].load(std::memory_order_relaxed);
+        }
+    }
+
+    stats.mLiveBytes = liveBytes;
+    if (stats.mLiveBytes > sPeakBytes[allocId])
+    {
+        sPeakBytes[allocId] = stats.mLiveBytes;
+    }
+    stats.mPeakBytes = sPeakBytes[allocId];
+}
+
+//----------------------------------------------------------------------------------------
+
+void GetAllocatorStats(unsigned int allocId, MemoryStats& stats)
+{
+    PG_ASSERTSTR(allocId < sMaxMemoryStatsIds, "Invalid allocator ID for the memory stats");
+    if (allocId >= sMaxMemoryStatsIds)
+    {
+        memset(&stats, 0, sizeof(MemoryStats));
+        return;
+    }
+
+    while (sAggregateLock.test_and_set(std::memory_order_acquire)) {}
+
+    unsigned int allocations, frees;
+    Aggregate(allocId, stats, allocations, frees);
+    stats.mFrameAllocations = allocations - sFrameBaseAllocations[allocId];
+    stats.mFrameFrees = frees - sFrameBaseFrees[allocId];
+    stats.mLastFrameAllocations = sLastFrameAllocations[allocId];
+    stats.mLastFrameFrees = sLastFrameFrees[allocId];
+
+    sAggregateLock.clear(std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ResetAllocatorFrameStats()
+{
+    while (sAggregateLock.test_and_set(std::memory_order_acquire)) {}
+
+    // The threads never write the frame counters, the new frame starts from the current totals
+    for (unsigned int allocId = 0; allocId < sMaxMemoryStatsIds; ++allocId)
+    {
+        MemoryStats stats;
+        unsigned int allocations, frees;
+        Aggregate(allocId, stats, allocations, frees);
+        sLastFrameAllocations[allocId] = allocations - sFrameBaseAllocations[allocId];
+        sLastFrameFrees[allocId] = frees - sFrameBaseFrees[allocId];
+        sFrameBaseAllocations[allocId] = allocations;
+        sFrameBaseFrees[allocId] = frees;
+    }
+
+    sAggregateLock.clear(std::memory_order_release);
+}
+
+#else
+
+//----------------------------------------------------------------------------------------
+
+void RecordAllocation(unsigned int allocId, size_t bytes, size_t requestedSize)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void RecordFree(unsigned int allocId, size_t bytes, unsigned int count)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void GetAllocatorStats(unsigned int allocId, MemoryStats& stats)
+{
+    memset(&stats, 0, sizeof(MemoryStats));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ResetAllocatorFrameStats()
+{
+}
+
+#endif  // PEGASUS_ENABLE_MEMORY_STATS
+
+
+}   // namespace Memory
+}   // namespace Pegasus
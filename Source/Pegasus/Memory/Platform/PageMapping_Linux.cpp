@@ -0,0 +1,123 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PageMapping_Linux.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Mapping of memory pages from the operating system (Linux implementation)
+
+#if PEGASUS_PLATFORM_LINUX
+
+#include "Pegasus/Memory/PageMapping.h"
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+namespace Pegasus {
+namespace Memory {
+
+//! False once a MAP_HUGETLB mapping failed. The huge page pool is often empty,
+//! in which case every attempt fails, so they are not attempted again
+static std::atomic<bool> sHugeTlbAvailable(true);
+
+//----------------------------------------------------------------------------------------
+
+//! \return true if the kernel backs the advised ranges with transparent huge pages
+static bool AreTransparentHugePagesEnabled()
+{
+    // Read once, the setting is "always [madvise] never" with the current mode in brackets
+    static int sEnabled = -1;
+    if (sEnabled < 0)
+    {
+        char setting[64] = { 0 };
+        FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+        if (file != nullptr)
+        {
+            fgets(setting, sizeof(setting), file);
+            fclose(file);
+        }
+        sEnabled = (strstr(setting, "[always]") != nullptr || strstr(setting, "[madvise]") != nullptr) ? 1 : 0;
+    }
+    return sEnabled != 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void* MapPages(size_t size, bool& hugePages)
+{
+    PG_ASSERTSTR((size & (sHugePageSize - 1)) == 0, "The size of mapped pages has to be a multiple of the huge page size");
+
+#ifdef MAP_HUGETLB
+    if (sHugeTlbAvailable.load(std::memory_order_relaxed))
+    {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+        {
+            hugePages = true;
+            return ptr;
+        }
+        sHugeTlbAvailable.store(false, std::memory_order_relaxed);
+    }
+#endif
+
+    // Regular pages, mapped with an extra huge page to trim the range to an aligned address.
+    // Aligned ranges can then be backed by transparent huge pages
+    char* range = static_cast<char*>(mmap(nullptr, size + sHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (range == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    char* aligned = reinterpret_cast<char*>((reinterpret_cast<size_t>(range) + sHugePageSize - 1) & ~(sHugePageSize - 1));
+    const size_t head = aligned - range;
+    if (head != 0)
+    {
+        munmap(range, head);
+    }
+    if (head != sHugePageSize)
+    {
+        munmap(aligned + size, sHugePageSize - head);
+    }
+
+    // The kernel backs the advised range with transparent huge pages on first touch,
+    // as long as it has free huge pages. The setting is often madvise, where nothing happens without the advice
+#ifdef MADV_HUGEPAGE
+    hugePages = (madvise(aligned, size, MADV_HUGEPAGE) == 0) && AreTransparentHugePagesEnabled();
+#else
+    hugePages = false;
+#endif
+    return aligned;
+}
+
+//----------------------------------------------------------------------------------------
+
+void UnmapPages(void* ptr, size_t size, bool /*hugePages*/)
+{
+    if (ptr != nullptr)
+    {
+        munmap(ptr, size);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long GetPageFaultCount()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        return static_cast<unsigned long long>(usage.ru_minflt) + static_cast<unsigned long long>(usage.ru_majflt);
+    }
+    return 0;
+}
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_LINUX
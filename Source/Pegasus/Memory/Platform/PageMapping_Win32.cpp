@@ -0,0 +1,102 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PageMapping_Win32.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Mapping of memory pages from the operating system (Win32 implementation)
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Memory/PageMapping.h"
+#include <atomic>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+
+#pragma comment(lib, "psapi.lib")
+
+namespace Pegasus {
+namespace Memory {
+
+//! False once a large page allocation failed. Large pages need the "Lock pages in memory" privilege,
+//! without it every attempt fails, so they are not attempted again
+static std::atomic<bool> sLargePagesAvailable(true);
+
+//! Number of attempts to reserve an aligned range, another thread can take the range between the attempts
+static const int sMaxReserveAttempts = 16;
+
+//----------------------------------------------------------------------------------------
+
+void* MapPages(size_t size, bool& hugePages)
+{
+    PG_ASSERTSTR((size & (sHugePageSize - 1)) == 0, "The size of mapped pages has to be a multiple of the huge page size");
+
+    if (sLargePagesAvailable.load(std::memory_order_relaxed))
+    {
+        const SIZE_T largePageSize = GetLargePageMinimum();
+        if (largePageSize != 0 && (sHugePageSize % largePageSize) == 0)
+        {
+            void* ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (ptr != nullptr)
+            {
+                hugePages = true;
+                return ptr;
+            }
+        }
+        sLargePagesAvailable.store(false, std::memory_order_relaxed);
+    }
+
+    // Regular pages. VirtualAlloc only aligns to 64KB, so a larger range is reserved to find an aligned
+    // address in it, then released and reserved again at the aligned address
+    hugePages = false;
+    for (int attempt = 0; attempt < sMaxReserveAttempts; ++attempt)
+    {
+        char* range = static_cast<char*>(VirtualAlloc(nullptr, size + sHugePageSize, MEM_RESERVE, PAGE_NOACCESS));
+        if (range == nullptr)
+        {
+            return nullptr;
+        }
+        VirtualFree(range, 0, MEM_RELEASE);
+
+        void* aligned = reinterpret_cast<void*>((reinterpret_cast<size_t>(range) + sHugePageSize - 1) & ~(sHugePageSize - 1));
+        void* ptr = VirtualAlloc(aligned, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (ptr != nullptr)
+        {
+            return ptr;
+        }
+    }
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void UnmapPages(void* ptr, size_t size, bool hugePages)
+{
+    if (ptr != nullptr)
+    {
+        VirtualFree(ptr, 0, MEM_RELEASE);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long GetPageFaultCount()
+{
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.PageFaultCount;
+    }
+    return 0;
+}
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
@@ -0,0 +1,776 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SlabAllocator.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Size class slab allocator. Small allocations are served from fixed size slots
+//!         of 64KB pages, with O(1) alloc and free. Large allocations go to the system heap.
+
+#include "Pegasus/Memory/SlabAllocator.h"
+#include "Pegasus/Memory/MemoryStats.h"
+#include <stdlib.h>
+
+namespace Pegasus {
+namespace Memory {
+
+//! size of the slots of each size class. All multiples of 16, so every slot is at least 16 bytes aligned
+static const unsigned int sSizeClasses[SlabAllocator::sSizeClassCount] = {
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048
+};
+
+//! size of the page header, slots start right after it. Keeps the first slot 64 bytes aligned
+static const unsigned int sPageHeaderSize = 64;
+
+//! initial capacity of the page map
+static const unsigned int sInitialPageMapCapacity = 64;
+
+//! size of the thread cache table of each thread, a power of 2
+static const unsigned int sThreadCacheTableSize = 32;
+
+//! entry of the thread cache table. The serial is checked before the cache is touched,
+//! so entries left by destroyed allocators are never dereferenced
+struct ThreadCacheEntry
+{
+    unsigned int mSerial;
+    void*        mCache;
+};
+
+//! thread cache table of the calling thread, indexed by the serial of the allocators
+static PEGASUS_THREAD_LOCAL ThreadCacheEntry sThreadCacheTable[sThreadCacheTableSize];
+
+//! its address identifies the calling thread
+static PEGASUS_THREAD_LOCAL char sThreadKey;
+
+//! next allocator serial
+static std::atomic<unsigned int> sNextSerial;
+
+//! \return the next slot of a list of slots
+static inline void*& NextSlot(void* slot)
+{
+    return static_cast<void**>(slot)[0];
+}
+
+//! \return the next batch of a list of batches
+static inline void*& NextBatch(void* batch)
+{
+    return static_cast<void**>(batch)[1];
+}
+
+//----------------------------------------------------------------------------------------
+
+SlabAllocator::SlabAllocator(unsigned int allocId)
+    : mLargeAllocator(allocId),
+      mAllocId(allocId),
+      mFreePages(nullptr),
+      mChunks(nullptr),
+      mChunkCount(0),
+      mChunkCapacity(0),
+      mThreadCaches(nullptr),
+      mLiveSlots(0)
+{
+    PG_ASSERT(sizeof(Page) <= sPageHeaderSize);
+    PG_ASSERT(sSizeClasses[sSizeClassCount - 1] == sMaxSlabSize);
+    mLock.clear();
+    mPageMap.store(nullptr, std::memory_order_relaxed);
+
+    // serial 0 marks the empty entries of the thread cache tables
+    do
+    {
+        mSerial = sNextSerial.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    while (mSerial == 0);
+
+    for (int i = 0; i < sSizeClassCount; ++i)
+    {
+        mPartialPages[i] = nullptr;
+        mDepot[i].store(nullptr, std::memory_order_relaxed);
+        mDepotCount[i].store(0, std::memory_order_relaxed);
+    }
+
+    // size class of each 16 byte granule, for O(1) lookups
+    int sizeClass = 0;
+    for (unsigned int granule = 0; granule <= sMaxSlabSize / 16; ++granule)
+    {
+        while (sSizeClasses[sizeClass] < granule * 16)
+        {
+            ++sizeClass;
+        }
+        mSizeClassLookup[granule] = static_cast<unsigned char>(sizeClass);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+SlabAllocator::~SlabAllocator()
+{
+    // The slots cached by the threads are free, only the allocations of the users count
+    int liveSlots = mLiveSlots;
+    for (ThreadCache* cache = mThreadCaches; cache != nullptr; cache = cache->mNext)
+    {
+        liveSlots += cache->mLiveDelta;
+    }
+
+    // Static allocators can be destroyed before the last objects are freed,
+    // in which case the pages are left to the process teardown
+    if (liveSlots == 0)
+    {
+        for (int i = 0; i < mChunkCount; ++i)
+        {
+            free(mChunks[i]);
+        }
+        free(mChunks);
+
+        PageMap* pageMap = mPageMap.load(std::memory_order_relaxed);
+        while (pageMap != nullptr)
+        {
+            PageMap* retired = pageMap->mRetired;
+            free(pageMap);
+            pageMap = retired;
+        }
+
+        ThreadCache* cache = mThreadCaches;
+        while (cache != nullptr)
+        {
+            ThreadCache* next = cache->mNext;
+            free(cache);
+            cache = next;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int SlabAllocator::GetSizeClassSize(int sizeClass)
+{
+    PG_ASSERT(sizeClass >= 0 && sizeClass < sSizeClassCount);
+    return sSizeClasses[sizeClass];
+}
+
+//----------------------------------------------------------------------------------------
+
+int SlabAllocator::GetBatchSize(int sizeClass)
+{
+    // about 4KB per batch, bounded so small classes do not hoard slots and big classes still batch
+    int batchSize = static_cast<int>(4096 / GetSizeClassSize(sizeClass));
+    return batchSize < 4 ? 4 : (batchSize > sMaxBatchSize ? sMaxBatchSize : batchSize);
+}
+
+//----------------------------------------------------------------------------------------
+
+void* SlabAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    return AllocAlign(size, 16, flags, category, debugText, file, line);
+}
+
+//----------------------------------------------------------------------------------------
+
+void* SlabAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    const int sizeClass = GetSizeClass(size, align);
+    if (sizeClass >= 0)
+    {
+        void* ptr = nullptr;
+        ThreadCache* cache = GetThreadCache();
+        if (cache != nullptr)
+        {
+            if (cache->mSlotCount[sizeClass] != 0 || RefillCache(cache, sizeClass))
+            {
+                ptr = cache->mSlots[sizeClass];
+                cache->mSlots[sizeClass] = NextSlot(ptr);
+                --cache->mSlotCount[sizeClass];
+                ++cache->mLiveDelta;
+            }
+        }
+        else
+        {
+            Lock();
+            ptr = AllocSlot(sizeClass);
+            if (ptr != nullptr)
+            {
+                ++mLiveSlots;
+            }
+            Unlock();
+        }
+
+        if (ptr != nullptr)
+        {
+#if PEGASUS_ENABLE_MEMORY_STATS
+            RecordAllocation(mAllocId, sSizeClasses[sizeClass], size);
+#endif
+            return ptr;
+        }
+    }
+
+    return mLargeAllocator.AllocAlign(size, align, flags, category, debugText, file, line);
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::Delete(void* ptr)
+{
+    if (ptr != nullptr)
+    {
+        // Slots never sit at the start of a page, so the masked address is the page header
+        Page* page = reinterpret_cast<Page*>(reinterpret_cast<size_t>(ptr) & ~static_cast<size_t>(sPageSize - 1));
+
+        if (FindPage(page))
+        {
+            // the size class of a page cannot change while one of its slots is allocated
+            const int sizeClass = page->mSizeClass;
+            PG_ASSERTSTR(sizeClass >= 0, "Slab allocation freed twice!  Memory corruption may follow...");
+
+            ThreadCache* cache = GetThreadCache();
+            if (cache != nullptr)
+            {
+                NextSlot(ptr) = cache->mSlots[sizeClass];
+                cache->mSlots[sizeClass] = ptr;
+                --cache->mLiveDelta;
+                if (++cache->mSlotCount[sizeClass] == 2 * GetBatchSize(sizeClass))
+                {
+                    FlushCache(cache, sizeClass);
+                }
+            }
+            else
+            {
+                Lock();
+                FreeSlot(page, ptr);
+                --mLiveSlots;
+                Unlock();
+            }
+
+#if PEGASUS_ENABLE_MEMORY_STATS
+            RecordFree(mAllocId, sSizeClasses[sizeClass]);
+#endif
+            return;
+        }
+
+        mLargeAllocator.Delete(ptr);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::Trim()
+{
+    ThreadCache* cache = nullptr;
+    const ThreadCacheEntry& entry = sThreadCacheTable[mSerial & (sThreadCacheTableSize - 1)];
+    if (entry.mSerial == mSerial)
+    {
+        cache = static_cast<ThreadCache*>(entry.mCache);
+    }
+
+    Lock();
+    if (cache != nullptr)
+    {
+        ReleaseCacheSlots(cache);
+    }
+
+    for (int sizeClass = 0; sizeClass < sSizeClassCount; ++sizeClass)
+    {
+        void* batches = mDepot[sizeClass].exchange(nullptr, std::memory_order_acquire);
+        for (void* batch = batches; batch != nullptr; batch = NextBatch(batch))
+        {
+            mDepotCount[sizeClass].fetch_sub(1, std::memory_order_relaxed);
+        }
+        ReleaseBatches(batches);
+    }
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::ReleaseThreadCache()
+{
+    const void* threadKey = &sThreadKey;
+    ThreadCacheEntry& entry = sThreadCacheTable[mSerial & (sThreadCacheTableSize - 1)];
+    if (entry.mSerial == mSerial)
+    {
+        entry.mSerial = 0;
+        entry.mCache = nullptr;
+    }
+
+    Lock();
+    for (ThreadCache* cache = mThreadCaches; cache != nullptr; cache = cache->mNext)
+    {
+        if (cache->mThreadKey == threadKey)
+        {
+            // The live delta stays in the cache, so the destructor still counts the allocations
+            // the thread did not free. The next thread taking the cache over adds its own to it
+            ReleaseCacheSlots(cache);
+            cache->mThreadKey = nullptr;
+            break;
+        }
+    }
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+SlabAllocator::ThreadCache* SlabAllocator::GetThreadCache()
+{
+    const ThreadCacheEntry& entry = sThreadCacheTable[mSerial & (sThreadCacheTableSize - 1)];
+    if (entry.mSerial == mSerial)
+    {
+        return static_cast<ThreadCache*>(entry.mCache);
+    }
+    return FindThreadCache();
+}
+
+//----------------------------------------------------------------------------------------
+
+SlabAllocator::ThreadCache* SlabAllocator::FindThreadCache()
+{
+    // first use of the allocator by the thread, or the table entry was taken by another allocator
+    const void* threadKey = &sThreadKey;
+    Lock();
+
+    ThreadCache* cache = mThreadCaches;
+    ThreadCache* releasedCache = nullptr;
+    while (cache != nullptr && cache->mThreadKey != threadKey)
+    {
+        if (cache->mThreadKey == nullptr && releasedCache == nullptr)
+        {
+            releasedCache = cache;
+        }
+        cache = cache->mNext;
+    }
+
+    if (cache == nullptr && releasedCache != nullptr)
+    {
+        // take over the cache released by a thread that exited
+        cache = releasedCache;
+        cache->mThreadKey = threadKey;
+    }
+    else if (cache == nullptr)
+    {
+        // The caches come from the system heap and are released with the allocator
+        cache = static_cast<ThreadCache*>(calloc(1, sizeof(ThreadCache)));
+        if (cache != nullptr)
+        {
+            cache->mThreadKey = threadKey;
+            cache->mNext = mThreadCaches;
+            mThreadCaches = cache;
+        }
+    }
+
+    Unlock();
+
+    if (cache != nullptr)
+    {
+        ThreadCacheEntry& entry = sThreadCacheTable[mSerial & (sThreadCacheTableSize - 1)];
+        entry.mSerial = mSerial;
+        entry.mCache = cache;
+    }
+    return cache;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool SlabAllocator::RefillCache(ThreadCache* cache, int sizeClass)
+{
+    const int batchSize = GetBatchSize(sizeClass);
+
+    if (cache->mBatches[sizeClass] == nullptr && mDepot[sizeClass].load(std::memory_order_relaxed) != nullptr)
+    {
+        // Take all the batches freed by the other threads at once. Only taking the whole list
+        // keeps the depot safe from the ABA problem without a lock
+        void* batches = mDepot[sizeClass].exchange(nullptr, std::memory_order_acquire);
+        int batchCount = 0;
+        for (void* batch = batches; batch != nullptr; batch = NextBatch(batch))
+        {
+            ++batchCount;
+        }
+        mDepotCount[sizeClass].fetch_sub(batchCount, std::memory_order_relaxed);
+        cache->mBatches[sizeClass] = batches;
+    }
+
+    void* batch = cache->mBatches[sizeClass];
+    if (batch != nullptr)
+    {
+        cache->mBatches[sizeClass] = NextBatch(batch);
+        cache->mSlots[sizeClass] = batch;
+        cache->mSlotCount[sizeClass] = batchSize;
+        return true;
+    }
+
+    // Nothing cached, carve a batch out of the pages
+    void* slots = nullptr;
+    int slotCount = 0;
+    Lock();
+    for (; slotCount < batchSize; ++slotCount)
+    {
+        void* slot = AllocSlot(sizeClass);
+        if (slot == nullptr)
+        {
+            break;
+        }
+        NextSlot(slot) = slots;
+        slots = slot;
+    }
+    Unlock();
+
+    cache->mSlots[sizeClass] = slots;
+    cache->mSlotCount[sizeClass] = slotCount;
+    return slotCount != 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::FlushCache(ThreadCache* cache, int sizeClass)
+{
+    // Cut a full batch from the head of the free slots
+    const int batchSize = GetBatchSize(sizeClass);
+    void* batch = cache->mSlots[sizeClass];
+    void* last = batch;
+    for (int i = 1; i < batchSize; ++i)
+    {
+        last = NextSlot(last);
+    }
+    cache->mSlots[sizeClass] = NextSlot(last);
+    cache->mSlotCount[sizeClass] -= batchSize;
+    NextSlot(last) = nullptr;
+
+    // One spare batch is kept, so a thread alternating allocs and frees around the limit does not ping-pong
+    if (cache->mBatches[sizeClass] == nullptr)
+    {
+        NextBatch(batch) = nullptr;
+        cache->mBatches[sizeClass] = batch;
+    }
+    else if (mDepotCount[sizeClass].load(std::memory_order_relaxed) < sMaxDepotBatches)
+    {
+        // Push only, the consumers take the whole list, so a compare and swap is enough
+        mDepotCount[sizeClass].fetch_add(1, std::memory_order_relaxed);
+        void* head = mDepot[sizeClass].load(std::memory_order_relaxed);
+        do
+        {
+            NextBatch(batch) = head;
+        }
+        while (!mDepot[sizeClass].compare_exchange_weak(head, batch, std::memory_order_release, std::memory_order_relaxed));
+    }
+    else
+    {
+        // The depot is full, nobody is allocating this size class. Give the slots back to the pages
+        Lock();
+        ReleaseSlots(batch);
+        Unlock();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::ReleaseCacheSlots(ThreadCache* cache)
+{
+    for (int sizeClass = 0; sizeClass < sSizeClassCount; ++sizeClass)
+    {
+        ReleaseSlots(cache->mSlots[sizeClass]);
+        ReleaseBatches(cache->mBatches[sizeClass]);
+        cache->mSlots[sizeClass] = nullptr;
+        cache->mSlotCount[sizeClass] = 0;
+        cache->mBatches[sizeClass] = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::ReleaseSlots(void* slots)
+{
+    while (slots != nullptr)
+    {
+        void* next = NextSlot(slots);
+        Page* page = reinterpret_cast<Page*>(reinterpret_cast<size_t>(slots) & ~static_cast<size_t>(sPageSize - 1));
+        FreeSlot(page, slots);
+        slots = next;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::ReleaseBatches(void* batches)
+{
+    while (batches != nullptr)
+    {
+        void* next = NextBatch(batches);
+        ReleaseSlots(batches);
+        batches = next;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+int SlabAllocator::GetSizeClass(size_t size, Alloc::Alignment align) const
+{
+    if (size > sMaxSlabSize || align > sMaxSlabAlignment)
+    {
+        return -1;
+    }
+
+    int sizeClass = mSizeClassLookup[(size + 15) >> 4];
+
+    // bigger alignments pick the first size class that is a multiple of the alignment,
+    // since the slots of a page are laid out from a 64 bytes aligned address
+    if (align > 16)
+    {
+        while (sizeClass < sSizeClassCount && (sSizeClasses[sizeClass] & (align - 1)) != 0)
+        {
+            ++sizeClass;
+        }
+    }
+
+    return sizeClass < sSizeClassCount ? sizeClass : -1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void* SlabAllocator::AllocSlot(int sizeClass)
+{
+    Page* page = mPartialPages[sizeClass];
+    if (page == nullptr)
+    {
+        page = NewPage(sizeClass);
+        if (page == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    void* slot = page->mFreeList;
+    if (slot != nullptr)
+    {
+        page->mFreeList = *static_cast<void**>(slot);
+    }
+    else
+    {
+        slot = page->mBump;
+        page->mBump += sSizeClasses[sizeClass];
+    }
+
+    if (++page->mUsed == page->mCapacity)
+    {
+        UnlinkPartialPage(page);
+    }
+
+    return slot;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::FreeSlot(Page* page, void* ptr)
+{
+    PG_ASSERTSTR(page->mSizeClass >= 0 && page->mUsed > 0, "Slab allocation freed twice!  Memory corruption may follow...");
+
+    if (page->mUsed == page->mCapacity)
+    {
+        // the page was full, it has a free slot again
+        LinkPartialPage(page);
+    }
+
+    *static_cast<void**>(ptr) = page->mFreeList;
+    page->mFreeList = ptr;
+
+    // Release empty pages to other size classes, but keep the last one of its class
+    // to avoid setting up a page again and again when a single object is created and destroyed
+    if (--page->mUsed == 0 && (page->mNext != nullptr || page->mPrev != nullptr))
+    {
+        UnlinkPartialPage(page);
+        page->mSizeClass = -1;
+        page->mNext = mFreePages;
+        mFreePages = page;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+SlabAllocator::Page* SlabAllocator::NewPage(int sizeClass)
+{
+    if (mFreePages == nullptr && !NewChunk())
+    {
+        return nullptr;
+    }
+
+    Page* page = mFreePages;
+    mFreePages = page->mNext;
+
+    page->mFreeList = nullptr;
+    page->mBump = reinterpret_cast<char*>(page) + sPageHeaderSize;
+    page->mSizeClass = sizeClass;
+    page->mUsed = 0;
+    page->mCapacity = static_cast<int>((sPageSize - sPageHeaderSize) / sSizeClasses[sizeClass]);
+    LinkPartialPage(page);
+    return page;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool SlabAllocator::NewChunk()
+{
+    if (mChunkCount == mChunkCapacity)
+    {
+        int newCapacity = mChunkCapacity == 0 ? 16 : mChunkCapacity * 2;
+        void** newChunks = static_cast<void**>(realloc(mChunks, newCapacity * sizeof(void*)));
+        if (newChunks == nullptr)
+        {
+            return false;
+        }
+        mChunks = newChunks;
+        mChunkCapacity = newCapacity;
+    }
+
+    PageMap* pageMap = mPageMap.load(std::memory_order_relaxed);
+    if (!ReservePageMap((pageMap != nullptr ? pageMap->mCount : 0) + sPagesPerChunk))
+    {
+        return false;
+    }
+
+    // one extra page, to align the pages to their size
+    void* chunk = malloc(sPageSize * (sPagesPerChunk + 1));
+    if (chunk == nullptr)
+    {
+        return false;
+    }
+
+    char* pages = reinterpret_cast<char*>((reinterpret_cast<size_t>(chunk) + sPageSize - 1) & ~static_cast<size_t>(sPageSize - 1));
+    for (int i = sPagesPerChunk - 1; i >= 0; --i)
+    {
+        Page* page = reinterpret_cast<Page*>(pages + i * sPageSize);
+        InsertPage(mPageMap.load(std::memory_order_relaxed), page);
+        page->mSizeClass = -1;
+        page->mPrev = nullptr;
+        page->mNext = mFreePages;
+        mFreePages = page;
+    }
+
+    mChunks[mChunkCount++] = chunk;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::LinkPartialPage(Page* page)
+{
+    Page*& head = mPartialPages[page->mSizeClass];
+    page->mPrev = nullptr;
+    page->mNext = head;
+    if (head != nullptr)
+    {
+        head->mPrev = page;
+    }
+    head = page;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::UnlinkPartialPage(Page* page)
+{
+    if (page->mPrev != nullptr)
+    {
+        page->mPrev->mNext = page->mNext;
+    }
+    else
+    {
+        mPartialPages[page->mSizeClass] = page->mNext;
+    }
+
+    if (page->mNext != nullptr)
+    {
+        page->mNext->mPrev = page->mPrev;
+    }
+
+    page->mNext = nullptr;
+    page->mPrev = nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+static inline unsigned int HashPage(const void* page, unsigned int capacity)
+{
+    // pages are aligned, drop the zero bits and scatter the rest
+    const size_t pageIndex = reinterpret_cast<size_t>(page) / SlabAllocator::sPageSize;
+    return static_cast<unsigned int>(pageIndex * 2654435761u) & (capacity - 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool SlabAllocator::FindPage(const Page* page) const
+{
+    // Entries are only ever added, and replaced maps stay alive, so probing needs no lock
+    const PageMap* pageMap = mPageMap.load(std::memory_order_acquire);
+    if (pageMap == nullptr)
+    {
+        return false;
+    }
+
+    unsigned int i = HashPage(page, pageMap->mCapacity);
+    const Page* entry;
+    while ((entry = pageMap->mEntries[i].load(std::memory_order_relaxed)) != nullptr)
+    {
+        if (entry == page)
+        {
+            return true;
+        }
+        i = (i + 1) & (pageMap->mCapacity - 1);
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool SlabAllocator::ReservePageMap(unsigned int pageCount)
+{
+    // keep the load under 50%, so probing stays short
+    PageMap* oldMap = mPageMap.load(std::memory_order_relaxed);
+    unsigned int oldCapacity = oldMap != nullptr ? oldMap->mCapacity : 0;
+    if (pageCount * 2 <= oldCapacity)
+    {
+        return true;
+    }
+
+    unsigned int newCapacity = oldCapacity == 0 ? sInitialPageMapCapacity : oldCapacity;
+    while (pageCount * 2 > newCapacity)
+    {
+        newCapacity *= 2;
+    }
+
+    PageMap* newMap = static_cast<PageMap*>(calloc(1, sizeof(PageMap) + (newCapacity - 1) * sizeof(std::atomic<Page*>)));
+    if (newMap == nullptr)
+    {
+        return false;
+    }
+
+    newMap->mRetired = oldMap;
+    newMap->mCapacity = newCapacity;
+    newMap->mCount = 0;
+    for (unsigned int i = 0; i < oldCapacity; ++i)
+    {
+        Page* page = oldMap->mEntries[i].load(std::memory_order_relaxed);
+        if (page != nullptr)
+        {
+            InsertPage(newMap, page);
+        }
+    }
+
+    // readers still probing the old map find every page they can hold a slot of
+    mPageMap.store(newMap, std::memory_order_release);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SlabAllocator::InsertPage(PageMap* pageMap, Page* page)
+{
+    PG_ASSERT((pageMap->mCount + 1) * 2 <= pageMap->mCapacity);
+    unsigned int i = HashPage(page, pageMap->mCapacity);
+    while (pageMap->mEntries[i].load(std::memory_order_relaxed) != nullptr)
+    {
+        i = (i + 1) & (pageMap->mCapacity - 1);
+    }
+    pageMap->mEntries[i].store(page, std::memory_order_release);
+    ++pageMap->mCount;
+}
+
+
+}   // namespace Memory
+}   // namespace Pegasus
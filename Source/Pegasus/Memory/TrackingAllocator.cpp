@@ -0,0 +1,296 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TrackingAllocator.cpp
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Allocator decorator recording the call site of every allocation,
+//!         to find leaks and the sites allocating the most per frame.
+
+#include "Pegasus/Memory/TrackingAllocator.h"
+#include "Pegasus/Core/Log.h"
+#include <atomic>
+#include <thread>
+
+#if PEGASUS_COMPILER_MSVC
+#include <intrin.h>
+#pragma intrinsic(_ReturnAddress)
+#define PEGASUS_CALLER_ADDRESS() _ReturnAddress()
+#else
+#define PEGASUS_CALLER_ADDRESS() __builtin_return_address(0)
+#endif
+
+namespace Pegasus {
+namespace Memory {
+
+//! States of a site slot
+enum SiteState
+{
+    SITE_FREE = 0, //!< never used
+    SITE_CLAIMED,  //!< being written by the thread inserting the site
+    SITE_READY     //!< key and debug text are valid
+};
+
+//! Slot of the site hash table. The key is only written once, when the slot is claimed,
+//! so lookups are lock-free and only wait for a slot being inserted at the same time
+struct SiteSlot
+{
+    std::atomic<unsigned int> mState;
+    const char*  mFile;
+    const void*  mAddress;
+    unsigned int mLine;
+    const char*  mDebugText;
+    std::atomic<long long>    mLiveBytes;
+    std::atomic<int>          mLiveAllocations;
+    std::atomic<unsigned int> mAllocations;          //!< allocations ever made, wraps around
+    std::atomic<unsigned int> mFrameBase;            //!< mAllocations at the last frame reset
+    std::atomic<unsigned int> mLastFrameAllocations;
+};
+
+//! Site table, open addressing with linear probing.
+//! The extra slot at the end receives the allocations of the sites that do not fit in the table
+static SiteSlot sSites[sMaxAllocationSites + 1];
+
+//! Index of the slot grouping the sites that do not fit in the table
+static const unsigned int sOverflowSite = sMaxAllocationSites;
+
+//! Maximum number of sites returned at once by the dump functions
+static const unsigned int sMaxDumpedSites = 64;
+
+//----------------------------------------------------------------------------------------
+
+//! Finds the slot of a call site, inserting it if needed
+//! \return the index of the slot
+static unsigned int FindSite(const char* file, const void* address, unsigned int line, const char* debugText)
+{
+    const size_t key = file != nullptr ? reinterpret_cast<size_t>(file) : reinterpret_cast<size_t>(address);
+    const unsigned int hash = static_cast<unsigned int>(key >> 4) ^ (line * 2654435761u);
+
+    for (unsigned int probe = 0; probe < sMaxAllocationSites; ++probe)
+    {
+        const unsigned int index = (hash + probe) & (sMaxAllocationSites - 1);
+        SiteSlot& slot = sSites[index];
+        unsigned int state = slot.mState.load(std::memory_order_acquire);
+        if (state == SITE_FREE)
+        {
+            if (slot.mState.compare_exchange_strong(state, SITE_CLAIMED, std::memory_order_acquire))
+            {
+                slot.mFile = file;
+                slot.mAddress = address;
+                slot.mLine = line;
+                slot.mDebugText = debugText;
+                slot.mState.store(SITE_READY, std::memory_order_release);
+                return index;
+            }
+        }
+
+        // Another thread is inserting a site in this slot, it could be the same site
+        while (state == SITE_CLAIMED)
+        {
+            std::this_thread::yield();
+            state = slot.mState.load(std::memory_order_acquire);
+        }
+
+        if (slot.mFile == file && slot.mAddress == address && slot.mLine == line)
+        {
+            return index;
+        }
+    }
+
+    return sOverflowSite;
+}
+
+//----------------------------------------------------------------------------------------
+
+TrackingAllocator::TrackingAllocator(Alloc::IAllocator* allocator)
+    : mAllocator(allocator)
+{
+    PG_ASSERT(sizeof(AllocationHeader) == 16);
+    PG_ASSERTSTR((sMaxAllocationSites & (sMaxAllocationSites - 1)) == 0, "The number of allocation sites has to be a power of 2");
+}
+
+//----------------------------------------------------------------------------------------
+
+TrackingAllocator::~TrackingAllocator()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void* TrackingAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    void* block = mAllocator->Alloc(size + sizeof(AllocationHeader), flags, category, debugText, file, line);
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    return Track(block, sizeof(AllocationHeader), size, debugText, file, line, file == nullptr ? PEGASUS_CALLER_ADDRESS() : nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+void* TrackingAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    // The header fits in the padding, which keeps the returned memory aligned
+    const size_t offset = align > sizeof(AllocationHeader) ? align : sizeof(AllocationHeader);
+    void* block = mAllocator->AllocAlign(size + offset, align, flags, category, debugText, file, line);
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    return Track(block, offset, size, debugText, file, line, file == nullptr ? PEGASUS_CALLER_ADDRESS() : nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+void* TrackingAllocator::Track(void* block, size_t offset, size_t size, const char* debugText, const char* file, unsigned int line, const void* caller)
+{
+    const unsigned int site = FindSite(file, caller, line, debugText);
+    SiteSlot& slot = sSites[site];
+    slot.mLiveBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+    slot.mLiveAllocations.fetch_add(1, std::memory_order_relaxed);
+    slot.mAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    char* ptr = static_cast<char*>(block) + offset;
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(ptr) - 1;
+    header->mSite = site;
+    header->mOffset = static_cast<unsigned int>(offset);
+    header->mSize = size;
+    return ptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::Delete(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    const AllocationHeader* header = static_cast<const AllocationHeader*>(ptr) - 1;
+    PG_ASSERTSTR(header->mSite <= sOverflowSite, "Pointer is not a tracked allocation!  Memory corruption may follow...");
+    SiteSlot& slot = sSites[header->mSite];
+    slot.mLiveBytes.fetch_sub(static_cast<long long>(header->mSize), std::memory_order_relaxed);
+    slot.mLiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    mAllocator->Delete(static_cast<char*>(ptr) - header->mOffset);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! \return the value used to sort the sites
+static long long GetSiteOrderValue(const AllocationSite& site, AllocationSiteOrder order)
+{
+    return order == ALLOCATION_SITE_ORDER_LIVE_BYTES ? site.mLiveBytes : static_cast<long long>(site.mLastFrameAllocations);
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetAllocationSites(AllocationSite* sites, unsigned int maxSites, AllocationSiteOrder order)
+{
+    unsigned int count = 0;
+    for (unsigned int s = 0; s <= sOverflowSite; ++s)
+    {
+        const SiteSlot& slot = sSites[s];
+        const unsigned int allocations = slot.mAllocations.load(std::memory_order_relaxed);
+        if (allocations == 0 || (s != sOverflowSite && slot.mState.load(std::memory_order_acquire) != SITE_READY))
+        {
+            continue;
+        }
+
+        AllocationSite site;
+        site.mFile = s == sOverflowSite ? "<other sites>" : slot.mFile;
+        site.mAddress = s == sOverflowSite ? nullptr : slot.mAddress;
+        site.mLine = s == sOverflowSite ? 0 : slot.mLine;
+        site.mDebugText = s == sOverflowSite ? nullptr : slot.mDebugText;
+        site.mLiveBytes = slot.mLiveBytes.load(std::memory_order_relaxed);
+        site.mLiveAllocations = slot.mLiveAllocations.load(std::memory_order_relaxed);
+        site.mFrameAllocations = allocations - slot.mFrameBase.load(std::memory_order_relaxed);
+        site.mLastFrameAllocations = slot.mLastFrameAllocations.load(std::memory_order_relaxed);
+
+        const long long value = GetSiteOrderValue(site, order);
+        if (value <= 0)
+        {
+            continue;
+        }
+
+        // Insertion into the sorted output, the lowest site falls off when it is full
+        unsigned int i = count < maxSites ? count++ : maxSites;
+        while (i > 0 && GetSiteOrderValue(sites[i - 1], order) < value)
+        {
+            if (i < maxSites)
+            {
+                sites[i] = sites[i - 1];
+            }
+            --i;
+        }
+        if (i < maxSites)
+        {
+            sites[i] = site;
+        }
+    }
+    return count;
+}
+
+//----------------------------------------------------------------------------------------
+
+void DumpLiveAllocationSites(unsigned int maxSites)
+{
+    AllocationSite sites[sMaxDumpedSites];
+    const unsigned int count = GetAllocationSites(sites, maxSites < sMaxDumpedSites ? maxSites : sMaxDumpedSites, ALLOCATION_SITE_ORDER_LIVE_BYTES);
+    PG_LOG('MEM_', "Live allocations, %u sites", count);
+    for (unsigned int s = 0; s < count; ++s)
+    {
+        const AllocationSite& site = sites[s];
+        if (site.mFile != nullptr)
+        {
+            PG_LOG('MEM_', "%s(%u): %lld bytes in %d allocations (%s)", site.mFile, site.mLine, site.mLiveBytes, site.mLiveAllocations, site.mDebugText != nullptr ? site.mDebugText : "");
+        }
+        else
+        {
+            PG_LOG('MEM_', "caller 0x%p: %lld bytes in %d allocations (%s)", site.mAddress, site.mLiveBytes, site.mLiveAllocations, site.mDebugText != nullptr ? site.mDebugText : "");
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void DumpChurnAllocationSites(unsigned int maxSites)
+{
+    AllocationSite sites[sMaxDumpedSites];
+    const unsigned int count = GetAllocationSites(sites, maxSites < sMaxDumpedSites ? maxSites : sMaxDumpedSites, ALLOCATION_SITE_ORDER_LAST_FRAME);
+    PG_LOG('MEM_', "Allocations of the last frame, %u sites", count);
+    for (unsigned int s = 0; s < count; ++s)
+    {
+        const AllocationSite& site = sites[s];
+        if (site.mFile != nullptr)
+        {
+            PG_LOG('MEM_', "%s(%u): %u allocations (%s)", site.mFile, site.mLine, site.mLastFrameAllocations, site.mDebugText != nullptr ? site.mDebugText : "");
+        }
+        else
+        {
+            PG_LOG('MEM_', "caller 0x%p: %u allocations (%s)", site.mAddress, site.mLastFrameAllocations, site.mDebugText != nullptr ? site.mDebugText : "");
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void ResetAllocationSiteFrame()
+{
+    for (unsigned int s = 0; s <= sOverflowSite; ++s)
+    {
+        SiteSlot& slot = sSites[s];
+        const unsigned int allocations = slot.mAllocations.load(std::memory_order_relaxed);
+        slot.mLastFrameAllocations.store(allocations - slot.mFrameBase.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        slot.mFrameBase.store(allocations, std::memory_order_relaxed);
+    }
+}
+
+
+}   // namespace Memory
+}   // namespace Pegasus
@@ -9,7 +9,9 @@
 //! \date   02nd November 2013
 //! \brief  Basic allocator using stdC malloc and free from the system heap.
 
-#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Memory/MemoryStats.h"
+#include <stdlib.h>
 
 namespace Pegasus {
 namespace Memory {
@@ -30,31 +32,53 @@ MallocFreeAllocator::~MallocFreeAllocator()
 void* MallocFreeAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
 {
     //! \todo Platform-specific allocs
-    // Grab the chunk with an extra int at the front for the allocator ID
-    unsigned int chunkSize = size + sizeof(unsigned int);
+    // Grab the chunk with an extra header at the front for the allocator ID
+    size_t chunkSize = size + sizeof(ChunkHeader);
     void* chunk = malloc(chunkSize);
-    void* ret = ((unsigned int*) chunk) + 1;
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
 
-    // Cache the ID
-    *((unsigned int*) chunk) = mAllocId;
+    ChunkHeader* header = static_cast<ChunkHeader*>(chunk);
+    header->mSize = size;
+    header->mOffset = sizeof(ChunkHeader);
+    header->mAllocId = mAllocId;
 
-    return ret;
+#if PEGASUS_ENABLE_MEMORY_STATS
+    RecordAllocation(mAllocId, size, size);
+#endif
+
+    return header + 1;
 }
 
 //----------------------------------------------------------------------------------------
 
 void* MallocFreeAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
 {
+    PG_ASSERTSTR(align != 0 && (align & (align - 1)) == 0, "Alignment has to be a power of 2");
+
     //! \todo Platform-specific allocs
-    // Grab the chunk with an extra int at the front for the allocator ID
-    unsigned int chunkSize = size + sizeof(unsigned int);
+    // Grab the chunk with room for the header and the alignment padding
+    size_t chunkSize = size + sizeof(ChunkHeader) + align - 1;
     void* chunk = malloc(chunkSize);
-    void* ret = ((unsigned int*) chunk) + 1;
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
 
-    // Cache the ID
-    *((unsigned int*) chunk) = mAllocId;
+    // Cache the ID and the distance to the chunk right before the aligned address
+    size_t ret = (reinterpret_cast<size_t>(chunk) + sizeof(ChunkHeader) + align - 1) & ~(align - 1);
+    ChunkHeader* header = reinterpret_cast<ChunkHeader*>(ret) - 1;
+    header->mSize = size;
+    header->mOffset = static_cast<unsigned int>(ret - reinterpret_cast<size_t>(chunk));
+    header->mAllocId = mAllocId;
 
-    return ret;
+#if PEGASUS_ENABLE_MEMORY_STATS
+    RecordAllocation(mAllocId, size, size);
+#endif
+
+    return reinterpret_cast<void*>(ret);
 }
 
 //----------------------------------------------------------------------------------------
@@ -64,13 +88,16 @@ void MallocFreeAllocator::Delete(void* ptr)
     if (ptr != nullptr)
     {
         // Grab the chunk and allocator ID
-        void* chunk = ((unsigned int*) ptr) - 1;
-        const unsigned int chunkId = *((unsigned int*) chunk);
+        const ChunkHeader* header = static_cast<ChunkHeader*>(ptr) - 1;
 
         // Allocator integrity check
-        PG_ASSERTSTR(chunkId == mAllocId, "Allocation freed from a different allocator than it was alloced in!  Memory corruption may follow...");
+        PG_ASSERTSTR(header->mAllocId == mAllocId, "Allocation freed from a different allocator than it was alloced in!  Memory corruption may follow...");
+
+#if PEGASUS_ENABLE_MEMORY_STATS
+        RecordFree(mAllocId, static_cast<size_t>(header->mSize));
+#endif
 
-        free(chunk);
+        free(static_cast<char*>(ptr) - header->mOffset);
     }
 }
 
@@ -51,7 +51,7 @@ END_IMPLEMENT_PROPERTIES(IcosphereGenerator)
 IcosphereGenerator::IcosphereGenerator(Pegasus::Alloc::IAllocator * nodeAllocator,
                                        Pegasus::Alloc::IAllocator * nodeDataAllocator)
 : MeshGenerator(nodeAllocator, nodeDataAllocator),
-  mIdxCache(nodeAllocator, sizeof(unsigned short))
+  mIdxCache(nodeAllocator)
 {
     //INIT properties
     BEGIN_INIT_PROPERTIES(IcosphereGenerator)
@@ -70,12 +70,9 @@ IcosphereGenerator::~IcosphereGenerator()
 
 unsigned short IcosphereGenerator::GenChild(MeshData * meshData, unsigned short p1, unsigned short p2)
 {
-    unsigned short r = 0; 
+    unsigned int r = 0; 
     // is there a child generated by these two vertices?
-    mIdxCache.Get(p1, p2, r);
-
-    //mIdxCache represents an infinite table with values initialized to 0
-    if (r == 0) //no index generated yet, lets go and generate the child, which is the midpoint
+    if (!mIdxCache.Get(p1, p2, r)) //no index generated yet, lets go and generate the child, which is the midpoint
     {
         StdVertex * stream = meshData->GetStream<StdVertex>(0);
         StdVertex * v1 = &stream[p1];
@@ -90,14 +87,14 @@ unsigned short IcosphereGenerator::GenChild(MeshData * meshData, unsigned short
         newVert.normal = normalizedP;
         newVert.uv = GenUvs(normalizedP);
         
-        r = meshData->PushVertex(newVert, 0) + 1;
+        r = meshData->PushVertex(newVert, 0);
         
         //store the cached index
         mIdxCache.Insert(p1, p2, r);
         
     }
     
-    return r - 1;
+    return static_cast<unsigned short>(r);
 
 }
 
@@ -204,6 +201,15 @@ void IcosphereGenerator::GenerateData()
         meshData->PushVertex<Vertex>(v, 0);
     }
     PG_ASSERT(GetDegree() > 0);
+
+    // every split edge makes a vertex, 10 * 4^(degree - 1) - 10 of them. The indices are 16 bits, which caps the count
+    unsigned int edgeCount = 10;
+    for (int d = 1; d < GetDegree() && edgeCount < 0x10000; ++d)
+    {
+        edgeCount *= 4;
+    }
+    mIdxCache.Reset(edgeCount);
+
     // do tesseleation step on icosahedron so we generate an icosphere
     for (int i = 0; i < sizeof(icotriangles)/sizeof(unsigned short); i += 3)
     {
@@ -215,7 +221,6 @@ void IcosphereGenerator::GenerateData()
             icotriangles[i]
         );
     } 
-    mIdxCache.Clear();
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
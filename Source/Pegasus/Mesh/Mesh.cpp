@@ -66,7 +66,11 @@ MeshDataReturn Mesh::GetUpdatedMeshData()
     PG_ASSERT(mFactory);
     bool updated = false;
     MeshDataRef meshData = Graph::OutputNode::GetUpdatedData(updated);
-    if (meshData != nullptr && meshData->IsGPUDataDirty())
+
+    // The previous data was invalidated before the asynchronous generation started,
+    // but its content and GPU data did not change
+    const bool gpuDataPending = IsDataPending() && (meshData != nullptr) && (meshData->GetNodeGPUData() != nullptr);
+    if (meshData != nullptr && meshData->IsGPUDataDirty() && !gpuDataPending)
     {
 #if PEGASUS_ENABLE_DETAILED_LOG
 #if PEGASUS_ENABLE_PROXIES
@@ -100,6 +104,10 @@ void Mesh::ReleaseGPUData()
     //!       This function can destroy GPU data of another graph sharing the same node.
     //!       GetUpdatedData() is called twice, and the first call might generate the data
     //!       of the graph that could have been empty, to release the content right after.
+
+    // The data being generated replaces the previous one, releasing its GPU data
+    CompleteAsyncGeneration();
+
     if (GetNumInputs() == 1 && GetInput(0)->GetData() != nullptr && mFactory != nullptr)
     {
 #if PEGASUS_ENABLE_DETAILED_LOG
@@ -116,6 +124,16 @@ void Mesh::ReleaseGPUData()
 
 //----------------------------------------------------------------------------------------
 
+void Mesh::OnAsyncDataSwapped(Graph::NodeData* previousData)
+{
+    if (mFactory != nullptr)
+    {
+        mFactory->DestroyNodeGPUData(static_cast<MeshData*>(previousData));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 Mesh::~Mesh()
 {
     ReleaseGPUData();
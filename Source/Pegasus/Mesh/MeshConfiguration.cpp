@@ -12,6 +12,7 @@
 
 #include "Pegasus/Mesh/MeshConfiguration.h"
 #include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/HashMap.h"
 
 namespace Pegasus {
 namespace Mesh {
@@ -46,6 +47,36 @@ bool MeshConfiguration::operator==(const MeshConfiguration& other) const
 
 //----------------------------------------------------------------------------------------
 
+unsigned long long MeshConfiguration::Hash(unsigned long long hash) const
+{
+    const int flags[] = {
+        mIsIndexed ? 1 : 0,
+        mIsDynamic ? 1 : 0,
+        mIsDrawIndirect ? 1 : 0,
+        static_cast<int>(mPrimitiveType),
+        mInputLayout.GetAttributeCount()
+    };
+    hash = Utils::HashBytes64(flags, sizeof(flags), hash);
+
+    // The fields are hashed one by one, the bit fields and the padding of the attributes are not hashed as bytes
+    for (int a = 0; a < mInputLayout.GetAttributeCount(); ++a)
+    {
+        const MeshInputLayout::AttrDesc& attr = mInputLayout.GetAttributeDesc(a);
+        const int fields[] = {
+            static_cast<int>(attr.mSemantic),
+            static_cast<int>(attr.mType),
+            attr.mByteSize,
+            attr.mByteOffset,
+            attr.mSemanticIndex,
+            attr.mStreamIndex
+        };
+        hash = Utils::HashBytes64(fields, sizeof(fields), hash);
+    }
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------
+
 MeshConfiguration & MeshConfiguration::operator=(const MeshConfiguration & other)
 {
     Pegasus::Utils::Memcpy(this, &other, sizeof(MeshConfiguration));
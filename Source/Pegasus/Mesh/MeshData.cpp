@@ -15,6 +15,8 @@
 namespace Pegasus {
 namespace Mesh {
 
+//! alignment of the streams, a cache line, for aligned SIMD accesses to the vertices
+static const Alloc::Alignment STREAM_ALIGNMENT = 64;
 
 MeshData::MeshData(const MeshConfiguration & configuration, Graph::Node::Mode mode, Alloc::IAllocator* allocator)
 :   Graph::NodeData(allocator),
@@ -122,6 +124,101 @@ void MeshData::Clear()
     mIndexCount = 0;
 }
 
+unsigned int MeshData::GetMemorySize() const
+{
+    int size = mIndexBuffer.GetByteSize();
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        size += mVertexStreams[s].GetByteSize();
+    }
+    return static_cast<unsigned int>(size);
+}
+
+//! Counts and strides of the mesh data written by MeshData::Serialize(), to detect a configuration change
+struct MeshDataHeader
+{
+    int mVertexCount;
+    int mIndexCount;
+    int mStrides[MESH_MAX_STREAMS];
+};
+
+bool MeshData::Serialize(Utils::ByteStream& stream) const
+{
+    if (mMode != Graph::Node::STANDARD)
+    {
+        return false;
+    }
+
+    MeshDataHeader header;
+    header.mVertexCount = mVertexCount;
+    header.mIndexCount = mIndexCount;
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        header.mStrides[s] = mVertexStreams[s].GetStride();
+    }
+    stream.Append(&header, sizeof(header));
+
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        if (header.mStrides[s] > 0 && mVertexCount > 0)
+        {
+            stream.Append(mVertexStreams[s].GetBuffer(), mVertexCount * header.mStrides[s]);
+        }
+    }
+    if (mIndexCount > 0)
+    {
+        stream.Append(mIndexBuffer.GetBuffer(), mIndexCount * mIndexBuffer.GetStride());
+    }
+    return true;
+}
+
+bool MeshData::Deserialize(const char* buffer, int size)
+{
+    if (mMode != Graph::Node::STANDARD || size < static_cast<int>(sizeof(MeshDataHeader)))
+    {
+        return false;
+    }
+
+    MeshDataHeader header;
+    Pegasus::Utils::Memcpy(&header, buffer, sizeof(header));
+    if (header.mVertexCount < 0 || header.mIndexCount < 0 || (header.mIndexCount > 0 && !mConfiguration.GetIsIndexed()))
+    {
+        return false;
+    }
+    int expectedSize = static_cast<int>(sizeof(header)) + header.mIndexCount * mIndexBuffer.GetStride();
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        if (header.mStrides[s] != mVertexStreams[s].GetStride())
+        {
+            return false;
+        }
+        expectedSize += header.mVertexCount * header.mStrides[s];
+    }
+    if (size != expectedSize)
+    {
+        return false;
+    }
+
+    AllocateVertexes(header.mVertexCount);
+    AllocateIndexes(header.mIndexCount);
+
+    const char* data = buffer + sizeof(header);
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int streamSize = header.mVertexCount * header.mStrides[s];
+        if (streamSize > 0)
+        {
+            Pegasus::Utils::Memcpy(mVertexStreams[s].GetBuffer(), data, streamSize);
+            data += streamSize;
+        }
+    }
+    if (header.mIndexCount > 0)
+    {
+        Pegasus::Utils::Memcpy(GetIndexBuffer(), data, header.mIndexCount * mIndexBuffer.GetStride());
+    }
+    return true;
+}
+
 MeshData::~MeshData()
 {
     Clear();
@@ -143,7 +240,7 @@ void MeshData::Stream::Grow(Alloc::IAllocator * allocator, int count, bool prese
 
         if (newByteSize > mByteSize || newByteSize < (mByteSize / 2))
         {
-            char * newList = PG_NEW_ARRAY(allocator, -1, "MeshData::Stream[i].mBuffer", Alloc::PG_MEM_TEMP, char, newByteSize);
+            char * newList = static_cast<char*>(allocator->AllocAlign(newByteSize, STREAM_ALIGNMENT, Alloc::PG_MEM_TEMP, -1, "MeshData::Stream[i].mBuffer", __FILE__, __LINE__));
             if (mByteSize > 0)
             {
                 if (preserveElements)
@@ -162,7 +259,7 @@ void MeshData::Stream::Grow(Alloc::IAllocator * allocator, int count, bool prese
 void MeshData::Stream::Destroy(Alloc::IAllocator * allocator)
 {
     PG_ASSERT(mBuffer != nullptr);
-    PG_DELETE_ARRAY(allocator, mBuffer); 
+    allocator->Delete(mBuffer);
     mBuffer = nullptr;
     mByteSize = 0;
 }
@@ -101,8 +101,7 @@ void CombineTransformOperator::GenerateData()
     //go for every single active child mesh and get all the counts.
     for (unsigned i = 0; i < GetNumInputs(); ++i)
     {
-        bool updated = false;
-        MeshData* inputData = static_cast<MeshData *>(&(*GetInput(i)->GetUpdatedData(updated)));
+        MeshData* inputData = static_cast<MeshData *>(&(*GetInput(i)->GetData()));
         //TODO: Work on checking compatible format when combining.
         if (inputData != nullptr)
         {
@@ -122,8 +121,7 @@ void CombineTransformOperator::GenerateData()
     //go for every single active child mesh and get all the counts.
     for (unsigned i = 0; i < GetNumInputs(); ++i)
     {
-        bool updated = false;
-        MeshData* inputData = static_cast<MeshData *>(&(*GetInput(i)->GetUpdatedData(updated)));
+        MeshData* inputData = static_cast<MeshData *>(&(*GetInput(i)->GetData()));
         Math::Mat44& targetTransform = matrices[i];
         Math::Mat33& targetNormalTransform = normalMatrices[i];
         if (inputData != nullptr)
@@ -55,8 +55,7 @@ void MultiCopyOperator::GenerateData()
         PG_LOG('ERR_', "MultiCopyFactor not allowed to be below 1 or above 64.");
         iterCount = 1;
     }
-    bool updated = false;
-    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetData()));
     const StdVertex* inputVertex = inputMesh->GetStream<StdVertex>(0);
     const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
 
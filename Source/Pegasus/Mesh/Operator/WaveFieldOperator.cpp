@@ -56,8 +56,7 @@ void WaveFieldOperator::GenerateData()
     Math::Vec3 displacementDir = Math::RotateVector(Math::Vec3(0.0f,1.0f,0.0f),q);
     Math::Vec3 timeDir = Math::RotateVector(Math::Vec3(0.0f, 0.0f, 1.0f), q);
     
-    bool updated = false;
-    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetData()));
     const StdVertex* inputVertex = inputMesh->GetStream<StdVertex>(0);
     const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
 
@@ -19,6 +19,8 @@ namespace PropertyGrid {
 PropertyGridManager::PropertyGridManager()
 :   mClassInfos(&PropertyGridStaticAllocator::GetInstance()),
     mEnumInfos(&PropertyGridStaticAllocator::GetInstance()),
+    mClassInfoIndices(&PropertyGridStaticAllocator::GetInstance()),
+    mEnumInfoIndices(&PropertyGridStaticAllocator::GetInstance()),
     mCurrentClassInfo(nullptr),
     mCurrentEnumInfo(nullptr)
 #if PEGASUS_ENABLE_PROXIES
@@ -53,6 +55,11 @@ void PropertyGridManager::BeginDeclareProperties(const char * className, const c
     //!       of the class list (no duplicates), and check that the connections between classes are correct
     //!       (inheritance)
 
+    // The first class registered with a name is the one found by name
+    if (!mClassInfoIndices.Contains(className))
+    {
+        mClassInfoIndices.Insert(className, mClassInfos.GetSize());
+    }
     mCurrentClassInfo = &mClassInfos.PushEmpty();
     mCurrentClassInfo->SetClassName(className, parentClassName);
 
@@ -73,15 +80,8 @@ void PropertyGridManager::ResolveInternalClassHierarchy()
         // Find the class info for the parent class if defined and link it
         if (classInfo->GetParentClassName()[0] != '\0')
         {
-            PropertyGridClassInfo* parentInfo = nullptr;
-            for (unsigned int pi = 0; pi < mClassInfos.GetSize(); ++pi)
-            {
-                if (Utils::Strcmp(mClassInfos[pi].GetClassName(), classInfo->GetParentClassName()) == 0)
-                {
-                    parentInfo = &mClassInfos[pi];
-                    break;
-                }
-            }
+            const unsigned int* parentIndex = mClassInfoIndices.Find(classInfo->GetParentClassName());
+            PropertyGridClassInfo* parentInfo = parentIndex != nullptr ? &mClassInfos[*parentIndex] : nullptr;
 
             PG_ASSERTSTR(parentInfo != nullptr, "Parent class not found");
             classInfo->SetParentClassInfo(parentInfo);
@@ -133,13 +133,11 @@ const PropertyGridClassInfo * PropertyGridManager::GetClassInfo(const char * cla
         return nullptr;
     }
 
-    for (unsigned int ci = 0; ci < mClassInfos.GetSize(); ++ci)
+    const unsigned int* index = mClassInfoIndices.Find(className);
+    if (index != nullptr)
     {
-        if (Utils::Strcmp(mClassInfos[ci].GetClassName(), className) == 0)
-        {
-            // Class found
-            return &mClassInfos[ci];
-        }
+        // Class found
+        return &mClassInfos[*index];
     }
 
     // Class not found
@@ -151,6 +149,10 @@ const PropertyGridClassInfo * PropertyGridManager::GetClassInfo(const char * cla
 
 void PropertyGridManager::BeginDeclareEnum(const char* enumName)
 {
+    if (!mEnumInfoIndices.Contains(enumName))
+    {
+        mEnumInfoIndices.Insert(enumName, mEnumInfos.GetSize());
+    }
     mCurrentEnumInfo = &mEnumInfos.PushEmpty();
     mCurrentEnumInfo->SetName(enumName);
 }
@@ -173,15 +175,8 @@ void PropertyGridManager::EndDeclareEnum()
 
 const EnumTypeInfo* PropertyGridManager::GetEnumInfo(const char* typeName) const
 {
-    for (unsigned int i = 0; i < mEnumInfos.GetSize(); ++i)
-    {
-        if (!Utils::Strcmp(typeName, mEnumInfos[i].GetName()))
-        {
-            return &mEnumInfos[i];
-        }
-    }
-
-    return nullptr;
+    const unsigned int* index = mEnumInfoIndices.Find(typeName);
+    return index != nullptr ? &mEnumInfos[*index] : nullptr;
 }
 
 
@@ -46,6 +46,8 @@ void PropertyAccessor::Write(const void * inputBuffer, unsigned int inputBufferS
     PG_ASSERTSTR(inputBufferSize == mSize, "Trying to write a property from a buffer whose size is incorrect.");
 #endif
 
+    mObj->PreparePropertyGridWrite();
+
     //! \todo Use a fast memcpy function that always take the fast path
     Utils::Memcpy(mPtr, inputBuffer, inputBufferSize);
 
@@ -60,20 +60,19 @@ Terrain3dGenerator::Terrain3dGenerator(Pegasus::Alloc::IAllocator* nodeAllocator
 
 bool Terrain3dGenerator::Update()
 {
-    bool updated = MeshGenerator::Update();
-
-    if (!updated)
+    //the programs are not input nodes. A reloaded program schedules this node and the mesh using it,
+    //otherwise the mesh skips its next update and the terrain keeps the data of the previous program.
+    for (unsigned int i = 0; i < Terrain3dSystem::PROGRAM_COUNT; ++i)
     {
-        for (unsigned int i = 0; i < Terrain3dSystem::PROGRAM_COUNT; ++i)
+        int newVersion = Render::GetProgramVersion(g3dTerrainSystemInstance->GetProgram(static_cast<Terrain3dSystem::Programs>(i)));
+        if (newVersion != mProgramVersions[i])
         {
-            int newVersion = Render::GetProgramVersion(g3dTerrainSystemInstance->GetProgram(static_cast<Terrain3dSystem::Programs>(i)));
-            if (newVersion != mProgramVersions[i])
-            {
-                mProgramVersions[i] = newVersion;
-                updated = true;
-            }
+            mProgramVersions[i] = newVersion;
+            SetDirty();
         }
     }
+
+    bool updated = MeshGenerator::Update();
     
     if (updated)
     {
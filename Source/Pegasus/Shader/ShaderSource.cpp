@@ -48,5 +48,5 @@ Pegasus::Graph::NodeData * ShaderSource::AllocateData() const
 
 void ShaderSource::InvalidateData()
 {
-    GeneratorNode::InvalidateData();
+    SetDirty();
 }
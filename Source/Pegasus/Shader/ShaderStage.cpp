@@ -150,6 +150,9 @@ void Pegasus::Shader::ShaderStage::InvalidateData()
     {
         GetData()->Invalidate();
     }
+
+    //! the programs linking this stage are updated on their next Update()
+    RequestUpdate();
 }
 
 Pegasus::Graph::NodeData * Pegasus::Shader::ShaderStage::AllocateData() const
@@ -50,14 +50,12 @@ void AddOperator::GenerateData()
     const unsigned char * inputLayerData;
     unsigned int layer, b;
     unsigned short addedValue;
-    bool updated;
 
     // Copy the first input texture
     for (layer = 0; layer < numLayers; ++layer)
     {
         //! \todo Use a simpler syntax
-        updated = false;
-        inputData = static_cast<TextureData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+        inputData = static_cast<TextureData *>(&(*GetInput(0)->GetData()));
         inputLayerData = inputData->GetLayerImageData(layer);
         layerData = data->GetLayerImageData(layer);
 
@@ -70,8 +68,7 @@ void AddOperator::GenerateData()
     for (input = 1; input < numInputs; ++input)
     {
         //! \todo Use a simpler syntax
-        updated = false;
-        inputData = static_cast<TextureData *>(&(*GetInput(input)->GetUpdatedData(updated)));
+        inputData = static_cast<TextureData *>(&(*GetInput(input)->GetData()));
 
         for (layer = 0; layer < numLayers; ++layer)
         {
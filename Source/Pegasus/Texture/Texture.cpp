@@ -109,7 +109,11 @@ TextureDataReturn Texture::GetUpdatedTextureData()
     PG_ASSERT(mFactory);
     bool updated = false;
     TextureDataRef textureData = Graph::OutputNode::GetUpdatedData(updated);
-    if (textureData->IsGPUDataDirty())
+
+    // The previous data was invalidated before the asynchronous generation started,
+    // but its content and GPU data did not change
+    const bool gpuDataPending = IsDataPending() && (textureData->GetNodeGPUData() != nullptr);
+    if (textureData->IsGPUDataDirty() && !gpuDataPending)
     {
 #if PEGASUS_ENABLE_DETAILED_LOG
 #if PEGASUS_ENABLE_PROXIES
@@ -144,6 +148,9 @@ void Texture::ReleaseGPUData()
     //!       GetUpdatedData() is called twice, and the first call might generate the data
     //!       of the graph that could have been empty, to release the content right after.
 
+    // The data being generated replaces the previous one, releasing its GPU data
+    CompleteAsyncGeneration();
+
     bool dummyVariable = false;
     if (GetNumInputs() == 1 && GetInput(0)->GetUpdatedData(dummyVariable) != nullptr && mFactory != nullptr)
     {
@@ -161,6 +168,16 @@ void Texture::ReleaseGPUData()
 
 //----------------------------------------------------------------------------------------
 
+void Texture::OnAsyncDataSwapped(Graph::NodeData* previousData)
+{
+    if (mFactory != nullptr)
+    {
+        mFactory->DestroyNodeGPUData(static_cast<TextureData*>(previousData));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 Texture::~Texture()
 {
     PEGASUS_EVENT_DESTROY_USER_DATA(&mProxy, "Texture", GetEventListener());
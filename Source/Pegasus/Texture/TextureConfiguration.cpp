@@ -11,6 +11,7 @@
 //!         between nodes to link them
 
 #include "Pegasus/Texture/TextureConfiguration.h"
+#include "Pegasus/Utils/HashMap.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -201,6 +202,21 @@ bool TextureConfiguration::IsCompatible(const TextureConfiguration & configurati
            && (configuration.mNumLayers == mNumLayers);
 }
 
+//----------------------------------------------------------------------------------------
+
+unsigned long long TextureConfiguration::Hash(unsigned long long hash) const
+{
+    const unsigned int fields[] = {
+        static_cast<unsigned int>(mType),
+        static_cast<unsigned int>(mPixelFormat),
+        mWidth,
+        mHeight,
+        mDepth,
+        mNumLayers
+    };
+    return Utils::HashBytes64(fields, sizeof(fields), hash);
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
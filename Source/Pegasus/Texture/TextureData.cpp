@@ -10,10 +10,13 @@
 //! \brief	Texture node data, used by all texture nodes, including generators and operators
 
 #include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Utils/Memcpy.h"
 
 namespace Pegasus {
 namespace Texture {
 
+//! Alignment of the layers, a cache line, so the operators stream through them with aligned SIMD accesses
+static const Alloc::Alignment sLayerAlignment = 64;
 
 TextureData::TextureData(const TextureConfiguration & configuration, Alloc::IAllocator* allocator)
 :   Graph::NodeData(allocator),
@@ -25,7 +28,7 @@ TextureData::TextureData(const TextureConfiguration & configuration, Alloc::IAll
     mImageData = PG_NEW_ARRAY(GetAllocator(), -1, "TextureData::mImageData", Alloc::PG_MEM_TEMP, unsigned char *, numLayers);
     for (unsigned int layer = 0; layer < numLayers; ++layer)
     {
-        mImageData[layer] = PG_NEW_ARRAY(GetAllocator(), -1, "TextureData::mImageData[layer]", Alloc::PG_MEM_TEMP, unsigned char, numBytesPerLayer);
+        mImageData[layer] = static_cast<unsigned char*>(GetAllocator()->AllocAlign(numBytesPerLayer, sLayerAlignment, Alloc::PG_MEM_TEMP, -1, "TextureData::mImageData[layer]", __FILE__, __LINE__));
     }
 }
 
@@ -36,11 +39,73 @@ TextureData::~TextureData()
     const unsigned int numLayers = mConfiguration.GetNumLayers();
     for (unsigned int layer = 0; layer < numLayers; ++layer)
     {
-        PG_DELETE_ARRAY(GetAllocator(), mImageData[layer]);
+        GetAllocator()->Delete(mImageData[layer]);
     }
     PG_DELETE_ARRAY(GetAllocator(), mImageData);
 }
 
+//----------------------------------------------------------------------------------------
+
+//! Dimensions of the image data written by TextureData::Serialize(), to detect a configuration change
+struct TextureDataHeader
+{
+    unsigned int mWidth;
+    unsigned int mHeight;
+    unsigned int mDepth;
+    unsigned int mNumLayers;
+    unsigned int mNumBytesPerLayer;
+};
+
+//----------------------------------------------------------------------------------------
+
+bool TextureData::Serialize(Utils::ByteStream& stream) const
+{
+    TextureDataHeader header;
+    header.mWidth = mConfiguration.GetWidth();
+    header.mHeight = mConfiguration.GetHeight();
+    header.mDepth = mConfiguration.GetDepth();
+    header.mNumLayers = mConfiguration.GetNumLayers();
+    header.mNumBytesPerLayer = mConfiguration.GetNumBytesPerLayer();
+    stream.Append(&header, sizeof(header));
+
+    for (unsigned int layer = 0; layer < header.mNumLayers; ++layer)
+    {
+        stream.Append(mImageData[layer], static_cast<int>(header.mNumBytesPerLayer));
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool TextureData::Deserialize(const char* buffer, int size)
+{
+    const unsigned int numLayers = mConfiguration.GetNumLayers();
+    const unsigned int numBytesPerLayer = mConfiguration.GetNumBytesPerLayer();
+    if (size != static_cast<int>(sizeof(TextureDataHeader) + numLayers * numBytesPerLayer))
+    {
+        return false;
+    }
+
+    TextureDataHeader header;
+    Utils::Memcpy(&header, buffer, sizeof(header));
+    if (   header.mWidth != mConfiguration.GetWidth()
+        || header.mHeight != mConfiguration.GetHeight()
+        || header.mDepth != mConfiguration.GetDepth()
+        || header.mNumLayers != numLayers
+        || header.mNumBytesPerLayer != numBytesPerLayer)
+    {
+        return false;
+    }
+
+    const char* layerData = buffer + sizeof(header);
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        Utils::Memcpy(mImageData[layer], layerData, numBytesPerLayer);
+        layerData += numBytesPerLayer;
+    }
+    return true;
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
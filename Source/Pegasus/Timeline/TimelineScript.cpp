@@ -387,6 +387,21 @@ void TimelineScript::OnCompilationError(const char* compilationUnitTitle, int li
     );
 }
 
+void TimelineScript::OnCompilationWarning(const char* compilationUnitTitle, int line, const char* warningMessage)
+{
+    PG_LOG('TMLN', "[%s:%d]: warning: %s", compilationUnitTitle, line, warningMessage);
+
+    PEGASUS_EVENT_DISPATCH(
+        this,
+        CompilerEvents::CompilationNotification,
+        // Shader Event specific arguments
+        CompilerEvents::CompilationNotification::COMPILATION_WARNING,
+        compilationUnitTitle,
+        line,
+        warningMessage
+    );
+}
+
 void TimelineScript::OnCompilationEnd(bool success)
 {
     if (success)
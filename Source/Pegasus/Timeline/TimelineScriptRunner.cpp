@@ -63,6 +63,7 @@ namespace Timeline
     , mPropertyGrid(propGrid)
 #if PEGASUS_ENABLE_PROXIES
     , mBlockScriptObserver(this)
+    , mGlobalSnapshot(allocator)
 #endif
     , mVmState(nullptr)
     , mGlobalCache(nullptr)
@@ -306,13 +307,70 @@ namespace Timeline
 
 
 #if PEGASUS_ENABLE_PROXIES
+    bool TimelineScriptRunner::CaptureScriptGlobals()
+    {
+        mGlobalSnapshot.Clear();
+
+        //Timeline_Destroy has to run on the old code before it gets released, so these scripts are always reinitialized.
+        //Scripts with a pending global initialization have nothing worth keeping.
+        if (mTimelineScript == nullptr || !mTimelineScript->IsDirty() || !mTimelineScript->IsScriptActive() ||
+            mTimelineScript->HasDestroyFunction() || mScriptVersion != mTimelineScript->GetSerialVersion())
+        {
+            return false;
+        }
+
+        return mTimelineScript->GetBlockScript()->CaptureGlobals(mVmState, mGlobalSnapshot);
+    }
+
+    bool TimelineScriptRunner::HotSwapScript()
+    {
+        if (!mGlobalSnapshot.IsValid())
+        {
+            return false;
+        }
+
+        bool success = false;
+        if (mTimelineScript != nullptr && mTimelineScript->IsScriptActive())
+        {
+            //listen to the stack initialization, so externs get patched with the property grid values
+            mVmState->SetRuntimeListener(&mRuntimeListener);
+            BlockScript::BlockScript::HotSwapResult result = mTimelineScript->GetBlockScript()->HotSwap(mVmState, mGlobalSnapshot);
+            mVmState->SetRuntimeListener(nullptr);
+
+            success = result != BlockScript::BlockScript::HOTSWAP_FAILED;
+            if (success)
+            {
+                //globals are alive, the nodes of the render collection are still valid. No need to run the global scope.
+                mScriptVersion = mTimelineScript->GetSerialVersion();
+                PG_LOG('TMLN', "Hot swapped script %s, globals %s.", mTimelineScript->GetDisplayName(), result == BlockScript::BlockScript::HOTSWAP_PRESERVED ? "preserved" : "migrated");
+            }
+        }
+
+        mGlobalSnapshot.Clear();
+        return success;
+    }
+
     void TimelineScriptRunner::BlockScriptObserver::OnCompilationBegin()
     {
-        //try to initialize the script. Compile wont call this observer stuff again since it is not dirty.
-        mRunner->UninitializeScript();
+        //keep the globals around if possible, the script only gets uninitialized if the hot swap fails.
+        if (!mRunner->CaptureScriptGlobals())
+        {
+            mRunner->UninitializeScript();
+        }
     }
     void TimelineScriptRunner::BlockScriptObserver::OnCompilationEnd()
     {
+        if (mRunner->mGlobalSnapshot.IsValid())
+        {
+            if (mRunner->HotSwapScript())
+            {
+                return;
+            }
+
+            //globals could not be kept, uninitialize now what was kept alive through the compilation
+            mRunner->UninitializeScript();
+        }
+
         //try to initialize the script. Compile wont call this observer stuff again since it is not dirty.
         mRunner->InitializeScript();
     }
@@ -0,0 +1,202 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Benchmark.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Microbenchmark harness for the core primitives: warmup runs, repeated timed runs,
+//!         median and 99th percentile per benchmark, printed as a table and written as JSON.
+
+#include "Pegasus/UnitTests/Benchmark.h"
+#include "Pegasus/Utils/String.h"
+#include <stdio.h>
+#include <stdlib.h>
+#if PEGASUS_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+//! \return a monotonic time, in nanoseconds
+static double GetTimeNs()
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    static double sNsPerTick = 0.0;
+    if (sNsPerTick == 0.0)
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        sNsPerTick = 1000000000.0 / static_cast<double>(frequency.QuadPart);
+    }
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return static_cast<double>(counter.QuadPart) * sNsPerTick;
+#else
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) * 1000000000.0 + static_cast<double>(now.tv_nsec);
+#endif
+}
+
+//! comparison of the samples, for qsort
+static int CompareSamples(const void* a, const void* b)
+{
+    const double sa = *static_cast<const double*>(a);
+    const double sb = *static_cast<const double*>(b);
+    return sa < sb ? -1 : (sa > sb ? 1 : 0);
+}
+
+//! \return true if a string contains another one
+static bool Contains(const char* str, const char* pattern)
+{
+    const unsigned patternLength = Pegasus::Utils::Strlen(pattern);
+    for (; *str != '\0'; ++str)
+    {
+        if (Pegasus::Utils::Strneq(str, pattern, patternLength))
+        {
+            return true;
+        }
+    }
+    return patternLength == 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+BenchmarkRunner::BenchmarkRunner()
+    : mWarmupRuns(2),
+      mRepetitions(15),
+      mFilter(nullptr),
+      mResultCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void BenchmarkRunner::SetRepetitions(int warmupRuns, int repetitions)
+{
+    PG_ASSERT(warmupRuns >= 0 && repetitions >= 1 && repetitions <= MAX_REPETITIONS);
+    mWarmupRuns = warmupRuns < 0 ? 0 : warmupRuns;
+    mRepetitions = repetitions < 1 ? 1 : (repetitions > MAX_REPETITIONS ? MAX_REPETITIONS : repetitions);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BenchmarkRunner::Run(const char* name, BenchmarkFunc func, void* userData, int iterations, unsigned long long bytesPerIteration)
+{
+    if ((mFilter != nullptr && !Contains(name, mFilter)) || mResultCount == MAX_RESULTS)
+    {
+        return;
+    }
+
+    for (int w = 0; w < mWarmupRuns; ++w)
+    {
+        func(userData, iterations);
+    }
+    for (int r = 0; r < mRepetitions; ++r)
+    {
+        const double begin = GetTimeNs();
+        func(userData, iterations);
+        mSamples[r] = (GetTimeNs() - begin) / static_cast<double>(iterations);
+    }
+    qsort(mSamples, mRepetitions, sizeof(double), CompareSamples);
+
+    BenchmarkResult& result = mResults[mResultCount++];
+    result.mName[0] = '\0';
+    Pegasus::Utils::Strcat(result.mName, name);
+    result.mIterations = iterations;
+    result.mRepetitions = mRepetitions;
+    result.mMedian = (mRepetitions & 1) ? mSamples[mRepetitions / 2] : (mSamples[mRepetitions / 2 - 1] + mSamples[mRepetitions / 2]) * 0.5;
+    const int p99Index = (mRepetitions * 99 + 99) / 100 - 1;
+    result.mP99 = mSamples[p99Index];
+    result.mMin = mSamples[0];
+    double sum = 0.0;
+    for (int r = 0; r < mRepetitions; ++r)
+    {
+        sum += mSamples[r];
+    }
+    result.mMean = sum / static_cast<double>(mRepetitions);
+    result.mBytes = bytesPerIteration;
+
+    printf("%-40s %12.1f %12.1f %12.1f", result.mName, result.mMedian, result.mP99, result.mMin);
+    if (bytesPerIteration != 0)
+    {
+        // bytes per nanosecond are GB/s
+        printf(" %10.2f", static_cast<double>(bytesPerIteration) / result.mMedian);
+    }
+    printf("\n");
+}
+
+//----------------------------------------------------------------------------------------
+
+bool BenchmarkRunner::WriteJson(const char* path) const
+{
+    FILE* file = fopen(path, "w");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    fprintf(file, "{\n  \"warmup_runs\": %d,\n  \"benchmarks\": [\n", mWarmupRuns);
+    for (int i = 0; i < mResultCount; ++i)
+    {
+        const BenchmarkResult& result = mResults[i];
+        fprintf(file, "    {\"name\": \"%s\", \"iterations\": %d, \"repetitions\": %d, "
+                      "\"median_ns\": %.3f, \"p99_ns\": %.3f, \"min_ns\": %.3f, \"mean_ns\": %.3f, \"bytes_per_iteration\": %llu",
+                result.mName, result.mIterations, result.mRepetitions,
+                result.mMedian, result.mP99, result.mMin, result.mMean, result.mBytes);
+        if (result.mBytes != 0)
+        {
+            fprintf(file, ", \"median_gb_per_s\": %.3f", static_cast<double>(result.mBytes) / result.mMedian);
+        }
+        fprintf(file, "}%s\n", i + 1 < mResultCount ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    return fclose(file) == 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+int RunBenchmarkSuites(int argc, char** argv)
+{
+    BenchmarkRunner runner;
+    const char* jsonPath = nullptr;
+    int warmupRuns = 2;
+    int repetitions = 15;
+    for (int a = 1; a < argc; ++a)
+    {
+        const bool hasValue = a + 1 < argc;
+        if (hasValue && !Pegasus::Utils::Strcmp(argv[a], "--json"))
+        {
+            jsonPath = argv[++a];
+        }
+        else if (hasValue && !Pegasus::Utils::Strcmp(argv[a], "--filter"))
+        {
+            runner.SetFilter(argv[++a]);
+        }
+        else if (hasValue && !Pegasus::Utils::Strcmp(argv[a], "--repetitions"))
+        {
+            repetitions = Pegasus::Utils::Atoi(argv[++a]);
+        }
+        else if (hasValue && !Pegasus::Utils::Strcmp(argv[a], "--warmup"))
+        {
+            warmupRuns = Pegasus::Utils::Atoi(argv[++a]);
+        }
+    }
+    runner.SetRepetitions(warmupRuns, repetitions);
+
+    printf("%-40s %12s %12s %12s %10s\n", "benchmark (ns per iteration)", "median", "p99", "min", "GB/s");
+    RunUtilsBenchmarks(runner);
+    RunMemoryBenchmarks(runner);
+    RunFileCacheBenchmarks(runner);
+    RunGraphBenchmarks(runner);
+
+    if (jsonPath != nullptr && !runner.WriteJson(jsonPath))
+    {
+        printf("Could not write %s\n", jsonPath);
+        return 1;
+    }
+    return 0;
+}
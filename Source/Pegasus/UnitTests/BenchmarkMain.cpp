@@ -0,0 +1,29 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BenchmarkMain.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Standalone entry point of the microbenchmarks, for the platforms without the
+//!         Visual Studio projects. The unit tests executable runs them with --bench.
+//!         Not part of the unit tests executable, main.cpp has its own main():
+//!         leave this file out of any Source/Pegasus/UnitTests/*.cpp glob building it.
+//!         Build and run from the root of the repository with g++ or clang++:
+//!
+//!         g++ -std=c++11 -O2 -pthread -D_PEGASUS_REL -include Pegasus/PegasusInternal.h -Iinclude
+//!             Source/Pegasus/UnitTests/Benchmark*.cpp Source/Pegasus/UnitTests/*Benchmarks.cpp
+//!             Source/Pegasus/Utils/*.cpp Source/Pegasus/Memory/*.cpp
+//!             Source/Pegasus/Memory/Platform/PageMapping_Linux.cpp Source/Pegasus/Core/Platform/Thread_Linux.cpp
+//!             Source/Pegasus/Allocator/NewDelete.cpp
+//!             -o PegasusBenchmarks
+//!         ./PegasusBenchmarks --json benchmarks.json
+
+#include "Pegasus/UnitTests/Benchmark.h"
+
+int main(int argc, char** argv)
+{
+    return RunBenchmarkSuites(argc, argv);
+}
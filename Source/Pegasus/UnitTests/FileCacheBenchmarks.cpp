@@ -0,0 +1,160 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FileCacheBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Microbenchmarks of the node data cache: the cold startup generating procedural
+//!         texture layers and storing them, against the warm startup loading them back.
+//!         The Core IO only builds on Windows, the suite is empty on the other platforms
+
+#include "Pegasus/UnitTests/Benchmark.h"
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Core/FileCache.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
+
+static Pegasus::Memory::MallocFreeAllocator sBenchmarkAllocator(0);
+
+//! keeps the results of the workloads alive, so the compiler cannot remove them
+static volatile unsigned int sBenchmarkSink = 0;
+
+//! number of texture layers of a startup, one cache entry each
+static const int sNumLayers = 8;
+
+//! octaves of the procedural noise, the cost of a typical generator graph
+static const int sNumOctaves = 4;
+
+//! parameters of the cache benchmarks
+struct FileCacheData
+{
+    Pegasus::Io::FileCache* mCache;
+    unsigned char* mPixels;
+    unsigned int mSize;         //!< width and height of a layer
+};
+
+//! value noise of a lattice point, in [0, 255]
+static unsigned int LatticeValue(unsigned int x, unsigned int y, unsigned int layer)
+{
+    return Pegasus::Utils::HashInt((static_cast<unsigned long long>(layer) << 40) | (static_cast<unsigned long long>(y) << 20) | x) & 0xFF;
+}
+
+//! fills a RGBA layer with octaves of bilinear value noise
+static void GenerateLayer(unsigned char* pixels, unsigned int size, unsigned int layer)
+{
+    for (unsigned int y = 0; y < size; ++y)
+    {
+        for (unsigned int x = 0; x < size; ++x)
+        {
+            unsigned int value = 0;
+            for (int o = 0; o < sNumOctaves; ++o)
+            {
+                const unsigned int cell = 64 >> o;
+                const unsigned int cx = x / cell, cy = y / cell;
+                const unsigned int fx = ((x % cell) << 8) / cell, fy = ((y % cell) << 8) / cell;
+                const unsigned int top = LatticeValue(cx, cy, layer) * (256 - fx) + LatticeValue(cx + 1, cy, layer) * fx;
+                const unsigned int bottom = LatticeValue(cx, cy + 1, layer) * (256 - fx) + LatticeValue(cx + 1, cy + 1, layer) * fx;
+                value += ((top * (256 - fy) + bottom * fy) >> 16) >> o;
+            }
+            unsigned char* pixel = pixels + 4 * (y * size + x);
+            pixel[0] = static_cast<unsigned char>(value >> 1);
+            pixel[1] = static_cast<unsigned char>(value >> 2);
+            pixel[2] = static_cast<unsigned char>(255 - (value >> 1));
+            pixel[3] = 255;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! cache miss of every layer: generation, then store
+static void BenchColdStartup(void* userData, int iterations)
+{
+    FileCacheData* data = static_cast<FileCacheData*>(userData);
+    const int layerSize = static_cast<int>(data->mSize * data->mSize * 4);
+    for (int i = 0; i < iterations; ++i)
+    {
+        data->mCache->Clear();
+        for (int layer = 0; layer < sNumLayers; ++layer)
+        {
+            GenerateLayer(data->mPixels, data->mSize, layer);
+            Pegasus::Utils::ByteStream stream(&sBenchmarkAllocator);
+            stream.Append(data->mPixels, layerSize);
+            sBenchmarkSink += data->mCache->Store(static_cast<unsigned long long>(layer), stream) ? 1 : 0;
+        }
+    }
+}
+
+//! cache hit of every layer: load, then copy into the texture data
+static void BenchWarmStartup(void* userData, int iterations)
+{
+    FileCacheData* data = static_cast<FileCacheData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int layer = 0; layer < sNumLayers; ++layer)
+        {
+            Pegasus::Io::FileBuffer fileBuffer;
+            int payloadSize = 0;
+            const char* payload = data->mCache->Load(static_cast<unsigned long long>(layer), fileBuffer, &sBenchmarkAllocator, payloadSize);
+            if (payload != nullptr)
+            {
+                Pegasus::Utils::Memcpy(data->mPixels, payload, payloadSize);
+                sBenchmarkSink += data->mPixels[0];
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void RunFileCacheBenchmarks(BenchmarkRunner& runner)
+{
+    char name[64];
+    static FileCacheData data;
+    const unsigned int sizes[] = { 256, 1024 };
+
+    // The files are written in the working directory, and deleted at the end
+    Pegasus::Io::IOManager ioManager(".\\");
+    Pegasus::Io::FileCache cache(&sBenchmarkAllocator);
+    cache.Initialize(&ioManager, "BenchmarkCache_", 1024ULL * 1024 * 1024);
+    data.mCache = &cache;
+
+    for (int s = 0; s < 2; ++s)
+    {
+        data.mSize = sizes[s];
+        data.mPixels = static_cast<unsigned char*>(sBenchmarkAllocator.AllocAlign(sizes[s] * sizes[s] * 4, 64, Pegasus::Alloc::PG_MEM_TEMP, -1, "Benchmark", __FILE__, __LINE__));
+        const unsigned long long bytes = static_cast<unsigned long long>(sizes[s]) * sizes[s] * 4 * sNumLayers;
+
+        name[0] = '\0';
+        Pegasus::Utils::Strcat(name, "NodeCache/Cold/");
+        Pegasus::Utils::Strcat(name, static_cast<int>(sizes[s]));
+        runner.Run(name, BenchColdStartup, &data, 1, bytes);
+
+        name[0] = '\0';
+        Pegasus::Utils::Strcat(name, "NodeCache/Warm/");
+        Pegasus::Utils::Strcat(name, static_cast<int>(sizes[s]));
+        runner.Run(name, BenchWarmStartup, &data, 1, bytes);
+
+        sBenchmarkAllocator.Delete(data.mPixels);
+    }
+
+    cache.Clear();
+    cache.Shutdown();
+    ioManager.RemoveFile("BenchmarkCache_index.pgc");
+}
+
+#else
+
+void RunFileCacheBenchmarks(BenchmarkRunner& /*runner*/)
+{
+}
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
@@ -0,0 +1,245 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Microbenchmarks of the graph evaluation: the recursive GetUpdatedData() of the nodes
+//!         against the linear evaluation of an execution plan, on a graph of 10k nodes.
+//!         The Graph library depends on the Core IO, which only builds on Windows,
+//!         the suite is empty on the other platforms
+
+#include "Pegasus/UnitTests/Benchmark.h"
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Graph/ExecutionPlan.h"
+#include "Pegasus/Graph/GeneratorNode.h"
+#include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Graph/OperatorNode.h"
+#include "Pegasus/PropertyGrid/PropertyGridManager.h"
+#include "Pegasus/Utils/Vector.h"
+
+static Pegasus::Memory::MallocFreeAllocator sBenchmarkAllocator(0);
+
+//! keeps the results of the workloads alive, so the compiler cannot remove them
+static volatile unsigned int sBenchmarkSink = 0;
+
+//! number of generators of the graph, reduced by a binary tree of operators (2 * sNumLeaves - 1 nodes)
+static const unsigned int sNumLeaves = 5000;
+
+//! data of the benchmark nodes, a single value so the evaluation cost dominates
+class BenchData : public Pegasus::Graph::NodeData
+{
+public:
+    BenchData(Pegasus::Alloc::IAllocator* allocator) : Pegasus::Graph::NodeData(allocator), mValue(0) {}
+    unsigned int mValue;
+};
+
+//! generator writing its index
+class BenchGenerator : public Pegasus::Graph::GeneratorNode
+{
+public:
+    BenchGenerator(Pegasus::Alloc::IAllocator* nodeAllocator, Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    :   Pegasus::Graph::GeneratorNode(nodeAllocator, nodeDataAllocator), mIndex(0) {}
+
+    static Pegasus::Graph::NodeReturn CreateNode(Pegasus::Graph::NodeManager* nodeManager,
+                                                 Pegasus::Alloc::IAllocator* nodeAllocator,
+                                                 Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    {
+        return PG_NEW(nodeAllocator, -1, "BenchGenerator", Pegasus::Alloc::PG_MEM_PERM) BenchGenerator(nodeAllocator, nodeDataAllocator);
+    }
+
+    virtual const char* GetClassInstanceName() const { return "BenchGenerator"; }
+
+    //! changes the generated value, as a property setter would
+    void SetIndex(unsigned int index) { mIndex = index; SetDirty(); }
+
+protected:
+    virtual Pegasus::Graph::NodeData* AllocateData() const
+    {
+        return PG_NEW(GetNodeDataAllocator(), -1, "BenchData", Pegasus::Alloc::PG_MEM_TEMP) BenchData(GetNodeDataAllocator());
+    }
+
+    virtual void GenerateData()
+    {
+        static_cast<BenchData*>(&(*GetData()))->mValue = mIndex;
+    }
+
+private:
+    unsigned int mIndex;
+};
+
+//! operator summing its one or two inputs
+class BenchOperator : public Pegasus::Graph::OperatorNode
+{
+public:
+    BenchOperator(Pegasus::Alloc::IAllocator* nodeAllocator, Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    :   Pegasus::Graph::OperatorNode(nodeAllocator, nodeDataAllocator) {}
+
+    static Pegasus::Graph::NodeReturn CreateNode(Pegasus::Graph::NodeManager* nodeManager,
+                                                 Pegasus::Alloc::IAllocator* nodeAllocator,
+                                                 Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    {
+        return PG_NEW(nodeAllocator, -1, "BenchOperator", Pegasus::Alloc::PG_MEM_PERM) BenchOperator(nodeAllocator, nodeDataAllocator);
+    }
+
+    virtual const char* GetClassInstanceName() const { return "BenchOperator"; }
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+    virtual unsigned int GetMaxNumInputNodes() const { return 2; }
+
+    void AddOperand(Pegasus::Graph::NodeIn inputNode) { AddInput(inputNode); }
+
+protected:
+    virtual Pegasus::Graph::NodeData* AllocateData() const
+    {
+        return PG_NEW(GetNodeDataAllocator(), -1, "BenchData", Pegasus::Alloc::PG_MEM_TEMP) BenchData(GetNodeDataAllocator());
+    }
+
+    virtual void GenerateData()
+    {
+        unsigned int value = 0;
+        for (unsigned int i = 0; i < GetNumInputs(); ++i)
+        {
+            value += static_cast<BenchData*>(&(*GetInput(i)->GetData()))->mValue;
+        }
+        static_cast<BenchData*>(&(*GetData()))->mValue = value;
+    }
+};
+
+//! parameters of the graph benchmarks
+struct GraphData
+{
+    Pegasus::Graph::Node* mRoot;
+    Pegasus::Graph::ExecutionPlan* mPlan;
+    BenchGenerator* mLeaves[sNumLeaves];
+    unsigned int mNextLeaf;     //!< leaf made dirty by the next iteration
+};
+
+//----------------------------------------------------------------------------------------
+
+//! evaluation of an up-to-date graph by recursion from the root
+static void BenchRecursiveClean(void* userData, int iterations)
+{
+    GraphData* data = static_cast<GraphData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        bool updated = false;
+        sBenchmarkSink += static_cast<BenchData*>(&(*data->mRoot->GetUpdatedData(updated)))->mValue;
+    }
+}
+
+//! evaluation of an up-to-date graph from its execution plan
+static void BenchPlanClean(void* userData, int iterations)
+{
+    GraphData* data = static_cast<GraphData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        bool updated = false;
+        sBenchmarkSink += static_cast<BenchData*>(&(*data->mPlan->Execute(updated)))->mValue;
+    }
+}
+
+//! evaluation by recursion from the root after a change of one generator
+static void BenchRecursiveOneDirty(void* userData, int iterations)
+{
+    GraphData* data = static_cast<GraphData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        data->mLeaves[data->mNextLeaf]->SetIndex(i);
+        data->mNextLeaf = (data->mNextLeaf + 1) % sNumLeaves;
+        bool updated = false;
+        sBenchmarkSink += static_cast<BenchData*>(&(*data->mRoot->GetUpdatedData(updated)))->mValue;
+    }
+}
+
+//! evaluation from the execution plan after a change of one generator
+static void BenchPlanOneDirty(void* userData, int iterations)
+{
+    GraphData* data = static_cast<GraphData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        data->mLeaves[data->mNextLeaf]->SetIndex(i);
+        data->mNextLeaf = (data->mNextLeaf + 1) % sNumLeaves;
+        bool updated = false;
+        sBenchmarkSink += static_cast<BenchData*>(&(*data->mPlan->Execute(updated)))->mValue;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void RunGraphBenchmarks(BenchmarkRunner& runner)
+{
+    // Done by the application otherwise, the node properties need their parent classes
+    Pegasus::PropertyGrid::PropertyGridManager::GetInstance().ResolveInternalClassHierarchy();
+
+    static GraphData data;
+    Pegasus::Graph::NodeManager nodeManager(&sBenchmarkAllocator, &sBenchmarkAllocator);
+    nodeManager.RegisterNode("BenchGenerator", BenchGenerator::CreateNode);
+    nodeManager.RegisterNode("BenchOperator", BenchOperator::CreateNode);
+
+    // The nodes are released before the node manager
+    {
+        // Binary reduction tree, without shared inputs so the recursion visits each node once
+        Pegasus::Utils::Vector<Pegasus::Graph::NodeRef> level(&sBenchmarkAllocator);
+        for (unsigned int l = 0; l < sNumLeaves; ++l)
+        {
+            Pegasus::Graph::NodeRef leaf = nodeManager.CreateNode("BenchGenerator");
+            data.mLeaves[l] = static_cast<BenchGenerator*>(&(*leaf));
+            data.mLeaves[l]->SetIndex(l);
+            level.PushEmpty() = leaf;
+        }
+        while (level.GetSize() > 1)
+        {
+            Pegasus::Utils::Vector<Pegasus::Graph::NodeRef> nextLevel(&sBenchmarkAllocator);
+            for (unsigned int n = 0; n + 1 < level.GetSize(); n += 2)
+            {
+                Pegasus::Graph::NodeRef op = nodeManager.CreateNode("BenchOperator");
+                static_cast<BenchOperator*>(&(*op))->AddOperand(level[n]);
+                static_cast<BenchOperator*>(&(*op))->AddOperand(level[n + 1]);
+                nextLevel.PushEmpty() = op;
+            }
+            if ((level.GetSize() & 1) != 0)
+            {
+                nextLevel.PushEmpty() = level[level.GetSize() - 1];
+            }
+            level.Clear();
+            for (unsigned int n = 0; n < nextLevel.GetSize(); ++n)
+            {
+                level.PushEmpty() = nextLevel[n];
+            }
+        }
+        Pegasus::Graph::NodeRef root = level[0];
+        level.Clear();
+
+        Pegasus::Graph::ExecutionPlan plan(&sBenchmarkAllocator);
+        plan.Compile(root);
+        data.mRoot = &(*root);
+        data.mPlan = &plan;
+        data.mNextLeaf = 0;
+
+        // Both paths start from generated data
+        bool updated = false;
+        (void) root->GetUpdatedData(updated);
+
+        runner.Run("Graph/Recursive/Clean", BenchRecursiveClean, &data, 100);
+        runner.Run("Graph/Plan/Clean", BenchPlanClean, &data, 100);
+        runner.Run("Graph/Recursive/OneDirty", BenchRecursiveOneDirty, &data, 100);
+        runner.Run("Graph/Plan/OneDirty", BenchPlanOneDirty, &data, 100);
+
+        plan.Clear();
+    }
+}
+
+#else
+
+void RunGraphBenchmarks(BenchmarkRunner& /*runner*/)
+{
+}
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
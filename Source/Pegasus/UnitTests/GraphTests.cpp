@@ -0,0 +1,374 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphTests.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Pegasus Unit tests for the Graph package, implementation
+
+#include "Pegasus/UnitTests/GraphTests.h"
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Graph/GeneratorNode.h"
+#include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Graph/OperatorNode.h"
+#include "Pegasus/Graph/OutputNode.h"
+#include "Pegasus/PropertyGrid/PropertyGridManager.h"
+
+static Pegasus::Memory::MallocFreeAllocator sGraphTestAllocator(0);
+
+//! data of the test nodes
+class TestData : public Pegasus::Graph::NodeData
+{
+public:
+    TestData(Pegasus::Alloc::IAllocator* allocator) : Pegasus::Graph::NodeData(allocator), mValue(0) {}
+    unsigned int mValue;
+};
+
+//! generator writing the value of its property
+class TestGenerator : public Pegasus::Graph::GeneratorNode
+{
+    BEGIN_DECLARE_PROPERTIES(TestGenerator, GeneratorNode)
+        DECLARE_PROPERTY(unsigned int, Value, 0)
+    END_DECLARE_PROPERTIES()
+
+public:
+    TestGenerator(Pegasus::Alloc::IAllocator* nodeAllocator, Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    :   Pegasus::Graph::GeneratorNode(nodeAllocator, nodeDataAllocator)
+    {
+        BEGIN_INIT_PROPERTIES(TestGenerator)
+            INIT_PROPERTY(Value)
+        END_INIT_PROPERTIES()
+    }
+
+    static Pegasus::Graph::NodeReturn CreateNode(Pegasus::Graph::NodeManager* nodeManager,
+                                                 Pegasus::Alloc::IAllocator* nodeAllocator,
+                                                 Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    {
+        return PG_NEW(nodeAllocator, -1, "TestGenerator", Pegasus::Alloc::PG_MEM_PERM) TestGenerator(nodeAllocator, nodeDataAllocator);
+    }
+
+    virtual const char* GetClassInstanceName() const { return "TestGenerator"; }
+    virtual bool IsGenerationThreadSafe() const { return true; }
+
+protected:
+    virtual Pegasus::Graph::NodeData* AllocateData() const
+    {
+        return PG_NEW(GetNodeDataAllocator(), -1, "TestData", Pegasus::Alloc::PG_MEM_TEMP) TestData(GetNodeDataAllocator());
+    }
+
+    virtual void GenerateData()
+    {
+        static_cast<TestData*>(&(*GetData()))->mValue = GetValue();
+    }
+};
+
+BEGIN_IMPLEMENT_PROPERTIES(TestGenerator)
+    IMPLEMENT_PROPERTY(TestGenerator, Value)
+END_IMPLEMENT_PROPERTIES(TestGenerator)
+
+//! operator summing its inputs
+class TestOperator : public Pegasus::Graph::OperatorNode
+{
+public:
+    TestOperator(Pegasus::Alloc::IAllocator* nodeAllocator, Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    :   Pegasus::Graph::OperatorNode(nodeAllocator, nodeDataAllocator), mNumGenerations(0) {}
+
+    static Pegasus::Graph::NodeReturn CreateNode(Pegasus::Graph::NodeManager* nodeManager,
+                                                 Pegasus::Alloc::IAllocator* nodeAllocator,
+                                                 Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    {
+        return PG_NEW(nodeAllocator, -1, "TestOperator", Pegasus::Alloc::PG_MEM_PERM) TestOperator(nodeAllocator, nodeDataAllocator);
+    }
+
+    virtual const char* GetClassInstanceName() const { return "TestOperator"; }
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+    virtual unsigned int GetMaxNumInputNodes() const { return 2; }
+
+    virtual bool IsGenerationThreadSafe() const { return true; }
+
+    void AddOperand(Pegasus::Graph::NodeIn inputNode) { AddInput(inputNode); }
+
+    //! number of calls to GenerateData(), from any thread
+    unsigned int GetNumGenerations() const { return mNumGenerations; }
+
+protected:
+    virtual Pegasus::Graph::NodeData* AllocateData() const
+    {
+        return PG_NEW(GetNodeDataAllocator(), -1, "TestData", Pegasus::Alloc::PG_MEM_TEMP) TestData(GetNodeDataAllocator());
+    }
+
+    virtual void GenerateData()
+    {
+        unsigned int value = 0;
+        for (unsigned int i = 0; i < GetNumInputs(); ++i)
+        {
+            value += static_cast<TestData*>(&(*GetInput(i)->GetData()))->mValue;
+        }
+        static_cast<TestData*>(&(*GetData()))->mValue = value;
+        ++mNumGenerations;
+    }
+
+private:
+    unsigned int mNumGenerations;
+};
+
+//! output node at the root of the test graphs
+class TestOutput : public Pegasus::Graph::OutputNode
+{
+public:
+    TestOutput(Pegasus::Graph::NodeManager* nodeManager, Pegasus::Alloc::IAllocator* nodeAllocator, Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    :   Pegasus::Graph::OutputNode(nodeManager, nodeAllocator, nodeDataAllocator) {}
+
+    virtual ~TestOutput() { CompleteAsyncGeneration(); }
+
+    static Pegasus::Graph::NodeReturn CreateNode(Pegasus::Graph::NodeManager* nodeManager,
+                                                 Pegasus::Alloc::IAllocator* nodeAllocator,
+                                                 Pegasus::Alloc::IAllocator* nodeDataAllocator)
+    {
+        return PG_NEW(nodeAllocator, -1, "TestOutput", Pegasus::Alloc::PG_MEM_PERM) TestOutput(nodeManager, nodeAllocator, nodeDataAllocator);
+    }
+
+    virtual const char* GetClassInstanceName() const { return "TestOutput"; }
+
+    void SetGraph(Pegasus::Graph::NodeIn inputNode) { AddInput(inputNode); }
+};
+
+//! updates and evaluates a graph as the application does each frame, then starts the next frame,
+//! so GetNumVisitedNodesLastFrame() returns the visits of this frame
+//! \return the value of the root
+static unsigned int RunFrame(Pegasus::Graph::NodeManager& nodeManager, Pegasus::Graph::NodeIn root)
+{
+    (void) root->Update();
+    bool updated = false;
+    const unsigned int value = static_cast<TestData*>(&(*root->GetUpdatedData(updated)))->mValue;
+    nodeManager.BeginFrame();
+    return value;
+}
+
+//! resolves the class hierarchy of the node properties once for all the tests,
+//! done by the application otherwise
+static void ResolveNodeClasses()
+{
+    static bool sResolved = false;
+    if (!sResolved)
+    {
+        Pegasus::PropertyGrid::PropertyGridManager::GetInstance().ResolveInternalClassHierarchy();
+        sResolved = true;
+    }
+}
+
+bool UNIT_TEST_GraphIdleFrame()
+{
+    ResolveNodeClasses();
+
+    Pegasus::Graph::NodeManager nodeManager(&sGraphTestAllocator, &sGraphTestAllocator);
+    nodeManager.RegisterNode("TestGenerator", TestGenerator::CreateNode);
+    nodeManager.RegisterNode("TestOperator", TestOperator::CreateNode);
+    bool success = true;
+
+    // The nodes are released before the node manager
+    {
+        // (a + b) + c
+        Pegasus::Graph::NodeRef a = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef b = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef c = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef ab = nodeManager.CreateNode("TestOperator");
+        Pegasus::Graph::NodeRef root = nodeManager.CreateNode("TestOperator");
+        static_cast<TestGenerator*>(&(*a))->SetValue(1);
+        static_cast<TestGenerator*>(&(*b))->SetValue(2);
+        static_cast<TestGenerator*>(&(*c))->SetValue(4);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(a);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(b);
+        static_cast<TestOperator*>(&(*root))->AddOperand(ab);
+        static_cast<TestOperator*>(&(*root))->AddOperand(c);
+
+        // the first frame visits the whole graph
+        success = success && RunFrame(nodeManager, root) == 7;
+        success = success && nodeManager.GetNumVisitedNodesLastFrame() == 5;
+
+        // nothing has changed, the idle frames do not visit any node
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            success = success && RunFrame(nodeManager, root) == 7;
+            success = success && nodeManager.GetNumVisitedNodesLastFrame() == 0;
+        }
+
+        // a change only visits the changed node and the nodes depending on it
+        static_cast<TestGenerator*>(&(*b))->SetValue(8);
+        success = success && RunFrame(nodeManager, root) == 13;
+        success = success && nodeManager.GetNumVisitedNodesLastFrame() == 3;
+        success = success && RunFrame(nodeManager, root) == 13;
+        success = success && nodeManager.GetNumVisitedNodesLastFrame() == 0;
+    }
+
+    return success;
+}
+
+bool UNIT_TEST_GraphContentHash()
+{
+    ResolveNodeClasses();
+
+    Pegasus::Graph::NodeManager nodeManager(&sGraphTestAllocator, &sGraphTestAllocator);
+    nodeManager.RegisterNode("TestGenerator", TestGenerator::CreateNode);
+    nodeManager.RegisterNode("TestOperator", TestOperator::CreateNode);
+    bool success = true;
+
+    {
+        // (a + b) + a, the input a is shared
+        Pegasus::Graph::NodeRef a = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef b = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef ab = nodeManager.CreateNode("TestOperator");
+        Pegasus::Graph::NodeRef root = nodeManager.CreateNode("TestOperator");
+        static_cast<TestGenerator*>(&(*a))->SetValue(1);
+        static_cast<TestGenerator*>(&(*b))->SetValue(2);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(a);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(b);
+        static_cast<TestOperator*>(&(*root))->AddOperand(ab);
+        static_cast<TestOperator*>(&(*root))->AddOperand(a);
+
+        // the cached hash is returned while nothing changes
+        const unsigned long long hash = root->ComputeContentHash();
+        success = success && RunFrame(nodeManager, root) == 4;
+        success = success && root->ComputeContentHash() == hash;
+
+        // a property change invalidates the hash of the node and of the nodes depending on it only
+        const unsigned long long bHash = b->ComputeContentHash();
+        static_cast<TestGenerator*>(&(*a))->SetValue(4);
+        success = success && b->ComputeContentHash() == bHash;
+        success = success && root->ComputeContentHash() != hash;
+        success = success && RunFrame(nodeManager, root) == 10;
+
+        // the hash only depends on the content, the original value gives the original hash
+        static_cast<TestGenerator*>(&(*a))->SetValue(1);
+        success = success && root->ComputeContentHash() == hash;
+        success = success && RunFrame(nodeManager, root) == 4;
+    }
+
+    return success;
+}
+
+bool UNIT_TEST_GraphScheduledFrame()
+{
+    ResolveNodeClasses();
+
+    Pegasus::Graph::NodeManager nodeManager(&sGraphTestAllocator, &sGraphTestAllocator);
+    nodeManager.RegisterNode("TestGenerator", TestGenerator::CreateNode);
+    nodeManager.RegisterNode("TestOperator", TestOperator::CreateNode);
+    nodeManager.RegisterNode("TestOutput", TestOutput::CreateNode);
+    nodeManager.GetScheduler()->SetNumWorkers(2);
+    bool success = nodeManager.GetScheduler()->GetNumWorkers() == 2;
+
+    {
+        // output((a + b) + c), generated by the worker threads of the scheduler
+        Pegasus::Graph::NodeRef a = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef b = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef c = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef ab = nodeManager.CreateNode("TestOperator");
+        Pegasus::Graph::NodeRef abc = nodeManager.CreateNode("TestOperator");
+        Pegasus::Graph::NodeRef output = nodeManager.CreateNode("TestOutput");
+        static_cast<TestGenerator*>(&(*a))->SetValue(1);
+        static_cast<TestGenerator*>(&(*b))->SetValue(2);
+        static_cast<TestGenerator*>(&(*c))->SetValue(4);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(a);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(b);
+        static_cast<TestOperator*>(&(*abc))->AddOperand(ab);
+        static_cast<TestOperator*>(&(*abc))->AddOperand(c);
+        static_cast<TestOutput*>(&(*output))->SetGraph(abc);
+        const TestOperator* abOperator = static_cast<const TestOperator*>(&(*ab));
+        const TestOperator* abcOperator = static_cast<const TestOperator*>(&(*abc));
+
+        success = success && RunFrame(nodeManager, output) == 7;
+        success = success && abOperator->GetNumGenerations() == 1;
+        success = success && abcOperator->GetNumGenerations() == 1;
+
+        // the clean graph is not handed to the scheduler nor generated again
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            success = success && RunFrame(nodeManager, output) == 7;
+            success = success && nodeManager.GetNumVisitedNodesLastFrame() == 0;
+        }
+        success = success && abcOperator->GetNumGenerations() == 1;
+
+        // a change only generates the nodes depending on it
+        static_cast<TestGenerator*>(&(*c))->SetValue(8);
+        success = success && RunFrame(nodeManager, output) == 11;
+        success = success && abOperator->GetNumGenerations() == 1;
+        success = success && abcOperator->GetNumGenerations() == 2;
+        success = success && nodeManager.GetScheduler()->IsIdle();
+    }
+
+    return success;
+}
+
+bool UNIT_TEST_GraphAsyncFrame()
+{
+    ResolveNodeClasses();
+
+    Pegasus::Graph::NodeManager nodeManager(&sGraphTestAllocator, &sGraphTestAllocator);
+    nodeManager.RegisterNode("TestGenerator", TestGenerator::CreateNode);
+    nodeManager.RegisterNode("TestOperator", TestOperator::CreateNode);
+    nodeManager.RegisterNode("TestOutput", TestOutput::CreateNode);
+    nodeManager.GetScheduler()->SetNumWorkers(2);
+    bool success = nodeManager.GetScheduler()->GetNumWorkers() == 2;
+
+    {
+        // output(a + b), generated in the background once generated a first time
+        Pegasus::Graph::NodeRef a = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef b = nodeManager.CreateNode("TestGenerator");
+        Pegasus::Graph::NodeRef ab = nodeManager.CreateNode("TestOperator");
+        Pegasus::Graph::NodeRef output = nodeManager.CreateNode("TestOutput");
+        TestGenerator* aGenerator = static_cast<TestGenerator*>(&(*a));
+        TestGenerator* bGenerator = static_cast<TestGenerator*>(&(*b));
+        TestOutput* testOutput = static_cast<TestOutput*>(&(*output));
+        aGenerator->SetValue(1);
+        bGenerator->SetValue(2);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(a);
+        static_cast<TestOperator*>(&(*ab))->AddOperand(b);
+        testOutput->SetGraph(ab);
+        testOutput->SetAsyncGeneration(true);
+
+        // without previous data, the first generation is synchronous
+        success = success && RunFrame(nodeManager, output) == 3;
+        success = success && !testOutput->IsDataPending();
+
+        // the previous data is returned while the new one is pending
+        bGenerator->SetValue(4);
+        success = success && RunFrame(nodeManager, output) == 3;
+        success = success && testOutput->IsDataPending();
+
+        // the completed data is swapped in by the first request of the next frame
+        while (!nodeManager.GetScheduler()->IsIdle())
+        {
+        }
+        success = success && RunFrame(nodeManager, output) == 5;
+        success = success && !testOutput->IsDataPending();
+
+        // a property write waits for the pending data, the change is picked up by the update after the swap
+        bGenerator->SetValue(8);
+        success = success && RunFrame(nodeManager, output) == 5;
+        aGenerator->SetValue(16);
+        success = success && nodeManager.GetScheduler()->IsIdle();
+        success = success && testOutput->IsDataPending();
+        success = success && RunFrame(nodeManager, output) == 9;
+        success = success && !testOutput->IsDataPending();
+        success = success && RunFrame(nodeManager, output) == 9;
+        success = success && testOutput->IsDataPending();
+
+        // completing the generation swaps the data in right away
+        testOutput->CompleteAsyncGeneration();
+        success = success && !testOutput->IsDataPending();
+        success = success && RunFrame(nodeManager, output) == 24;
+        success = success && !testOutput->IsDataPending();
+    }
+
+    return success;
+}
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
@@ -0,0 +1,419 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MemoryBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Microbenchmarks of the Memory package: block allocator, slab allocator, large block
+//!         allocator and the allocators of the memory manager, against the system heap
+
+#include "Pegasus/UnitTests/Benchmark.h"
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Memory/BlockAllocator.h"
+#include "Pegasus/Memory/SlabAllocator.h"
+#include "Pegasus/Memory/LargeBlockAllocator.h"
+#include "Pegasus/Memory/PageMapping.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Core/Thread.h"
+#include <stdio.h>
+#include <atomic>
+
+//! keeps the results of the workloads alive, so the compiler cannot remove them
+static volatile unsigned int sBenchmarkSink = 0;
+
+//! number of live allocations of the batch benchmarks, timed per batch
+static const int sBatchSize = 1024;
+
+//! parameters of the allocator benchmarks
+struct AllocatorData
+{
+    Pegasus::Alloc::IAllocator* mAllocator;
+    size_t mSize;
+    void* mPointers[sBatchSize];
+};
+
+//! builds a name made of a category, an allocator and a size
+static const char* MakeName(char* name, const char* category, const char* allocator, size_t size)
+{
+    name[0] = '\0';
+    Pegasus::Utils::Strcat(name, category);
+    Pegasus::Utils::Strcat(name, "/");
+    Pegasus::Utils::Strcat(name, allocator);
+    Pegasus::Utils::Strcat(name, "/");
+    Pegasus::Utils::Strcat(name, static_cast<int>(size));
+    return name;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! an allocation immediately deleted, the best case of the free lists
+static void BenchAllocPair(void* userData, int iterations)
+{
+    AllocatorData* data = static_cast<AllocatorData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        char* p = static_cast<char*>(data->mAllocator->Alloc(data->mSize, Pegasus::Alloc::PG_MEM_TEMP));
+        p[0] = static_cast<char>(i);
+        sBenchmarkSink += static_cast<unsigned char>(p[0]);
+        data->mAllocator->Delete(p);
+    }
+}
+
+//! batches of live allocations, deleted in the reverse order of a half and the order of the other half
+static void BenchAllocBatch(void* userData, int iterations)
+{
+    AllocatorData* data = static_cast<AllocatorData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int b = 0; b < sBatchSize; ++b)
+        {
+            data->mPointers[b] = data->mAllocator->Alloc(data->mSize, Pegasus::Alloc::PG_MEM_TEMP);
+            static_cast<char*>(data->mPointers[b])[0] = static_cast<char>(b);
+        }
+        for (int b = sBatchSize / 2 - 1; b >= 0; --b)
+        {
+            data->mAllocator->Delete(data->mPointers[b]);
+        }
+        for (int b = sBatchSize / 2; b < sBatchSize; ++b)
+        {
+            data->mAllocator->Delete(data->mPointers[b]);
+        }
+    }
+}
+
+//! pointer bumps, the memory released at once
+static void BenchBlockAllocator(void* userData, int iterations)
+{
+    AllocatorData* data = static_cast<AllocatorData*>(userData);
+    Pegasus::Memory::BlockAllocator* blockAllocator = static_cast<Pegasus::Memory::BlockAllocator*>(data->mAllocator);
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int b = 0; b < sBatchSize; ++b)
+        {
+            static_cast<char*>(blockAllocator->Alloc(data->mSize, Pegasus::Alloc::PG_MEM_TEMP))[0] = static_cast<char>(b);
+        }
+        sBenchmarkSink += static_cast<unsigned int>(blockAllocator->GetMemorySize());
+        blockAllocator->Reset();
+    }
+}
+
+//! frames of temporaries, the frame allocator is flipped after each batch
+static void BenchFrameAllocator(void* userData, int iterations)
+{
+    AllocatorData* data = static_cast<AllocatorData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int b = 0; b < sBatchSize; ++b)
+        {
+            static_cast<char*>(data->mAllocator->Alloc(data->mSize, Pegasus::Alloc::PG_MEM_TEMP))[0] = static_cast<char>(b);
+        }
+        Pegasus::Memory::FlipFrameAllocator();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! number of live objects of the churn benchmark
+static const int sChurnWindowSize = 4096;
+
+//! parameters of the churn benchmark
+struct ChurnData
+{
+    Pegasus::Alloc::IAllocator* mAllocator;
+    unsigned int mSeed;
+    void* mWindow[sChurnWindowSize];
+};
+
+//! small allocations of random sizes, each one replacing a random object of a window of live objects
+static void BenchChurn(void* userData, int iterations)
+{
+    ChurnData* data = static_cast<ChurnData*>(userData);
+    unsigned int seed = data->mSeed;
+    for (int i = 0; i < iterations; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        const int slot = (seed >> 8) % sChurnWindowSize;
+        data->mAllocator->Delete(data->mWindow[slot]);
+        data->mWindow[slot] = data->mAllocator->Alloc(16 + (seed >> 20) % 240, Pegasus::Alloc::PG_MEM_TEMP);
+    }
+    data->mSeed = seed;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! spinning barrier, to run the rounds of the cross thread workload in lock step
+class SpinBarrier
+{
+public:
+    SpinBarrier(int threadCount) : mThreadCount(threadCount) { mCount.store(0); mGeneration.store(0); }
+
+    void Wait()
+    {
+        const int generation = mGeneration.load();
+        if (mCount.fetch_add(1) + 1 == mThreadCount)
+        {
+            mCount.store(0);
+            mGeneration.fetch_add(1);
+        }
+        else
+        {
+            while (mGeneration.load() == generation)
+            {
+                Pegasus::Core::Thread::YieldCurrentThread();
+            }
+        }
+    }
+
+private:
+    std::atomic<int> mCount;
+    std::atomic<int> mGeneration;
+    int mThreadCount;
+};
+
+static const int sMaxScalingThreads = 16;
+static const int sHandoffSize = 256;
+
+//! shared state of the threads of the scaling benchmark
+struct ScalingData
+{
+    Pegasus::Alloc::IAllocator* mAllocator;
+    Pegasus::Memory::SlabAllocator* mSlabAllocator; //!< thread cache released by each thread before exiting, nullptr for other allocators
+    int mThreadCount;
+    int mIterations;      //!< allocations per thread
+    bool mCrossThread;    //!< if true, each thread frees what the previous thread allocated
+    SpinBarrier* mBarrier;
+    void* mHandoff[sMaxScalingThreads * sHandoffSize];   //!< sHandoffSize pointers per thread, for the cross thread workload
+};
+
+//! parameters of a thread of the scaling benchmark
+struct ScalingThreadArgs
+{
+    ScalingData* mData;
+    int mThread;
+};
+
+static void ScalingThread(void* userData)
+{
+    ScalingData* data = static_cast<ScalingThreadArgs*>(userData)->mData;
+    const int thread = static_cast<ScalingThreadArgs*>(userData)->mThread;
+    Pegasus::Alloc::IAllocator* allocator = data->mAllocator;
+    if (data->mCrossThread)
+    {
+        // each round, allocate a batch, then free the batch of the previous thread
+        void** mine = data->mHandoff + thread * sHandoffSize;
+        void** theirs = data->mHandoff + ((thread + data->mThreadCount - 1) % data->mThreadCount) * sHandoffSize;
+        for (int round = 0; round < data->mIterations / sHandoffSize; ++round)
+        {
+            for (int i = 0; i < sHandoffSize; ++i)
+            {
+                mine[i] = allocator->Alloc(16 + (i * 37) % 240, Pegasus::Alloc::PG_MEM_TEMP);
+            }
+            data->mBarrier->Wait();
+            for (int i = 0; i < sHandoffSize; ++i)
+            {
+                allocator->Delete(theirs[i]);
+            }
+            data->mBarrier->Wait();
+        }
+    }
+    else
+    {
+        // churn of a window of live objects private to the thread
+        const int windowSize = 1024;
+        void* window[windowSize];
+        for (int i = 0; i < windowSize; ++i) window[i] = nullptr;
+        unsigned int seed = 12345 + thread;
+        for (int i = 0; i < data->mIterations; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            int slot = (seed >> 8) % windowSize;
+            allocator->Delete(window[slot]);
+            window[slot] = allocator->Alloc(16 + (seed >> 20) % 240, Pegasus::Alloc::PG_MEM_TEMP);
+        }
+        for (int i = 0; i < windowSize; ++i) allocator->Delete(window[i]);
+    }
+
+    if (data->mSlabAllocator != nullptr)
+    {
+        data->mSlabAllocator->ReleaseThreadCache();
+    }
+}
+
+//! the alloc and free pairs shared by the threads, the thread startup included
+static void BenchScaling(void* userData, int iterations)
+{
+    ScalingData* data = static_cast<ScalingData*>(userData);
+    Pegasus::Core::Thread threads[sMaxScalingThreads];
+    ScalingThreadArgs args[sMaxScalingThreads];
+    SpinBarrier barrier(data->mThreadCount);
+    data->mBarrier = &barrier;
+    data->mIterations = iterations / data->mThreadCount;
+    for (int t = 0; t < data->mThreadCount; ++t)
+    {
+        args[t].mData = data;
+        args[t].mThread = t;
+        threads[t].Start(ScalingThread, &args[t]);
+    }
+    for (int t = 0; t < data->mThreadCount; ++t)
+    {
+        threads[t].Join();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! width of the layers of the texture benchmark, 1 MB of float RGBA per layer
+static const int sTextureWidth = 256;
+static const int sTextureLayerSize = sTextureWidth * sTextureWidth * 4 * sizeof(float);
+static const int sTextureLayerCount = 4;
+
+//! parameters of the texture benchmark, the layers kept between the runs
+struct TextureData
+{
+    Pegasus::Alloc::IAllocator* mAllocator;
+    float* mLayers[sTextureLayerCount];
+    int mEvaluation;
+};
+
+//! a texture operator graph: every evaluation allocates an output layer, blends two inputs into it,
+//! then the oldest layer is released, like the nodes of an edited graph being recomputed
+static void BenchTextureOperators(void* userData, int iterations)
+{
+    TextureData* data = static_cast<TextureData*>(userData);
+    for (int i = 0; i < iterations; ++i, ++data->mEvaluation)
+    {
+        const int e = data->mEvaluation;
+        const float* a = data->mLayers[(e + 1) % sTextureLayerCount];
+        const float* b = data->mLayers[(e + 2) % sTextureLayerCount];
+        float* output = static_cast<float*>(data->mAllocator->AllocAlign(sTextureLayerSize, 64, Pegasus::Alloc::PG_MEM_TEMP));
+        for (int p = 0; p < sTextureWidth * sTextureWidth * 4; ++p)
+        {
+            output[p] = a[p] * 0.5f + b[p] * 0.5f;
+        }
+        data->mAllocator->Delete(data->mLayers[e % sTextureLayerCount]);
+        data->mLayers[e % sTextureLayerCount] = output;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void RunMemoryBenchmarks(BenchmarkRunner& runner)
+{
+    char name[64];
+    static AllocatorData data;
+    const size_t sizes[] = { 64, 1024 };
+
+    Pegasus::Memory::MallocFreeAllocator mallocAllocator(0);
+    Pegasus::Memory::BlockAllocator blockAllocator;
+    blockAllocator.Initialize(64 * 1024, &mallocAllocator);
+
+    struct NamedAllocator
+    {
+        const char* mName;
+        Pegasus::Alloc::IAllocator* mAllocator;
+    };
+    const NamedAllocator allocators[] = {
+        { "Malloc", &mallocAllocator },
+        { "Global", Pegasus::Memory::GetGlobalAllocator() },
+        { "Core", Pegasus::Memory::GetCoreAllocator() },
+        { "Render", Pegasus::Memory::GetRenderAllocator() },
+        { "Node", Pegasus::Memory::GetNodeAllocator() },
+        { "NodeData", Pegasus::Memory::GetNodeDataAllocator() },
+        { "PropertyPointer", Pegasus::Memory::GetPropertyPointerAllocator() },
+        { "Timeline", Pegasus::Memory::GetTimelineAllocator() },
+        { "Window", Pegasus::Memory::GetWindowAllocator() }
+    };
+
+    for (int s = 0; s < 2; ++s)
+    {
+        data.mSize = sizes[s];
+        for (unsigned int a = 0; a < sizeof(allocators) / sizeof(allocators[0]); ++a)
+        {
+            data.mAllocator = allocators[a].mAllocator;
+            runner.Run(MakeName(name, "AllocPair", allocators[a].mName, data.mSize), BenchAllocPair, &data, 100000);
+            runner.Run(MakeName(name, "AllocBatch", allocators[a].mName, data.mSize), BenchAllocBatch, &data, 20);
+        }
+
+        data.mAllocator = &blockAllocator;
+        runner.Run(MakeName(name, "AllocBatch", "Block", data.mSize), BenchBlockAllocator, &data, 20);
+        data.mAllocator = Pegasus::Memory::GetFrameAllocator();
+        runner.Run(MakeName(name, "AllocBatch", "Frame", data.mSize), BenchFrameAllocator, &data, 20);
+    }
+
+    blockAllocator.FreeMemory();
+
+    Pegasus::Memory::SlabAllocator slabAllocator(1);
+    const NamedAllocator churnAllocators[] = {
+        { "Malloc", &mallocAllocator },
+        { "Slab", &slabAllocator }
+    };
+    static ChurnData churnData;
+    for (int a = 0; a < 2; ++a)
+    {
+        churnData.mAllocator = churnAllocators[a].mAllocator;
+        churnData.mSeed = 12345;
+        for (int i = 0; i < sChurnWindowSize; ++i) churnData.mWindow[i] = nullptr;
+        runner.Run(MakeName(name, "Churn", churnAllocators[a].mName, sChurnWindowSize), BenchChurn, &churnData, 200000);
+        for (int i = 0; i < sChurnWindowSize; ++i) churnData.mAllocator->Delete(churnData.mWindow[i]);
+    }
+
+    // named after the thread count, the time per pair drops as the allocators scale.
+    // At least 4 threads, so the cross thread paths are measured on small machines too
+    int maxThreads = static_cast<int>(Pegasus::Core::Thread::GetNumHardwareThreads());
+    maxThreads = maxThreads < 4 ? 4 : (maxThreads > sMaxScalingThreads ? sMaxScalingThreads : maxThreads);
+    static ScalingData scalingData;
+    for (int crossThread = 0; crossThread < 2; ++crossThread)
+    {
+        scalingData.mCrossThread = crossThread != 0;
+        for (scalingData.mThreadCount = 1; scalingData.mThreadCount <= maxThreads; scalingData.mThreadCount *= 2)
+        {
+            for (int a = 0; a < 2; ++a)
+            {
+                scalingData.mAllocator = churnAllocators[a].mAllocator;
+                scalingData.mSlabAllocator = a == 1 ? &slabAllocator : nullptr;
+                runner.Run(MakeName(name, crossThread ? "ScalingCrossThread" : "ScalingThreadLocal", churnAllocators[a].mName, scalingData.mThreadCount),
+                           BenchScaling, &scalingData, 400000);
+            }
+        }
+    }
+
+    // the page faults are printed after the timings, the time of a fault depends on the machine
+    Pegasus::Memory::LargeBlockAllocator largeAllocator(1, &slabAllocator);
+    const NamedAllocator textureAllocators[] = {
+        { "Malloc", &mallocAllocator },
+        { "LargeBlock", &largeAllocator }
+    };
+    static TextureData textureData;
+    for (int a = 0; a < 2; ++a)
+    {
+        textureData.mAllocator = textureAllocators[a].mAllocator;
+        textureData.mEvaluation = 0;
+        for (int l = 0; l < sTextureLayerCount; ++l)
+        {
+            textureData.mLayers[l] = static_cast<float*>(textureData.mAllocator->AllocAlign(sTextureLayerSize, 64, Pegasus::Alloc::PG_MEM_TEMP));
+            for (int p = 0; p < sTextureWidth * sTextureWidth * 4; ++p) textureData.mLayers[l][p] = static_cast<float>(l);
+        }
+
+        const int resultCount = runner.GetResultCount();
+        const unsigned long long firstFault = Pegasus::Memory::GetPageFaultCount();
+        runner.Run(MakeName(name, "TextureOperators", textureAllocators[a].mName, sTextureWidth), BenchTextureOperators, &textureData, 100, 3 * sTextureLayerSize);
+        if (runner.GetResultCount() != resultCount)
+        {
+            printf("    %llu page faults in %d evaluations", Pegasus::Memory::GetPageFaultCount() - firstFault, textureData.mEvaluation);
+            if (textureData.mAllocator == &largeAllocator)
+            {
+                printf(", %u of %u chunks on huge pages", largeAllocator.GetHugePageChunkCount(), largeAllocator.GetChunkCount());
+            }
+            printf("\n");
+        }
+
+        for (int l = 0; l < sTextureLayerCount; ++l)
+        {
+            textureData.mAllocator->Delete(textureData.mLayers[l]);
+        }
+    }
+}
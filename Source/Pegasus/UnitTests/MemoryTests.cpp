@@ -0,0 +1,603 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MemoryTests.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Pegasus Unit tests for the Memory package, implementation
+
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Memory/SlabAllocator.h"
+#include "Pegasus/Memory/FrameAllocator.h"
+#include "Pegasus/Memory/BlockAllocator.h"
+#include "Pegasus/Memory/TrackingAllocator.h"
+#include "Pegasus/Memory/LargeBlockAllocator.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/MemoryStats.h"
+#include "Pegasus/UnitTests/MemoryTests.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/Thread.h"
+#include <stdio.h>
+
+static bool IsAligned(const void* ptr, size_t align)
+{
+    return (reinterpret_cast<size_t>(ptr) & (align - 1)) == 0;
+}
+
+bool UNIT_TEST_MallocFreeAlign1()
+{
+    Pegasus::Memory::MallocFreeAllocator mallocAllocator(0);
+    Pegasus::Alloc::IAllocator* allocator = &mallocAllocator;
+    const size_t alignments[] = { 4, 16, 32, 64, 256 };
+    void* ptrs[5];
+    bool aligned = true;
+    for (int i = 0; i < 5; ++i)
+    {
+        ptrs[i] = allocator->AllocAlign(100, alignments[i], Pegasus::Alloc::PG_MEM_TEMP);
+        aligned = aligned && IsAligned(ptrs[i], alignments[i]);
+        Pegasus::Utils::Memset8(ptrs[i], i, 100);
+    }
+
+    for (int i = 0; i < 5; ++i)
+    {
+        allocator->Delete(ptrs[i]);
+    }
+
+    return aligned;
+}
+
+bool UNIT_TEST_SlabAllocator1()
+{
+    // every size class and the large fallback, written and checked for overlaps
+    Pegasus::Memory::SlabAllocator slabAllocator(0);
+    Pegasus::Alloc::IAllocator* allocator = &slabAllocator;
+    const int count = 600;
+    unsigned char* ptrs[count];
+    for (int i = 0; i < count; ++i)
+    {
+        int size = 1 + (i * 37) % 3000;
+        ptrs[i] = static_cast<unsigned char*>(allocator->Alloc(size, Pegasus::Alloc::PG_MEM_TEMP));
+        if (ptrs[i] == nullptr || !IsAligned(ptrs[i], 16)) return false;
+        for (int b = 0; b < size; ++b) ptrs[i][b] = static_cast<unsigned char>(i);
+    }
+
+    bool match = true;
+    for (int i = 0; i < count; ++i)
+    {
+        int size = 1 + (i * 37) % 3000;
+        for (int b = 0; b < size; ++b) match = match && ptrs[i][b] == static_cast<unsigned char>(i);
+        allocator->Delete(ptrs[i]);
+    }
+
+    return match;
+}
+
+bool UNIT_TEST_SlabAllocator2()
+{
+    // alignments are honored by the slabs up to 64 bytes, and by the system heap above
+    Pegasus::Memory::SlabAllocator slabAllocator(0);
+    Pegasus::Alloc::IAllocator* allocator = &slabAllocator;
+    const size_t alignments[] = { 16, 32, 64, 128 };
+    const size_t sizes[] = { 8, 24, 48, 100, 200, 1000, 2048, 5000 };
+    void* ptrs[4 * 8];
+    bool aligned = true;
+    for (int a = 0; a < 4; ++a)
+    {
+        for (int s = 0; s < 8; ++s)
+        {
+            void* p = allocator->AllocAlign(sizes[s], alignments[a], Pegasus::Alloc::PG_MEM_TEMP);
+            aligned = aligned && p != nullptr && IsAligned(p, alignments[a]);
+            ptrs[a * 8 + s] = p;
+        }
+    }
+
+    for (int i = 0; i < 4 * 8; ++i)
+    {
+        allocator->Delete(ptrs[i]);
+    }
+
+    return aligned;
+}
+
+bool UNIT_TEST_SlabAllocator3()
+{
+    // freed slots are reused first, and empty pages go back to other size classes
+    Pegasus::Memory::SlabAllocator slabAllocator(0);
+    Pegasus::Alloc::IAllocator* allocator = &slabAllocator;
+    void* a = allocator->Alloc(40, Pegasus::Alloc::PG_MEM_TEMP);
+    void* b = allocator->Alloc(40, Pegasus::Alloc::PG_MEM_TEMP);
+    allocator->Delete(a);
+    void* c = allocator->Alloc(33, Pegasus::Alloc::PG_MEM_TEMP);
+    bool reused = c == a;
+    allocator->Delete(b);
+    allocator->Delete(c);
+
+    // fill several pages of a size class, free them, and reuse them for another size class
+    const int count = 3 * (Pegasus::Memory::SlabAllocator::sPageSize / 512);
+    void* ptrs[count];
+    const size_t pageMask = ~static_cast<size_t>(Pegasus::Memory::SlabAllocator::sPageSize - 1);
+    for (int i = 0; i < count; ++i) ptrs[i] = allocator->Alloc(512, Pegasus::Alloc::PG_MEM_TEMP);
+    size_t firstPage = reinterpret_cast<size_t>(ptrs[0]) & pageMask;
+    size_t lastPage = reinterpret_cast<size_t>(ptrs[count - 1]) & pageMask;
+    for (int i = 0; i < count; ++i) allocator->Delete(ptrs[i]);
+
+    // the freed slots sit in the thread cache until they are trimmed back to their pages
+    slabAllocator.Trim();
+
+    bool pageReused = true;
+    for (int i = 0; i < count; ++i)
+    {
+        ptrs[i] = allocator->Alloc(64, Pegasus::Alloc::PG_MEM_TEMP);
+        size_t page = reinterpret_cast<size_t>(ptrs[i]) & pageMask;
+        pageReused = pageReused && page >= firstPage && page <= lastPage;
+    }
+    for (int i = 0; i < count; ++i) allocator->Delete(ptrs[i]);
+
+    return reused && pageReused;
+}
+
+//! parameters of the thread of the thread cache release test
+struct ReleaseThreadArgs
+{
+    Pegasus::Memory::SlabAllocator* mSlabAllocator;
+    void* mPtrs[4];
+};
+
+static void ReleaseThread(void* userData)
+{
+    ReleaseThreadArgs* args = static_cast<ReleaseThreadArgs*>(userData);
+    Pegasus::Alloc::IAllocator* allocator = args->mSlabAllocator;
+    for (int i = 0; i < 4; ++i) args->mPtrs[i] = allocator->Alloc(512, Pegasus::Alloc::PG_MEM_TEMP);
+    for (int i = 0; i < 4; ++i) allocator->Delete(args->mPtrs[i]);
+    args->mSlabAllocator->ReleaseThreadCache();
+}
+
+bool UNIT_TEST_SlabAllocatorReleaseThreadCache()
+{
+    // the slots freed by a thread that released its cache are allocated again by another thread
+    Pegasus::Memory::SlabAllocator slabAllocator(0);
+    Pegasus::Alloc::IAllocator* allocator = &slabAllocator;
+    ReleaseThreadArgs args;
+    args.mSlabAllocator = &slabAllocator;
+    Pegasus::Core::Thread thread;
+    thread.Start(ReleaseThread, &args);
+    thread.Join();
+
+    bool reused = true;
+    void* ptrs[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        ptrs[i] = allocator->Alloc(512, Pegasus::Alloc::PG_MEM_TEMP);
+        bool found = false;
+        for (int j = 0; j < 4; ++j) found = found || ptrs[i] == args.mPtrs[j];
+        reused = reused && found;
+    }
+    for (int i = 0; i < 4; ++i) allocator->Delete(ptrs[i]);
+
+    // a new thread takes the released cache over, and releases it again
+    thread.Start(ReleaseThread, &args);
+    thread.Join();
+
+    return reused;
+}
+
+bool UNIT_TEST_MemoryStats1()
+{
+#if PEGASUS_ENABLE_MEMORY_STATS
+    // allocator IDs unused by the memory manager, so the engine allocations do not interfere
+    const unsigned int mallocId = Pegasus::Memory::sMaxMemoryStatsIds - 1;
+    const unsigned int slabId = Pegasus::Memory::sMaxMemoryStatsIds - 2;
+    Pegasus::Memory::MallocFreeAllocator mallocAllocator(mallocId);
+    Pegasus::Memory::SlabAllocator slabAllocator(slabId);
+    Pegasus::Alloc::IAllocator* allocators[] = { &mallocAllocator, &slabAllocator };
+    const unsigned int ids[] = { mallocId, slabId };
+
+    bool success = true;
+    for (int a = 0; a < 2; ++a)
+    {
+        Pegasus::Memory::MemoryStats before, during, after;
+        Pegasus::Memory::ResetAllocatorFrameStats();
+        Pegasus::Memory::GetAllocatorStats(ids[a], before);
+
+        void* ptrs[3];
+        ptrs[0] = allocators[a]->Alloc(8, Pegasus::Alloc::PG_MEM_TEMP);
+        ptrs[1] = allocators[a]->Alloc(100, Pegasus::Alloc::PG_MEM_TEMP);
+        ptrs[2] = allocators[a]->AllocAlign(4000, 64, Pegasus::Alloc::PG_MEM_TEMP);
+        Pegasus::Memory::GetAllocatorStats(ids[a], during);
+        allocators[a]->Delete(ptrs[1]);
+        Pegasus::Memory::GetAllocatorStats(ids[a], after);
+
+        // the slabs round the sizes up to their size class
+        const long long liveBytes = during.mLiveBytes - before.mLiveBytes;
+        success = success && during.mLiveAllocations - before.mLiveAllocations == 3;
+        success = success && liveBytes >= 8 + 100 + 4000;
+        success = success && during.mFrameAllocations == 3 && during.mFrameFrees == 0;
+        success = success && after.mFrameAllocations == 3 && after.mFrameFrees == 1;
+        success = success && after.mLiveAllocations - before.mLiveAllocations == 2;
+        success = success && after.mPeakBytes >= during.mLiveBytes;
+        success = success && during.mHistogram[0] - before.mHistogram[0] == 1;
+        success = success && during.mHistogram[Pegasus::Memory::GetMemoryHistogramBucket(100)] - before.mHistogram[Pegasus::Memory::GetMemoryHistogramBucket(100)] == 1;
+
+        // the frame counters move to the last frame counters on reset
+        Pegasus::Memory::ResetAllocatorFrameStats();
+        Pegasus::Memory::GetAllocatorStats(ids[a], after);
+        success = success && after.mFrameAllocations == 0 && after.mFrameFrees == 0;
+        success = success && after.mLastFrameAllocations == 3 && after.mLastFrameFrees == 1;
+
+        allocators[a]->Delete(ptrs[0]);
+        allocators[a]->Delete(ptrs[2]);
+        Pegasus::Memory::GetAllocatorStats(ids[a], after);
+        success = success && after.mLiveBytes == before.mLiveBytes && after.mLiveAllocations == before.mLiveAllocations;
+    }
+
+    return success;
+#else
+    return true;
+#endif
+}
+
+bool UNIT_TEST_FrameAllocator1()
+{
+    // bump allocations are aligned and disjoint, and the memory comes back two frames later
+    Pegasus::Memory::FrameAllocator frameAllocator(0, 4096);
+    Pegasus::Alloc::IAllocator* allocator = &frameAllocator;
+    const size_t alignments[] = { 4, 16, 64, 256 };
+    unsigned char* ptrs[64];
+    bool success = true;
+    for (int i = 0; i < 64; ++i)
+    {
+        ptrs[i] = static_cast<unsigned char*>(allocator->AllocAlign(1 + i * 5, alignments[i % 4], Pegasus::Alloc::PG_MEM_TEMP));
+        success = success && ptrs[i] != nullptr && IsAligned(ptrs[i], alignments[i % 4]);
+        for (int b = 0; b < 1 + i * 5; ++b) ptrs[i][b] = static_cast<unsigned char>(i);
+    }
+    for (int i = 0; i < 64; ++i)
+    {
+        for (int b = 0; b < 1 + i * 5; ++b) success = success && ptrs[i][b] == static_cast<unsigned char>(i);
+        allocator->Delete(ptrs[i]);
+    }
+    success = success && frameAllocator.GetFrameAllocationCount() == 64;
+
+    // the allocations of the previous frame stay valid during the next frame
+    frameAllocator.Flip();
+    void* next = allocator->Alloc(16, Pegasus::Alloc::PG_MEM_TEMP);
+    success = success && frameAllocator.GetFrameAllocationCount() == 1;
+    success = success && ptrs[63][0] == 63;
+    allocator->Delete(ptrs[63]);
+    allocator->Delete(next);
+
+    // the first buffer overflowed its 4KB page, after the reset it has a single page big enough for the frame
+    frameAllocator.Flip();
+    success = success && frameAllocator.GetFrameAllocationCount() == 0 && frameAllocator.GetFrameBytes() == 0;
+    unsigned char* first = static_cast<unsigned char*>(allocator->Alloc(8, Pegasus::Alloc::PG_MEM_TEMP));
+    unsigned char* big = static_cast<unsigned char*>(allocator->Alloc(8000, Pegasus::Alloc::PG_MEM_TEMP));
+    success = success && big > first && big <= first + 64;
+    allocator->Delete(first);
+    allocator->Delete(big);
+
+    return success;
+}
+
+bool UNIT_TEST_FrameAllocator2()
+{
+#if PEGASUS_ENABLE_MEMORY_STATS
+    // the allocations are reported live until their buffer is reclaimed
+    const unsigned int frameId = Pegasus::Memory::sMaxMemoryStatsIds - 3;
+    Pegasus::Memory::FrameAllocator frameAllocator(frameId);
+    Pegasus::Alloc::IAllocator* allocator = &frameAllocator;
+    Pegasus::Memory::MemoryStats before, during, after;
+    Pegasus::Memory::GetAllocatorStats(frameId, before);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        allocator->Alloc(32, Pegasus::Alloc::PG_MEM_TEMP);
+    }
+    frameAllocator.Flip();
+    Pegasus::Memory::GetAllocatorStats(frameId, during);
+    frameAllocator.Flip();
+    Pegasus::Memory::GetAllocatorStats(frameId, after);
+
+    return during.mLiveAllocations - before.mLiveAllocations == 10 &&
+           during.mLiveBytes - before.mLiveBytes >= 10 * 32 &&
+           after.mLiveAllocations == before.mLiveAllocations &&
+           after.mLiveBytes == before.mLiveBytes;
+#else
+    return true;
+#endif
+}
+
+bool UNIT_TEST_BlockAllocator1()
+{
+    Pegasus::Memory::MallocFreeAllocator mallocAllocator(0);
+    Pegasus::Memory::BlockAllocator blockAllocator;
+    blockAllocator.Initialize(1024, &mallocAllocator);
+    blockAllocator.SetRetainedBudget(4 * 1024);
+    bool success = true;
+
+    // consecutive allocations are packed, and the last one can be given back
+    char* a = static_cast<char*>(blockAllocator.Alloc(100, Pegasus::Alloc::PG_MEM_TEMP));
+    char* b = static_cast<char*>(blockAllocator.Alloc(100, Pegasus::Alloc::PG_MEM_TEMP));
+    success = success && b == a + 100;
+    blockAllocator.Delete(b);
+    success = success && blockAllocator.GetMemorySize() == 100;
+    success = success && blockAllocator.Alloc(100, Pegasus::Alloc::PG_MEM_TEMP) == b;
+    char* c = static_cast<char*>(blockAllocator.AllocAlign(8, 64, Pegasus::Alloc::PG_MEM_TEMP));
+    success = success && IsAligned(c, 64);
+
+    // allocations bigger than a page go to the underlying allocator
+    char* big = static_cast<char*>(blockAllocator.AllocAlign(5000, 32, Pegasus::Alloc::PG_MEM_TEMP));
+    char* big2 = static_cast<char*>(blockAllocator.Alloc(3000, Pegasus::Alloc::PG_MEM_TEMP));
+    success = success && big != nullptr && IsAligned(big, 32) && big2 != nullptr;
+    for (int i = 0; i < 5000; ++i) big[i] = static_cast<char>(i);
+    for (int i = 0; i < 3000; ++i) big2[i] = static_cast<char>(i);
+    blockAllocator.Delete(big);
+
+    // pages are reused after a reset, and only the budget is kept
+    for (int i = 0; i < 16; ++i)
+    {
+        success = success && blockAllocator.Alloc(1000, Pegasus::Alloc::PG_MEM_TEMP) != nullptr;
+    }
+    success = success && blockAllocator.GetPageCount() == 17;
+    blockAllocator.Reset();
+    success = success && blockAllocator.GetPageCount() == 4 && blockAllocator.GetMemorySize() == 0;
+    success = success && blockAllocator.Alloc(100, Pegasus::Alloc::PG_MEM_TEMP) == a;
+
+    blockAllocator.FreeMemory();
+    success = success && blockAllocator.GetPageCount() == 0;
+    return success;
+}
+
+//! allocates like the compilations of a script, mostly small nodes and a few big tables, releasing everything after each one
+static double Recompile(Pegasus::Alloc::IAllocator* allocator, Pegasus::Memory::BlockAllocator* blockAllocator, int compilations)
+{
+    const int nodeCount = 20000;
+    static void* sNodes[nodeCount];
+    Pegasus::Core::UpdatePegasusTime();
+    double begin = Pegasus::Core::GetPegasusTime();
+    for (int c = 0; c < compilations; ++c)
+    {
+        // the same script is compiled every time
+        unsigned int seed = 12345;
+        for (int i = 0; i < nodeCount; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            size_t size = (i % 1000) == 999 ? 8192 : 16 + (seed >> 20) % 48;
+            sNodes[i] = allocator->AllocAlign(size, 8, Pegasus::Alloc::PG_MEM_TEMP);
+            *static_cast<char*>(sNodes[i]) = 0;
+        }
+
+        if (blockAllocator != nullptr)
+        {
+            blockAllocator->Reset();
+        }
+        else
+        {
+            for (int i = 0; i < nodeCount; ++i) allocator->Delete(sNodes[i]);
+        }
+    }
+    Pegasus::Core::UpdatePegasusTime();
+    return Pegasus::Core::GetPegasusTime() - begin;
+}
+
+bool UNIT_TEST_BlockAllocatorRecompile()
+{
+    const int compilations = 200;
+    Pegasus::Core::InitializePegasusTime();
+    Pegasus::Memory::MallocFreeAllocator mallocAllocator(0);
+    Pegasus::Memory::BlockAllocator blockAllocator;
+    blockAllocator.Initialize(4096, &mallocAllocator);
+
+    double mallocTime = Recompile(&mallocAllocator, nullptr, compilations);
+    Recompile(&blockAllocator, &blockAllocator, 1);
+    int pageCount = blockAllocator.GetPageCount();
+    double blockTime = Recompile(&blockAllocator, &blockAllocator, compilations);
+    printf("%d compile / reset cycles: malloc %f ms, block %f ms\n", compilations, mallocTime * 1000.0, blockTime * 1000.0);
+
+    // the pages of the first compilation are recycled by the next ones
+    bool success = pageCount > 0 && blockAllocator.GetPageCount() == pageCount;
+
+    // timings are informative only
+    return success;
+}
+
+//! finds the counters of a call site
+static bool FindAllocationSite(const char* file, unsigned int line, Pegasus::Memory::AllocationSiteOrder order, Pegasus::Memory::AllocationSite& site)
+{
+    static Pegasus::Memory::AllocationSite sSites[Pegasus::Memory::sMaxAllocationSites];
+    unsigned int count = Pegasus::Memory::GetAllocationSites(sSites, Pegasus::Memory::sMaxAllocationSites, order);
+    for (unsigned int s = 0; s < count; ++s)
+    {
+        if (sSites[s].mFile == file && sSites[s].mLine == line)
+        {
+            site = sSites[s];
+            return true;
+        }
+    }
+    return false;
+}
+
+bool UNIT_TEST_TrackingAllocator1()
+{
+    Pegasus::Memory::MallocFreeAllocator mallocAllocator(0);
+    Pegasus::Memory::TrackingAllocator trackingAllocator(&mallocAllocator);
+    Pegasus::Alloc::IAllocator* allocator = &trackingAllocator;
+    const char* file = __FILE__;
+    const unsigned int leakLine = __LINE__;
+    const unsigned int churnLine = leakLine + 1;
+    bool success = true;
+
+    // a deliberate leak, next to allocations that are all deleted
+    void* leaks[10];
+    for (int i = 0; i < 10; ++i)
+    {
+        leaks[i] = allocator->AllocAlign(100, 64, Pegasus::Alloc::PG_MEM_TEMP, -1, "Leak", file, leakLine);
+        success = success && IsAligned(leaks[i], 64);
+    }
+    Pegasus::Memory::ResetAllocationSiteFrame();
+    for (int i = 0; i < 50; ++i)
+    {
+        allocator->Delete(allocator->Alloc(32, Pegasus::Alloc::PG_MEM_TEMP, -1, "Churn", file, churnLine));
+    }
+    Pegasus::Memory::ResetAllocationSiteFrame();
+
+    // the leak shows up with its live bytes, the churn site with its allocations of the frame
+    Pegasus::Memory::AllocationSite site;
+    success = success && FindAllocationSite(file, leakLine, Pegasus::Memory::ALLOCATION_SITE_ORDER_LIVE_BYTES, site);
+    success = success && site.mLiveBytes == 1000 && site.mLiveAllocations == 10;
+    success = success && !FindAllocationSite(file, churnLine, Pegasus::Memory::ALLOCATION_SITE_ORDER_LIVE_BYTES, site);
+    success = success && FindAllocationSite(file, churnLine, Pegasus::Memory::ALLOCATION_SITE_ORDER_LAST_FRAME, site);
+    success = success && site.mLastFrameAllocations == 50 && site.mLiveAllocations == 0;
+
+    // the sites are sorted
+    Pegasus::Memory::AllocationSite sites[4];
+    unsigned int count = Pegasus::Memory::GetAllocationSites(sites, 4, Pegasus::Memory::ALLOCATION_SITE_ORDER_LAST_FRAME);
+    for (unsigned int s = 1; s < count; ++s)
+    {
+        success = success && sites[s - 1].mLastFrameAllocations >= sites[s].mLastFrameAllocations;
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        allocator->Delete(leaks[i]);
+    }
+    success = success && !FindAllocationSite(file, leakLine, Pegasus::Memory::ALLOCATION_SITE_ORDER_LIVE_BYTES, site);
+    return success;
+}
+
+//! cache of the budget stress test, evicting its oldest half when asked
+struct BudgetCache
+{
+    static const int sMaxEntries = 4096;
+    void* mEntries[sMaxEntries];
+    int mBegin;
+    int mEnd;
+    int mSoftEvents;
+    int mHardEvents;
+
+    void Evict()
+    {
+        int count = (mEnd - mBegin + 1) / 2;
+        for (int i = 0; i < count; ++i)
+        {
+            Pegasus::Memory::GetNodeDataAllocator()->Delete(mEntries[mBegin++ % sMaxEntries]);
+        }
+    }
+};
+
+static void BudgetCallback(Pegasus::Memory::BudgetEvent event, size_t /*liveBytes*/, size_t /*requestedBytes*/, void* userData)
+{
+    BudgetCache* cache = static_cast<BudgetCache*>(userData);
+    if (event == Pegasus::Memory::BUDGET_EVENT_SOFT_LIMIT)
+    {
+        ++cache->mSoftEvents;
+    }
+    else
+    {
+        ++cache->mHardEvents;
+    }
+    cache->Evict();
+}
+
+bool UNIT_TEST_MemoryBudget1()
+{
+    // fills the node data category to 8 times its budget, the callback keeps it under the hard limit
+    const size_t softLimit = 512 * 1024;
+    const size_t hardLimit = 1024 * 1024;
+    const size_t entrySize = 4096;
+    static BudgetCache sCache;
+    sCache.mBegin = sCache.mEnd = 0;
+    sCache.mSoftEvents = sCache.mHardEvents = 0;
+
+    const size_t baseBytes = Pegasus::Memory::GetMemoryBudgetUsage(Pegasus::Memory::MEMORY_NODE_DATA);
+    Pegasus::Memory::SetMemoryBudget(Pegasus::Memory::MEMORY_NODE_DATA, baseBytes + softLimit, baseBytes + hardLimit, Pegasus::Memory::BUDGET_POLICY_FAIL);
+    Pegasus::Memory::SetMemoryBudgetCallback(Pegasus::Memory::MEMORY_NODE_DATA, BudgetCallback, &sCache);
+
+    bool success = true;
+    size_t peakBytes = 0;
+    for (int i = 0; i < 8 * static_cast<int>(hardLimit / entrySize); ++i)
+    {
+        void* entry = Pegasus::Memory::GetNodeDataAllocator()->Alloc(entrySize, Pegasus::Alloc::PG_MEM_TEMP);
+        success = success && entry != nullptr;
+        sCache.mEntries[sCache.mEnd++ % BudgetCache::sMaxEntries] = entry;
+        size_t liveBytes = Pegasus::Memory::GetMemoryBudgetUsage(Pegasus::Memory::MEMORY_NODE_DATA);
+        peakBytes = liveBytes > peakBytes ? liveBytes : peakBytes;
+    }
+    success = success && sCache.mSoftEvents > 0 && peakBytes <= baseBytes + hardLimit;
+
+    // without a callback to evict, the hard limit refuses the allocation
+    Pegasus::Memory::SetMemoryBudgetCallback(Pegasus::Memory::MEMORY_NODE_DATA, nullptr, nullptr);
+    while (Pegasus::Memory::GetMemoryBudgetUsage(Pegasus::Memory::MEMORY_NODE_DATA) + entrySize <= baseBytes + hardLimit)
+    {
+        sCache.mEntries[sCache.mEnd++ % BudgetCache::sMaxEntries] = Pegasus::Memory::GetNodeDataAllocator()->Alloc(entrySize, Pegasus::Alloc::PG_MEM_TEMP);
+    }
+    success = success && Pegasus::Memory::GetNodeDataAllocator()->Alloc(entrySize, Pegasus::Alloc::PG_MEM_TEMP) == nullptr;
+
+    while (sCache.mBegin != sCache.mEnd)
+    {
+        Pegasus::Memory::GetNodeDataAllocator()->Delete(sCache.mEntries[sCache.mBegin++ % BudgetCache::sMaxEntries]);
+    }
+    Pegasus::Memory::SetMemoryBudget(Pegasus::Memory::MEMORY_NODE_DATA, 0, 0);
+    success = success && Pegasus::Memory::GetMemoryBudgetUsage(Pegasus::Memory::MEMORY_NODE_DATA) == baseBytes;
+    return success;
+}
+
+bool UNIT_TEST_LargeBlockAllocator1()
+{
+    Pegasus::Memory::SlabAllocator slabAllocator(1);
+    Pegasus::Memory::LargeBlockAllocator largeAllocator(1, &slabAllocator);
+    Pegasus::Alloc::IAllocator* allocator = &largeAllocator;
+    const size_t headerSize = Pegasus::Memory::LargeBlockAllocator::sBlockAlignment;
+    bool success = true;
+
+    // small allocations go to the small allocator
+    void* small = allocator->Alloc(100, Pegasus::Alloc::PG_MEM_TEMP);
+    success = success && small != nullptr && largeAllocator.GetChunkCount() == 0;
+    allocator->Delete(small);
+
+    // large blocks are aligned and packed in a chunk
+    char* a = static_cast<char*>(allocator->Alloc(100 * 1024, Pegasus::Alloc::PG_MEM_TEMP));
+    char* b = static_cast<char*>(allocator->AllocAlign(200 * 1024, 64, Pegasus::Alloc::PG_MEM_TEMP));
+    success = success && IsAligned(a, 64) && IsAligned(b, 64) && b == a + 100 * 1024 + headerSize;
+    success = success && largeAllocator.GetChunkCount() == 1;
+    Pegasus::Utils::Memset8(a, 0xaa, 100 * 1024);
+    Pegasus::Utils::Memset8(b, 0xbb, 200 * 1024);
+
+    // freed blocks are reused, and coalesce back into the whole chunk
+    allocator->Delete(a);
+    char* c = static_cast<char*>(allocator->Alloc(80 * 1024, Pegasus::Alloc::PG_MEM_TEMP));
+    success = success && c == a;
+    allocator->Delete(c);
+    allocator->Delete(b);
+    success = success && allocator->Alloc(1024 * 1024, Pegasus::Alloc::PG_MEM_TEMP) == a;
+    allocator->Delete(a);
+
+    // allocations larger than a chunk are mapped on their own
+    const size_t bigSize = 5 * 1024 * 1024;
+    char* big = static_cast<char*>(allocator->Alloc(bigSize, Pegasus::Alloc::PG_MEM_TEMP));
+    success = success && big != nullptr && IsAligned(big, 64) && largeAllocator.GetChunkCount() == 2;
+    Pegasus::Utils::Memset8(big, 0xcc, bigSize);
+    allocator->Delete(big);
+    success = success && largeAllocator.GetChunkCount() == 1;
+
+    // only a few empty chunks are kept mapped
+    const int blockCount = 8;
+    void* blocks[blockCount];
+    for (int i = 0; i < blockCount; ++i)
+    {
+        blocks[i] = allocator->Alloc(1024 * 1024, Pegasus::Alloc::PG_MEM_TEMP);
+        success = success && blocks[i] != nullptr;
+    }
+    success = success && largeAllocator.GetChunkCount() == blockCount;
+    for (int i = 0; i < blockCount; ++i)
+    {
+        allocator->Delete(blocks[i]);
+    }
+    success = success && largeAllocator.GetChunkCount() == Pegasus::Memory::LargeBlockAllocator::sMaxRetainedChunks;
+
+    largeAllocator.Trim();
+    success = success && largeAllocator.GetChunkCount() == 0 && largeAllocator.GetMappedBytes() == 0;
+    return success;
+}
@@ -0,0 +1,688 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   UtilsBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Microbenchmarks of the Utils package: memory and string routines, vector growth,
+//!         byte streams, the edge caches, the icosphere subdivision and the name lookups
+
+#include "Pegasus/UnitTests/Benchmark.h"
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/CpuFeatures.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/TesselationTable.h"
+#include "Pegasus/Utils/EdgeTable.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/InternedString.h"
+#include "Pegasus/Core/Thread.h"
+
+static Pegasus::Memory::MallocFreeAllocator sBenchmarkAllocator(0);
+
+//! keeps the results of the workloads alive, so the compiler cannot remove them
+static volatile unsigned int sBenchmarkSink = 0;
+
+//! sizes of the memory and string benchmarks
+static const unsigned int sMemorySizes[] = { 16, 64, 256, 4 * 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024 };
+static const unsigned int sStringSizes[] = { 16, 256, 4 * 1024 };
+
+//! number of vertices of the strips of the edge benchmarks
+static const int sStripVertexCount = 4096;
+
+//! number of names of the largest lookup benchmark
+static const int sMaxLookupCount = 10000;
+
+//! buffers of a memory or string benchmark
+struct BufferData
+{
+    char* mSrc;
+    char* mDst;
+    unsigned int mSize;
+};
+
+//! \return the iterations processing about 64 MB, at least 1
+static int GetIterations(unsigned int size)
+{
+    const unsigned int iterations = (64 * 1024 * 1024) / size;
+    return iterations < 1 ? 1 : (iterations > 100000 ? 100000 : static_cast<int>(iterations));
+}
+
+//! builds a name made of a category and a size
+static const char* MakeName(char* name, const char* category, unsigned int size)
+{
+    name[0] = '\0';
+    Pegasus::Utils::Strcat(name, category);
+    Pegasus::Utils::Strcat(name, "/");
+    Pegasus::Utils::Strcat(name, static_cast<int>(size));
+    return name;
+}
+
+//----------------------------------------------------------------------------------------
+
+static void BenchMemcpy(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        Pegasus::Utils::Memcpy(data->mDst, data->mSrc, data->mSize);
+    }
+    sBenchmarkSink += static_cast<unsigned char>(data->mDst[data->mSize - 1]);
+}
+
+//! destination moving between the 8 first bytes of the buffer, mostly misaligned
+static void BenchMemcpyMisaligned(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        Pegasus::Utils::Memcpy(data->mDst + (i & 7), data->mSrc, data->mSize);
+    }
+    sBenchmarkSink += static_cast<unsigned char>(data->mDst[data->mSize - 1]);
+}
+
+static void BenchMemset(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        Pegasus::Utils::Memset8(data->mDst, static_cast<char>(i), data->mSize);
+    }
+    sBenchmarkSink += static_cast<unsigned char>(data->mDst[data->mSize - 1]);
+}
+
+static void BenchStrlen(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    unsigned int total = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        total += Pegasus::Utils::Strlen(data->mSrc);
+    }
+    sBenchmarkSink += total;
+}
+
+static void BenchStrcmp(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    int total = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        total += Pegasus::Utils::Strcmp(data->mSrc, data->mDst);
+    }
+    sBenchmarkSink += static_cast<unsigned int>(total);
+}
+
+static void BenchStricmp(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    int total = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        total += Pegasus::Utils::Stricmp(data->mSrc, data->mDst);
+    }
+    sBenchmarkSink += static_cast<unsigned int>(total);
+}
+
+static void BenchStrchr(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    unsigned int total = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        total += Pegasus::Utils::Strchr(data->mSrc, '!') == nullptr ? 0 : 1;
+    }
+    sBenchmarkSink += total;
+}
+
+static void BenchHashStr(void* userData, int iterations)
+{
+    BufferData* data = static_cast<BufferData*>(userData);
+    unsigned int total = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        total += Pegasus::Utils::HashStr(data->mSrc);
+    }
+    sBenchmarkSink += total;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! parameters of the vector benchmarks
+struct VectorData
+{
+    int mCount;
+    bool mReserve;
+};
+
+static void BenchVectorPush(void* userData, int iterations)
+{
+    const VectorData* data = static_cast<const VectorData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        Pegasus::Utils::Vector<int> v(&sBenchmarkAllocator);
+        if (data->mReserve)
+        {
+            v.Reserve(data->mCount);
+        }
+        for (int e = 0; e < data->mCount; ++e)
+        {
+            v.PushEmpty() = e;
+        }
+        sBenchmarkSink += v[v.GetSize() - 1];
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! sink dropping the bytes, the cost of the stream without the cost of a file
+class DiscardSink : public Pegasus::Utils::IByteStreamSink
+{
+public:
+    virtual bool Write(const void* buffer, int size)
+    {
+        sBenchmarkSink += static_cast<const unsigned char*>(buffer)[size - 1];
+        return true;
+    }
+};
+
+//! parameters of the byte stream benchmarks
+struct ByteStreamData
+{
+    const char* mRecord;
+    int mRecordSize;
+    int mTotalSize;
+    bool mJoin;
+    Pegasus::Utils::IByteStreamSink* mSink;
+};
+
+static void BenchByteStream(void* userData, int iterations)
+{
+    const ByteStreamData* data = static_cast<const ByteStreamData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        Pegasus::Utils::ByteStream stream(&sBenchmarkAllocator);
+        if (data->mSink != nullptr)
+        {
+            stream.SetSink(data->mSink);
+        }
+        for (int written = 0; written < data->mTotalSize; written += data->mRecordSize)
+        {
+            stream.Append(data->mRecord, data->mRecordSize);
+        }
+        if (data->mJoin)
+        {
+            sBenchmarkSink += static_cast<unsigned char>(static_cast<char*>(stream.GetBuffer())[data->mTotalSize - 1]);
+        }
+        if (data->mSink != nullptr)
+        {
+            stream.Flush();
+        }
+        sBenchmarkSink += static_cast<unsigned int>(stream.GetSize());
+    }
+}
+
+//! a single buffer doubling on growth, as the byte stream used to be
+static void BenchContiguousBuffer(void* userData, int iterations)
+{
+    const ByteStreamData* data = static_cast<const ByteStreamData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        char* buffer = nullptr;
+        int size = 0;
+        int capacity = 0;
+        for (; size < data->mTotalSize; size += data->mRecordSize)
+        {
+            if (size + data->mRecordSize > capacity)
+            {
+                capacity = 2 * (size + data->mRecordSize);
+                char* newBuffer = PG_NEW_ARRAY(&sBenchmarkAllocator, -1, "Benchmark", Pegasus::Alloc::PG_MEM_TEMP, char, capacity);
+                if (buffer != nullptr)
+                {
+                    Pegasus::Utils::Memcpy(newBuffer, buffer, size);
+                    PG_DELETE_ARRAY(&sBenchmarkAllocator, buffer);
+                }
+                buffer = newBuffer;
+            }
+            Pegasus::Utils::Memcpy(buffer + size, data->mRecord, data->mRecordSize);
+        }
+        sBenchmarkSink += static_cast<unsigned char>(buffer[size - 1]);
+        PG_DELETE_ARRAY(&sBenchmarkAllocator, buffer);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! edges of a strip of triangles, the edges of the midpoint caches of a tesselation
+static void BenchTesselationTable(void* userData, int iterations)
+{
+    Pegasus::Utils::TesselationTable* table = static_cast<Pegasus::Utils::TesselationTable*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int v = 1; v < sStripVertexCount; ++v)
+        {
+            table->Insert(v, v - 1, v);
+            if (v > 1)
+            {
+                table->Insert(v, v - 2, v);
+            }
+        }
+        int total = 0;
+        for (int v = 2; v < sStripVertexCount; ++v)
+        {
+            int value = 0;
+            table->Get(v - 2, v, value);
+            total += value;
+        }
+        sBenchmarkSink += static_cast<unsigned int>(total);
+        table->Clear();
+    }
+}
+
+static void BenchEdgeTable(void* userData, int iterations)
+{
+    Pegasus::Utils::EdgeTable* table = static_cast<Pegasus::Utils::EdgeTable*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        table->Reset(2 * sStripVertexCount);
+        for (unsigned int v = 1; v < sStripVertexCount; ++v)
+        {
+            table->Insert(v, v - 1, v);
+            if (v > 1)
+            {
+                table->Insert(v, v - 2, v);
+            }
+        }
+        unsigned int total = 0;
+        for (unsigned int v = 2; v < sStripVertexCount; ++v)
+        {
+            unsigned int value = 0;
+            table->Get(v - 2, v, value);
+            total += value;
+        }
+        sBenchmarkSink += total;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! icosahedron triangles, the base of the icosphere subdivision
+static const unsigned int sIcosahedronTriangles[] = {
+    1,  6,  3,  1,  3,  7,  1, 10,  6,  1,  7,  8,  1,  8, 10,
+    3,  6, 11,  3,  9,  7,  3, 11,  9,  0,  2,  4,  0,  5,  2,
+    0, 10,  8,  0,  4, 10,  0,  8,  5,  2, 11,  4,  2,  5,  9,
+    2,  9, 11, 10,  4,  6,  4, 11,  6,  8,  7,  5,  7,  9,  5
+};
+
+//! midpoint cache of the tesselation table, storing the index + 1 since the missing elements read as 0
+struct TesselationTableCache
+{
+    TesselationTableCache() : mTable(&sBenchmarkAllocator, sizeof(int)) {}
+
+    unsigned int GetChild(std::atomic<unsigned int>& vertexCount, unsigned int a, unsigned int b)
+    {
+        int r = 0;
+        mTable.Get(a, b, r);
+        if (r == 0)
+        {
+            r = static_cast<int>(vertexCount.fetch_add(1, std::memory_order_relaxed)) + 1;
+            mTable.Insert(a, b, r);
+        }
+        return static_cast<unsigned int>(r - 1);
+    }
+
+    Pegasus::Utils::TesselationTable mTable;
+};
+
+//! midpoint cache of the edge table, single threaded
+struct EdgeTableCache
+{
+    unsigned int GetChild(std::atomic<unsigned int>& vertexCount, unsigned int a, unsigned int b)
+    {
+        unsigned int r = 0;
+        if (!mTable->Get(a, b, r))
+        {
+            r = vertexCount.fetch_add(1, std::memory_order_relaxed);
+            mTable->Insert(a, b, r);
+        }
+        return r;
+    }
+
+    Pegasus::Utils::EdgeTable* mTable;
+};
+
+//! midpoint cache of the edge table, shared by several threads
+struct ConcurrentEdgeTableCache
+{
+    unsigned int GetChild(std::atomic<unsigned int>& vertexCount, unsigned int a, unsigned int b)
+    {
+        unsigned int r = 0;
+        if (!mTable->Get(a, b, r))
+        {
+            // the index of a losing thread is wasted, like a vertex pushed twice
+            mTable->InsertOrGet(a, b, vertexCount.fetch_add(1, std::memory_order_relaxed), r);
+        }
+        return r;
+    }
+
+    Pegasus::Utils::EdgeTable* mTable;
+};
+
+//! subdivides a triangle like the icosphere generator does, without computing the vertices
+template<class Cache>
+static void SubdivideTriangle(Cache& cache, std::atomic<unsigned int>& vertexCount, int level, unsigned int a, unsigned int b, unsigned int c)
+{
+    if (level > 1)
+    {
+        const unsigned int c1 = cache.GetChild(vertexCount, a, b);
+        const unsigned int c2 = cache.GetChild(vertexCount, b, c);
+        const unsigned int c3 = cache.GetChild(vertexCount, c, a);
+        SubdivideTriangle(cache, vertexCount, level - 1, a, c1, c3);
+        SubdivideTriangle(cache, vertexCount, level - 1, c1, b, c2);
+        SubdivideTriangle(cache, vertexCount, level - 1, c2, c, c3);
+        SubdivideTriangle(cache, vertexCount, level - 1, c1, c2, c3);
+    }
+}
+
+//! subdivides the icosahedron triangles of a thread
+template<class Cache>
+static void SubdivideIcosahedron(Cache* cache, std::atomic<unsigned int>* vertexCount, int degree, int firstTriangle, int triangleStep)
+{
+    for (int t = firstTriangle; t < 20; t += triangleStep)
+    {
+        SubdivideTriangle(*cache, *vertexCount, degree, sIcosahedronTriangles[3 * t + 2], sIcosahedronTriangles[3 * t + 1], sIcosahedronTriangles[3 * t]);
+    }
+}
+
+//! parameters of a thread subdividing the icosahedron with the concurrent cache
+struct SubdivisionThreadArgs
+{
+    ConcurrentEdgeTableCache* mCache;
+    std::atomic<unsigned int>* mVertexCount;
+    int mDegree;
+    int mFirstTriangle;
+};
+
+static void SubdivisionThread(void* userData)
+{
+    const SubdivisionThreadArgs* args = static_cast<const SubdivisionThreadArgs*>(userData);
+    SubdivideIcosahedron(args->mCache, args->mVertexCount, args->mDegree, args->mFirstTriangle, 4);
+}
+
+//! parameters of the icosphere benchmarks
+struct IcosphereData
+{
+    int mDegree;
+    unsigned int mVertexCount;
+    Pegasus::Utils::EdgeTable* mTable;
+};
+
+static void BenchIcosphereTesselationTable(void* userData, int iterations)
+{
+    const IcosphereData* data = static_cast<const IcosphereData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        TesselationTableCache cache;
+        std::atomic<unsigned int> vertexCount(12);
+        SubdivideIcosahedron(&cache, &vertexCount, data->mDegree, 0, 1);
+        sBenchmarkSink += vertexCount.load();
+    }
+}
+
+static void BenchIcosphereEdgeTable(void* userData, int iterations)
+{
+    const IcosphereData* data = static_cast<const IcosphereData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        EdgeTableCache cache;
+        cache.mTable = data->mTable;
+        std::atomic<unsigned int> vertexCount(12);
+        data->mTable->Reset(data->mVertexCount - 12);
+        SubdivideIcosahedron(&cache, &vertexCount, data->mDegree, 0, 1);
+        sBenchmarkSink += vertexCount.load();
+    }
+}
+
+//! the triangles shared by 4 threads, the thread startup included
+static void BenchIcosphereEdgeTableThreads(void* userData, int iterations)
+{
+    const IcosphereData* data = static_cast<const IcosphereData*>(userData);
+    for (int i = 0; i < iterations; ++i)
+    {
+        ConcurrentEdgeTableCache cache;
+        cache.mTable = data->mTable;
+        std::atomic<unsigned int> vertexCount(12);
+        data->mTable->Reset(data->mVertexCount - 12);
+        Pegasus::Core::Thread threads[4];
+        SubdivisionThreadArgs args[4];
+        for (int t = 0; t < 4; ++t)
+        {
+            args[t].mCache = &cache;
+            args[t].mVertexCount = &vertexCount;
+            args[t].mDegree = data->mDegree;
+            args[t].mFirstTriangle = t;
+            threads[t].Start(SubdivisionThread, &args[t]);
+        }
+        for (int t = 0; t < 4; ++t) threads[t].Join();
+        sBenchmarkSink += data->mTable->GetSize();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! parameters of the name lookup benchmarks, the keys looked up in turn
+struct LookupData
+{
+    const char* const* mNames;
+    int mCount;
+    Pegasus::Utils::HashMap<const char*, int, Pegasus::Utils::StringHashTraits>* mStringMap;
+    Pegasus::Utils::HashMap<Pegasus::Utils::InternedString, int>* mInternedMap;
+    const Pegasus::Utils::InternedString* mKeys;
+};
+
+//! linear scan of the names with Strcmp, the keys taken with a prime stride so a few iterations spread over all the names
+static void BenchLinearLookup(void* userData, int iterations)
+{
+    const LookupData* data = static_cast<const LookupData*>(userData);
+    unsigned int checksum = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        const char* key = data->mNames[(static_cast<unsigned int>(i) * 7919u) % data->mCount];
+        for (int n = 0; n < data->mCount; ++n)
+        {
+            if (Pegasus::Utils::Strcmp(data->mNames[n], key) == 0)
+            {
+                checksum += n;
+                break;
+            }
+        }
+    }
+    sBenchmarkSink += checksum;
+}
+
+static void BenchStringMapLookup(void* userData, int iterations)
+{
+    const LookupData* data = static_cast<const LookupData*>(userData);
+    unsigned int checksum = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        checksum += *data->mStringMap->Find(data->mNames[i % data->mCount]);
+    }
+    sBenchmarkSink += checksum;
+}
+
+static void BenchInternedMapLookup(void* userData, int iterations)
+{
+    const LookupData* data = static_cast<const LookupData*>(userData);
+    unsigned int checksum = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        checksum += *data->mInternedMap->Find(data->mKeys[i % data->mCount]);
+    }
+    sBenchmarkSink += checksum;
+}
+
+//----------------------------------------------------------------------------------------
+
+void RunUtilsBenchmarks(BenchmarkRunner& runner)
+{
+    char name[64];
+    const unsigned int maxSize = sMemorySizes[sizeof(sMemorySizes) / sizeof(sMemorySizes[0]) - 1];
+    BufferData buffers;
+    buffers.mSrc = static_cast<char*>(sBenchmarkAllocator.AllocAlign(maxSize + 1, 64, Pegasus::Alloc::PG_MEM_TEMP, -1, "Benchmark", __FILE__, __LINE__));
+    buffers.mDst = static_cast<char*>(sBenchmarkAllocator.AllocAlign(maxSize + 8, 64, Pegasus::Alloc::PG_MEM_TEMP, -1, "Benchmark", __FILE__, __LINE__));
+    for (unsigned int i = 0; i < maxSize; ++i)
+    {
+        buffers.mSrc[i] = static_cast<char>('a' + i % 26);
+    }
+
+    for (unsigned int s = 0; s < sizeof(sMemorySizes) / sizeof(sMemorySizes[0]); ++s)
+    {
+        buffers.mSize = sMemorySizes[s];
+        runner.Run(MakeName(name, "Memcpy", buffers.mSize), BenchMemcpy, &buffers, GetIterations(buffers.mSize), buffers.mSize);
+    }
+    for (unsigned int s = 0; s < sizeof(sMemorySizes) / sizeof(sMemorySizes[0]); ++s)
+    {
+        buffers.mSize = sMemorySizes[s];
+        runner.Run(MakeName(name, "MemcpyMisaligned", buffers.mSize), BenchMemcpyMisaligned, &buffers, GetIterations(buffers.mSize), buffers.mSize);
+    }
+
+    // The paths below the best one, forced with the CPU feature mask
+    const unsigned int cpuFeatureMasks[] = { 0, Pegasus::Utils::CPU_FEATURE_SSE2 };
+    const char* cpuFeatureNames[] = { "MemcpyGeneric", "MemcpySse2" };
+    for (int m = 0; m < 2; ++m)
+    {
+        Pegasus::Utils::SetCpuFeatureMask(cpuFeatureMasks[m]);
+        for (unsigned int s = 0; s < sizeof(sMemorySizes) / sizeof(sMemorySizes[0]); ++s)
+        {
+            buffers.mSize = sMemorySizes[s];
+            runner.Run(MakeName(name, cpuFeatureNames[m], buffers.mSize), BenchMemcpy, &buffers, GetIterations(buffers.mSize), buffers.mSize);
+        }
+    }
+    Pegasus::Utils::SetCpuFeatureMask(~0u);
+    for (unsigned int s = 0; s < sizeof(sMemorySizes) / sizeof(sMemorySizes[0]); ++s)
+    {
+        buffers.mSize = sMemorySizes[s];
+        runner.Run(MakeName(name, "Memset", buffers.mSize), BenchMemset, &buffers, GetIterations(buffers.mSize), buffers.mSize);
+    }
+
+    // Strings of the same characters, the comparisons scan them entirely
+    for (unsigned int s = 0; s < sizeof(sStringSizes) / sizeof(sStringSizes[0]); ++s)
+    {
+        buffers.mSize = sStringSizes[s];
+        Pegasus::Utils::Memcpy(buffers.mDst, buffers.mSrc, buffers.mSize);
+        buffers.mSrc[buffers.mSize - 1] = '\0';
+        buffers.mDst[buffers.mSize - 1] = '\0';
+        const int iterations = GetIterations(buffers.mSize) / 16 + 1;
+        runner.Run(MakeName(name, "Strlen", buffers.mSize), BenchStrlen, &buffers, iterations, buffers.mSize);
+        runner.Run(MakeName(name, "Strcmp", buffers.mSize), BenchStrcmp, &buffers, iterations, buffers.mSize);
+        runner.Run(MakeName(name, "Stricmp", buffers.mSize), BenchStricmp, &buffers, iterations, buffers.mSize);
+        runner.Run(MakeName(name, "Strchr", buffers.mSize), BenchStrchr, &buffers, iterations, buffers.mSize);
+        runner.Run(MakeName(name, "HashStr", buffers.mSize), BenchHashStr, &buffers, iterations, buffers.mSize);
+        buffers.mSrc[buffers.mSize - 1] = static_cast<char>('a' + (buffers.mSize - 1) % 26);
+    }
+
+    VectorData vectorData;
+    const int vectorCounts[] = { 1024, 1024 * 1024 };
+    for (int c = 0; c < 2; ++c)
+    {
+        vectorData.mCount = vectorCounts[c];
+        const int iterations = vectorData.mCount > 1024 ? 4 : 1000;
+        vectorData.mReserve = false;
+        runner.Run(MakeName(name, "VectorPush", vectorData.mCount), BenchVectorPush, &vectorData, iterations, vectorData.mCount * sizeof(int));
+        vectorData.mReserve = true;
+        runner.Run(MakeName(name, "VectorPushReserved", vectorData.mCount), BenchVectorPush, &vectorData, iterations, vectorData.mCount * sizeof(int));
+    }
+
+    ByteStreamData streamData;
+    DiscardSink discardSink;
+    streamData.mRecord = buffers.mSrc;
+    streamData.mTotalSize = 16 * 1024 * 1024;
+    streamData.mSink = nullptr;
+    const int recordSizes[] = { 64, 4096 };
+    for (int r = 0; r < 2; ++r)
+    {
+        streamData.mRecordSize = recordSizes[r];
+        streamData.mJoin = false;
+        runner.Run(MakeName(name, "ByteStreamAppend", streamData.mRecordSize), BenchByteStream, &streamData, 2, streamData.mTotalSize);
+        runner.Run(MakeName(name, "ByteStreamContiguous", streamData.mRecordSize), BenchContiguousBuffer, &streamData, 2, streamData.mTotalSize);
+        streamData.mSink = &discardSink;
+        runner.Run(MakeName(name, "ByteStreamSink", streamData.mRecordSize), BenchByteStream, &streamData, 2, streamData.mTotalSize);
+        streamData.mSink = nullptr;
+    }
+    streamData.mJoin = true;
+    runner.Run(MakeName(name, "ByteStreamAppendJoin", streamData.mRecordSize), BenchByteStream, &streamData, 2, streamData.mTotalSize);
+
+    {
+        Pegasus::Utils::TesselationTable tesselationTable(&sBenchmarkAllocator, sizeof(int));
+        runner.Run(MakeName(name, "TesselationTableStrip", sStripVertexCount), BenchTesselationTable, &tesselationTable, 1);
+        Pegasus::Utils::EdgeTable edgeTable(&sBenchmarkAllocator);
+        runner.Run(MakeName(name, "EdgeTableStrip", sStripVertexCount), BenchEdgeTable, &edgeTable, 100);
+
+        // named after the vertex count, 10 * 4^(degree - 1) + 2
+        IcosphereData icosphereData;
+        icosphereData.mTable = &edgeTable;
+        for (icosphereData.mDegree = 6; icosphereData.mDegree <= 10; icosphereData.mDegree += 2)
+        {
+            icosphereData.mVertexCount = 10;
+            for (int d = 1; d < icosphereData.mDegree; ++d) icosphereData.mVertexCount *= 4;
+            icosphereData.mVertexCount += 2;
+
+            // the indices of the tesselation table overflow past 46340 vertices
+            if (icosphereData.mVertexCount <= 46340)
+            {
+                runner.Run(MakeName(name, "IcosphereTesselationTable", icosphereData.mVertexCount), BenchIcosphereTesselationTable, &icosphereData, 1);
+            }
+            runner.Run(MakeName(name, "IcosphereEdgeTable", icosphereData.mVertexCount), BenchIcosphereEdgeTable, &icosphereData, 1);
+            runner.Run(MakeName(name, "IcosphereEdgeTableThreads", icosphereData.mVertexCount), BenchIcosphereEdgeTableThreads, &icosphereData, 1);
+        }
+    }
+
+    // Names sharing a long prefix, as the names of the node classes
+    char* names[sMaxLookupCount];
+    for (int n = 0; n < sMaxLookupCount; ++n)
+    {
+        names[n] = static_cast<char*>(sBenchmarkAllocator.Alloc(32, Pegasus::Alloc::PG_MEM_TEMP, -1, "Benchmark", __FILE__, __LINE__));
+        names[n][0] = '\0';
+        Pegasus::Utils::Strcat(names[n], "Pegasus::Texture::Node");
+        Pegasus::Utils::Strcat(names[n], n);
+    }
+    const int lookupCounts[] = { 10, 100, sMaxLookupCount };
+    for (int c = 0; c < 3; ++c)
+    {
+        Pegasus::Utils::StringInterner interner(&sBenchmarkAllocator);
+        Pegasus::Utils::HashMap<const char*, int, Pegasus::Utils::StringHashTraits> stringMap(&sBenchmarkAllocator);
+        Pegasus::Utils::HashMap<Pegasus::Utils::InternedString, int> internedMap(&sBenchmarkAllocator);
+        Pegasus::Utils::Vector<Pegasus::Utils::InternedString> keys(&sBenchmarkAllocator);
+        LookupData lookupData;
+        lookupData.mNames = names;
+        lookupData.mCount = lookupCounts[c];
+        for (int n = 0; n < lookupData.mCount; ++n)
+        {
+            stringMap.Insert(names[n], n);
+            keys.PushEmpty() = interner.Intern(names[n]);
+            internedMap.Insert(keys[n], n);
+        }
+        lookupData.mStringMap = &stringMap;
+        lookupData.mInternedMap = &internedMap;
+        lookupData.mKeys = keys.Data();
+
+        // fewer iterations for the long linear scans, a run stays below a hundred milliseconds
+        runner.Run(MakeName(name, "LookupLinear", lookupData.mCount), BenchLinearLookup, &lookupData, lookupData.mCount > 1000 ? 1000 : 10000);
+        runner.Run(MakeName(name, "LookupHashMap", lookupData.mCount), BenchStringMapLookup, &lookupData, 100000);
+        runner.Run(MakeName(name, "LookupInterned", lookupData.mCount), BenchInternedMapLookup, &lookupData, 100000);
+    }
+    for (int n = 0; n < sMaxLookupCount; ++n)
+    {
+        sBenchmarkAllocator.Delete(names[n]);
+    }
+
+    sBenchmarkAllocator.Delete(buffers.mSrc);
+    sBenchmarkAllocator.Delete(buffers.mDst);
+}
@@ -9,14 +9,22 @@
 //! \date   30th March 2014
 //! \brief  Pegasus Unit tests for the Utils package, implementation
 
-#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/Memory/mallocfreeallocator.h"
 #include "Pegasus/UnitTests/UtilsTests.h"
 #include "Pegasus/Utils/Memset.h"
 #include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/CpuFeatures.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/TesselationTable.h"
+#include "Pegasus/Utils/EdgeTable.h"
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/InternedString.h"
 #include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/Thread.h"
+#include <stdio.h>
+#include <stdlib.h>
 
 static Pegasus::Memory::MallocFreeAllocator sGlobalAllocator(0);
 
@@ -62,7 +70,7 @@ bool UNIT_TEST_Memcpy3()
 
     //compare
     bool match = true;    
-    for (int i = 0; i < 256; ++i) match = match && destList[i] == i;
+    for (int i = 0; i < 256; ++i) match = match && destList[i] == static_cast<unsigned long long>(i);
 
     return match;
 }
@@ -99,6 +107,108 @@ bool UNIT_TEST_Memset4()
     return true;
 }
 
+//! Feature masks running every implementation of the dispatched routines available on the processor
+static const unsigned int sCpuFeatureMasks[] = { 0, Pegasus::Utils::CPU_FEATURE_SSE2, ~0u };
+static const int sCpuFeatureMaskCount = sizeof(sCpuFeatureMasks) / sizeof(sCpuFeatureMasks[0]);
+
+bool UNIT_TEST_Memcpy4()
+{
+    // every size up to a few vectors, from every alignment, with guard bytes around the destination
+    const int maxSize = 300;
+    unsigned char source[maxSize + 64];
+    unsigned char dest[maxSize + 128];
+    for (int i = 0; i < maxSize + 64; ++i) source[i] = static_cast<unsigned char>(i * 7 + 1);
+
+    bool match = true;
+    for (int m = 0; m < sCpuFeatureMaskCount; ++m)
+    {
+        Pegasus::Utils::SetCpuFeatureMask(sCpuFeatureMasks[m]);
+        for (int size = 0; size <= maxSize; ++size)
+        {
+            for (int offset = 0; offset < 32; offset += 3)
+            {
+                for (int i = 0; i < maxSize + 128; ++i) dest[i] = 0xee;
+                Pegasus::Utils::Memcpy(dest + 32 + offset, source + (offset * 5) % 32, size);
+                for (int i = 0; i < 32 + offset; ++i) match = match && dest[i] == 0xee;
+                for (int i = 0; i < size; ++i) match = match && dest[32 + offset + i] == source[(offset * 5) % 32 + i];
+                for (int i = 32 + offset + size; i < maxSize + 128; ++i) match = match && dest[i] == 0xee;
+            }
+        }
+    }
+    Pegasus::Utils::SetCpuFeatureMask(~0u);
+    return match;
+}
+
+bool UNIT_TEST_Memmove1()
+{
+    // overlapping copies in both directions, checked against a copy through a temporary buffer
+    const int bufferSize = 512;
+    unsigned char buffer[bufferSize];
+    unsigned char expected[bufferSize];
+    unsigned char temp[bufferSize];
+
+    bool match = true;
+    for (int m = 0; m < sCpuFeatureMaskCount; ++m)
+    {
+        Pegasus::Utils::SetCpuFeatureMask(sCpuFeatureMasks[m]);
+        for (int size = 0; size <= 200; size += 7)
+        {
+            for (int shift = -40; shift <= 40; shift += 3)
+            {
+                const int src = 100;
+                const int dst = src + shift;
+                for (int i = 0; i < bufferSize; ++i) buffer[i] = expected[i] = static_cast<unsigned char>(i);
+                for (int i = 0; i < size; ++i) temp[i] = expected[src + i];
+                for (int i = 0; i < size; ++i) expected[dst + i] = temp[i];
+
+                Pegasus::Utils::Memmove(buffer + dst, buffer + src, size);
+                for (int i = 0; i < bufferSize; ++i) match = match && buffer[i] == expected[i];
+            }
+        }
+    }
+    Pegasus::Utils::SetCpuFeatureMask(~0u);
+    return match;
+}
+
+bool UNIT_TEST_Memset5()
+{
+    // 16 and 32 bits patterns from every alignment, the pattern starts at the destination
+    const int maxSize = 300;
+    unsigned char dest[maxSize + 128];
+
+    bool match = true;
+    for (int m = 0; m < sCpuFeatureMaskCount; ++m)
+    {
+        Pegasus::Utils::SetCpuFeatureMask(sCpuFeatureMasks[m]);
+        for (int size = 0; size <= maxSize; size += 4)
+        {
+            for (int offset = 0; offset < 32; ++offset)
+            {
+                for (int i = 0; i < maxSize + 128; ++i) dest[i] = 0xee;
+                unsigned char* target = dest + 32 + offset;
+
+                const unsigned int value32 = 0x12345678;
+                Pegasus::Utils::Memset32(target, value32, size);
+                const unsigned char* pattern32 = reinterpret_cast<const unsigned char*>(&value32);
+                for (int i = 0; i < size; ++i) match = match && target[i] == pattern32[i & 3];
+                match = match && dest[31 + offset] == 0xee && target[size] == 0xee;
+
+                const unsigned short value16 = 0xabcd;
+                Pegasus::Utils::Memset16(target, value16, size + 2);
+                const unsigned char* pattern16 = reinterpret_cast<const unsigned char*>(&value16);
+                for (int i = 0; i < size + 2; ++i) match = match && target[i] == pattern16[i & 1];
+                match = match && dest[31 + offset] == 0xee && target[size + 2] == 0xee;
+
+                Pegasus::Utils::Memset8(target, static_cast<char>(0x80), size + 1);
+                for (int i = 0; i < size + 1; ++i) match = match && target[i] == 0x80;
+                match = match && dest[31 + offset] == 0xee;
+            }
+        }
+    }
+    Pegasus::Utils::SetCpuFeatureMask(~0u);
+    return match;
+}
+
 bool UNIT_TEST_Strcmp1()
 {
     const char * c1 = "ThisIsAString";
@@ -167,6 +277,80 @@ bool UNIT_TEST_Strlen3()
 }
 
 
+bool UNIT_TEST_Strlen4()
+{
+    // strings ending at every position around a page boundary, with the SIMD routines reading whole vectors
+    const int pageSize = 4096;
+    char* buffer = static_cast<char*>(malloc(3 * pageSize));
+    if (buffer == nullptr)
+    {
+        return false;
+    }
+    char* page = reinterpret_cast<char*>((reinterpret_cast<size_t>(buffer) + pageSize - 1) & ~static_cast<size_t>(pageSize - 1)) + pageSize;
+
+    bool match = true;
+    for (int m = 0; m < sCpuFeatureMaskCount; ++m)
+    {
+        Pegasus::Utils::SetCpuFeatureMask(sCpuFeatureMasks[m]);
+        for (int start = -40; start < 8; ++start)
+        {
+            for (int length = 0; length < 48; ++length)
+            {
+                char* str = page + start;
+                for (int i = -64; i < 64; ++i) page[i] = 'a' + (i & 15);
+                str[length] = '\0';
+                match = match && Pegasus::Utils::Strlen(str) == static_cast<unsigned>(length);
+            }
+        }
+    }
+    Pegasus::Utils::SetCpuFeatureMask(~0u);
+    free(buffer);
+    return match;
+}
+
+bool UNIT_TEST_Strcmp5()
+{
+    // differences and ends at every position, with the strings around a page boundary
+    const int pageSize = 4096;
+    char* buffer = static_cast<char*>(malloc(4 * pageSize));
+    if (buffer == nullptr)
+    {
+        return false;
+    }
+    char* page = reinterpret_cast<char*>((reinterpret_cast<size_t>(buffer) + pageSize - 1) & ~static_cast<size_t>(pageSize - 1)) + pageSize;
+    char* str1 = page - 20;
+    char* str2 = page + pageSize - 7;
+    char reference1[64];
+    char reference2[64];
+
+    bool match = true;
+    for (int m = 0; m < sCpuFeatureMaskCount; ++m)
+    {
+        Pegasus::Utils::SetCpuFeatureMask(sCpuFeatureMasks[m]);
+        for (int length = 0; length < 40; ++length)
+        {
+            for (int diff = 0; diff <= length; ++diff)
+            {
+                for (int i = 0; i < length; ++i) str1[i] = str2[i] = 'A' + (i % 26);
+                str1[length] = str2[length] = '\0';
+                if (diff < length) str2[diff] = (diff & 1) ? 'z' : '\0';
+
+                // the generic version gives the expected result
+                for (int i = 0; i <= length; ++i) { reference1[i] = str1[i]; reference2[i] = str2[i]; }
+                Pegasus::Utils::SetCpuFeatureMask(0);
+                const int expected = Pegasus::Utils::Strcmp(reference1, reference2);
+                const int expectedSwapped = Pegasus::Utils::Strcmp(reference2, reference1);
+                Pegasus::Utils::SetCpuFeatureMask(sCpuFeatureMasks[m]);
+                match = match && Pegasus::Utils::Strcmp(str1, str2) == expected;
+                match = match && Pegasus::Utils::Strcmp(str2, str1) == expectedSwapped;
+            }
+        }
+    }
+    Pegasus::Utils::SetCpuFeatureMask(~0u);
+    free(buffer);
+    return match;
+}
+
 bool UNIT_TEST_Strchr1()
 {
     const char * c1 = "01234567890";
@@ -397,13 +581,113 @@ bool UNIT_TEST_TesselationTable4()
     return res1 == 0 && res2 == val;
 }
 
+bool UNIT_TEST_EdgeTable1()
+{
+    Pegasus::Utils::EdgeTable t(&sGlobalAllocator);
+    unsigned int value = 0;
+    bool success = !t.Get(1, 2, value);
+
+    // the table grows with single threaded insertions
+    for (unsigned int i = 0; i < 1000; ++i) t.Insert(i, i * 3 + 1, i);
+    t.Insert(1000000, 7, 5);
+    t.Insert(7, 1000000, 6);
+    success = success && t.GetSize() == 1001 && t.Get(1000000, 7, value) && value == 6;
+    for (unsigned int i = 0; i < 1000; ++i) success = success && t.Get(i * 3 + 1, i, value) && value == i;
+    success = success && !t.Get(2, 5, value);
+
+    // a new generation forgets the edges and keeps the memory, also when the generations wrap around
+    const unsigned int capacity = t.GetCapacity();
+    for (int generation = 0; generation < 300; ++generation)
+    {
+        t.Reset(1000);
+        success = success && t.GetSize() == 0 && t.GetCapacity() == capacity && !t.Get(0, 1, value) && !t.Get(7, 1000000, value);
+        t.Insert(generation, generation + 1, generation);
+        success = success && t.Get(generation + 1, generation, value) && value == static_cast<unsigned int>(generation);
+    }
+
+    bool inserted = t.InsertOrGet(3, 4, 34, value);
+    success = success && inserted && value == 34;
+    inserted = t.InsertOrGet(4, 3, 43, value);
+    success = success && !inserted && value == 34;
+
+    t.Clear();
+    return success && t.GetCapacity() == 0 && !t.Get(3, 4, value);
+}
+
+//! shared state of the threads inserting edges concurrently
+struct EdgeTableThreadState
+{
+    Pegasus::Utils::EdgeTable* mTable;
+    std::atomic<unsigned int> mNextValue;
+    std::atomic<unsigned int> mInsertions;
+    unsigned int mEdgeCount;
+};
+
+//! parameters of a thread inserting edges
+struct EdgeTableThreadArgs
+{
+    EdgeTableThreadState* mState;
+    unsigned int mFirstEdge;
+};
+
+static void EdgeTableThread(void* userData)
+{
+    // all the threads insert all the edges, starting at different edges
+    EdgeTableThreadState* state = static_cast<EdgeTableThreadArgs*>(userData)->mState;
+    const unsigned int firstEdge = static_cast<EdgeTableThreadArgs*>(userData)->mFirstEdge;
+    unsigned int insertions = 0;
+    for (unsigned int e = 0; e < state->mEdgeCount; ++e)
+    {
+        const unsigned int edge = (firstEdge + e) % state->mEdgeCount;
+        unsigned int value = 0;
+        if (state->mTable->InsertOrGet(edge, edge / 3, state->mNextValue.fetch_add(1), value))
+        {
+            ++insertions;
+        }
+    }
+    state->mInsertions.fetch_add(insertions);
+}
+
+bool UNIT_TEST_EdgeTable2()
+{
+    Pegasus::Utils::EdgeTable t(&sGlobalAllocator);
+    EdgeTableThreadState state;
+    state.mTable = &t;
+    state.mEdgeCount = 100000;
+    bool success = true;
+
+    for (int generation = 0; generation < 3; ++generation)
+    {
+        t.Reset(state.mEdgeCount);
+        state.mNextValue.store(0);
+        state.mInsertions.store(0);
+        Pegasus::Core::Thread threads[4];
+        EdgeTableThreadArgs args[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            args[i].mState = &state;
+            args[i].mFirstEdge = i * 7919u * (generation + 1);
+            threads[i].Start(EdgeTableThread, &args[i]);
+        }
+        for (int i = 0; i < 4; ++i) threads[i].Join();
+
+        // each edge has been inserted once, and kept the value of the winning thread
+        success = success && state.mInsertions.load() == state.mEdgeCount && t.GetSize() == state.mEdgeCount;
+        for (unsigned int edge = 0; edge < state.mEdgeCount; ++edge)
+        {
+            unsigned int value = 0;
+            unsigned int other = 0;
+            success = success && t.Get(edge / 3, edge, value) && !t.InsertOrGet(edge, edge / 3, 0xffffffff, other) && other == value;
+        }
+    }
+    return success;
+}
+
 bool UNIT_TEST_Vector1()
 {
     Pegasus::Utils::Vector<int> v(&sGlobalAllocator);
     for (int i = 0; i < 400; ++i) v.PushEmpty() = i;
 
-    bool rightOrdering = true;
-
     int last = -1;
 
     for (unsigned int i = 0; i < v.GetSize(); ++i)
@@ -440,8 +724,86 @@ bool UNIT_TEST_Vector2()
     for (unsigned int i = 0; i < v.GetSize(); ++i)
     {
         Ss& st = v[i];
-        if (st.i != (2*i + 1) || st.c != (st.i % 56)) return false;
+        if (st.i != static_cast<int>(2*i + 1) || st.c != (st.i % 56)) return false;
+    }
+    return true;
+}
+
+//! element counting its live instances, to check the constructors and destructors called by the vector
+struct VectorCounted
+{
+    static int sLive;
+    int mValue;
+    VectorCounted() : mValue(0) { ++sLive; }
+    VectorCounted(int value, int scale) : mValue(value * scale) { ++sLive; }
+    VectorCounted(const VectorCounted& other) : mValue(other.mValue) { ++sLive; }
+    ~VectorCounted() { --sLive; }
+};
+
+int VectorCounted::sLive = 0;
+
+bool UNIT_TEST_Vector3()
+{
+    bool success = true;
+    {
+        Pegasus::Utils::Vector<VectorCounted> v(&sGlobalAllocator);
+        v.Reserve(100);
+        success = success && v.GetCapacity() == 100 && v.GetSize() == 0;
+        for (int i = 0; i < 100; ++i) v.Emplace(i, 2);
+        success = success && v.GetCapacity() == 100 && VectorCounted::sLive == 100;
+
+        // pushing a copy of an element of the vector itself, while the buffer grows
+        v.Push(v[10]);
+        success = success && v.GetCapacity() == 200 && v[100].mValue == 20;
+
+        VectorCounted last = v.Pop();
+        success = success && last.mValue == 20 && v.GetSize() == 100 && VectorCounted::sLive == 101;
+
+        v.ShrinkToFit();
+        success = success && v.GetCapacity() == 100;
+        for (int i = 0; i < 100; ++i) success = success && v[i].mValue == i * 2;
+
+        // moving takes the buffer, copying duplicates the elements
+        Pegasus::Utils::Vector<VectorCounted> moved(static_cast<Pegasus::Utils::Vector<VectorCounted>&&>(v));
+        success = success && v.GetSize() == 0 && moved.GetSize() == 100 && VectorCounted::sLive == 101;
+        Pegasus::Utils::Vector<VectorCounted> copied(moved);
+        success = success && copied.GetSize() == 100 && copied[99].mValue == 198 && VectorCounted::sLive == 201;
+
+        moved.Clear();
+        moved.ShrinkToFit();
+        success = success && moved.GetCapacity() == 0 && moved.Data() == nullptr;
+    }
+    return success && VectorCounted::sLive == 0;
+}
+
+//! pushes elements one at a time
+//! \param linearGrowth if true, emulates the previous growth policy of 64 more elements on each reallocation
+static double PushElements(int count, bool linearGrowth)
+{
+    Pegasus::Utils::Vector<int> v(&sGlobalAllocator);
+    Pegasus::Core::UpdatePegasusTime();
+    double begin = Pegasus::Core::GetPegasusTime();
+    for (int i = 0; i < count; ++i)
+    {
+        if (linearGrowth && v.GetSize() == v.GetCapacity())
+        {
+            v.Reserve(v.GetCapacity() + 64);
+        }
+        v.PushEmpty() = i;
     }
+    Pegasus::Core::UpdatePegasusTime();
+    return Pegasus::Core::GetPegasusTime() - begin;
+}
+
+bool UNIT_TEST_VectorGrowth()
+{
+    const int count = 1000000;
+    Pegasus::Core::InitializePegasusTime();
+    double linearTime = PushElements(count, true);
+    double geometricTime = PushElements(count, false);
+    printf("push of %d elements: linear growth %f ms, geometric growth %f ms\n", count, linearTime * 1000.0, geometricTime * 1000.0);
+
+    // timings are informative only
     return true;
 }
 
@@ -490,6 +852,97 @@ bool UNIT_TEST_ByteStream3()
     return !Pegasus::Utils::Strcmp(static_cast<char*>(bs2.GetBuffer()), static_cast<char*>(bs.GetBuffer()));
 }
 
+//! sink keeping the bytes written in memory, with the size of every write
+class ByteStreamTestSink : public Pegasus::Utils::IByteStreamSink
+{
+public:
+    ByteStreamTestSink() : mBytes(&sGlobalAllocator), mWriteSizes(&sGlobalAllocator), mFail(false) {}
+
+    virtual bool Write(const void* buffer, int size)
+    {
+        mBytes.Append(buffer, size);
+        mWriteSizes.PushEmpty() = size;
+        return !mFail;
+    }
+
+    Pegasus::Utils::ByteStream mBytes;
+    Pegasus::Utils::Vector<int> mWriteSizes;
+    bool mFail;
+};
+
+bool UNIT_TEST_ByteStream4()
+{
+    Pegasus::Utils::ByteStream bs(&sGlobalAllocator);
+    unsigned char pattern[5000];
+    for (int i = 0; i < 5000; ++i) pattern[i] = static_cast<unsigned char>(i * 7);
+
+    // small and large appends, the first chunk never moves
+    bs.Append(pattern, 10);
+    int firstSize = 0;
+    const void* first = bs.GetChunk(0, firstSize);
+    for (int i = 0; i < 200; ++i) bs.Append(pattern + 10, 990);
+    bs.Append(pattern, 5000);
+    int size = 0;
+    bool success = bs.GetChunk(0, size) == first && bs.GetChunkCount() > 1 && bs.GetSize() == 10 + 200 * 990 + 5000;
+
+    // gathering a range crossing chunks
+    unsigned char range[3000];
+    success = success && bs.Read(10 + 199 * 990 + 500, range, 3000) == 3000;
+    for (int i = 0; i < 3000; ++i)
+    {
+        const unsigned char expected = i < 490 ? pattern[10 + 500 + i] : pattern[i - 490];
+        success = success && range[i] == expected;
+    }
+    success = success && bs.Read(bs.GetSize() - 10, range, 3000) == 10 && range[9] == pattern[4999];
+
+    // joining the chunks
+    const unsigned char* joined = static_cast<const unsigned char*>(bs.GetBuffer());
+    success = success && bs.GetChunkCount() == 1 && bs.GetSize() == 10 + 200 * 990 + 5000;
+    for (int i = 0; i < 200; ++i) success = success && joined[10 + i * 990] == pattern[10] && joined[10 + i * 990 + 989] == pattern[999];
+    success = success && joined[bs.GetSize() - 1] == pattern[4999];
+
+    // appending after the join
+    bs.Append(pattern, 1);
+    success = success && bs.GetChunkCount() == 2 && static_cast<const unsigned char*>(bs.GetBuffer())[bs.GetSize() - 1] == pattern[0];
+
+    bs.Reset();
+    return success && bs.GetSize() == 0 && bs.GetChunkCount() == 0 && bs.GetBuffer() == nullptr;
+}
+
+bool UNIT_TEST_ByteStream5()
+{
+    ByteStreamTestSink sink;
+    Pegasus::Utils::ByteStream bs(&sGlobalAllocator);
+    bs.SetSink(&sink, 1024);
+
+    char pattern[3000];
+    for (int i = 0; i < 3000; ++i) pattern[i] = static_cast<char>(i * 13);
+
+    // 100 bytes stay in memory, a complete block is written, large appends at a block boundary skip the copy
+    bs.Append(pattern, 100);
+    bool success = sink.mWriteSizes.GetSize() == 0 && bs.GetSize() == 100;
+    bs.Append(pattern + 100, 2900);
+    success = success && bs.GetSize() == 3000 - 2048 && bs.GetFlushedSize() == 2048;
+    bs.Append(pattern, 100);
+    bs.Append(pattern, 3000);
+    success = success && bs.Flush() && bs.GetSize() == 0 && bs.GetFlushedSize() == 6100;
+
+    // every write but the last one is made of whole blocks
+    for (unsigned int i = 0; i + 1 < sink.mWriteSizes.GetSize(); ++i) success = success && sink.mWriteSizes[i] % 1024 == 0;
+    const char* written = static_cast<const char*>(sink.mBytes.GetBuffer());
+    success = success && sink.mBytes.GetSize() == 6100;
+    for (int i = 0; i < 3000; ++i) success = success && written[i] == pattern[i] && written[3100 + i] == pattern[i];
+    for (int i = 0; i < 100; ++i) success = success && written[3000 + i] == pattern[i];
+
+    // failures are reported by the next flush
+    sink.mFail = true;
+    bs.Append(pattern, 3000);
+    sink.mFail = false;
+    success = success && !bs.Flush();
+
+    return success;
+}
+
 bool UNIT_TEST_HashStr()
 {
     int hashes[10];
@@ -519,3 +972,127 @@ bool UNIT_TEST_HashStr()
 
     return pass;
 }
+
+bool UNIT_TEST_HashBytes64()
+{
+    // reference values of FNV-1a, the hashes key files written by earlier runs
+    const char ab[] = "ab";
+    bool success = Pegasus::Utils::HashBytes64(ab, 0) == 0xcbf29ce484222325ULL;
+    success = success && Pegasus::Utils::HashBytes64(ab, 1) == 0xaf63dc4c8601ec8cULL;
+
+    // combining the hashes of split buffers gives the hash of the whole buffer
+    const unsigned long long first = Pegasus::Utils::HashBytes64(ab, 1);
+    success = success && Pegasus::Utils::HashBytes64(ab + 1, 1, first) == Pegasus::Utils::HashBytes64(ab, 2);
+    return success && Pegasus::Utils::HashBytes64("ba", 2) != Pegasus::Utils::HashBytes64(ab, 2);
+}
+
+bool UNIT_TEST_HashMap1()
+{
+    Pegasus::Utils::HashMap<int, int> map(&sGlobalAllocator);
+    bool success = map.Find(7) == nullptr && !map.Remove(7);
+
+    for (int i = 0; i < 10000; ++i) map.Insert(i * 7, i);
+    success = success && map.GetSize() == 10000;
+
+    // replacing keeps a single key
+    map.Insert(14, -2);
+    success = success && map.GetSize() == 10000 && *map.Find(14) == -2;
+    map.Insert(14, 2);
+
+    // removing shifts the following keys of the clusters, they all have to stay reachable
+    for (int i = 0; i < 10000; i += 2) success = success && map.Remove(i * 7);
+    success = success && map.GetSize() == 5000;
+    for (int i = 0; i < 10000; ++i)
+    {
+        const int* value = map.Find(i * 7);
+        success = success && ((i & 1) ? (value != nullptr && *value == i) : value == nullptr);
+    }
+
+    bool inserted = false;
+    map.FindOrInsert(3, &inserted) = 33;
+    success = success && inserted && *map.Find(3) == 33;
+    map.FindOrInsert(3, &inserted) += 1;
+    success = success && !inserted && *map.Find(3) == 34;
+
+    // every key is seen once when iterating the slots
+    int count = 0;
+    long long sum = 0;
+    for (unsigned int s = 0; s < map.GetSlotCount(); ++s)
+    {
+        if (map.IsSlotUsed(s))
+        {
+            ++count;
+            sum += map.GetSlotValue(s);
+        }
+    }
+    success = success && count == 5001 && sum == 25000000LL + 34;
+
+    map.Clear();
+    return success && map.GetSize() == 0 && map.GetSlotCount() == 0 && map.Find(21) == nullptr;
+}
+
+bool UNIT_TEST_HashMap2()
+{
+    bool success = true;
+    {
+        Pegasus::Utils::HashMap<const void*, VectorCounted> map(&sGlobalAllocator);
+        static char sKeys[1000];
+        map.Reserve(1000);
+        const unsigned int slotCount = map.GetSlotCount();
+        for (int i = 0; i < 1000; ++i) map.Insert(&sKeys[i], VectorCounted(i, 3));
+        success = success && map.GetSlotCount() == slotCount && VectorCounted::sLive == 1000;
+
+        for (int i = 0; i < 1000; i += 3) map.Remove(&sKeys[i]);
+        success = success && VectorCounted::sLive == 666;
+
+        // the values are moved while growing
+        for (int i = 0; i < 1000; i += 3) map.Insert(&sKeys[i], VectorCounted(i, 3));
+        Pegasus::Utils::HashMap<const void*, VectorCounted> moved(static_cast<Pegasus::Utils::HashMap<const void*, VectorCounted>&&>(map));
+        success = success && map.GetSize() == 0 && moved.GetSize() == 1000 && VectorCounted::sLive == 1000;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const VectorCounted* value = moved.Find(&sKeys[i]);
+            success = success && value != nullptr && value->mValue == i * 3;
+        }
+    }
+    return success && VectorCounted::sLive == 0;
+}
+
+bool UNIT_TEST_InternedString1()
+{
+    Pegasus::Utils::StringInterner interner(&sGlobalAllocator);
+    char buffer[] = "RenderTargetNode";
+    Pegasus::Utils::InternedString a = interner.Intern("RenderTargetNode");
+    Pegasus::Utils::InternedString b = interner.Intern(buffer);
+    Pegasus::Utils::InternedString c = interner.Intern("RenderTargetNodeX", 16);
+    Pegasus::Utils::InternedString d = interner.Intern("MeshNode");
+
+    bool success = a == b && a == c && a != d && a.GetStr() != buffer && interner.GetSize() == 2;
+    success = success && a.GetHash() == Pegasus::Utils::HashStr("RenderTargetNode") && !Pegasus::Utils::Strcmp(c.GetStr(), "RenderTargetNode");
+    success = success && interner.Find("MeshNode") == d && interner.Find("Mesh").IsNull();
+
+    // strings longer than the packed strings, and enough strings to fill several pages
+    char longString[3000];
+    Pegasus::Utils::Memset8(longString, 'x', sizeof(longString));
+    longString[sizeof(longString) - 1] = '\0';
+    Pegasus::Utils::InternedString e = interner.Intern(longString);
+    char name[32];
+    for (int i = 0; i < 2000; ++i)
+    {
+        name[0] = '\0';
+        Pegasus::Utils::Strcat(name, "Name");
+        Pegasus::Utils::Strcat(name, i);
+        interner.Intern(name);
+    }
+    success = success && interner.Intern(longString) == e && Pegasus::Utils::Strlen(e.GetStr()) == sizeof(longString) - 1;
+    success = success && interner.GetSize() == 2003 && !Pegasus::Utils::Strcmp(interner.Find("Name1999").GetStr(), "Name1999");
+
+    // interned keys, found either with an interned string or with the text
+    Pegasus::Utils::HashMap<Pegasus::Utils::InternedString, int> map(&sGlobalAllocator);
+    map.Insert(a, 1);
+    map.Insert(d, 2);
+    success = success && *map.Find(b) == 1 && *map.Find("MeshNode") == 2 && map.Find("Mesh") == nullptr;
+
+    interner.Clear();
+    return success && interner.GetSize() == 0 && interner.Find("MeshNode").IsNull();
+}
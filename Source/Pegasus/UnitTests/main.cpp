@@ -11,6 +11,10 @@
 //!         any data structure. To run, edit Utils project to generate an executable, and run
 
 #include "Pegasus/UnitTests/UtilsTests.h"
+#include "Pegasus/UnitTests/MemoryTests.h"
+#include "Pegasus/UnitTests/GraphTests.h"
+#include "Pegasus/UnitTests/Benchmark.h"
+#include "Pegasus/Utils/String.h"
 #include <stdio.h>
 
 typedef bool (*TestFunc)(void);
@@ -30,8 +34,17 @@ bool RunTests(TestFunc func, const char * testTitle, int& outSucceses, int& outT
     return result;
 }
 
-int main()
+int main(int argc, char** argv)
 {
+    // --bench runs the microbenchmarks instead of the unit tests, see Benchmark.h for the options
+    for (int a = 1; a < argc; ++a)
+    {
+        if (!Pegasus::Utils::Strcmp(argv[a], "--bench"))
+        {
+            return RunBenchmarkSuites(argc, argv);
+        }
+    }
+
     int successes = 0;
     int total = 0;
 
@@ -45,18 +58,22 @@ int main()
     RUN_TEST(Memcpy1);
     RUN_TEST(Memcpy2);
     RUN_TEST(Memcpy3);
+    RUN_TEST(Memcpy4);
+    RUN_TEST(Memmove1);
 
     //memset
     RUN_TEST(Memset1);
     RUN_TEST(Memset2);
     RUN_TEST(Memset3);
     RUN_TEST(Memset4);
+    RUN_TEST(Memset5);
 
     //strcmp
     RUN_TEST(Strcmp1);
     RUN_TEST(Strcmp2);
     RUN_TEST(Strcmp3);
     RUN_TEST(Strcmp4);
+    RUN_TEST(Strcmp5);
 
     //stricmp
     RUN_TEST(Stricmp1);
@@ -67,6 +84,7 @@ int main()
     RUN_TEST(Strlen1);
     RUN_TEST(Strlen2);
     RUN_TEST(Strlen3);
+    RUN_TEST(Strlen4);
 
     //strchr
     RUN_TEST(Strchr1);
@@ -88,6 +106,7 @@ int main()
 
     //StringHash
     RUN_TEST(HashStr);
+    RUN_TEST(HashBytes64);
 
     //Atoi
     RUN_TEST(Atoi1);
@@ -105,16 +124,72 @@ int main()
     RUN_TEST(TesselationTable3);
     RUN_TEST(TesselationTable4);
 
+    //EdgeTable
+    RUN_TEST(EdgeTable1);
+    RUN_TEST(EdgeTable2);
+
     //Vector
     RUN_TEST(Vector1);
     RUN_TEST(Vector2);
+    RUN_TEST(Vector3);
+    RUN_TEST(VectorGrowth);
 
     //ByteStream
     RUN_TEST(ByteStream1);
     RUN_TEST(ByteStream2);
-    RUN_TEST(ByteStream3);    
+    RUN_TEST(ByteStream3);
+    RUN_TEST(ByteStream4);
+    RUN_TEST(ByteStream5);
+
+    //HashMap
+    RUN_TEST(HashMap1);
+    RUN_TEST(HashMap2);
+    RUN_TEST(InternedString1);
+
+    ///////////////////////////////////////////////////////////////////
+    // UNIT TESTS - add here your MEMORY package unit tests executions/
+    ///////////////////////////////////////////////////////////////////
+
+    //allocators
+    RUN_TEST(MallocFreeAlign1);
+    RUN_TEST(SlabAllocator1);
+    RUN_TEST(SlabAllocator2);
+    RUN_TEST(SlabAllocator3);
+    RUN_TEST(SlabAllocatorReleaseThreadCache);
+    RUN_TEST(FrameAllocator1);
+    RUN_TEST(FrameAllocator2);
+    RUN_TEST(BlockAllocator1);
+    RUN_TEST(BlockAllocatorRecompile);
+
+    //stats
+    RUN_TEST(MemoryStats1);
+
+    //tracking
+    RUN_TEST(TrackingAllocator1);
+
+    //budgets
+    RUN_TEST(MemoryBudget1);
+
+    //large blocks
+    RUN_TEST(LargeBlockAllocator1);
+
+    ///////////////////////////////////////////////////////////////////
+    // UNIT TESTS - add here your GRAPH package unit tests executions //
+    ///////////////////////////////////////////////////////////////////
+
+#if PEGASUS_PLATFORM_WINDOWS
+    //invalidation
+    RUN_TEST(GraphIdleFrame);
+    //content hash
+    RUN_TEST(GraphContentHash);
+    //scheduler
+    RUN_TEST(GraphScheduledFrame);
+    //asynchronous generation
+    RUN_TEST(GraphAsyncFrame);
+#endif
 
     ///////////////////////////////////////////////////////////
 
     printf("Final Results: %d out of %d succeeded\n", successes, total);
+    return successes == total ? 0 : 1;
 }
@@ -14,61 +14,231 @@
 #include "Pegasus/Allocator/Alloc.h"
 #include "Pegasus/Allocator/IAllocator.h"
 #include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Core/Assertion.h"
 
 
 using namespace Pegasus;
 using namespace Pegasus::Utils;
 
+//! capacity of the first chunk of a stream
+static const int sMinChunkSize = 256;
+
+//! capacity above which the chunks stop growing, unless a single append needs more
+static const int sMaxChunkSize = 1024 * 1024;
+
+//! alignment of the chunk array. PG_NEW_ARRAY and Vector only guarantee 4 bytes, too little for the chunk pointers
+static const Alloc::Alignment sChunkAlignment = 16;
+
+//! number of chunks of the first chunk array
+static const int sMinChunkCount = 4;
+
 ByteStream::ByteStream(Alloc::IAllocator* allocator)
     : mAllocator(allocator),
-      mBuffer(nullptr),
+      mChunks(nullptr),
+      mChunkCount(0),
+      mChunkCapacity(0),
       mBufferSize(0),
-      mTotalCount(0)
+      mSink(nullptr),
+      mBlockSize(DEFAULT_BLOCK_SIZE),
+      mFlushedSize(0),
+      mSinkFailed(false)
 {
-    
+
 }
 
 ByteStream::~ByteStream()
 {
     Reset();
+    if (mChunks != nullptr)
+    {
+        mAllocator->Delete(mChunks);
+    }
+}
+
+void* ByteStream::GetBuffer()
+{
+    if (mChunkCount > 1)
+    {
+        // Join the chunks, a single copy of every byte
+        char* joined = PG_NEW_ARRAY(mAllocator, -1, "ByteStream", Alloc::PG_MEM_TEMP, char, mBufferSize);
+        Read(0, joined, mBufferSize);
+        DeleteChunks();
+        Chunk& chunk = PushChunk();
+        chunk.mData = joined;
+        chunk.mSize = mBufferSize;
+        chunk.mCapacity = mBufferSize;
+    }
+    return mChunkCount == 0 ? nullptr : mChunks[0].mData;
+}
+
+const void* ByteStream::GetBuffer() const
+{
+    PG_ASSERTSTR(mChunkCount <= 1, "The chunks of a byte stream have to be joined before getting a const buffer.");
+    return mChunkCount == 0 ? nullptr : mChunks[0].mData;
 }
 
 void ByteStream::Append(const void* buffer, int size)
 {
-    if (mBufferSize + size > mTotalCount)
+    const char* src = static_cast<const char*>(buffer);
+    while (size > 0)
     {
-        mTotalCount = 2 * (mBufferSize + size);
-        void* newBuffer = PG_NEW_ARRAY(mAllocator, -1, "ByteStream", Alloc::PG_MEM_TEMP, char, mTotalCount);
-        if (mBuffer != nullptr)
+        Chunk* chunk = mChunkCount == 0 ? nullptr : &mChunks[mChunkCount - 1];
+        if (mSink != nullptr)
         {
-            Utils::Memcpy(newBuffer, mBuffer, mBufferSize);
-            PG_DELETE_ARRAY(mAllocator, static_cast<char*>(mBuffer));
+            if ((chunk == nullptr || chunk->mSize == 0) && size >= mBlockSize)
+            {
+                // Whole blocks at a block boundary go straight to the sink, without copy
+                const int blocksSize = size - size % mBlockSize;
+                WriteToSink(src, blocksSize);
+                src += blocksSize;
+                size -= blocksSize;
+                continue;
+            }
+            if (chunk == nullptr)
+            {
+                chunk = &AddChunk(mBlockSize);
+            }
         }
-        mBuffer = newBuffer;
-    }
+        else if (chunk == nullptr || chunk->mSize == chunk->mCapacity)
+        {
+            // Geometric growth, the new chunk holds what is left of the append
+            int growth = mBufferSize < sMinChunkSize ? sMinChunkSize : (mBufferSize > sMaxChunkSize ? sMaxChunkSize : mBufferSize);
+            chunk = &AddChunk(size > growth ? size : growth);
+        }
+
+        const int available = chunk->mCapacity - chunk->mSize;
+        const int copySize = size < available ? size : available;
+        Utils::Memcpy(chunk->mData + chunk->mSize, src, copySize);
+        chunk->mSize += copySize;
+        mBufferSize += copySize;
+        src += copySize;
+        size -= copySize;
 
-    Utils::Memcpy(static_cast<char*>(mBuffer) + mBufferSize, buffer, size);
-    mBufferSize += size;
-    
+        if (mSink != nullptr && chunk->mSize == chunk->mCapacity)
+        {
+            // The block is complete, the chunk is reused for the next block
+            WriteToSink(chunk->mData, chunk->mSize);
+            mBufferSize -= chunk->mSize;
+            chunk->mSize = 0;
+        }
+    }
 }
 
 void ByteStream::Append(const ByteStream* byteStream)
 {
-    Append(byteStream->GetBuffer(), byteStream->GetSize());
+    PG_ASSERTSTR(byteStream != this, "A byte stream cannot be appended to itself.");
+    for (int i = 0; i < byteStream->mChunkCount; ++i)
+    {
+        Append(byteStream->mChunks[i].mData, byteStream->mChunks[i].mSize);
+    }
+}
+
+const void* ByteStream::GetChunk(int index, int& outSize) const
+{
+    PG_ASSERT(index >= 0 && index < GetChunkCount());
+    outSize = mChunks[index].mSize;
+    return mChunks[index].mData;
+}
+
+int ByteStream::Read(int offset, void* destination, int size) const
+{
+    PG_ASSERT(offset >= 0 && size >= 0);
+    char* dst = static_cast<char*>(destination);
+    int copied = 0;
+    for (int i = 0; i < mChunkCount && copied < size; ++i)
+    {
+        const Chunk& chunk = mChunks[i];
+        if (offset >= chunk.mSize)
+        {
+            offset -= chunk.mSize;
+            continue;
+        }
+
+        int copySize = chunk.mSize - offset;
+        copySize = copySize < size - copied ? copySize : size - copied;
+        Utils::Memcpy(dst + copied, chunk.mData + offset, copySize);
+        copied += copySize;
+        offset = 0;
+    }
+    return copied;
+}
+
+void ByteStream::SetSink(IByteStreamSink* sink, int blockSize)
+{
+    PG_ASSERTSTR(mBufferSize == 0, "The sink of a byte stream can only be set while the stream is empty.");
+    PG_ASSERT(blockSize > 0);
+    DeleteChunks();
+    mSink = sink;
+    mBlockSize = blockSize;
+    mFlushedSize = 0;
+    mSinkFailed = false;
+}
+
+bool ByteStream::Flush()
+{
+    PG_ASSERTSTR(mSink != nullptr, "Flushing a byte stream requires a sink.");
+    if (mChunkCount != 0 && mChunks[0].mSize != 0)
+    {
+        WriteToSink(mChunks[0].mData, mChunks[0].mSize);
+        mBufferSize = 0;
+        mChunks[0].mSize = 0;
+    }
+    return !mSinkFailed;
+}
+
+ByteStream::Chunk& ByteStream::PushChunk()
+{
+    if (mChunkCount == mChunkCapacity)
+    {
+        const int capacity = mChunkCapacity == 0 ? sMinChunkCount : mChunkCapacity * 2;
+        Chunk* chunks = static_cast<Chunk*>(mAllocator->AllocAlign(capacity * sizeof(Chunk), sChunkAlignment, Alloc::PG_MEM_TEMP, -1, "ByteStream::mChunks", __FILE__, __LINE__));
+        if (mChunks != nullptr)
+        {
+            Utils::Memcpy(chunks, mChunks, static_cast<unsigned>(mChunkCount * sizeof(Chunk)));
+            mAllocator->Delete(mChunks);
+        }
+        mChunks = chunks;
+        mChunkCapacity = capacity;
+    }
+    return mChunks[mChunkCount++];
+}
+
+ByteStream::Chunk& ByteStream::AddChunk(int minCapacity)
+{
+    Chunk& chunk = PushChunk();
+    chunk.mData = PG_NEW_ARRAY(mAllocator, -1, "ByteStream", Alloc::PG_MEM_TEMP, char, minCapacity);
+    chunk.mSize = 0;
+    chunk.mCapacity = minCapacity;
+    return chunk;
+}
+
+void ByteStream::WriteToSink(const void* buffer, int size)
+{
+    if (!mSink->Write(buffer, size))
+    {
+        mSinkFailed = true;
+    }
+    mFlushedSize += size;
+}
+
+void ByteStream::DeleteChunks()
+{
+    for (int i = 0; i < mChunkCount; ++i)
+    {
+        PG_DELETE_ARRAY(mAllocator, mChunks[i].mData);
+    }
+    mChunkCount = 0;
 }
 
 void ByteStream::ForgetBuffer()
 {
-    mBuffer = nullptr;
-    mTotalCount = 0;
+    PG_ASSERTSTR(mChunkCount <= 1, "The buffer of a byte stream has to be acquired with GetBuffer before being forgotten.");
+    mChunkCount = 0;
     mBufferSize = 0;
 }
 
 void ByteStream::Reset()
 {
-    if (mBuffer != nullptr)
-    {
-        PG_DELETE_ARRAY(mAllocator, static_cast<char*>(mBuffer));
-        ForgetBuffer();
-    }
+    DeleteChunks();
+    mBufferSize = 0;
 }
@@ -0,0 +1,204 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CpuFeatures.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Detection of the instruction sets of the processor, selecting the
+//!         implementation of the memory and string routines at runtime.
+
+#include "Pegasus/Utils/CpuFeatures.h"
+#include "SimdRoutines.h"
+
+#if PEGASUS_ARCH_X86
+#if PEGASUS_COMPILER_MSVC
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Pegasus {
+namespace Utils {
+
+//! Bit set in sDetectedFeatures once the detection ran
+static const unsigned int sFeaturesDetected = 0x80000000;
+
+//! Features of the processor, 0 until detected
+static std::atomic<unsigned int> sDetectedFeatures(0);
+
+//! Features allowed by SetCpuFeatureMask
+static std::atomic<unsigned int> sFeatureMask(~0u);
+
+//----------------------------------------------------------------------------------------
+
+//! Runs CPUID
+//! \param leaf Function of CPUID
+//! \param subLeaf Sub-function of CPUID
+//! \param registers Receives EAX, EBX, ECX and EDX
+static void Cpuid(unsigned int leaf, unsigned int subLeaf, unsigned int registers[4])
+{
+#if PEGASUS_ARCH_X86
+#if PEGASUS_COMPILER_MSVC
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subLeaf));
+    for (int r = 0; r < 4; ++r)
+    {
+        registers[r] = static_cast<unsigned int>(info[r]);
+    }
+#else
+    __cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+#else
+    registers[0] = registers[1] = registers[2] = registers[3] = 0;
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+//! \return the CPU_FEATURE flags of the processor
+static unsigned int DetectFeatures()
+{
+    unsigned int features = 0;
+#if PEGASUS_ARCH_X86
+    unsigned int registers[4];
+    Cpuid(0, 0, registers);
+    const unsigned int maxLeaf = registers[0];
+
+    Cpuid(1, 0, registers);
+    if (registers[3] & (1u << 26))
+    {
+        features |= CPU_FEATURE_SSE2;
+    }
+
+    // AVX2 also needs the operating system to save the YMM registers (OSXSAVE, then XCR0 bits 1 and 2)
+    const bool osxsave = (registers[2] & (1u << 27)) != 0;
+    const bool avx = (registers[2] & (1u << 28)) != 0;
+    if (osxsave && avx && maxLeaf >= 7)
+    {
+#if PEGASUS_COMPILER_MSVC
+        const unsigned long long xcr0 = _xgetbv(0);
+#else
+        unsigned int xcr0Low, xcr0High;
+        __asm__ ("xgetbv" : "=a" (xcr0Low), "=d" (xcr0High) : "c" (0));
+        const unsigned long long xcr0 = (static_cast<unsigned long long>(xcr0High) << 32) | xcr0Low;
+#endif
+        Cpuid(7, 0, registers);
+        if ((xcr0 & 0x6) == 0x6 && (registers[1] & (1u << 5)))
+        {
+            features |= CPU_FEATURE_AVX2;
+        }
+    }
+#endif
+    return features;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetCpuFeatures()
+{
+    unsigned int features = sDetectedFeatures.load(std::memory_order_relaxed);
+    if (features == 0)
+    {
+        // Detecting more than once is harmless, every thread finds the same features
+        features = DetectFeatures() | sFeaturesDetected;
+        sDetectedFeatures.store(features, std::memory_order_relaxed);
+    }
+    return features & sFeatureMask.load(std::memory_order_relaxed) & ~sFeaturesDetected;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Fills the dispatch table with the best implementations allowed
+static void SelectRoutines()
+{
+    Simd::Routines& routines = Simd::gRoutines;
+    const unsigned int features = GetCpuFeatures();
+#if PEGASUS_ARCH_X86
+    if (features & CPU_FEATURE_AVX2)
+    {
+        routines.mMemcpy.store(Simd::MemcpyAvx2, std::memory_order_relaxed);
+        routines.mFill.store(Simd::FillAvx2, std::memory_order_relaxed);
+    }
+    else if (features & CPU_FEATURE_SSE2)
+    {
+        routines.mMemcpy.store(Simd::MemcpySse2, std::memory_order_relaxed);
+        routines.mFill.store(Simd::FillSse2, std::memory_order_relaxed);
+    }
+    else
+    {
+        routines.mMemcpy.store(Simd::MemcpyGeneric, std::memory_order_relaxed);
+        routines.mFill.store(Simd::FillGeneric, std::memory_order_relaxed);
+    }
+
+    // The overlapping copies and the strings are short, 16 bytes vectors are enough
+    const bool sse2 = (features & CPU_FEATURE_SSE2) != 0;
+    routines.mMemmove.store(sse2 ? Simd::MemmoveSse2 : Simd::MemmoveGeneric, std::memory_order_relaxed);
+    routines.mStrlen.store(sse2 ? Simd::StrlenSse2 : Simd::StrlenGeneric, std::memory_order_relaxed);
+    routines.mStrcmp.store(sse2 ? Simd::StrcmpSse2 : Simd::StrcmpGeneric, std::memory_order_relaxed);
+#else
+    routines.mMemcpy.store(Simd::MemcpyGeneric, std::memory_order_relaxed);
+    routines.mMemmove.store(Simd::MemmoveGeneric, std::memory_order_relaxed);
+    routines.mFill.store(Simd::FillGeneric, std::memory_order_relaxed);
+    routines.mStrlen.store(Simd::StrlenGeneric, std::memory_order_relaxed);
+    routines.mStrcmp.store(Simd::StrcmpGeneric, std::memory_order_relaxed);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void SetCpuFeatureMask(unsigned int mask)
+{
+    sFeatureMask.store(mask, std::memory_order_relaxed);
+    SelectRoutines();
+}
+
+//----------------------------------------------------------------------------------------
+
+// Stubs of the dispatch table, selecting the implementations on the first call.
+// The table is constant initialized, so the routines can be called during the static initialization
+
+static void MemcpyStub(void* destination, const void* source, size_t count)
+{
+    SelectRoutines();
+    Simd::gRoutines.mMemcpy.load(std::memory_order_relaxed)(destination, source, count);
+}
+
+static void MemmoveStub(void* destination, const void* source, size_t count)
+{
+    SelectRoutines();
+    Simd::gRoutines.mMemmove.load(std::memory_order_relaxed)(destination, source, count);
+}
+
+static void FillStub(void* destination, unsigned int pattern, size_t size)
+{
+    SelectRoutines();
+    Simd::gRoutines.mFill.load(std::memory_order_relaxed)(destination, pattern, size);
+}
+
+static size_t StrlenStub(const char* str)
+{
+    SelectRoutines();
+    return Simd::gRoutines.mStrlen.load(std::memory_order_relaxed)(str);
+}
+
+static int StrcmpStub(const char* str1, const char* str2)
+{
+    SelectRoutines();
+    return Simd::gRoutines.mStrcmp.load(std::memory_order_relaxed)(str1, str2);
+}
+
+Simd::Routines Simd::gRoutines = {
+    { MemcpyStub },
+    { MemmoveStub },
+    { FillStub },
+    { StrlenStub },
+    { StrcmpStub }
+};
+
+
+}   // namespace Utils
+}   // namespace Pegasus
@@ -0,0 +1,276 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   EdgeTable.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Open addressing table of values stored on the edges between two vertex indices,
+//!         with a memory linear in the number of edges. Use it instead of the tesselation table
+//!         to cache the midpoints of large meshes.
+
+#include "Pegasus/Utils/EdgeTable.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include <thread>
+
+namespace Pegasus
+{
+
+namespace Utils
+{
+
+//! bits of an index in a key
+static const int sIndexBits = 28;
+
+//! first bit of the generation in a key
+static const int sGenerationShift = 2 * sIndexBits;
+
+//! smallest number of slots
+static const unsigned int sMinCapacity = 16;
+
+//----------------------------------------------------------------------------------------
+
+EdgeTable::EdgeTable(Alloc::IAllocator* alloc)
+    : mAllocator(alloc),
+      mSlots(nullptr),
+      mCapacity(0),
+      mMask(0),
+      mMaxSize(0),
+      mGeneration(1)
+{
+    mSize.store(0);
+}
+
+//----------------------------------------------------------------------------------------
+
+EdgeTable::~EdgeTable()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void EdgeTable::Reset(unsigned int maxEdgeCount)
+{
+    // Load factor of 3/4
+    unsigned int capacity = sMinCapacity;
+    while (capacity - capacity / 4 < maxEdgeCount)
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > mCapacity)
+    {
+        Clear();
+        Allocate(capacity);
+    }
+    else if (++mGeneration > 0xff)
+    {
+        // The generations wrapped around, the old slots have to be emptied once
+        mGeneration = 1;
+        for (unsigned int s = 0; s < mCapacity; ++s)
+        {
+            mSlots[s].mKey.store(0, std::memory_order_relaxed);
+            mSlots[s].mValue.store(0, std::memory_order_relaxed);
+        }
+    }
+    mSize.store(0);
+}
+
+//----------------------------------------------------------------------------------------
+
+void EdgeTable::Insert(unsigned int i, unsigned int j, unsigned int value)
+{
+    if (GetSize() + 1 > mMaxSize)
+    {
+        Grow();
+    }
+
+    const unsigned long long key = MakeKey(i, j);
+    const unsigned long long generationValue = static_cast<unsigned long long>(mGeneration) << 32;
+    unsigned int index = GetHomeSlot(key);
+    for (;;)
+    {
+        Slot& slot = mSlots[index];
+        const unsigned long long current = slot.mKey.load(std::memory_order_relaxed);
+        if (current == key)
+        {
+            slot.mValue.store(generationValue | value, std::memory_order_relaxed);
+            return;
+        }
+        else if ((current >> sGenerationShift) != mGeneration)
+        {
+            slot.mKey.store(key, std::memory_order_relaxed);
+            slot.mValue.store(generationValue | value, std::memory_order_relaxed);
+            mSize.store(GetSize() + 1, std::memory_order_relaxed);
+            return;
+        }
+        index = (index + 1) & mMask;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool EdgeTable::InsertOrGet(unsigned int i, unsigned int j, unsigned int value, unsigned int& outValue)
+{
+    PG_ASSERTSTR(mSlots != nullptr, "The edge table must be reset with the expected edge count before concurrent insertions.");
+    const unsigned long long key = MakeKey(i, j);
+    const unsigned long long generationValue = static_cast<unsigned long long>(mGeneration) << 32;
+    unsigned int index = GetHomeSlot(key);
+    for (;;)
+    {
+        Slot& slot = mSlots[index];
+        unsigned long long current = slot.mKey.load(std::memory_order_acquire);
+        if (current == key)
+        {
+            outValue = ReadValue(slot);
+            return false;
+        }
+        else if ((current >> sGenerationShift) != mGeneration)
+        {
+            // Empty slot, claimed with a CAS. On failure, the same slot is checked again
+            if (slot.mKey.compare_exchange_strong(current, key, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                slot.mValue.store(generationValue | value, std::memory_order_release);
+#if PEGASUS_ENABLE_ASSERT
+                const unsigned int size = mSize.fetch_add(1, std::memory_order_relaxed) + 1;
+                PG_ASSERTSTR(size <= mMaxSize, "Too many edges inserted concurrently, reset the edge table with a larger edge count.");
+#else
+                mSize.fetch_add(1, std::memory_order_relaxed);
+#endif
+                outValue = value;
+                return true;
+            }
+            continue;
+        }
+        index = (index + 1) & mMask;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool EdgeTable::Get(unsigned int i, unsigned int j, unsigned int& outValue) const
+{
+    if (mSlots == nullptr)
+    {
+        return false;
+    }
+
+    const unsigned long long key = MakeKey(i, j);
+    unsigned int index = GetHomeSlot(key);
+    for (;;)
+    {
+        const Slot& slot = mSlots[index];
+        const unsigned long long current = slot.mKey.load(std::memory_order_acquire);
+        if (current == key)
+        {
+            outValue = ReadValue(slot);
+            return true;
+        }
+        else if ((current >> sGenerationShift) != mGeneration)
+        {
+            return false;
+        }
+        index = (index + 1) & mMask;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void EdgeTable::Clear()
+{
+    if (mSlots != nullptr)
+    {
+        mAllocator->Delete(mSlots);
+        mSlots = nullptr;
+    }
+    mCapacity = 0;
+    mMask = 0;
+    mMaxSize = 0;
+    mSize.store(0);
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long EdgeTable::MakeKey(unsigned int i, unsigned int j) const
+{
+    // the same key for (i,j) and (j,i), the larger index first
+    const unsigned long long ni = i >= j ? i : j;
+    const unsigned long long nj = i >= j ? j : i;
+    PG_ASSERTSTR(ni <= MAX_VERTEX_INDEX, "Vertex index too large for the edge table.");
+    return (static_cast<unsigned long long>(mGeneration) << sGenerationShift) | (ni << sIndexBits) | nj;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int EdgeTable::GetHomeSlot(unsigned long long key) const
+{
+    // the generation is left out, an edge keeps its slot across generations
+    return HashInt(key & ((1ULL << sGenerationShift) - 1)) & mMask;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int EdgeTable::ReadValue(const Slot& slot) const
+{
+    // The thread which claimed the slot may not have published its value yet
+    const unsigned long long generationValue = static_cast<unsigned long long>(mGeneration) << 32;
+    unsigned long long storedValue = slot.mValue.load(std::memory_order_acquire);
+    while ((storedValue & 0xffffffff00000000ULL) != generationValue)
+    {
+        std::this_thread::yield();
+        storedValue = slot.mValue.load(std::memory_order_acquire);
+    }
+    return static_cast<unsigned int>(storedValue);
+}
+
+//----------------------------------------------------------------------------------------
+
+void EdgeTable::Allocate(unsigned int capacity)
+{
+    mSlots = static_cast<Slot*>(mAllocator->AllocAlign(capacity * sizeof(Slot), 16, Alloc::PG_MEM_TEMP, -1, "EdgeTable", __FILE__, __LINE__));
+    for (unsigned int s = 0; s < capacity; ++s)
+    {
+        mSlots[s].mKey.store(0, std::memory_order_relaxed);
+        mSlots[s].mValue.store(0, std::memory_order_relaxed);
+    }
+    mCapacity = capacity;
+    mMask = capacity - 1;
+    mMaxSize = capacity - capacity / 4;
+}
+
+//----------------------------------------------------------------------------------------
+
+void EdgeTable::Grow()
+{
+    Slot* oldSlots = mSlots;
+    const unsigned int oldCapacity = mCapacity;
+    Allocate(oldCapacity == 0 ? sMinCapacity : oldCapacity * 2);
+
+    // the keys keep their generation, the slots of the new memory are all empty
+    for (unsigned int s = 0; s < oldCapacity; ++s)
+    {
+        const unsigned long long key = oldSlots[s].mKey.load(std::memory_order_relaxed);
+        if ((key >> sGenerationShift) == mGeneration)
+        {
+            unsigned int index = GetHomeSlot(key);
+            while (mSlots[index].mKey.load(std::memory_order_relaxed) != 0)
+            {
+                index = (index + 1) & mMask;
+            }
+            mSlots[index].mKey.store(key, std::memory_order_relaxed);
+            mSlots[index].mValue.store(oldSlots[s].mValue.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    if (oldSlots != nullptr)
+    {
+        mAllocator->Delete(oldSlots);
+    }
+}
+
+}
+}
@@ -0,0 +1,121 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   InternedString.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Strings interned by a string interner, which keeps a single copy of each text.
+
+#include "Pegasus/Utils/InternedString.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Allocator/IAllocator.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Utils;
+
+//! characters of a page, header included
+static const int sPageByteSize = 4096;
+
+//! longest string packed in the pages, longer strings get a page of their own
+static const int sMaxPackedLength = sPageByteSize / 4;
+
+StringInterner::StringInterner(Alloc::IAllocator* allocator)
+    : mAllocator(allocator),
+      mTable(allocator),
+      mPages(nullptr),
+      mPageUsed(sPageByteSize)
+{
+}
+
+StringInterner::~StringInterner()
+{
+    Clear();
+}
+
+void StringInterner::SetAllocator(Alloc::IAllocator* allocator)
+{
+    PG_ASSERTSTR(mPages == nullptr, "Cannot change the allocator of a string interner in use.");
+    mAllocator = allocator;
+    mTable.SetAllocator(allocator);
+}
+
+InternedString StringInterner::Intern(const char* str)
+{
+    return Intern(str, static_cast<int>(Utils::Strlen(str)));
+}
+
+InternedString StringInterner::Intern(const char* str, int length)
+{
+    PG_ASSERT(str != nullptr && length >= 0);
+    const unsigned int hash = Utils::HashStr(str, length);
+    const char* found = mTable.Find(str, length, hash);
+    if (found == nullptr)
+    {
+        found = Store(str, length);
+        mTable.Insert(found, length, hash);
+    }
+    return InternedString(found, hash);
+}
+
+InternedString StringInterner::Find(const char* str) const
+{
+    PG_ASSERT(str != nullptr);
+    const int length = static_cast<int>(Utils::Strlen(str));
+    const unsigned int hash = Utils::HashStr(str, length);
+    const char* found = mTable.Find(str, length, hash);
+    return found == nullptr ? InternedString() : InternedString(found, hash);
+}
+
+void StringInterner::Clear()
+{
+    while (mPages != nullptr)
+    {
+        Page* next = mPages->mNext;
+        mAllocator->Delete(mPages);
+        mPages = next;
+    }
+    mPageUsed = sPageByteSize;
+    mTable.Reset();
+}
+
+char* StringInterner::Store(const char* str, int length)
+{
+    const int size = length + 1;
+    char* copy = nullptr;
+    if (size > sMaxPackedLength)
+    {
+        // Dedicated page, inserted after the current page so the current page keeps filling up
+        Page* page = static_cast<Page*>(mAllocator->Alloc(sizeof(Page) + size, Alloc::PG_MEM_PERM, -1, "StringInterner", __FILE__, __LINE__));
+        if (mPages == nullptr)
+        {
+            page->mNext = nullptr;
+            mPages = page;
+        }
+        else
+        {
+            page->mNext = mPages->mNext;
+            mPages->mNext = page;
+        }
+        copy = reinterpret_cast<char*>(page + 1);
+    }
+    else
+    {
+        if (mPageUsed + size > sPageByteSize)
+        {
+            Page* page = static_cast<Page*>(mAllocator->Alloc(sPageByteSize, Alloc::PG_MEM_PERM, -1, "StringInterner", __FILE__, __LINE__));
+            page->mNext = mPages;
+            mPages = page;
+            mPageUsed = sizeof(Page);
+        }
+        copy = reinterpret_cast<char*>(mPages) + mPageUsed;
+        mPageUsed += size;
+    }
+
+    Utils::Memcpy(copy, str, length);
+    copy[length] = '\0';
+    return copy;
+}
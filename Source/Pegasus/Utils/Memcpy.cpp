@@ -10,62 +10,302 @@
 //! \brief	Memcpy implementation
 
 #include "Pegasus/Utils/Memcpy.h"
-
-#if   PEGASUS_POINTERSIZE_64BIT 
-    typedef unsigned long long NumPtr;
-#else
-    typedef int NumPtr;
-#endif
+#include "SimdRoutines.h"
+#include <string.h>
 
 //! Memcpy
 void * Pegasus::Utils::Memcpy(void* dst, const void* src, unsigned count)
 {
     PG_ASSERTSTR( 
-        reinterpret_cast<NumPtr>(dst) < reinterpret_cast<NumPtr>(src) ||
-        (reinterpret_cast<NumPtr>(dst) > reinterpret_cast<NumPtr>(src) && (reinterpret_cast<NumPtr>(dst) - reinterpret_cast<NumPtr>(src)) >= static_cast<NumPtr>(count)),
-        "Fatal Memcpy!, memcpy intersection detected. Pegasus only supports fwd copy. this will result in a possible memory stomp."
+        reinterpret_cast<size_t>(dst) <= reinterpret_cast<size_t>(src) ||
+        reinterpret_cast<size_t>(dst) - reinterpret_cast<size_t>(src) >= count,
+        "Fatal Memcpy!, memcpy intersection detected. Pegasus only supports fwd copy, use Memmove. this will result in a possible memory stomp."
     );
 
-    unsigned blockSize = 0;
-    unsigned i = 0;
-#if  PEGASUS_POINTERSIZE_64BIT 
-    long long * dst64bit = static_cast<long long*>(dst);
-    const long long * src64bit = static_cast<const long long*>(src);
-    blockSize = (count >> 3); 
-    for (i = 0; i < blockSize; ++i)
+    // Forward copies within a buffer are supported, the vector routines are not safe for them
+    const bool intersecting = reinterpret_cast<size_t>(src) - reinterpret_cast<size_t>(dst) < count;
+    (intersecting ? Simd::gRoutines.mMemmove : Simd::gRoutines.mMemcpy).load(std::memory_order_relaxed)(dst, src, count);
+    return dst;
+}
+
+//! Memmove
+void * Pegasus::Utils::Memmove(void* dst, const void* src, unsigned count)
+{
+    Simd::gRoutines.mMemmove.load(std::memory_order_relaxed)(dst, src, count);
+    return dst;
+}
+
+namespace Pegasus {
+namespace Utils {
+namespace Simd {
+
+//----------------------------------------------------------------------------------------
+
+void MemcpyGeneric(void* destination, const void* source, size_t count)
+{
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+    const unsigned char* src = static_cast<const unsigned char*>(source);
+
+    // Word copies when both pointers can be aligned together, bytes otherwise
+    if (((reinterpret_cast<size_t>(dst) ^ reinterpret_cast<size_t>(src)) & (sizeof(size_t) - 1)) == 0)
     {
-        *(dst64bit++) = *(src64bit++);
+        while (count > 0 && (reinterpret_cast<size_t>(dst) & (sizeof(size_t) - 1)) != 0)
+        {
+            *dst++ = *src++;
+            --count;
+        }
+        size_t* dstWord = reinterpret_cast<size_t*>(dst);
+        const size_t* srcWord = reinterpret_cast<const size_t*>(src);
+        for (; count >= sizeof(size_t); count -= sizeof(size_t))
+        {
+            *dstWord++ = *srcWord++;
+        }
+        dst = reinterpret_cast<unsigned char*>(dstWord);
+        src = reinterpret_cast<const unsigned char*>(srcWord);
     }
-    count -= blockSize << 3;
-    dst = dst64bit;
-    src = src64bit;
-#endif
 
-    int * dst32bit = reinterpret_cast<int*>(dst);
-    const int * src32bit = reinterpret_cast<const int*>(src);
-    blockSize = (count >> 2);
-    for (i = 0; i < blockSize; ++i)
+    while (count-- > 0)
     {
-        *(dst32bit++) = *(src32bit++);
+        *dst++ = *src++;
     }
-    count -= blockSize << 2;
+}
 
-    short * dst16bit = reinterpret_cast<short *>(dst32bit);
-    const short * src16bit = reinterpret_cast<const short*>(src32bit);
-    blockSize = (count >> 1);
-    for (i = 0; i < blockSize; ++i)
+//----------------------------------------------------------------------------------------
+
+void MemmoveGeneric(void* destination, const void* source, size_t count)
+{
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+    const unsigned char* src = static_cast<const unsigned char*>(source);
+    if (dst <= src || dst >= src + count)
     {
-        *(dst16bit++) = *(src16bit++);
+        // Forward, every byte is read before the copy reaches it
+        while (count-- > 0)
+        {
+            *dst++ = *src++;
+        }
     }
-    count -= blockSize << 1;
-    
-    char * dst8bit = reinterpret_cast<char*>(dst16bit);
-    const char * src8bit = reinterpret_cast<const char*>(src16bit);
-    for (i = 0; i < count; ++i)
+    else
     {
-        *(dst8bit++) = *(src8bit++);
+        // Backward, the destination is after the source
+        while (count-- > 0)
+        {
+            dst[count] = src[count];
+        }
     }
+}
 
-    return dst;
-    
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_ARCH_X86
+
+//! Copies up to 16 bytes, with two possibly overlapping loads and stores.
+//! Both loads happen before the stores, so the copy is safe for intersecting memory
+PEGASUS_TARGET_SSE2 static inline void CopySmall(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    if (count >= 8)
+    {
+        const __m128i head = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        const __m128i tail = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + count - 8));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), head);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + count - 8), tail);
+    }
+    else if (count >= 4)
+    {
+        // Fixed size copies compile to unaligned 32 bits moves, without breaking the aliasing rules
+        unsigned int head, tail;
+        memcpy(&head, src, 4);
+        memcpy(&tail, src + count - 4, 4);
+        memcpy(dst, &head, 4);
+        memcpy(dst + count - 4, &tail, 4);
+    }
+    else if (count > 0)
+    {
+        const unsigned char first = src[0];
+        const unsigned char middle = src[count >> 1];
+        const unsigned char last = src[count - 1];
+        dst[0] = first;
+        dst[count >> 1] = middle;
+        dst[count - 1] = last;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+PEGASUS_TARGET_SSE2 void MemcpySse2(void* destination, const void* source, size_t count)
+{
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+    const unsigned char* src = static_cast<const unsigned char*>(source);
+
+    if (count <= 16)
+    {
+        CopySmall(dst, src, count);
+        return;
+    }
+    if (count <= 32)
+    {
+        const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count - 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), head);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count - 16), tail);
+        return;
+    }
+
+    // The last 16 bytes are stored at the end, the unaligned head first, then aligned stores in between
+    const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count - 16));
+    unsigned char* const dstTail = dst + count - 16;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    const size_t skip = 16 - (reinterpret_cast<size_t>(dst) & 15);
+    dst += skip;
+    src += skip;
+    count -= skip;
+
+    if (count >= sNonTemporalThreshold)
+    {
+        for (; count >= 64; count -= 64, dst += 64, src += 64)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst), a);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), b);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), c);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), d);
+        }
+        _mm_sfence();
+    }
+    else
+    {
+        for (; count >= 64; count -= 64, dst += 64, src += 64)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst), a);
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + 16), b);
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + 32), c);
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + 48), d);
+        }
+    }
+
+    for (; count > 16; count -= 16, dst += 16, src += 16)
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dstTail), tail);
 }
+
+//----------------------------------------------------------------------------------------
+
+PEGASUS_TARGET_AVX2 void MemcpyAvx2(void* destination, const void* source, size_t count)
+{
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+    const unsigned char* src = static_cast<const unsigned char*>(source);
+
+    if (count <= 32)
+    {
+        MemcpySse2(dst, src, count);
+        return;
+    }
+    if (count <= 64)
+    {
+        const __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + count - 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), head);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + count - 32), tail);
+        _mm256_zeroupper();
+        return;
+    }
+
+    // The last 32 bytes are stored at the end, the unaligned head first, then aligned stores in between
+    const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + count - 32));
+    unsigned char* const dstTail = dst + count - 32;
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    const size_t skip = 32 - (reinterpret_cast<size_t>(dst) & 31);
+    dst += skip;
+    src += skip;
+    count -= skip;
+
+    if (count >= sNonTemporalThreshold)
+    {
+        for (; count >= 128; count -= 128, dst += 128, src += 128)
+        {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+            const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 64));
+            const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 96));
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst), a);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 32), b);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 64), c);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 96), d);
+        }
+        _mm_sfence();
+    }
+    else
+    {
+        for (; count >= 128; count -= 128, dst += 128, src += 128)
+        {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+            const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 64));
+            const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 96));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst), a);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + 32), b);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + 64), c);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + 96), d);
+        }
+    }
+
+    for (; count > 32; count -= 32, dst += 32, src += 32)
+    {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(dst), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dstTail), tail);
+    _mm256_zeroupper();
+}
+
+//----------------------------------------------------------------------------------------
+
+PEGASUS_TARGET_SSE2 void MemmoveSse2(void* destination, const void* source, size_t count)
+{
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+    const unsigned char* src = static_cast<const unsigned char*>(source);
+
+    if (count <= 16)
+    {
+        CopySmall(dst, src, count);
+    }
+    else if (dst + count <= src || src + count <= dst)
+    {
+        MemcpySse2(dst, src, count);
+    }
+    else if (dst < src)
+    {
+        // Forward, each vector is loaded before the stores reach it. The last one is loaded first
+        const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count - 16));
+        unsigned char* const dstTail = dst + count - 16;
+        for (; count > 16; count -= 16, dst += 16, src += 16)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dstTail), tail);
+    }
+    else
+    {
+        // Backward, the destination is after the source. The first vector is loaded first
+        const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        for (; count > 16; count -= 16)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count - 16), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count - 16)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), head);
+    }
+}
+
+#endif  // PEGASUS_ARCH_X86
+
+
+}   // namespace Simd
+}   // namespace Utils
+}   // namespace Pegasus
@@ -10,6 +10,7 @@
 //! \brief	Memset implementation (all its flavors)
 
 #include "Pegasus/Utils/Memset.h"
+#include "SimdRoutines.h"
 
 namespace Pegasus {
 namespace Utils {
@@ -17,45 +18,164 @@ namespace Utils {
 
 void* Memset8(void * destination, char value, unsigned int size)
 {
-    // Copy the major part of the buffer using 32 bit blocks
-    if (size >= 4)
+    // The pattern is built from the unsigned byte, a negative char does not extend into the other bytes
+    const unsigned int value8 = static_cast<unsigned char>(value);
+    Simd::gRoutines.mFill.load(std::memory_order_relaxed)(destination, value8 * 0x01010101u, size);
+    return destination;
+}
+
+//----------------------------------------------------------------------------------------
+
+void * Memset16(void * destination, unsigned short value, unsigned int size)
+{
+    PG_ASSERTSTR((size & 0x1) == 0, "The size of the output buffer must be a multiple of 2");
+    const unsigned int value16 = value;
+    Simd::gRoutines.mFill.load(std::memory_order_relaxed)(destination, value16 | (value16 << 16), size);
+    return destination;
+}
+
+//----------------------------------------------------------------------------------------
+
+void * Memset32(void * destination, unsigned int value, unsigned int size)
+{
+    PG_ASSERTSTR((size & 0x3) == 0, "The size of the output buffer must be a multiple of 4");
+    Simd::gRoutines.mFill.load(std::memory_order_relaxed)(destination, value, size);
+    return destination;
+}
+
+//----------------------------------------------------------------------------------------
+
+namespace Simd {
+
+//! Fills bytes one by one, the first byte receiving byte (offset % 4) of the pattern in memory
+static inline void FillBytes(unsigned char* dst, unsigned int pattern, size_t offset, size_t size)
+{
+    const unsigned char* patternBytes = reinterpret_cast<const unsigned char*>(&pattern);
+    for (size_t i = 0; i < size; ++i)
     {
-        unsigned long value32 = static_cast<unsigned long>(value);
-        value32 = (value32 << 8) | value32;
-        value32 = (value32 << 16) | value32;
-        Memset32(destination, value32, size & 0xFFFFFFFC);
+        dst[i] = patternBytes[(offset + i) & 3];
     }
+}
+
+//----------------------------------------------------------------------------------------
+
+void FillGeneric(void* destination, unsigned int pattern, size_t size)
+{
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+
+    // Bytes up to a 4 bytes boundary, then 32 bits words holding the pattern rotated to the boundary
+    size_t head = (4 - (reinterpret_cast<size_t>(dst) & 3)) & 3;
+    head = head < size ? head : size;
+    FillBytes(dst, pattern, 0, head);
 
-    // Copy the leftover bytes if the buffer size is not a multiple of 4
-    if (size & 3)
+    unsigned int word;
+    FillBytes(reinterpret_cast<unsigned char*>(&word), pattern, head, 4);
+    unsigned int* dstWord = reinterpret_cast<unsigned int*>(dst + head);
+    size_t offset = head;
+    for (; offset + 4 <= size; offset += 4)
     {
-        char * byteDestination = static_cast<char *>(destination);
-        byteDestination += size & 0xFFFFFFFC;
-        size = size & 3;
-        while (size-- > 0)
+        *dstWord++ = word;
+    }
+
+    FillBytes(dst + offset, pattern, offset, size - offset);
+}
+
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_ARCH_X86
+
+//! \return a pattern rotated so its first byte in memory is byte (offset % 4) of the original, x86 being little endian
+static inline unsigned int RotatePattern(unsigned int pattern, size_t offset)
+{
+    const unsigned int shift = static_cast<unsigned int>(offset & 3) * 8;
+    return shift == 0 ? pattern : (pattern >> shift) | (pattern << (32 - shift));
+}
+
+//----------------------------------------------------------------------------------------
+
+PEGASUS_TARGET_SSE2 void FillSse2(void* destination, unsigned int pattern, size_t size)
+{
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+    if (size < 16)
+    {
+        FillBytes(dst, pattern, 0, size);
+        return;
+    }
+
+    // The unaligned head and tail vectors cover the ends, aligned stores fill in between.
+    // The pattern has a period of 4 bytes, so each store uses it rotated to its offset
+    const __m128i vector = _mm_set1_epi32(static_cast<int>(pattern));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), vector);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + size - 16), _mm_set1_epi32(static_cast<int>(RotatePattern(pattern, size - 16))));
+
+    size_t offset = 16 - (reinterpret_cast<size_t>(dst) & 15);
+    const __m128i aligned = _mm_set1_epi32(static_cast<int>(RotatePattern(pattern, offset)));
+    if (size >= sNonTemporalThreshold)
+    {
+        for (; offset + 64 <= size; offset += 64)
         {
-            *byteDestination++ = value;
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + offset), aligned);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + offset + 16), aligned);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + offset + 32), aligned);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + offset + 48), aligned);
         }
+        _mm_sfence();
+    }
+    for (; offset + 16 <= size; offset += 16)
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(dst + offset), aligned);
     }
-
-    return destination;
 }
 
 //----------------------------------------------------------------------------------------
 
-void * Memset32(void * destination, unsigned long value, unsigned int size)
+PEGASUS_TARGET_AVX2 void FillAvx2(void* destination, unsigned int pattern, size_t size)
 {
-    PG_ASSERTSTR((size & 0x3) == 0, "The size of the output buffer must be a multiple of 4");
-    unsigned int numBlocks = size >> 2;
+    unsigned char* dst = static_cast<unsigned char*>(destination);
+    if (size < 64)
+    {
+        FillSse2(dst, pattern, size);
+        return;
+    }
+
+    const __m256i vector = _mm256_set1_epi32(static_cast<int>(pattern));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), vector);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + size - 32), _mm256_set1_epi32(static_cast<int>(RotatePattern(pattern, size - 32))));
 
-    unsigned long * ulongDestination = static_cast<unsigned long *>(destination);
-    while (numBlocks-- > 0)
+    size_t offset = 32 - (reinterpret_cast<size_t>(dst) & 31);
+    const __m256i aligned = _mm256_set1_epi32(static_cast<int>(RotatePattern(pattern, offset)));
+    if (size >= sNonTemporalThreshold)
     {
-        *ulongDestination++ = value;
+        for (; offset + 128 <= size; offset += 128)
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + offset), aligned);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + offset + 32), aligned);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + offset + 64), aligned);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + offset + 96), aligned);
+        }
+        _mm_sfence();
     }
-    return destination;
+    else
+    {
+        for (; offset + 128 <= size; offset += 128)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + offset), aligned);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + offset + 32), aligned);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + offset + 64), aligned);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst + offset + 96), aligned);
+        }
+    }
+    for (; offset + 32 <= size; offset += 32)
+    {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(dst + offset), aligned);
+    }
+    _mm256_zeroupper();
 }
 
+#endif  // PEGASUS_ARCH_X86
+
+}   // namespace Simd
+
 
 }   // namespace Utils
 }   // namespace Pegasus
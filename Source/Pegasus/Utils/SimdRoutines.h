@@ -0,0 +1,90 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SimdRoutines.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Dispatch table of the memory and string routines, private to the Utils library.
+//!         Each routine has a generic implementation and SSE2 / AVX2 ones on x86.
+
+#ifndef PEGASUS_UTILS_SIMDROUTINES_H
+#define PEGASUS_UTILS_SIMDROUTINES_H
+
+#include <atomic>
+
+#if PEGASUS_ARCH_X86
+#include <emmintrin.h>
+#include <immintrin.h>
+#if PEGASUS_COMPILER_MSVC
+#include <intrin.h>
+#endif
+#endif
+
+//! Compiles a function for an instruction set, without requiring it from the rest of the code
+#if PEGASUS_COMPILER_MSVC
+#define PEGASUS_TARGET_SSE2
+#define PEGASUS_TARGET_AVX2
+#else
+#define PEGASUS_TARGET_SSE2 __attribute__((target("sse2")))
+#define PEGASUS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace Pegasus {
+namespace Utils {
+namespace Simd {
+
+//! Copy of count bytes (Memcpy, Memmove)
+typedef void (*CopyFunc)(void* destination, const void* source, size_t count);
+
+//! Fill of size bytes repeating a 32 bits pattern from the destination address, whatever its alignment
+typedef void (*FillFunc)(void* destination, unsigned int pattern, size_t size);
+
+//! Length of a null terminated string
+typedef size_t (*StrlenFunc)(const char* str);
+
+//! Comparison of null terminated strings, with the conventions of Utils::Strcmp
+typedef int (*StrcmpFunc)(const char* str1, const char* str2);
+
+//! Implementations selected for the processor. Each entry starts as a stub selecting the table on its first call
+struct Routines
+{
+    std::atomic<CopyFunc>   mMemcpy;
+    std::atomic<CopyFunc>   mMemmove;
+    std::atomic<FillFunc>   mFill;
+    std::atomic<StrlenFunc> mStrlen;
+    std::atomic<StrcmpFunc> mStrcmp;
+};
+
+//! Dispatch table, filled by CpuFeatures.cpp
+extern Routines gRoutines;
+
+// Implementations, in Memcpy.cpp, Memset.cpp and String.cpp
+void MemcpyGeneric(void* destination, const void* source, size_t count);
+void MemmoveGeneric(void* destination, const void* source, size_t count);
+void FillGeneric(void* destination, unsigned int pattern, size_t size);
+size_t StrlenGeneric(const char* str);
+int StrcmpGeneric(const char* str1, const char* str2);
+
+#if PEGASUS_ARCH_X86
+void MemcpySse2(void* destination, const void* source, size_t count);
+void MemcpyAvx2(void* destination, const void* source, size_t count);
+void MemmoveSse2(void* destination, const void* source, size_t count);
+void FillSse2(void* destination, unsigned int pattern, size_t size);
+void FillAvx2(void* destination, unsigned int pattern, size_t size);
+size_t StrlenSse2(const char* str);
+int StrcmpSse2(const char* str1, const char* str2);
+#endif
+
+//! Copies above this size bypass the caches with non-temporal stores,
+//! the destination would evict the whole working set without being read back soon
+const size_t sNonTemporalThreshold = 4 * 1024 * 1024;
+
+
+}   // namespace Simd
+}   // namespace Utils
+}   // namespace Pegasus
+
+#endif  // PEGASUS_UTILS_SIMDROUTINES_H
@@ -10,18 +10,24 @@
 //! \brief	String utilities
 
 #include "Pegasus/Utils/String.h"
+#include "SimdRoutines.h"
+
+//! The SSE2 string routines read whole aligned vectors, past the terminator but never past its page.
+//! The address sanitizer cannot tell those reads from overflows
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define PEGASUS_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+#elif defined(__SANITIZE_ADDRESS__)
+#define PEGASUS_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+#ifndef PEGASUS_NO_SANITIZE_ADDRESS
+#define PEGASUS_NO_SANITIZE_ADDRESS
+#endif
 
 int Pegasus::Utils::Strcmp(const char * str1, const char * str2)
 {
-    while(*str1 && *str2)
-    {
-        int c = *str1++ - *str2++; 
-        if (c != 0)
-        {
-            return c;
-        }
-    }
-    return *str1 ? -*str1 : (*str2 ? *str2 : 0 );
+    return Simd::gRoutines.mStrcmp.load(std::memory_order_relaxed)(str1, str2);
 }
 
 
@@ -44,9 +50,7 @@ int Pegasus::Utils::Stricmp(const char * str1, const char * str2)
 
 unsigned Pegasus::Utils::Strlen(const char * str)
 {
-    int counter = 0;
-    for (; *str; ++str, ++counter);
-    return counter;
+    return static_cast<unsigned>(Simd::gRoutines.mStrlen.load(std::memory_order_relaxed)(str));
 }
 
 const char * Pegasus::Utils::Strchr ( const char * str, char character)
@@ -150,6 +154,24 @@ int Pegasus::Utils::Atoi(const char * str)
     return 0;
 }
 
+int Pegasus::Utils::Atoi(const char * str, int length)
+{
+    const char * end = str + length;
+    int sign = 1;
+    if (str < end && *str == '-')
+    {
+        sign = -1;
+        ++str;
+    }
+    int val = 0;
+    while (str < end && *str >= '0' && *str <= '9')
+    {
+        val = 10*val + (*str - '0');
+        ++str;
+    }
+    return sign * val;
+}
+
 float Pegasus::Utils::Atof(const char * str)
 {
     const char * p = str;
@@ -181,6 +203,38 @@ float Pegasus::Utils::Atof(const char * str)
     return f * sign;
 }
 
+float Pegasus::Utils::Atof(const char * str, int length)
+{
+    const char * p = str;
+    const char * end = str + length;
+    float sign = 1.0f;
+    if (p < end && *p == '-')
+    {
+        sign = -1.0f;
+        ++p;
+    }
+    float f = 0.0;
+    float r = 10.0;
+    bool pastPoint = false;
+    
+    while (p < end)
+    {
+        if (*p == '.')
+        {
+            pastPoint = true;
+        }
+        else
+        {
+            float n = static_cast<float>(*p - '0');
+            f = (pastPoint ? (n / r) : n ) + (pastPoint ? f : (f * 10.0f));
+            r = pastPoint ? r * 10.0f : r;
+        }
+        ++p;
+    }
+
+    return f * sign;
+}
+
 unsigned int Pegasus::Utils::HashStr(const char* str)
 {
     //! djb2
@@ -196,3 +250,143 @@ unsigned int Pegasus::Utils::HashStr(const char* str)
     return hash;
 }
 
+unsigned int Pegasus::Utils::HashStr(const char* str, int length)
+{
+    //same djb2 as the null terminated version, bounded by length
+    unsigned int hash = 5381;
+    for (int i = 0; i < length; ++i)
+    {
+        hash = ((hash << 5) + hash) + str[i]; /* hash * 33 + c */
+    }
+
+    return hash;
+}
+
+bool Pegasus::Utils::Strneq(const char* str1, const char* str2, int length)
+{
+    for (int i = 0; i < length; ++i)
+    {
+        if (str1[i] != str2[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace Pegasus {
+namespace Utils {
+namespace Simd {
+
+size_t StrlenGeneric(const char* str)
+{
+    const char* end = str;
+    for (; *end; ++end);
+    return end - str;
+}
+
+int StrcmpGeneric(const char* str1, const char* str2)
+{
+    while(*str1 && *str2)
+    {
+        int c = *str1++ - *str2++; 
+        if (c != 0)
+        {
+            return c;
+        }
+    }
+    return *str1 ? -*str1 : (*str2 ? *str2 : 0 );
+}
+
+#if PEGASUS_ARCH_X86
+
+//! \return the index of the lowest bit set in a non zero mask
+static inline unsigned int FirstBit(unsigned int mask)
+{
+#if PEGASUS_COMPILER_MSVC
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+}
+
+PEGASUS_TARGET_SSE2 PEGASUS_NO_SANITIZE_ADDRESS size_t StrlenSse2(const char* str)
+{
+    // Aligned loads never cross a page, so reading the whole vector of the terminator is safe
+    const size_t misalignment = reinterpret_cast<size_t>(str) & 15;
+    const __m128i* block = reinterpret_cast<const __m128i*>(str - misalignment);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(block), zero))) >> misalignment;
+    if (mask != 0)
+    {
+        return FirstBit(mask);
+    }
+
+    for (;;)
+    {
+        ++block;
+        mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(block), zero)));
+        if (mask != 0)
+        {
+            return reinterpret_cast<const char*>(block) + FirstBit(mask) - str;
+        }
+    }
+}
+
+//! Size of the smallest memory page, the unaligned vector loads do not cross its boundaries
+static const size_t sPageSize = 4096;
+
+PEGASUS_TARGET_SSE2 PEGASUS_NO_SANITIZE_ADDRESS int StrcmpSse2(const char* str1, const char* str2)
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (;;)
+    {
+        // 16 characters at once while neither string is close to the end of a page
+        if ((reinterpret_cast<size_t>(str1) & (sPageSize - 1)) <= sPageSize - 16 &&
+            (reinterpret_cast<size_t>(str2) & (sPageSize - 1)) <= sPageSize - 16)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str1));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str2));
+            const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(
+                _mm_xor_si128(_mm_cmpeq_epi8(a, b), _mm_set1_epi8(-1)),
+                _mm_cmpeq_epi8(a, zero))));
+            if (mask == 0)
+            {
+                str1 += 16;
+                str2 += 16;
+                continue;
+            }
+
+            // First difference or end of the strings, same results as the generic version
+            const unsigned int index = FirstBit(mask);
+            const char c1 = str1[index];
+            const char c2 = str2[index];
+            if (c1 == 0 || c2 == 0)
+            {
+                return c1 ? -c1 : (c2 ? c2 : 0);
+            }
+            return c1 - c2;
+        }
+
+        // One character at a time over the page boundary
+        const char c1 = *str1++;
+        const char c2 = *str2++;
+        if (c1 == 0 || c2 == 0)
+        {
+            return c1 ? -c1 : (c2 ? c2 : 0);
+        }
+        if (c1 != c2)
+        {
+            return c1 - c2;
+        }
+    }
+}
+
+#endif  // PEGASUS_ARCH_X86
+
+
+}   // namespace Simd
+}   // namespace Utils
+}   // namespace Pegasus
@@ -0,0 +1,128 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   StringInternTable.cpp
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Open addressing hash table mapping string views to a single stored copy.
+
+#include "Pegasus/Utils/StringInternTable.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Allocator/IAllocator.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Utils;
+
+//! initial number of buckets, must be a power of 2
+static const int sInitialCapacity = 64;
+
+StringInternTable::StringInternTable(Alloc::IAllocator* allocator)
+    : mAllocator(allocator),
+      mEntries(nullptr),
+      mCapacity(0),
+      mCount(0)
+{
+}
+
+StringInternTable::~StringInternTable()
+{
+    Reset();
+}
+
+void StringInternTable::SetAllocator(Alloc::IAllocator* allocator)
+{
+    PG_ASSERTSTR(mEntries == nullptr, "Cannot change the allocator of a string intern table in use.");
+    mAllocator = allocator;
+}
+
+const char* StringInternTable::Find(const char* str, int length, unsigned int hash) const
+{
+    if (mCount == 0)
+    {
+        return nullptr;
+    }
+
+    //linear probing. The load factor is kept under 1/2 so there is always an empty bucket.
+    const unsigned int mask = static_cast<unsigned int>(mCapacity - 1);
+    for (unsigned int i = hash & mask; ; i = (i + 1) & mask)
+    {
+        const Entry& e = mEntries[i];
+        if (e.mStr == nullptr)
+        {
+            return nullptr;
+        }
+        else if (e.mHash == hash && e.mLength == length && Utils::Strneq(e.mStr, str, length))
+        {
+            return e.mStr;
+        }
+    }
+}
+
+void StringInternTable::Insert(const char* storedStr, int length, unsigned int hash)
+{
+    PG_ASSERT(storedStr != nullptr);
+    if (2 * (mCount + 1) > mCapacity)
+    {
+        Grow();
+    }
+
+    const unsigned int mask = static_cast<unsigned int>(mCapacity - 1);
+    unsigned int i = hash & mask;
+    while (mEntries[i].mStr != nullptr)
+    {
+        i = (i + 1) & mask;
+    }
+
+    Entry& e = mEntries[i];
+    e.mStr = storedStr;
+    e.mHash = hash;
+    e.mLength = length;
+    ++mCount;
+}
+
+void StringInternTable::Reset()
+{
+    if (mEntries != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mEntries);
+        mEntries = nullptr;
+    }
+    mCapacity = 0;
+    mCount = 0;
+}
+
+void StringInternTable::Grow()
+{
+    int newCapacity = mCapacity == 0 ? sInitialCapacity : 2 * mCapacity;
+    Entry* newEntries = PG_NEW_ARRAY(mAllocator, -1, "StringInternTable", Alloc::PG_MEM_TEMP, Entry, newCapacity);
+    for (int i = 0; i < newCapacity; ++i)
+    {
+        newEntries[i].mStr = nullptr;
+    }
+
+    const unsigned int mask = static_cast<unsigned int>(newCapacity - 1);
+    for (int i = 0; i < mCapacity; ++i)
+    {
+        const Entry& e = mEntries[i];
+        if (e.mStr != nullptr)
+        {
+            unsigned int target = e.mHash & mask;
+            while (newEntries[target].mStr != nullptr)
+            {
+                target = (target + 1) & mask;
+            }
+            newEntries[target] = e;
+        }
+    }
+
+    if (mEntries != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mEntries);
+    }
+    mEntries = newEntries;
+    mCapacity = newCapacity;
+}
@@ -17,6 +17,9 @@
 using namespace Pegasus;
 using namespace Pegasus::Utils;
 
+//! capacity of the first buffer of a vector, in elements
+static const unsigned int sMinCapacity = 16;
+
 BaseVector::BaseVector(Alloc::IAllocator* alloc, unsigned int typeSize)
     : mAlloc(alloc),
       mElementByteSize(typeSize),
@@ -31,34 +34,75 @@ BaseVector::~BaseVector()
     Clear();
 }
 
+void BaseVector::Reallocate(unsigned int count)
+{
+    PG_ASSERT(count >= mDataSize);
+    void* oldData = mData;
+    mData = count == 0 ? nullptr : PG_NEW_ARRAY(mAlloc, -1, "Vector Page", Alloc::PG_MEM_PERM, char, count * mElementByteSize);
+
+    if (oldData != nullptr)
+    {
+        // elements are relocated with a plain copy of their bytes, no constructor or destructor is called
+        Utils::Memcpy(mData, oldData, mDataSize * mElementByteSize);
+        PG_DELETE_ARRAY(mAlloc,  static_cast<char*>(oldData));
+    }
+
+    mDataCount = count;
+}
+
 void* BaseVector::PushEmpty()
 {
     if (mDataCount <= mDataSize)
     {
-        const unsigned int PAGE_SIZE = 64;
-        void* oldData = mData;
-        
-        mData = PG_NEW_ARRAY(mAlloc, -1, "Vector Page", Alloc::PG_MEM_PERM, char, (mDataCount + PAGE_SIZE)*mElementByteSize);
-
-        if (oldData != nullptr)
-        {
-            Utils::Memcpy(mData, oldData, mDataCount*mElementByteSize);
-            PG_DELETE_ARRAY(mAlloc,  static_cast<char*>(oldData));
-        }
-
-        mDataCount += PAGE_SIZE;
+        // geometric growth, so pushing N elements copies O(N) elements in total
+        Reallocate(mDataCount < sMinCapacity ? sMinCapacity : mDataCount * 2);
     }
 
     return static_cast<char*>(mData) + (mDataSize++) * mElementByteSize;
 }
 
+void BaseVector::Reserve(unsigned int count)
+{
+    if (count > mDataCount)
+    {
+        Reallocate(count);
+    }
+}
+
+void BaseVector::ShrinkToFit()
+{
+    if (mDataCount > mDataSize)
+    {
+        Reallocate(mDataSize);
+    }
+}
+
+void BaseVector::Swap(BaseVector& other)
+{
+    PG_ASSERT(mElementByteSize == other.mElementByteSize);
+    void* data = mData;
+    unsigned int dataCount = mDataCount;
+    unsigned int dataSize = mDataSize;
+    Alloc::IAllocator* alloc = mAlloc;
+
+    mData = other.mData;
+    mDataCount = other.mDataCount;
+    mDataSize = other.mDataSize;
+    mAlloc = other.mAlloc;
+
+    other.mData = data;
+    other.mDataCount = dataCount;
+    other.mDataSize = dataSize;
+    other.mAlloc = alloc;
+}
+
 void BaseVector::Delete(unsigned int index)
 {
     PG_ASSERT(index >= 0 && index < mDataSize);
     char* memToDelete = static_cast<char*>(mData) + index * mElementByteSize;
     if (index < mDataSize - 1)
     {
-        Utils::Memcpy(memToDelete, memToDelete + mElementByteSize, (mDataSize - index - 1)*mElementByteSize);
+        Utils::Memmove(memToDelete, memToDelete + mElementByteSize, (mDataSize - index - 1)*mElementByteSize);
     }
     --mDataSize;
 }
@@ -12,6 +12,8 @@
 #ifndef PEGASUS_ALLOC_IALLOCATOR_H
 #define PEGASUS_ALLOC_IALLOCATOR_H
 
+#include <stddef.h>
+
 namespace Pegasus {
 namespace Alloc {
 
@@ -72,7 +72,7 @@ inline T* NewArrayAligned(IAllocator* alloc, Alignment align, Flags flags, unsig
     *((unsigned int*) block) = count;
 
     // Init the array with placement new from beginning to end
-    for (unsigned int i = 0; i < count, i++)
+    for (unsigned int i = 0; i < count; i++)
     {
         new(arrayPtr + i) T();
     }
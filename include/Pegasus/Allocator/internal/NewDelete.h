@@ -72,7 +72,7 @@ void* operator new[] (size_t size, Pegasus::Alloc::IAllocator* allocator, Pegasu
 //! Pegasus delete operator
 //! \param pointer Address of memory to delete
 //! \todo Make sure this function is called properly in a unit test
-void operator delete(void* pointer);
+void operator delete(void* pointer) throw();
 
 //! Pegasus delete operator
 //! \param pointer Address of memory to delete
@@ -12,6 +12,7 @@
 #ifndef RENDER_COLLECTION_H
 #define RENDER_COLLECTION_H
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/HashMap.h"
 #include "Pegasus/BlockScript/FunCallback.h"
 #include "Pegasus/PropertyGrid/PropertyGridObject.h"
 #include "Pegasus/Render/Render.h"
@@ -158,6 +159,7 @@ namespace Application
         {
             const char* mName;
             Utils::Vector<const char*> mProperties;
+            Utils::HashMap<const char*, int, Utils::StringHashTraits> mPropertyIndices; //!< index in mProperties of each property name
         };
 
         //! Constructor
@@ -186,6 +188,9 @@ namespace Application
 
 
         Utils::Vector<PropEntries> mPropLayoutEntries;
+
+        //! index in mPropLayoutEntries of each node type name
+        Utils::HashMap<const char*, unsigned int, Utils::StringHashTraits> mPropLayoutIndices;
         
         Alloc::IAllocator* mAlloc;
     
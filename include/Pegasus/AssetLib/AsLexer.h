@@ -0,0 +1,81 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AsLexer.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Hand written AssetScript lexer. Tokens are scanned straight out of the loaded
+//!         file buffer, and strings are interned in the asset being built.
+
+#ifndef PEGASUS_AS_LEXER_H
+#define PEGASUS_AS_LEXER_H
+
+//fwd declarations
+union YYSTYPE;
+
+namespace Pegasus
+{
+namespace AssetLib
+{
+    class AssetBuilder;
+
+    //! AssetScript lexer, feeds tokens to the bison parser through AS_lex
+    class AsLexer
+    {
+    public:
+        //! Constructor
+        //! \param builder the asset builder, owner of the strings scanned
+        explicit AsLexer(AssetBuilder* builder);
+
+        //! Destructor
+        ~AsLexer() {}
+
+        //! Starts lexing a buffer. The buffer is not copied, it must stay alive until lexing is done.
+        //! \param buffer the text to lex, does not need to be null terminated
+        //! \param bufferSize the size of the text in bytes
+        void Begin(const char* buffer, int bufferSize);
+
+        //! Scans the next token
+        //! \param lval the semantic value of the token, filled for numbers and strings
+        //! \return the token id, 0 if the end of the text is reached or an error terminated lexing
+        int Lex(YYSTYPE* lval);
+
+        //! \return true if there is still text to lex, false otherwise
+        bool HasNext() const { return !mTerminated && mCursor < mEnd; }
+
+        //! Lexes all the text, discarding the tokens. Used to measure lexer throughput.
+        //! \return the number of tokens scanned
+        int LexAll();
+
+        //! \return the builder this lexer feeds
+        AssetBuilder* GetBuilder() const { return mBuilder; }
+
+    private:
+        //! Captures a string, the cursor being right after the opening character
+        //! \param terminator the character closing the string
+        //! \return the interned string, nullptr if an error stopped lexing
+        const char* CaptureString(char terminator);
+
+        //! Interns a word or a string. Stops lexing if the string does not fit
+        //! \return the interned string, nullptr if an error stopped lexing
+        const char* Intern(const char* str, int length);
+
+        AssetBuilder* mBuilder;
+        const char* mCursor;
+        const char* mEnd;
+        bool mTerminated;
+        char mStringAccumulator[512];
+    };
+}
+}
+
+//! Bison lexer hook
+//! \param lval the semantic value of the token
+//! \param scanner the AsLexer
+//! \return the token id
+int AS_lex(YYSTYPE* lval, void* scanner);
+
+#endif
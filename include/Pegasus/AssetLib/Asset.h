@@ -127,6 +127,12 @@ public:
     //! Copies a string passed in, whose lifetime is this assets object
     const char* CopyString(const char* string);
 
+    //! Copies a string view (not null terminated) passed in, whose lifetime is this assets object
+    //! \param string the first character of the view
+    //! \param length the number of characters to copy
+    //! \return the null terminated copy, nullptr if the string does not fit in a string page
+    const char* CopyString(const char* string, int length);
+
     //! Resets this asset internally (destroys all internal memory and makes it an empty asset)
     void Clear();
 
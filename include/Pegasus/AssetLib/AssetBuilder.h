@@ -14,6 +14,7 @@
 
 #include "Pegasus/Memory/BlockAllocator.h"
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/StringInternTable.h"
 
 //fwd declarations
 namespace Pegasus
@@ -84,6 +85,13 @@ public:
     //! \return the string copied
     const char* CopyString(const char* string);
 
+    //! Interns a string view read by the lexer. The first occurrence gets copied into the asset,
+    //! every following occurrence of the same text returns the same copy
+    //! \param string the first character of the view, does not need to be null terminated
+    //! \param length the number of characters of the view
+    //! \return the interned string, nullptr if the string is too long
+    const char* InternString(const char* string, int length);
+
     //! Increments the current line being processed in the asset script file (json)
     void IncLine() { ++mCurrentLine; }
 
@@ -128,6 +136,8 @@ private:
     Utils::Vector<ObjectChildAssetRequest> mObjectChildAssetQueue;
     Utils::Vector<ArrayChildAssetRequest>  mArrayChildAssetQueue;
 
+    Utils::StringInternTable mInternTable;
+
     Asset*  mFinalAsset;
     int     mCurrentLine;
     int     mErrorCount;
@@ -15,6 +15,7 @@
 #include "Pegasus/AssetLib/RuntimeAssetObject.h"
 #include "Pegasus/AssetLib/AssetBuilder.h"
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/HashMap.h"
 #include "Pegasus/Core/Io.h"
 #include "Pegasus/PegasusAssetTypes.h"
 #include "Pegasus/AssetLib/Shared/AssetEvent.h"
@@ -173,6 +174,13 @@ public:
 
 
 private:
+    //! Hash traits of the asset paths, case insensitive and treating / and \\ as the same character
+    struct PathHashTraits
+    {
+        static unsigned int Hash(const char* path);
+        static bool Equal(const char* path1, const char* path2);
+    };
+
     Pegasus::AssetLib::AssetRuntimeFactory* FindFactory(Asset* asset, const char* ext, const PegasusAssetTypeDesc** outDesc) const;
     Io::IoError InternalBuildAsset(Asset** memory, bool isStructured, const char* path);   
 
@@ -186,6 +194,7 @@ private:
     AssetBuilder   mBuilder;
     Io::IOManager* mIoMgr;
     Utils::Vector<Asset*> mAssets;
+    Utils::HashMap<const char*, Asset*, PathHashTraits> mAssetsByPath; //!< loaded assets, keyed by the path they own
     Utils::Vector<AssetRuntimeFactory*> mFactories;
 
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
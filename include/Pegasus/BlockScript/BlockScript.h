@@ -14,6 +14,7 @@
 
 #include "Pegasus/BlockScript/BlockScriptCompiler.h"
 #include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/BlockScript/TypeDesc.h"
 #include "Pegasus/Utils/Vector.h"
 
 namespace Pegasus
@@ -24,6 +25,48 @@ namespace BlockScript
 
 class BlockLib;
 
+//! Copy of the globals of a vm state, together with the layout of the global frame that produced them.
+//! Used to keep the globals of a running script alive across a recompilation, see BlockScript::HotSwap.
+class GlobalStateSnapshot
+{
+    friend class BlockScript;
+public:
+    //! Constructor
+    //! \param allocator the allocator used for the global memory copy
+    explicit GlobalStateSnapshot(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    ~GlobalStateSnapshot();
+
+    //! \return true if globals have been captured, false otherwise
+    bool IsValid() const { return mIsValid; }
+
+    //! Releases the captured globals
+    void Clear();
+
+private:
+    //no copies of a snapshot
+    GlobalStateSnapshot(const GlobalStateSnapshot&);
+    GlobalStateSnapshot& operator=(const GlobalStateSnapshot&);
+
+    //! Global variable of the captured frame
+    struct Entry
+    {
+        char mName[IddStrPool::sCharsPerString];
+        char mTypeName[TypeDesc::sMaxTypeName];
+        int  mOffset;
+        int  mByteSize;
+    };
+
+    Alloc::IAllocator* mAllocator;
+    Utils::Vector<Entry> mEntries;
+    char* mMemory;
+    int   mMemorySize;
+    int   mMemoryCapacity;
+    unsigned int mGlobalScopeHash;
+    bool  mIsValid;
+};
+
 //! Main API entry point for blockscript executables
 class BlockScript : public BlockScriptCompiler
 {
@@ -44,6 +87,30 @@ public:
     //! Runs the block script
     void Run(BsVmState* vmState); 
 
+    //! Result of a hot swap
+    enum HotSwapResult
+    {
+        HOTSWAP_FAILED,    //!< the global scope code changed, the script has to be run again
+        HOTSWAP_PRESERVED, //!< the global layout is the same, all the globals memory has been kept
+        HOTSWAP_MIGRATED   //!< the global layout changed, globals have been copied by name and type
+    };
+
+    //! Captures the globals of a vm state that ran this script. Call before recompiling.
+    //! Heap strings of the state are detached from this script, since its memory is about to be released.
+    //! \param vmState the state, which must have its global frame alive
+    //! \param snapshot output of the globals captured
+    //! \return true if the globals got captured, false if there is no global frame to capture
+    bool CaptureGlobals(BsVmState* vmState, GlobalStateSnapshot& snapshot);
+
+    //! Swaps the compiled code under a vm state, without running the global scope again.
+    //! Function bodies are taken from the new compilation. Globals are restored from the snapshot,
+    //! which only succeeds if the code of the global scope (anything outside functions) did not change.
+    //! On failure the state is left untouched, and the caller is expected to Reset it and Run this script.
+    //! \param vmState the state that ran the script captured
+    //! \param snapshot the globals captured before compiling this script
+    //! \return the result of the swap
+    HotSwapResult HotSwap(BsVmState* vmState, const GlobalStateSnapshot& snapshot);
+
     //! Compiles a file string buffer into block script
     //! \param fb the file buffer containing the script
     //! \return true if successful, false otherwise
@@ -96,6 +163,9 @@ public:
 
 
 private:
+    //! \return the hash of all the code in the global scope, function bodies excluded
+    unsigned int ComputeGlobalScopeHash();
+
     // Virtual machine (state of this vm is pushed by the user through BsVmState class)
     BsVm      mVm;
     BlockLib* mRuntimeLib;
@@ -460,8 +460,15 @@ private:
 class StmtStructDef : public Stmt
 {
 public:
+    //! Memory layout of the struct members
+    enum Layout
+    {
+        LAYOUT_PACKED, //!< members are tightly packed, the default
+        LAYOUT_STD140  //!< members follow the std140 uniform block rules, so the struct can be uploaded to a uniform buffer as is
+    };
+
     StmtStructDef(const char* structName, ArgList* argList)
-        : mName(structName), mArgList(argList), mFrameInfo(nullptr)
+        : mName(structName), mArgList(argList), mFrameInfo(nullptr), mAnnotations(nullptr), mLayout(LAYOUT_PACKED)
     {
     }
 
@@ -477,12 +484,22 @@ public:
 
     void SetFrameInfo(StackFrameInfo* frameInfo) { mFrameInfo = frameInfo; }
 
+    Annotations* GetAnnotations() const { return mAnnotations; }
+
+    void SetAnnotations(Annotations* annotations) { mAnnotations = annotations; }
+
+    Layout GetLayout() const { return mLayout; }
+
+    void SetLayout(Layout layout) { mLayout = layout; }
+
     VISITOR_ACCESS
 
 private:
     const char* mName;
     ArgList*    mArgList;
     StackFrameInfo* mFrameInfo;
+    Annotations* mAnnotations;
+    Layout mLayout;
 };
 
 //! function declarator
@@ -490,7 +507,7 @@ class StmtFunDec : public Stmt
 {
 public:
 
-    StmtFunDec(ArgList* argList, const TypeDesc* retType, const char* name) : mArgList(argList), mStmtList(nullptr), mName(name), mReturnType(retType), mFrame(nullptr), mDesc(nullptr) {}
+    StmtFunDec(ArgList* argList, const TypeDesc* retType, const char* name) : mArgList(argList), mStmtList(nullptr), mName(name), mReturnType(retType), mFrame(nullptr), mDesc(nullptr), mCompilationUnitTitle(nullptr), mLine(0) {}
 
     virtual ~StmtFunDec() {}
 
@@ -512,6 +529,13 @@ public:
     
     void SetStmtList(StmtList* stmtList) { mStmtList = stmtList; }
 
+    //! Sets where this function got declared, used for diagnostics after parsing
+    void SetLocation(const char* compilationUnitTitle, int line) { mCompilationUnitTitle = compilationUnitTitle; mLine = line; }
+
+    const char* GetCompilationUnitTitle() const { return mCompilationUnitTitle; }
+
+    int GetLine() const { return mLine; }
+
     VISITOR_ACCESS
 
 private:
@@ -527,6 +551,10 @@ private:
     StackFrameInfo*  mFrame;
 
     FunDesc* mDesc;
+
+    const char* mCompilationUnitTitle;
+
+    int mLine;
 };
 
 class StmtWhile : public Stmt
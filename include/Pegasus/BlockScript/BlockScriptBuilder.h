@@ -115,7 +115,7 @@ public:
     Ast::StmtFunDec* BindFunImplementation(Ast::StmtFunDec* funDec, Ast::StmtList* stmts);
     Ast::StmtIfElse* BuildStmtIfElse(Ast::Exp* exp, Ast::StmtList* ifBlock, Ast::StmtIfElse* tail, StackFrameInfo* frame);
     Ast::Exp*        BuildStaticArrayDec(const TypeDesc* arrayType);
-    Ast::StmtStructDef* BuildStmtStructDef(const char* name, Ast::ArgList* definitions);
+    Ast::StmtStructDef* BuildStmtStructDef(const char* name, Ast::ArgList* definitions, Ast::Annotations* annotations = nullptr);
     Ast::StmtEnumTypeDef* BuildStmtEnumTypeDef(const TypeDesc* type);
     Ast::ArgDec* BuildArgDec(const char* var, const TypeDesc* type);
     Ast::Exp* BuildStrImm(const char* strToCopy);
@@ -212,6 +212,17 @@ private:
     //! \return true if operation is valid for this type, false otherwise
     bool IsBinopValid(const TypeDesc* type, int op);
 
+    //! Parses the annotations of a struct definition and sets the layout requested
+    //! \param structDef the struct definition
+    //! \param annotations the annotations of the struct, can be null
+    //! \return true if success, false if the annotations are invalid
+    bool ParseStructLayout(Ast::StmtStructDef* structDef, Ast::Annotations* annotations);
+
+    //! Computes the offset of every member of a struct and validates them against its layout rules
+    //! \param structDef the struct definition, with its layout set
+    //! \return true if success, false if a member cannot be laid out
+    bool ComputeStructOffsets(Ast::StmtStructDef* structDef);
+
     //! Is this in an annotation context?
     bool IsInAnnotation() const { return mCurrAnnotations != nullptr; }
     
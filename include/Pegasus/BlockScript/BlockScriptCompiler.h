@@ -18,6 +18,7 @@
 #include "Pegasus/BlockScript/FunCallback.h"
 #include "Pegasus/BlockScript/Container.h"
 #include "Pegasus/BlockScript/Preprocessor.h"
+#include "Pegasus/BlockScript/CostEstimator.h"
 #include "Pegasus/Memory/BlockAllocator.h"
 
 
@@ -126,6 +127,22 @@ public:
     //! \return the includer to get.
     IFileIncluder* GetFileIncluder() const { return mFileIncluder; }
 
+    //! Sets the frame budget of functions, in canon instructions. After a successful compilation,
+    //! every function which estimated cost exceeds the budget triggers a compilation warning.
+    //! \param budget - the budget, 0 disables the lint
+    void SetCostBudget(int budget) { mCostBudget = budget; }
+
+    //! \return the frame budget of functions, 0 if the lint is disabled
+    int GetCostBudget() const { return mCostBudget; }
+
+    //! Gets the cost estimator, to tweak native function costs or to query the costs computed
+    //! \return the cost estimator
+    CostEstimator* GetCostEstimator() { return &mCostEstimator; }
+
+    //! Estimates the cost of the functions of the last successful compilation
+    //! and triggers warnings for the ones exceeding the cost budget.
+    void EstimateCosts();
+
 protected:
     BlockScriptBuilder       mBuilder;
 
@@ -136,6 +153,8 @@ private:
     Assembly                 mAsm;
     IFileIncluder*           mFileIncluder;
     Container<Preprocessor::Definition>   mDefinitionList;
+    CostEstimator            mCostEstimator;
+    int                      mCostBudget;
     const char* mTitle;
 };
 
@@ -0,0 +1,151 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BsLexer.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Hand written BlockScript lexer. Tokens are scanned straight out of the loaded
+//!         file buffer (and macro / include buffers) without copying them into a lexer buffer.
+//!         Identifiers are interned in the builder string pool, so each unique name is copied once.
+
+#ifndef PEGASUS_BS_LEXER_H
+#define PEGASUS_BS_LEXER_H
+
+#include "Pegasus/BlockScript/Preprocessor.h"
+#include "Pegasus/Utils/Vector.h"
+
+//fwd declarations
+union YYSTYPE;
+
+namespace Pegasus
+{
+    namespace Alloc
+    {
+        class IAllocator;
+    }
+
+namespace BlockScript
+{
+    class CompilerState;
+
+    //! BlockScript lexer, feeds tokens to the bison parser through BS_lex
+    class BsLexer
+    {
+    public:
+        //! Constructor
+        //! \param state the compiler state, holding the builder and the preprocessor
+        //! \param allocator allocator used for the internal buffer stack
+        BsLexer(CompilerState* state, Alloc::IAllocator* allocator);
+
+        //! Destructor
+        ~BsLexer();
+
+        //! Starts lexing a buffer. The buffer is not copied, it must stay alive until lexing is done.
+        //! \param buffer the text to lex, does not need to be null terminated
+        //! \param bufferSize the size of the text in bytes
+        void Begin(const char* buffer, int bufferSize);
+
+        //! Scans the next token
+        //! \param lval the semantic value of the token, filled for numbers, strings and identifiers
+        //! \return the token id, 0 if the end of the text is reached or an error terminated lexing
+        int Lex(YYSTYPE* lval);
+
+        //! \return true if there is still text to lex in the root buffer, false otherwise
+        bool HasNext() const;
+
+        //! Lexes all the text, discarding the tokens. Used to measure lexer throughput.
+        //! \return the number of tokens scanned
+        int LexAll();
+
+        //! \return the compiler state this lexer feeds
+        CompilerState* GetCompilerState() const { return mState; }
+
+        //! Gets the text of the last token scanned. Only meant for error reporting, since it copies the token.
+        //! \return null terminated token text
+        const char* GetTokenText();
+
+    private:
+        //! Lexer modes, mirroring the preprocessor flow
+        enum Mode
+        {
+            MODE_CODE,              //!< regular code
+            MODE_PREPROCESSOR,      //!< after a # character, parsing a preprocessor command
+            MODE_DEFINE_CAPTURE,    //!< capturing the value of a define, up to the end of the line
+            MODE_IGNORE_CODE        //!< skipping code of an inactive ifdef block
+        };
+
+        //! Input source. The root file, a macro being expanded or an included file
+        struct Source
+        {
+            const char* mCursor;
+            const char* mEnd;
+            const Preprocessor::Definition* mDef;
+        };
+
+        //! Scans a token in code mode
+        //! \return the token, -1 if a token was not produced and scanning should continue
+        int LexCode(YYSTYPE* lval);
+
+        //! Scans input in preprocessor mode
+        void LexPreprocessor();
+
+        //! Captures input of a define command
+        void LexDefineCapture();
+
+        //! Skips input of an inactive code block
+        void LexIgnoreCode();
+
+        //! Processes the end of line of a preprocessor command
+        void EndPreprocessorLine();
+
+        //! Processes a word found in preprocessor mode
+        void PreprocessorWord(const char* word, int length);
+
+        //! Processes a word found in code mode
+        //! \return the token, -1 if the word was a macro that got expanded
+        int CodeWord(YYSTYPE* lval, const char* word, int length);
+
+        //! Skips a comment starting at the cursor. Line comments leave the end of line unconsumed.
+        //! \return true if a comment was skipped, false if the cursor is not at a comment
+        bool SkipComment();
+
+        //! Captures a string literal, the cursor being right after the opening quote
+        //! \return true if success, false if the string is too long
+        bool CaptureString();
+
+        //! Pushes a new input source
+        void PushSource(const char* buffer, int bufferSize, const Preprocessor::Definition* def);
+
+        //! Pops the current input source
+        //! \return false if the current source is the root buffer
+        bool PopSource();
+
+        //! Reports an error to the builder and stops lexing
+        void Error(const char* message);
+
+        //! Pops the mode stack of the compiler state
+        void PopMode();
+
+        CompilerState* mState;
+        Utils::Vector<Source> mSourceStack;
+        Source mRoot;
+        Source* mSource;
+        Mode  mMode;
+        bool  mTerminated;
+        const char* mTokenStart;
+        int   mTokenLength;
+        char  mTokenText[64];
+    };
+}
+}
+
+//! Bison lexer hook
+//! \param lval the semantic value of the token
+//! \param scanner the BsLexer
+//! \return the token id
+int BS_lex(YYSTYPE* lval, void* scanner);
+
+#endif
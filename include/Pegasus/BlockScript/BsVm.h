@@ -55,6 +55,15 @@ public:
     //! Resets the state of this structure
     void Reset();
 
+    //! Resets the stack and registers, keeping the heap elements alive.
+    //! Used when the globals of a script are going to be restored on top of a new compilation.
+    void ResetStack();
+
+    //! Copies all the strings referenced by the heap into memory owned by this state.
+    //! Heap strings point to literals of the assembly that pushed them, so call this before
+    //! that assembly gets destroyed if this state has to outlive it.
+    void DetachHeapStrings();
+
     //! Sets the user context (to be acquired by callbacks in the need of so).
     void SetUserContext(void* userContext) { mUserContext = userContext; }
 
@@ -140,6 +149,15 @@ private:
 
     //! Runtime listener
     IRuntimeListener* mRuntimeListener;
+
+    //! strings owned by this state, copied from the heap on DetachHeapStrings
+    Container<char*> mDetachedStrings;
+
+    //! count of heap elements already pointing to detached strings
+    int mDetachedHeapSize;
+
+    //! frees all the detached strings
+    void FreeDetachedStrings();
 };
 
 //actual virtual machine modifying the state
@@ -19,11 +19,6 @@
 //fwd declarations
 namespace Pegasus
 {
-    namespace Io
-    {
-        class FileBuffer;
-    }
-    
     namespace BlockScript
     {
         class BlockScriptBuilder;
@@ -43,28 +38,16 @@ namespace BlockScript
     class CompilerState 
     {
     public:
-        struct DefineBufferEl
-        {
-            int  mBufferPosition;
-            void* mLexerBufferId;
-            const BlockScript::Preprocessor::Definition* mDef;
-        };
-
-        BlockScript::Preprocessor mPreprocessor;
-        BlockScript::BlockScriptBuilder* mBuilder;
-        int mBufferPosition;
-        const Io::FileBuffer* mFileBuffer;
+        Preprocessor mPreprocessor;
+        BlockScriptBuilder* mBuilder;
         char mStringAccumulator[512];
         int  mStringAccumulatorPos;
 
         CompilerState(Alloc::IAllocator* allocator)
         : mBuilder(nullptr),
-          mBufferPosition(0),
-          mFileBuffer(nullptr),
           mStringAccumulatorPos(0),
           mPreprocessor(allocator),
-          mLexerStack(allocator),
-          mDefineBufferStack(allocator)
+          mLexerStack(allocator)
         {
         }
 
@@ -74,20 +57,11 @@ namespace BlockScript
 
         int  GetLexerState();
 
-        BlockScript::Preprocessor& GetPreprocessor() { return mPreprocessor; }
-
-        void PushDefineStack(void* bufferId, const BlockScript::Preprocessor::Definition* def);
-
-        int  GetDefineStackCount() const;
-
-        DefineBufferEl* GetDefineStackTop();
-
-        void* PopDefineStack();
+        Preprocessor& GetPreprocessor() { return mPreprocessor; }
 
     private:
 
         Utils::Vector<int>  mLexerStack;
-        Utils::Vector<DefineBufferEl>     mDefineBufferStack;
     };
 }
 }
@@ -17,7 +17,9 @@
 #include "Pegasus/Core/Assertion.h"
 #include <new>
 
-#define CONTAINER_PAGE_SZ 32
+//! elements per page, a power of 2 so the element lookup is a shift and a mask
+#define CONTAINER_PAGE_SHIFT 5
+#define CONTAINER_PAGE_SZ (1 << CONTAINER_PAGE_SHIFT)
 
 namespace Pegasus
 {
@@ -106,13 +108,8 @@ namespace BlockScript
     {
         int s = Size();
         PG_ASSERT(i >= 0 && i < s);
-        char** ps = GetMemoryPages();
-        int memsz = GetMemorySize();
-        int pageSize = GetPageSize();
-		int offset = (i * sizeof(T));
-        int pageId =  offset / (pageSize);
-        char* page = ps[pageId];
-        return *reinterpret_cast<T*>(page + (offset % pageSize));
+        char* page = GetMemoryPages()[i >> CONTAINER_PAGE_SHIFT];
+        return *reinterpret_cast<T*>(page + (i & (CONTAINER_PAGE_SZ - 1)) * sizeof(T));
     };
 
     template<class T>
@@ -120,13 +117,8 @@ namespace BlockScript
     {
         int s = Size();
         PG_ASSERT(i >= 0 && i < s);
-        char** const ps = GetMemoryPagesConst();
-        int memsz = GetMemorySize();
-        int pageSize = GetPageSize();
-		int offset = (i * sizeof(T));
-        int pageId =  offset / (pageSize);
-        const char* page = ps[pageId];
-        return *reinterpret_cast<const T*>(page + (offset % pageSize));
+        const char* page = GetMemoryPagesConst()[i >> CONTAINER_PAGE_SHIFT];
+        return *reinterpret_cast<const T*>(page + (i & (CONTAINER_PAGE_SZ - 1)) * sizeof(T));
     };
 
     template <class T>
@@ -145,7 +137,10 @@ namespace BlockScript
     void Container<T>::Pop()
     {
         PG_ASSERTSTR(Size() > 0, "Nothing to pop! memory corruption to follow.");
+        (*this)[mSize - 1].~T();
         --mSize;
+        //give the slot back, so the next push reuses it
+        Rewind(mSize >> CONTAINER_PAGE_SHIFT, (mSize & (CONTAINER_PAGE_SZ - 1)) * sizeof(T));
     }
 };
 
@@ -0,0 +1,137 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CostEstimator.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Static cost estimation of blockscript functions. Costs are measured in canon
+//!         instructions, with native calls weighted by a per function cost table.
+
+#ifndef PEGASUS_BLOCKSCRIPT_COST_ESTIMATOR_H
+#define PEGASUS_BLOCKSCRIPT_COST_ESTIMATOR_H
+
+#include "Pegasus/BlockScript/IVisitor.h"
+#include "Pegasus/BlockScript/Container.h"
+
+namespace Pegasus
+{
+
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace BlockScript
+{
+
+class FunDesc;
+
+//! Estimated cost of a piece of code. The cost is mFixedCost + N * mPerIterationCost,
+//! where N is the trip count of the loops that could not be resolved at compile time.
+struct FunCost
+{
+    int  mFixedCost;        //!< cost of the code, loops with a known trip count included
+    int  mPerIterationCost; //!< cost of an iteration of the loops with an unknown trip count
+    bool mIsUnbounded;      //!< true if there is recursion or nested unknown loops, the cost has no static bound
+
+    FunCost() : mFixedCost(0), mPerIterationCost(0), mIsUnbounded(false) {}
+};
+
+//! Walks the abstract syntax tree and computes an upper bound cost for every function
+class CostEstimator : private IVisitor
+{
+public:
+
+    //! cost of a native function call not found in the cost table
+    static const int sDefaultNativeCost = 4;
+
+    //! trip count assumed for loops with unknown trip count when checking a budget
+    static const int sAssumedTripCount = 16;
+
+    //! Constructor
+    CostEstimator();
+
+    //! Destructor
+    virtual ~CostEstimator();
+
+    //! \param alloc allocator for the internal containers
+    void Initialize(Alloc::IAllocator* alloc);
+
+    //! Sets the cost of a native function, in canon instructions. Overrides the default cost table entry.
+    //! \param funName the name of the native function. The string must be kept alive externally.
+    //! \param cost the cost of a call
+    void SetNativeCost(const char* funName, int cost);
+
+    //! Computes the cost of all the functions with a body in the program
+    //! \param program the program to walk
+    void Estimate(Ast::Program* program);
+
+    //! Clears all the function costs computed
+    void Reset();
+
+    //! \return the number of functions which cost has been computed
+    int GetFunctionCount() const { return mFunctions.Size(); }
+
+    //! \param i the index of the function
+    //! \return the function declaration
+    const Ast::StmtFunDec* GetFunction(int i) const { return mFunctions[i].mFunDec; }
+
+    //! \param i the index of the function
+    //! \return the cost of the function
+    const FunCost& GetCost(int i) const { return mFunctions[i].mCost; }
+
+    //! Checks a cost against a budget. Unknown loops are assumed to run sAssumedTripCount times.
+    //! \param cost the cost to check
+    //! \param budget the budget in canon instructions
+    //! \return true if the cost exceeds the budget, false otherwise
+    static bool ExceedsBudget(const FunCost& cost, int budget);
+
+private:
+    // visitor functions
+    #define BS_PROCESS(N) virtual void Visit(Ast::N*);
+    #include "Pegasus/BlockScript/Ast.inl"
+    #undef BS_PROCESS
+
+    //! visits a node and returns its cost
+    FunCost Eval(Ast::Node* node);
+
+    //! computes the cost of a function, memoized
+    FunCost EvalFunction(const Ast::StmtFunDec* funDec);
+
+    //! \return the cost of a native function call
+    int GetNativeCost(const char* funName) const;
+
+    //! \return the trip count of a for loop, -1 if it cannot be determined statically
+    static int GetTripCount(Ast::StmtFor* forLoop);
+
+    enum FunctionState
+    {
+        FUNCTION_IN_PROGRESS,
+        FUNCTION_DONE
+    };
+
+    struct FunctionEntry
+    {
+        const Ast::StmtFunDec* mFunDec;
+        FunCost mCost;
+        FunctionState mState;
+    };
+
+    struct NativeCostEntry
+    {
+        const char* mName;
+        int mCost;
+    };
+
+    Container<FunctionEntry> mFunctions;
+    Container<NativeCostEntry> mNativeCosts;
+    FunCost mResult;
+};
+
+}
+}
+
+#endif
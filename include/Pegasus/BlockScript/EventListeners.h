@@ -44,6 +44,12 @@ public:
     //! \param errorMessage the actual error message
     virtual void OnCompilationError(const char* compilationUnitTitle, int line, const char* errorMessage, const char* token) = 0;
 
+    //! Triggered when there is a compilation warning. Warnings do not fail compilation.
+    //! \param compilationUnitTitle the title of the compilation unit
+    //! \param line the line of the warning
+    //! \param warningMessage the actual warning message
+    virtual void OnCompilationWarning(const char* compilationUnitTitle, int line, const char* warningMessage) {}
+
     //! Triggered at compile time on a function call. Use this function to evaluate at compile time
     //! any function calls.
     //! funcall - function call abstract syntax tree element to process.
@@ -14,6 +14,7 @@
 
 #include "Pegasus/BlockScript/Container.h"
 #include "Pegasus/BlockScript/FunDesc.h"
+#include "Pegasus/Utils/InternedString.h"
 
 namespace Pegasus
 {
@@ -67,8 +68,20 @@ public:
     int GetSize() const { return mContainer.Size(); }
 
 private:
+    //! \return the index of the first function with this name, -1 if none
+    int FindFirstOverload(const char* name) const;
+
     Container<FunDesc> mContainer;
 
+    //! for each function, index of the next function with the same name, -1 at the end of the list
+    Container<int> mNextOverloads;
+
+    //! copies of the function names, the declarations can be released before the table
+    Utils::StringInterner mNames;
+
+    //! index of the first function of each name
+    Utils::HashMap<Utils::InternedString, int> mFirstOverloads;
+
 };
 
 }
@@ -12,6 +12,8 @@
 #ifndef IDD_STR_POOL_H
 #define IDD_STR_POOL_H
 
+#include "Pegasus/Utils/StringInternTable.h"
+
 namespace Pegasus
 {
 
@@ -51,6 +53,13 @@ public:
     //! Allocates a string in the cached pages
     char* AllocateString();
 
+    //! Interns a string view. The first occurrence of a string gets copied into the cached pages,
+    //! every following occurrence returns the same copy
+    //! \param str the string view, does not need to be null terminated
+    //! \param length the number of characters of the view, must be less than sCharsPerString
+    //! \return the null terminated pooled string, nullptr if out of memory
+    char* Intern(const char* str, int length);
+
     //! Get page count
     int GetPageCount() const { return mStringCount == 0 ? 0 : (mStringCount / sMaxStringsPerPages + 1); }
 
@@ -64,6 +73,7 @@ private:
     Alloc::IAllocator* mAllocator;
     char* mPages[sMaxPages];
     int   mStringCount;
+    Utils::StringInternTable mInternTable;
 
     
 };
@@ -106,6 +106,13 @@ public:
     //! \return gets the parent stack frame id
     StackFrameInfo* GetParentStackFrame() const { return mParent; }
 
+    //! \return the number of declarations in this frame
+    int GetEntryCount() const { return mEntries.Size(); }
+
+    //! \param i the index of the declaration
+    //! \return the declaration entry
+    const Entry& GetEntry(int i) const { return mEntries[i]; }
+
 private:
     int mSize; 
     int mTempSize;
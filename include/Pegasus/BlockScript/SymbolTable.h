@@ -129,6 +129,14 @@ public:
     //! \return the star type created
     TypeDesc* CreateStarType();
 
+    //! Creates a typed * type, which only accepts static arrays of a child type (i.e. float4*). Used only in c++ callbacks.
+    //! The callback receives the address of the array, the array size is found in the type of the argument expression.
+    //! \param name the name of the type
+    //! \param childType the element type of the arrays accepted
+    //! \param count the number of elements of the array bound to the star. 0 for the type used in function signatures
+    //! \return the star type created
+    TypeDesc* CreateStarType(const char* name, TypeDesc* childType, int count = 0);
+
     //! Creates a static array type.
     //! \param name the name of this array. Irrelevant though, since the arrays are found using the array parsing identifiers notation
     //! \param childType the child type of the array (meaning the basic type)
@@ -108,6 +108,7 @@ public:
         M_REFERECE, // custom c++ object reference
         M_STAR      // only used in c++ callbacks, not in blockscript, grabs the pointer of whichever input is passed.
                     // the actual type is actually recorded in the funcall list passed in the FunCallback
+                    // a star with a child type (i.e. float4*) only accepts static arrays of such child type
     };
 
     //! only Types that use arithmetic and logical operations. 
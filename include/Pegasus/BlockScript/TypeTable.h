@@ -12,6 +12,7 @@
 #define PEGASUS_TYPETABLE_H
 #include "Pegasus/BlockScript/TypeDesc.h"
 #include "Pegasus/BlockScript/Container.h"
+#include "Pegasus/Utils/HashMap.h"
 
 namespace Pegasus
 {
@@ -96,7 +97,17 @@ public:
     const TypeDesc* GetTypeByIndex(int index) const { return &mTypeDescPool[index]; }
 
 private:
+    //! \return the index of the first non array type with this name, -1 if none
+    int FindFirstTypeIndex(const char* name) const;
+
     Container<TypeDesc> mTypeDescPool;
+
+    //! for each type, index of the next non array type with the same name, -1 at the end of the list
+    Container<int> mNextTypeWithName;
+
+    //! index of the first non array type of each name, keyed by the name stored in the type
+    Utils::HashMap<const char*, int, Utils::StringHashTraits> mFirstTypeWithName;
+
     Container<EnumNode> mEnumNodePool;
     Container<PropertyNode> mPropertyNodePool;
 };
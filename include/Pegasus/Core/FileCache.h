@@ -0,0 +1,173 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FileCache.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Size bounded cache of binary blobs on disk, keyed by 64 bit hashes
+
+#ifndef PEGASUS_CORE_FILECACHE_H
+#define PEGASUS_CORE_FILECACHE_H
+
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Utils/Vector.h"
+
+namespace Pegasus {
+namespace Io {
+
+//! Cache of binary blobs stored as files of the asset root, one file per key.
+//! When the files exceed the size budget, the least recently used entries are deleted.
+//! The index of the entries is saved next to the files, so the cache persists across runs.
+//! All the functions can be called from any thread.
+class FileCache
+{
+public:
+
+    //! Constructor, the cache is disabled until initialized
+    //! \param allocator Allocator used for the index of the entries
+    explicit FileCache(Alloc::IAllocator* allocator);
+
+    //! Destructor, saves the index of the entries
+    ~FileCache();
+
+    //! Enable the cache, loading the index saved by the last run
+    //! \param ioManager IO manager used to access the files, must outlive the cache or the next Initialize() call
+    //! \param prefix Prefix of the names of the cache files, relative to the asset root
+    //! \param maxSize Size budget of the cache files in bytes
+    void Initialize(IOManager* ioManager, const char* prefix, unsigned long long maxSize);
+
+    //! Disable the cache, saving the index of the entries. The cache files are kept
+    void Shutdown();
+
+    //! \return True if the cache has been initialized
+    inline bool IsEnabled() const { return mIoManager != nullptr; }
+
+    //! Load the blob of a key
+    //! \param key Key of the blob
+    //! \param fileBuffer Buffer receiving the cache file, allocated with alloc and owned by the caller
+    //! \param alloc Allocator of the file buffer
+    //! \param payloadSize Receives the size of the blob in bytes
+    //! \return Blob inside the file buffer, nullptr if the key is not in the cache
+    //!         or if its blob is being stored by another thread
+    const char* Load(unsigned long long key, FileBuffer& fileBuffer, Alloc::IAllocator* alloc, int& payloadSize);
+
+    //! Store the blob of a key, replacing any blob already stored for the key,
+    //! then evict the least recently used entries exceeding the size budget
+    //! \param key Key of the blob
+    //! \param payload Bytes of the blob
+    //! \return True if the blob has been written, false if the blob of the key
+    //!         is being loaded or stored by another thread
+    bool Store(unsigned long long key, const Utils::ByteStream& payload);
+
+    //! Remove the blob of a key, deleting its file
+    //! \param key Key of the blob
+    void Remove(unsigned long long key);
+
+    //! Remove all the blobs, deleting their files
+    void Clear();
+
+    //! Write the index of the entries, to reuse the files in the next run
+    //! \return True if the index has been written
+    bool SaveIndex();
+
+    //! \return Size of the cache files in bytes
+    unsigned long long GetSize() const;
+
+    //! \return Number of blobs in the cache
+    unsigned int GetNumEntries() const;
+
+    //! Maximum length of the prefix of the cache files
+    static const unsigned int MAX_PREFIX_LENGTH = 128;
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The cache owns files, it cannot be copied
+    PG_DISABLE_COPY(FileCache)
+
+    //! Blob stored in the cache
+    struct Entry
+    {
+        unsigned long long mKey;        //!< Key of the blob
+        unsigned long long mLastUse;    //!< Value of mUseCounter when the blob was last loaded or stored
+        unsigned int mSize;             //!< Size of the file in bytes, header included
+        unsigned int mPadding;          //!< Unused, keeps the index layout explicit
+    };
+
+    //! Find the entry of a key, with the lock held
+    //! \param key Key of the blob
+    //! \return Index of the entry, -1 if not found
+    int FindEntry(unsigned long long key) const;
+
+    //! Test if the file of a key is being read or written, with the lock held
+    //! \param key Key of the blob
+    //! \return True if a Load() or a Store() of the key is accessing the file
+    bool IsKeyBusy(unsigned long long key) const;
+
+    //! Mark the file of a key as no longer accessed, with the lock held
+    //! \param key Key of the blob, marked by Load() or Store()
+    void ReleaseKey(unsigned long long key);
+
+    //! Delete the file of an entry and remove the entry, with the lock held
+    //! \param index Index of the entry
+    void RemoveEntry(unsigned int index);
+
+    //! Remove the least recently used entries until the files fit in the size budget, with the lock held
+    void Evict();
+
+    //! Write the index of the entries, with the lock held
+    bool SaveIndexLocked();
+
+    //! Build the name of the file of a key
+    //! \param key Key of the blob
+    //! \param path Receives the path relative to the asset root, at least IOManager::MAX_FILEPATH_LENGTH bytes
+    void GetFilePath(unsigned long long key, char* path) const;
+
+    //! Build the name of the index file
+    //! \param path Receives the path relative to the asset root, at least IOManager::MAX_FILEPATH_LENGTH bytes
+    void GetIndexPath(char* path) const;
+
+
+    //! Allocator used for the index and the temporary buffers
+    Alloc::IAllocator* mAllocator;
+
+    //! IO manager accessing the files, nullptr when the cache is disabled
+    IOManager* mIoManager;
+
+    //! Prefix of the cache files
+    char mPrefix[MAX_PREFIX_LENGTH];
+
+    //! Size budget of the cache files in bytes
+    unsigned long long mMaxSize;
+
+    //! Size of the cache files in bytes
+    unsigned long long mSize;
+
+    //! Incremented on each access, orders the entries from the least to the most recently used
+    unsigned long long mUseCounter;
+
+    //! Entries of the cache, the few hundred entries of a cache are searched linearly
+    Utils::Vector<Entry> mEntries;
+
+    //! Keys whose file is being read or written outside of the lock. The other accesses
+    //! to these keys miss meanwhile, rather than reading a partially written file
+    Utils::Vector<unsigned long long> mBusyKeys;
+
+    //! True when the entries have changed since the index has been saved
+    bool mIndexDirty;
+
+    //! Lock of the entries and of the busy keys. The blob files are read and written without it,
+    //! the deletions and the index file are kept under it to stay consistent with the entries
+    mutable Core::Mutex mLock;
+};
+
+
+}   // namespace Io
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_FILECACHE_H
@@ -13,6 +13,7 @@
 #define PEGASUS_IO_H
 
 #include "Pegasus/Core/Shared/IoErrors.h"
+#include "Pegasus/Utils/ByteStream.h"
 
 // forward declarations
 namespace Pegasus {
@@ -86,6 +87,40 @@ private:
 
 //----------------------------------------------------------------------------------------
 
+//! Writer of a file, appending the bytes in the order of the writes.
+//! The writer is a byte stream sink, letting a byte stream flush its blocks straight to the file
+class FileWriter : public Utils::IByteStreamSink
+{
+public:
+    //! Constructor, without any file
+    FileWriter();
+
+    //! Destructor, closes the file
+    virtual ~FileWriter();
+
+    //! \return true if a file is open
+    bool IsOpen() const { return mHandle != nullptr; }
+
+    //! Writes bytes at the end of the file
+    //! \param buffer the bytes to write
+    //! \param size the number of bytes to write
+    //! \return true if all the bytes have been written
+    virtual bool Write(const void* buffer, int size);
+
+    //! Closes the file
+    void Close();
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(FileWriter);
+
+    friend class IOManager;
+
+    void* mHandle; //!< Native handle or FILE pointer of the open file, nullptr if none
+};
+
+//----------------------------------------------------------------------------------------
+
 //! IO manager, loads files/assets from a given root filesystem
 class IOManager
 {
@@ -118,6 +153,17 @@ public:
     //! \return Error code.
     IoError SaveFileToBuffer(const char* relativePath, const FileBuffer& inputBuffer);
 
+    //! Opens a file for writing, replacing any existing file
+    //! \param relativePath Relative path to the file, within the asset root.
+    //! \param writer the writer receiving the open file, closed beforehand if needed
+    //! \return Error code.
+    IoError OpenFileToWrite(const char* relativePath, FileWriter& writer);
+
+    //! Deletes a file
+    //! \param relativePath Relative path to the file, within the asset root.
+    //! \return Error code, ERR_FILE_NOT_FOUND if the file could not be deleted.
+    IoError RemoveFile(const char* relativePath);
+
 
     static const unsigned int MAX_FILEPATH_LENGTH = 256; //!< Max length for a file path
 
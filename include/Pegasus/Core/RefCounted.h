@@ -13,6 +13,8 @@
 #ifndef PEGASUS_CORE_REFCOUNTED_H
 #define PEGASUS_CORE_REFCOUNTED_H
 
+#include <atomic>
+
 namespace Pegasus {
     namespace Alloc {
         class IAllocator;
@@ -41,12 +43,12 @@ public:
 
     //! Get the current reference count of this object
     //! \return the ref count
-    inline int GetRefCount() const { return mRefCount; }
+    inline int GetRefCount() const { return mRefCount.load(); }
 
 private:
 
-    //! Reference counter
-    int mRefCount;
+    //! Reference counter, atomic since the nodes are shared by the threads of the node scheduler
+    std::atomic<int> mRefCount;
     
     //! Pointer to allocator
     Alloc::IAllocator* mAllocator;
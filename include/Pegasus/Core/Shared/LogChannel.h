@@ -37,6 +37,7 @@ static const LogChannel sLogChannels[] = {
  
     'FILE',     // File management
     'ASST',     // Asset management
+    'MEM_',     // Memory management (allocation tracking)
 
     'TMLN',     // Timeline info
     'TXTR',     // Texture (generation)
@@ -0,0 +1,179 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread.h
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Threads and synchronization primitives of the operating system
+
+#ifndef PEGASUS_CORE_THREAD_H
+#define PEGASUS_CORE_THREAD_H
+
+namespace Pegasus {
+namespace Core {
+
+
+//! Entry point of a thread
+//! \param userData Pointer given to Thread::Start()
+typedef void (*ThreadFunc)(void* userData);
+
+//! Thread of the operating system.
+//! \note Use it rather than std::thread, which allocates its state with the global operator new,
+//!       crashing on purpose in Pegasus (see NewDelete.cpp). The thread does not allocate memory
+class Thread
+{
+public:
+
+    //! Constructor, the thread is not started
+    Thread();
+
+    //! Destructor
+    //! \warning The thread has to be joined before
+    ~Thread();
+
+    //! Start the thread
+    //! \param func Entry point of the thread
+    //! \param userData Pointer given to the entry point
+    //! \return True if the thread has been started, false if already running or on failure
+    bool Start(ThreadFunc func, void* userData);
+
+    //! Wait for the end of the thread, returns immediately if not running
+    void Join();
+
+    //! Test if the thread has been started and not joined yet
+    //! \return True if running
+    inline bool IsRunning() const { return mRunning; }
+
+    //! Get the number of threads the processor runs in parallel
+    //! \return Number of hardware threads, 1 if unknown
+    static unsigned int GetNumHardwareThreads();
+
+    //! Give the rest of the time slice of the calling thread to another thread ready to run,
+    //! for the spin loops waiting on another thread
+    static void YieldCurrentThread();
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The native thread references the object, it cannot be copied
+    PG_DISABLE_COPY(Thread)
+
+    // Native entry point of the thread, defined by the platform implementation
+    friend struct ThreadEntry;
+
+    //! Entry point of the thread
+    ThreadFunc mFunc;
+
+    //! Pointer given to the entry point
+    void* mUserData;
+
+    //! Native handle of the thread (HANDLE on Windows, pthread_t on Linux)
+    unsigned long long mHandle;
+
+    //! True between Start() and Join()
+    bool mRunning;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Mutual exclusion lock of the operating system, not recursive
+class Mutex
+{
+public:
+
+    //! Constructor, the mutex is unlocked
+    Mutex();
+
+    //! Destructor
+    //! \warning The mutex must be unlocked
+    ~Mutex();
+
+    //! Lock the mutex, waiting for the other threads to unlock it
+    void Lock();
+
+    //! Unlock the mutex locked by the calling thread
+    void Unlock();
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The native object is used by address, it cannot be copied
+    PG_DISABLE_COPY(Mutex)
+
+    // Waits with the native object
+    friend class ConditionVariable;
+
+    //! Storage of the native object (SRWLOCK on Windows, pthread_mutex_t on Linux),
+    //! keeping the system headers out of the engine headers
+    unsigned long long mNative[8];
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Lock of a mutex for the lifetime of the object
+class ScopedLock
+{
+public:
+
+    //! Constructor, locks the mutex
+    //! \param mutex Mutex to lock, unlocked by the destructor
+    explicit ScopedLock(Mutex& mutex) : mMutex(mutex) { mMutex.Lock(); }
+
+    //! Destructor, unlocks the mutex
+    ~ScopedLock() { mMutex.Unlock(); }
+
+private:
+
+    // The mutex would be unlocked twice
+    PG_DISABLE_COPY(ScopedLock)
+
+    //! Locked mutex
+    Mutex& mMutex;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Condition variable of the operating system, waited for with a locked mutex
+class ConditionVariable
+{
+public:
+
+    //! Constructor
+    ConditionVariable();
+
+    //! Destructor
+    //! \warning No thread must be waiting
+    ~ConditionVariable();
+
+    //! Unlock a mutex and wait for a notification, the mutex being locked again before returning
+    //! \param mutex Mutex locked by the calling thread
+    //! \note The wait can end without notification, the condition has to be tested again
+    void Wait(Mutex& mutex);
+
+    //! Wake up one of the waiting threads
+    void NotifyOne();
+
+    //! Wake up all the waiting threads
+    void NotifyAll();
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The native object is used by address, it cannot be copied
+    PG_DISABLE_COPY(ConditionVariable)
+
+    //! Storage of the native object (CONDITION_VARIABLE on Windows, pthread_cond_t on Linux)
+    unsigned long long mNative[8];
+};
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_THREAD_H
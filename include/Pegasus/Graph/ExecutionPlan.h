@@ -0,0 +1,123 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ExecutionPlan.h
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Graph of nodes flattened into an array of execution records in topological order
+
+#ifndef PEGASUS_GRAPH_EXECUTIONPLAN_H
+#define PEGASUS_GRAPH_EXECUTIONPLAN_H
+
+#include "Pegasus/Graph/Node.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/Vector.h"
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Graph of nodes compiled into a contiguous array of execution records, the input nodes first.
+//! Evaluating the plan visits the records linearly: the up-to-date nodes are skipped after testing
+//! a flag, and the dirty nodes are generated without the recursion over their inputs.
+//! The plan is compiled again when the topology of the graphs of the node manager changes.
+//! \warning The nodes must be created by a node manager to detect the topology changes,
+//!          Compile() has to be called after each change otherwise
+class ExecutionPlan
+{
+public:
+
+    //! Constructor, the plan is empty until compiled
+    //! \param allocator Allocator used for the records
+    explicit ExecutionPlan(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    ~ExecutionPlan();
+
+    //! Sort the graph of a node into execution records
+    //! \param root Node whose data is evaluated, with its input nodes, kept alive by the plan.
+    //!             Typically the input node of an output node, since output nodes have no data
+    void Compile(NodeIn root);
+
+    //! Release the records and the reference to the root node
+    void Clear();
+
+    //! Test if the plan has been compiled
+    //! \return True if a root node is defined
+    inline bool IsCompiled() const { return mRoot != nullptr; }
+
+    //! Test if the topology of the graph is unchanged since the compilation
+    //! \return True if compiled and if no input node has been connected or disconnected since
+    bool IsUpToDate() const;
+
+    //! Get the root node of the plan
+    //! \return Node given to Compile(), null reference if not compiled
+    inline NodeReturn GetRoot() const { return mRoot; }
+
+    //! Get the number of execution records
+    //! \return Number of nodes of the graph
+    inline unsigned int GetNumRecords() const { return mRecords.GetSize(); }
+
+    //! Update the data of every dirty node, in topological order, compiling the plan again if the topology has changed
+    //! \param updated Set to true if the root node or any of its input nodes has had the data recomputed
+    //!                (output parameter, set to false only by the caller)
+    //! \return Up-to-date data of the root node, null reference if not compiled
+    NodeDataReturn Execute(bool& updated);
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The plan references nodes by address, it cannot be copied
+    PG_DISABLE_COPY(ExecutionPlan)
+
+    //! Node of the plan
+    struct Record
+    {
+        Node* mNode;                    //!< Node to update, kept alive by the root node
+        unsigned int mFirstInput;       //!< First index in mInputRecords of the records of the input nodes
+        unsigned int mNumInputs;        //!< Number of input nodes
+    };
+
+    //! Node being sorted by Compile(), with its next input to visit
+    struct StackEntry
+    {
+        Node* mNode;
+        unsigned int mNextInput;
+    };
+
+
+    //! Root node of the graph, its data is returned by Execute()
+    NodeRef mRoot;
+
+    //! Node manager counting the topology changes, nullptr if the root has not been created by one
+    NodeManager* mNodeManager;
+
+    //! Topology version of the node manager when compiled
+    unsigned int mTopologyVersion;
+
+    //! Execution records, the inputs of a node before the node
+    Utils::Vector<Record> mRecords;
+
+    //! Index of the record of each input node, ranges given by Record::mFirstInput and Record::mNumInputs.
+    //! The node data pointers change when the data is generated again, so the inputs are referenced by record
+    Utils::Vector<unsigned int> mInputRecords;
+
+    //! Dirty bit of each record, set by Execute() when the data of the node has been recomputed
+    Utils::Vector<unsigned char> mUpdated;
+
+    //! Record of each node visited by Compile()
+    Utils::HashMap<Node*, int> mRecordIndices;
+
+    //! Nodes being sorted by Compile(), the depth of the graphs is not limited by the call stack
+    Utils::Vector<StackEntry> mStack;
+};
+
+
+}   // namespace Graph
+}   // namespace Pegasus
+
+#endif  // PEGASUS_GRAPH_EXECUTIONPLAN_H
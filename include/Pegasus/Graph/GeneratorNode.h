@@ -40,6 +40,8 @@ public:
     //!       can be ORed with the content of the override before returning it.
     //! \note This class implements the default behavior of a generator,
     //!       which returns only the dirty state of the data
+    //! \note Only visits the node when scheduled by a change (see Node::SetDirty()),
+    //!       returns the dirty state of the data right away otherwise
     //! \warning If this base class function is called in a derived class,
     //!       it must be called at the end, after updating the internal state
     //!       and invalidating the node data
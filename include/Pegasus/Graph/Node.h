@@ -17,23 +17,38 @@
 #include "Pegasus/PropertyGrid/PropertyGridObject.h"
 #include "Pegasus/Core/Ref.h"
 #include "Pegasus/Core/RefCounted.h"
+#include "Pegasus/Utils/Vector.h"
+#include <atomic>
 
 namespace Pegasus {
     namespace AssetLib {
         class Asset;
         class Object;
     }
+    namespace Io {
+        class FileCache;
+    }
 }
 
 namespace Pegasus {
 namespace Graph {
 
+class ExecutionPlan;
 class NodeManager;
+class NodeDataBudget;
+class NodeScheduler;
+class OutputNode;
+struct NodeAsyncJob;
 
 //! Base node class for all graph-based systems (textures, meshes, shaders, etc.)
 class Node : public Core::RefCounted, public PropertyGrid::PropertyGridObject
 {
     template<class C> friend class Pegasus::Core::Ref;
+    friend class ExecutionPlan;
+    friend class NodeManager;
+    friend class NodeDataBudget;
+    friend class NodeScheduler;
+    friend class OutputNode;
 
     BEGIN_DECLARE_PROPERTIES_BASE(Node)
     END_DECLARE_PROPERTIES()
@@ -83,7 +98,9 @@ public:
     //! This function sets the dirty flag of the node data if the internal state has changed
     //! or if an input node is dirty, and returns the dirty flag to the parent caller.
     //! That will trigger a chain of refreshed data when calling GetUpdatedData().
-    //! \warning To be redefined in derived classes
+    //! \note The changes are pushed to the nodes depending on them (see \a SetDirty()), so only the nodes
+    //!       scheduled since their last visit are visited, the others return their dirty flag right away
+    //! \warning To be redefined in derived classes, starting with a call to \a BeginUpdate()
     //! \return True if the node data is dirty or if any input node is.
     virtual bool Update() = 0;
 
@@ -98,6 +115,15 @@ public:
     //! \warning The \a updated output parameter must be set to false by the first caller
     virtual NodeDataReturn GetUpdatedData(bool & updated);
 
+    //! Return the node up-to-date data, the input nodes being up-to-date already.
+    //! Used by the execution plans, which update the nodes of a graph in topological order,
+    //! to avoid the recursion over the input nodes of GetUpdatedData()
+    //! \note The default behavior calls GetUpdatedData(), redefine it for the nodes updating their inputs
+    //! \param updated Set to true if the node has had the data recomputed
+    //!                (output parameter, set to false only by the caller)
+    //! \return Reference to the node data
+    virtual NodeDataReturn GetUpdatedDataFromInputs(bool & updated) { return GetUpdatedData(updated); }
+
     //! Deallocate the data of the current node and ask the input nodes to do the same.
     //! Typically used when keeping the graph in memory but not the associated data,
     //! to save memory and to be able to restore the data later
@@ -108,6 +134,11 @@ public:
     //! \warning The data can be missing. Use \a GetUpdatedData() if up-to-date data is required
     inline NodeDataReturn GetData() const { return mData; }
 
+    //! Test if the data has been released by the memory budget of the node manager.
+    //! An evicted node is up-to-date, its data is generated again when a node depending on it is generated
+    //! \return True if the data has been evicted and not generated again since
+    inline bool IsDataEvicted() const { return mDataEvicted; }
+
     //! Creation function type used by the node manager
     //! \param nodeManager - the node manager used for creation
     //! \param nodeAllocator Allocator used for node internal data (except the attached NodeData)
@@ -121,6 +152,28 @@ public:
     //! Gets the mode of this graph.
     virtual Mode GetMode() const { return STANDARD; }
 
+    //! Test if the data of the node can be generated on a worker thread of the NodeScheduler.
+    //! The generation must only write the data of the node, read its input data,
+    //! and not use the GPU or any global state (a random generator for example).
+    //! \note Redefine this function in derived classes to allow the parallel generation
+    //! \return True if GenerateData() can run on a worker thread, false by default
+    virtual bool IsGenerationThreadSafe() const { return false; }
+
+    //! Test if the data of the node can be stored in the node data cache of the node manager.
+    //! The data must only depend on the properties, on HashContent() and on the input data,
+    //! and its class must implement NodeData::Serialize() and NodeData::Deserialize().
+    //! \note Redefine this function in derived classes to allow the caching
+    //! \return True if the data can be loaded from the cache instead of calling GenerateData(), false by default
+    virtual bool IsDataCacheable() const { return false; }
+
+    //! Compute the hash of the content of the node, identical across runs when the node would generate the same data.
+    //! Includes the class name, the class and object properties (the name excluded), HashContent()
+    //! and the content hash of every input node
+    //! \note The hash is cached until the node is scheduled for an update (see \a RequestUpdate()),
+    //!       so the inputs shared by several nodes are hashed once
+    //! \return 64 bit hash of the content of the node
+    unsigned long long ComputeContentHash() const;
+
 #if PEGASUS_ENABLE_PROXIES
 
     //! Definition of the different types of nodes
@@ -177,6 +230,35 @@ protected:
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
+    //! Generate the content of the data associated with the node, loading it from the node data cache if possible.
+    //! When the node is cacheable and its content hash is not in the cache, GenerateData() is called
+    //! and the resulting data is stored in the cache
+    //! \note Called by \a GetUpdatedData() instead of GenerateData(), the data must be allocated
+    void GenerateCachedData();
+
+    //! Add the state of the node that is not a property to a content hash, such as the configuration of the data
+    //! \note Redefine this function in derived classes having such a state
+    //! \param hash Content hash of the node so far
+    //! \return The hash combined with the state of the node, the unmodified hash by default
+    virtual unsigned long long HashContent(unsigned long long hash) const { return hash; }
+
+    //! Start the visit of the node by \a Update(), clearing the scheduling flag
+    //! \return True if the node has to be updated, false if nothing has changed since the last visit
+    bool BeginUpdate();
+
+    //! Schedule the node and the nodes depending on it for their next \a Update(),
+    //! invalidating their cached content hash
+    //! \note The propagation stops at the nodes already scheduled without a cached content hash,
+    //!       their dependents are already scheduled, and hashing them would have cached the hash of the node
+    void RequestUpdate();
+
+    //! Schedule the node after a property change
+    virtual void OnPropertyGridInvalidated();
+
+    //! Wait for the asynchronous generation reading the node before a property change,
+    //! the change is picked up by the first update after the new data is swapped in
+    virtual void OnPropertyGridWrite();
+
 
     //! Create the data associated with the node
     //! \warning Only calls the default constructor of the node data object,
@@ -192,14 +274,28 @@ protected:
     inline bool IsDataAllocated() const { return mData != nullptr; }
 
     //! Test if the node data is dirty
-    //! \return True if the node data is dirty or unallocated
-    inline bool IsDataDirty() const { return (mData != nullptr) ? mData->IsDirty() : true; }
+    //! \return True if the node data is dirty or unallocated, false for the data evicted by the memory budget
+    inline bool IsDataDirty() const { return (mData != nullptr) ? mData->IsDirty() : !mDataEvicted; }
 
     //! Set the dirty flag of the node data if allocated, keep it set when not allocated
     void InvalidateData();
 
+    //! Invalidate the node data after a change of the node state that is not a property,
+    //! and schedule the node and the nodes depending on it for their next \a Update()
+    //! \note The property setters schedule the node automatically
+    void SetDirty();
+
+    //! Test if the node has to be visited by its next \a Update()
+    //! \return True if a property, an input or the state of the node has changed since the last visit
+    inline bool IsUpdatePending() const { return mUpdatePending; }
+
     //! Deallocate the data, set the dirty flag of the node data at the same time
-    inline void ReleaseData() { mData = nullptr; }
+    void ReleaseData();
+
+    //! Report an access to the data to the memory budget of the node manager, after the data is up-to-date.
+    //! Only the cacheable data is tracked, since it is generated again identical after an eviction
+    //! \param regenerated True if the data has just been generated again after an eviction
+    void TouchData(bool regenerated);
 
 
     //! Maximum number of input nodes
@@ -270,6 +366,54 @@ private:
     //! Data node, used to store optional intermediate node data
     NodeDataRef mData;
 
+    //! Cache of the generated data, set by the node manager creating the node, nullptr if none
+    Io::FileCache* mDataCache;
+
+    //! Memory budget of the data, set by the node manager creating the node, nullptr if none
+    NodeDataBudget* mDataBudget;
+
+    //! True when the data has been released by the memory budget while up-to-date
+    bool mDataEvicted;
+
+    //! Number of output nodes using this node as input, the data of these nodes is never evicted
+    unsigned int mNumOutputs;
+
+    //! Nodes using this node as input, once per use. The inputs are referenced by their
+    //! dependents, so these raw pointers are valid until the dependents remove their inputs
+    Utils::Vector<Node*> mDependents;
+
+    //! True when the node has to be visited by its next Update()
+    bool mUpdatePending;
+
+    //! Node manager counting the visits, set by the node manager creating the node, nullptr if none
+    NodeManager* mManager;
+
+    //! Content hash cached by ComputeContentHash(), valid when mContentHashValid is set.
+    //! Atomic since the worker threads can hash a shared input at the same time, with the same result
+    mutable std::atomic<unsigned long long> mContentHash;
+
+    //! True when mContentHash is up-to-date, cleared by RequestUpdate()
+    mutable std::atomic<bool> mContentHashValid;
+
+    //! Asynchronous generation reading the node on a worker thread, nullptr if none,
+    //! set by the output node starting it until the data is swapped in
+    NodeAsyncJob* mAsyncJob;
+
+    //! Register a node using this node as input
+    //! \param dependent Node whose input is this node
+    void AddDependent(Node* dependent);
+
+    //! Unregister one use of this node as input
+    //! \param dependent Node whose input was this node
+    void RemoveDependent(Node* dependent);
+
+    //! Test if the data can be released by the memory budget
+    //! \return True if the data is up-to-date, without GPU data, not used by an output node nor referenced elsewhere
+    bool IsDataEvictable() const;
+
+    //! Release the up-to-date data for the memory budget, the node stays up-to-date
+    void EvictData();
+
 #if PEGASUS_ENABLE_PROXIES
 
     //! Proxy associated with the node
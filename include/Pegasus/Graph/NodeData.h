@@ -14,6 +14,8 @@
 
 #include "Pegasus/Core/Ref.h"
 #include "Pegasus/Graph/NodeGPUData.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include <atomic>
 
 namespace Pegasus {
 namespace Graph {
@@ -67,6 +69,23 @@ public:
     //! \return External GPU data stored in the node data, can be nullptr if invalid or dirty
     inline const NodeGPUData * GetNodeGPUData () const { return mNodeGPUData; }
 
+    //! Write the content of the data, to store it in the node data cache
+    //! \note Redefine this function in derived classes to make their data cacheable
+    //! \param stream Stream receiving the content
+    //! \return True if the content has been written, false by default (the data cannot be serialized)
+    virtual bool Serialize(Utils::ByteStream& stream) const { return false; }
+
+    //! Restore the content of the data written by Serialize()
+    //! \param buffer Bytes written by Serialize()
+    //! \param size Number of bytes
+    //! \return True if the content has been restored, false if the bytes do not match the data
+    virtual bool Deserialize(const char* buffer, int size) { return false; }
+
+    //! Get the memory used by the content of the data, for the memory budget of the intermediate nodes
+    //! \note Redefine this function in derived classes allocating large buffers
+    //! \return Size in bytes, 0 by default
+    virtual unsigned int GetMemorySize() const { return 0; }
+
     //------------------------------------------------------------------------------------
     
 protected:
@@ -88,7 +107,7 @@ private:
 
     //! Get the current reference counter
     //! \return Number of Ref<Node> objects pointing to the current object (>= 0)
-    inline int GetRefCount() const { return mRefCount; }
+    inline int GetRefCount() const { return mRefCount.load(); }
 
     //! Decrease the reference counter, and delete the current object
     //! if the counter reaches 0
@@ -100,9 +119,8 @@ private:
     //! Allocator for this object
     Alloc::IAllocator * mAllocator;
 
-    //! Reference counter
-    //! \todo Use atomic integer
-    int mRefCount;
+    //! Reference counter, atomic since the data is read by the threads of the node scheduler
+    std::atomic<int> mRefCount;
 
     //! True when the data is dirty, meaning it will need to be recomputed to be valid
     bool mDirty;
@@ -0,0 +1,136 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataBudget.h
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Memory budget of the node data kept by the intermediate nodes of the graphs
+
+#ifndef PEGASUS_GRAPH_NODEDATABUDGET_H
+#define PEGASUS_GRAPH_NODEDATABUDGET_H
+
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Utils/HashMap.h"
+
+namespace Pegasus {
+namespace Graph {
+
+class Node;
+
+
+//! Memory budget of the node data kept by the intermediate nodes (the nodes not connected to an output node).
+//! The nodes report each access to their data, and when the data exceeds the budget, the least recently
+//! used data is released. An evicted node stays up-to-date, its data is generated again only when
+//! a node depending on it has to be generated.
+//! Touch(), Remove() and RecordRegeneration() can be called from any thread, Evict() only when
+//! no graph is being generated.
+class NodeDataBudget
+{
+public:
+
+    //! Statistics of the budget
+    struct Stats
+    {
+        unsigned long long mResidentSize;       //!< Size in bytes of the data of the tracked nodes
+        unsigned long long mPeakResidentSize;   //!< Largest resident size since the last reset
+        unsigned long long mEvictedSize;        //!< Size in bytes of the evicted data since the last reset
+        unsigned long long mRegeneratedSize;    //!< Size in bytes of the regenerated data since the last reset
+        unsigned int mNumNodes;                 //!< Number of tracked nodes
+        unsigned int mNumEvictions;             //!< Number of evicted node data since the last reset
+        unsigned int mNumRegenerations;         //!< Number of evicted node data generated again since the last reset
+    };
+
+    //! Constructor, without budget (the data is never evicted)
+    //! \param allocator Allocator used for the tracking of the nodes
+    explicit NodeDataBudget(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    ~NodeDataBudget();
+
+    //! Set the memory budget of the intermediate node data
+    //! \param maxSize Size in bytes, 0 to never evict the data (default)
+    void SetBudget(unsigned long long maxSize);
+
+    //! Get the memory budget of the intermediate node data
+    //! \return Size in bytes, 0 if the data is never evicted
+    unsigned long long GetBudget() const;
+
+    //! Record an access to the data of a node, updating its size
+    //! \param node Node whose data has been generated or read
+    //! \param size Size in bytes of the data
+    void Touch(Node* node, unsigned int size);
+
+    //! Stop tracking a node, when destroyed
+    //! \param node Node to forget
+    void Remove(Node* node);
+
+    //! Record the generation of data evicted before
+    //! \param size Size in bytes of the data
+    void RecordRegeneration(unsigned int size);
+
+    //! Evict the least recently used data of the intermediate nodes until the budget is met.
+    //! The nodes connected to an output node and the data also referenced outside of its node are kept.
+    //! When only such data remains, the next calls return immediately until a node is touched or removed
+    //! \warning Must not be called while a graph is generated, the evicted data could be in use
+    void Evict();
+
+    //! Get the statistics of the budget
+    //! \return Copy of the statistics
+    Stats GetStats() const;
+
+    //! Reset the counters of the statistics, the resident size and the number of nodes are kept
+    void ResetStats();
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The budget tracks nodes by address, it cannot be copied
+    PG_DISABLE_COPY(NodeDataBudget)
+
+    //! Data of a tracked node, linked from the least to the most recently used.
+    //! The links are nodes rather than entries, since the entries move when the map grows
+    struct Entry
+    {
+        Node* mOlder;                   //!< Node accessed just before, nullptr for the least recently used
+        Node* mNewer;                   //!< Node accessed just after, nullptr for the most recently used
+        unsigned int mSize;             //!< Size in bytes of the data at the last access
+    };
+
+    //! Append a node to the list of the tracked nodes, as the most recently used
+    //! \param node Node to append
+    //! \param entry Entry of the node, not linked yet
+    void LinkNewest(Node* node, Entry& entry);
+
+    //! Remove the entry of a node from the list of the tracked nodes
+    //! \param entry Entry of the node, linked
+    void Unlink(const Entry& entry);
+
+    //! Tracked nodes
+    Utils::HashMap<Node*, Entry> mEntries;
+
+    //! Least and most recently used nodes, nullptr when no node is tracked
+    Node* mOldest;
+    Node* mNewest;
+
+    //! Memory budget, 0 to never evict the data
+    unsigned long long mMaxSize;
+
+    //! True when the last eviction could not meet the budget, the remaining data being in use
+    bool mEvictionBlocked;
+
+    //! Statistics
+    Stats mStats;
+
+    //! Lock of the entries and of the statistics
+    mutable Core::Mutex mLock;
+};
+
+
+}   // namespace Graph
+}   // namespace Pegasus
+
+#endif  // PEGASUS_GRAPH_NODEDATABUDGET_H
@@ -13,6 +13,10 @@
 #define PEGASUS_GRAPH_NODEMANAGER_H
 
 #include "Pegasus/Graph/Node.h"
+#include "Pegasus/Graph/NodeScheduler.h"
+#include "Pegasus/Graph/NodeDataBudget.h"
+#include "Pegasus/Core/FileCache.h"
+#include "Pegasus/Utils/HashMap.h"
 
 namespace Pegasus {
 namespace Graph {
@@ -21,6 +25,8 @@ namespace Graph {
 //! Global node manager, including the factory features
 class NodeManager
 {
+    friend class Node;
+
 public:
 
     //! Default constructor
@@ -45,6 +51,51 @@ public:
     //! \return Reference to the created node, null reference if an error occurred
     NodeReturn CreateNode(const char * className);
 
+    //! Get the scheduler generating the node data of the graphs
+    //! \return Node scheduler, without worker thread by default
+    inline NodeScheduler* GetScheduler() { return &mScheduler; }
+
+    //! Get the cache of the generated node data, shared by the nodes created by this manager
+    //! \return Node data cache, disabled until initialized with an IO manager
+    inline Io::FileCache* GetDataCache() { return &mDataCache; }
+
+    //! Get the memory budget of the data of the intermediate nodes created by this manager
+    //! \return Node data budget, unlimited by default
+    inline NodeDataBudget* GetDataBudget() { return &mDataBudget; }
+
+    //! Start a new frame, the output nodes generating their data asynchronously
+    //! swap in the completed data only at the first request of a frame.
+    //! The intermediate node data exceeding the memory budget is evicted when no node is being generated
+    //! \note To be called once per frame by the application, before any node data is requested
+    void BeginFrame();
+
+    //! Get the index of the current frame
+    //! \return Index of the frame, incremented by BeginFrame()
+    inline unsigned int GetFrameIndex() const { return mFrameIndex; }
+
+    //! Get the number of nodes visited by Update() since the last call to BeginFrame().
+    //! Only the nodes scheduled by a change are visited, so an idle frame visits none
+    //! \return Number of visited nodes of the current frame
+    inline unsigned int GetNumVisitedNodes() const { return mNumVisitedNodes; }
+
+    //! Get the number of nodes visited by Update() during the previous frame
+    //! \return Number of visited nodes between the last two calls to BeginFrame()
+    inline unsigned int GetNumVisitedNodesLastFrame() const { return mNumVisitedNodesLastFrame; }
+
+    //! Get the version of the topology of the graphs, incremented each time an input node is connected or disconnected
+    //! \return Version of the topology, to detect the changes since an execution plan has been compiled
+    inline unsigned int GetTopologyVersion() const { return mTopologyVersion; }
+
+    //! Enable or disable the asynchronous generation of the output nodes requesting it.
+    //! When disabled, the pending generations are waited for and the data is generated
+    //! before being returned, for a deterministic rendering (video capture for example)
+    //! \param enabled True to allow the asynchronous generation (default), false to generate synchronously
+    inline void SetAsyncGenerationEnabled(bool enabled) { mAsyncGenerationEnabled = enabled; }
+
+    //! Test if the asynchronous generation of the output nodes is allowed
+    //! \return True if allowed (default)
+    inline bool IsAsyncGenerationEnabled() const { return mAsyncGenerationEnabled; }
+
     //------------------------------------------------------------------------------------
     
 private:
@@ -58,6 +109,12 @@ private:
     //!         mNumRegisteredNodes if not found
     unsigned int GetRegisteredNodeIndex(const char * className) const;
 
+    //! Count the visit of a node by Update(), called by the nodes
+    inline void RecordNodeVisit() { ++mNumVisitedNodes; }
+
+    //! Count a change of the topology of a graph, called by the nodes
+    inline void RecordTopologyChange() { ++mTopologyVersion; }
+
 
     //! Allocator used for node internal data (except the attached NodeData)
     Alloc::IAllocator* mNodeAllocator;
@@ -86,6 +143,33 @@ private:
 
     //! Number of currently registered nodes (<= MAX_NUM_REGISTERED_NODES)
     unsigned int mNumRegisteredNodes;
+
+    //! Index in \a mRegisteredNodes of each class name, the first registration of a name wins
+    Utils::HashMap<const char*, unsigned int, Utils::StringHashTraits> mRegisteredNodeIndices;
+
+    //! Cache of the generated node data, declared before the scheduler whose workers use it
+    Io::FileCache mDataCache;
+
+    //! Memory budget of the intermediate node data, declared before the scheduler whose workers use it
+    NodeDataBudget mDataBudget;
+
+    //! Scheduler generating the node data of the graphs created by this manager
+    NodeScheduler mScheduler;
+
+    //! Index of the current frame, incremented by BeginFrame()
+    unsigned int mFrameIndex;
+
+    //! True if the output nodes are allowed to generate their data asynchronously
+    bool mAsyncGenerationEnabled;
+
+    //! Number of nodes visited by Update() since the last call to BeginFrame()
+    unsigned int mNumVisitedNodes;
+
+    //! Number of nodes visited by Update() during the previous frame
+    unsigned int mNumVisitedNodesLastFrame;
+
+    //! Version of the topology of the graphs, incremented by each connection or disconnection of an input node
+    unsigned int mTopologyVersion;
 };
 
 
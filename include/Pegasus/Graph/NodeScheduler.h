@@ -0,0 +1,203 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeScheduler.h
+//! \author Karolyn Boulanger
+//! \date   October 19th 2026
+//! \brief  Scheduler generating the dirty node data of a graph, independent nodes in parallel
+
+#ifndef PEGASUS_GRAPH_NODESCHEDULER_H
+#define PEGASUS_GRAPH_NODESCHEDULER_H
+
+#include "Pegasus/Graph/Node.h"
+#include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Core/Thread.h"
+#include <atomic>
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Generation of the data of a node and of its inputs on a worker thread of the NodeScheduler.
+//! Owned by the requester (typically an output node), which must wait for the completion
+//! with NodeScheduler::WaitForAsyncJob() before destroying it or editing the graph
+struct NodeAsyncJob
+{
+    Node* mNode;                    //!< Node to generate, nullptr when no generation is pending
+    std::atomic<bool> mCompleted;   //!< Set once the data of the node is generated
+
+    NodeAsyncJob() : mNode(nullptr) { mCompleted.store(false); }    //!< Default constructor
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Scheduler of the node data generation.
+//! The dirty nodes of a graph are gathered in a dependency graph, then generated in the order of
+//! their dependencies by a pool of worker threads and by the calling thread.
+//! Each node is still generated by its own GetUpdatedDataFromInputs(), once its inputs are up-to-date,
+//! so the data is identical to the serial evaluation of the graph.
+//! Only the nodes returning true from IsGenerationThreadSafe() run on the worker threads,
+//! the other ones run on the calling thread.
+class NodeScheduler
+{
+public:
+
+    //! Maximum number of worker threads
+    enum { MAX_NUM_WORKERS = 16 };
+
+    //! Constructor, without worker thread (the graphs are evaluated serially)
+    //! \param allocator Allocator used for the dependency graph
+    explicit NodeScheduler(Alloc::IAllocator* allocator);
+
+    //! Destructor, stops the worker threads
+    ~NodeScheduler();
+
+    //! Set the number of worker threads, stopping the current ones
+    //! \param numWorkers Number of worker threads (0 to MAX_NUM_WORKERS), 0 to evaluate the graphs serially
+    //! \warning Must not be called during a generation
+    void SetNumWorkers(unsigned int numWorkers);
+
+    //! Get the number of worker threads
+    //! \return Number of worker threads, 0 if the graphs are evaluated serially
+    inline unsigned int GetNumWorkers() const { return mNumWorkers; }
+
+    //! Get the number of worker threads matching the processor, one hardware thread being left to the caller
+    //! \return Number of worker threads (0 to MAX_NUM_WORKERS)
+    static unsigned int GetDefaultNumWorkers();
+
+    //! Generate the data of a node and of its input nodes, if dirty
+    //! \param node Node to update, with its input nodes
+    //! \param updated Set to true if the node or any of its input nodes has had the data recomputed
+    //!                (output parameter, set to false only by the caller)
+    //! \return True if the data has been generated by the scheduler. False if the scheduler has no
+    //!         worker thread, if it is already generating a graph (when called by a node during
+    //!         the generation) or if no node of the graph has to be generated (the node is up-to-date
+    //!         or only evicted), the caller then has to evaluate the graph serially
+    bool GenerateData(Node* node, bool& updated);
+
+    //! Generate the data of a node and of its input nodes on a worker thread, returning immediately
+    //! \param job Job to run, owned by the caller, with no generation pending
+    //! \param node Node to update with its input nodes, kept alive by the caller until the job is completed
+    //! \note Without worker thread, the data is generated by the calling thread before returning
+    //! \warning The nodes of the graph must not be used by other threads until the job is completed
+    void GenerateDataAsync(NodeAsyncJob* job, Node* node);
+
+    //! Wait for the completion of a job, running it on the calling thread if no worker has started it
+    //! \param job Job to wait for, returns immediately if no generation is pending
+    void WaitForAsyncJob(NodeAsyncJob* job);
+
+    //! Test if no node is being generated, by a graph generation or by an asynchronous job
+    //! \return True if the node data can be released safely
+    bool IsIdle();
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The scheduler owns threads, it cannot be copied
+    PG_DISABLE_COPY(NodeScheduler)
+
+    //! Node to update, with its dependencies
+    struct Task
+    {
+        Node* mNode;                                //!< Node to update, owned by the graph during the generation
+        int mInputs[Node::MAX_NUM_INPUTS];          //!< Tasks of the inputs, -1 for the inputs already up-to-date
+        unsigned int mNumInputs;                    //!< Number of inputs of the node
+        unsigned int mFirstDependent;               //!< First index in mDependents of the tasks depending on this one
+        unsigned int mNumDependents;                //!< Number of tasks depending on this one
+        int mNumPendingInputs;                      //!< Number of input tasks not completed yet
+        bool mMainThread;                           //!< True if the node must be generated on the calling thread
+        bool mUpdated;                              //!< True if the node or an input has had its data recomputed
+    };
+
+    //! Add the task of a node and the tasks of its dirty inputs
+    //! \param node Node to add
+    //! \return Index of the task, -1 if the node and its inputs are up-to-date
+    //! \note The nodes neither dirty nor scheduled for an update are not visited, nor their inputs
+    int AddTask(Node* node);
+
+    //! Add the task generating again the data of a node evicted by the memory budget,
+    //! and the tasks of its evicted inputs, when a task depends on it
+    //! \param node Evicted node already visited by AddTask()
+    //! \return Index of the task
+    int AddEvictedTask(Node* node);
+
+    //! Update the node of a task, its input tasks being completed
+    //! \param taskIndex Index of the task
+    void RunTask(unsigned int taskIndex);
+
+    //! Release the tasks depending on a completed task, with the lock held
+    //! \param taskIndex Index of the completed task
+    void CompleteTask(unsigned int taskIndex);
+
+    //! Generate the node data of an asynchronous job, and signal its completion
+    //! \param job Job to run, removed from the queue, with the lock held when called and when returning.
+    //!            The lock is released while generating the data
+    void RunAsyncJob(NodeAsyncJob* job);
+
+    //! Entry point of the worker threads
+    //! \param scheduler Scheduler owning the thread
+    static void WorkerEntry(void* scheduler);
+
+    //! Loop of a worker thread
+    void WorkerLoop();
+
+    //! Stop and join the worker threads, the queued asynchronous jobs are run by the calling thread
+    void StopWorkers();
+
+
+    //! Allocator used for the dependency graph
+    Alloc::IAllocator* mAllocator;
+
+    //! Tasks of the current generation
+    Utils::Vector<Task> mTasks;
+
+    //! Tasks depending on each task, ranges given by Task::mFirstDependent and Task::mNumDependents
+    Utils::Vector<unsigned int> mDependents;
+
+    //! Task of each node visited by AddTask, -1 for the up-to-date nodes
+    Utils::HashMap<Node*, int> mTaskIndices;
+
+    //! Tasks ready to run on any thread
+    Utils::Vector<unsigned int> mWorkerQueue;
+
+    //! Tasks ready to run on the calling thread
+    Utils::Vector<unsigned int> mMainThreadQueue;
+
+    //! Asynchronous jobs not started yet, the graph tasks have priority over them
+    Utils::Vector<NodeAsyncJob*> mAsyncQueue;
+
+    //! Number of completed tasks of the current generation
+    unsigned int mNumCompletedTasks;
+
+    //! Number of asynchronous jobs being run
+    unsigned int mNumRunningAsyncJobs;
+
+    //! Lock of the queues and of the dependency counters
+    Core::Mutex mLock;
+
+    //! Signaled when tasks or jobs are queued, completed, or when the workers have to stop
+    Core::ConditionVariable mCondition;
+
+    //! Worker threads, only the first mNumWorkers ones are running
+    Core::Thread mWorkers[MAX_NUM_WORKERS];
+
+    //! Number of running worker threads
+    unsigned int mNumWorkers;
+
+    //! True when the worker threads have to exit
+    bool mStopWorkers;
+
+    //! True during a generation, the nodes generated by the scheduler can ask for a generation themselves
+    std::atomic<bool> mGenerating;
+};
+
+
+}   // namespace Graph
+}   // namespace Pegasus
+
+#endif  // PEGASUS_GRAPH_NODESCHEDULER_H
@@ -54,6 +54,8 @@ public:
     //! \note This class implements the default behavior of an operator:
     //!       if any input is dirty, invalidate the node data and return true,
     //!       otherwise return the dirty state of the data
+    //! \note Only visits the node when scheduled by a change (see Node::SetDirty()),
+    //!       returns the dirty state of the data right away otherwise
     //! \warning If this base class function is called in a derived class,
     //!       it must be called at the end, after updating the internal state
     //!       and invalidating the node data
@@ -75,6 +77,13 @@ public:
     //! \warning The \a updated output parameter must be set to false by the first caller
     virtual NodeDataReturn GetUpdatedData(bool & updated);
 
+    //! Return the node up-to-date data, without updating the input nodes first
+    //! \note Generates the data if dirty, only the evicted inputs are generated again
+    //! \param updated Set to true if the node has had the data recomputed
+    //!                (output parameter, set to false only by the caller)
+    //! \return Reference to the node data
+    virtual NodeDataReturn GetUpdatedDataFromInputs(bool & updated);
+
     //------------------------------------------------------------------------------------
     
 protected:
@@ -92,6 +101,8 @@ protected:
 
     //! Generate the content of the data associated with the node
     //! \warning To be redefined by each derived class, to implement its behavior
+    //! \warning The input nodes are up-to-date when called, read their data with GetData().
+    //!          Calling GetUpdatedData() on them would traverse their graph again
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
@@ -119,6 +130,17 @@ private:
 
     // Nodes cannot be copied, only references to them
     PG_DISABLE_COPY(OperatorNode)
+
+
+    //! Test if the number of input nodes is between the boundaries of the operator
+    //! \return True if valid, throws an assertion otherwise
+    bool IsNumInputsValid() const;
+
+    //! Generate the data if dirty or if an input has been updated, the inputs being up-to-date
+    //! \param inputUpdated True if an input node has had the data recomputed
+    //! \param updated Set to true if the node has had the data recomputed
+    //! \return Reference to the node data
+    NodeDataReturn GenerateUpdatedData(bool inputUpdated, bool & updated);
 };
 
 
@@ -13,6 +13,8 @@
 #define PEGASUS_GRAPH_OUTPUTNODE_H
 
 #include "Pegasus/Graph/Node.h"
+#include "Pegasus/Graph/ExecutionPlan.h"
+#include "Pegasus/Graph/NodeScheduler.h"
 #include "Pegasus/AssetLib/RuntimeAssetObject.h"
 
 namespace Pegasus {
@@ -42,12 +44,23 @@ public:
     //! Update the node internal state by pulling external parameters.
     //! \note Does only call Update() for the input node.
     //!       That will trigger a chain of refreshed data when calling GetUpdatedData().
-    //! \return True if the node data of the input node is dirty or if any input node is.
+    //!       The graph is left untouched while its data is generated asynchronously,
+    //!       the changes are picked up by the first update after the completion
+    //! \note Only visits the node when scheduled by a change (see Node::SetDirty()),
+    //!       returns the dirty state of the input data right away otherwise
+    //! \return True if the node data of the input node is dirty or if any input node is,
+    //!         or if the data is being generated asynchronously
     virtual bool Update();
 
     //! Return the node up-to-date data.
     //! \note Defines the standard behavior of all output nodes.
     //!       Calls GetUpdatedData() on the input.
+    //!       When the node scheduler of the node manager has worker threads,
+    //!       the dirty nodes of the graph are generated by the scheduler first.
+    //!       The graph is evaluated from an execution plan compiled at the first request,
+    //!       and compiled again when the topology changes (see ExecutionPlan).
+    //!       With the asynchronous generation, the last completed data is returned
+    //!       while the graph is generated in the background (see IsDataPending())
     //!       It should be overridden only for special cases.
     //! \param updated Set to true if the input node or any of its input nodes has had the data recomputed
     //!                (output parameter, set to false only by the caller)
@@ -66,6 +79,34 @@ public:
     //!         (throws an assertion error in that case)
     virtual NodeDataReturn GetUpdatedData();
 
+
+    //! Enable or disable the asynchronous generation of the graph data.
+    //! When enabled, a dirty graph with up-to-date data already generated once is regenerated
+    //! on a worker thread of the node scheduler into a new buffer, while GetUpdatedData() keeps
+    //! returning the last completed data. The new data is swapped in at the first request
+    //! of the frame following the completion (see NodeManager::BeginFrame()).
+    //! \note Graphs with nodes that cannot be generated on a worker thread
+    //!       (see Node::IsGenerationThreadSafe()) are always generated synchronously
+    //! \note The property writes to the nodes of the graph wait for the pending data to be completed
+    //! \warning The nodes of the graph must not be shared with other output nodes,
+    //!          and their state that is not a property must not change while the data is pending
+    //! \param async True to generate the data asynchronously, false by default.
+    //!              When disabling it, the pending data is completed and swapped in
+    void SetAsyncGeneration(bool async);
+
+    //! Test if the asynchronous generation of the graph data is requested
+    //! \return True if requested with SetAsyncGeneration()
+    inline bool IsAsyncGeneration() const { return mAsyncGeneration; }
+
+    //! Test if new data is being generated asynchronously
+    //! \return True if GetUpdatedData() returns the last completed data while the new one is generated
+    inline bool IsDataPending() const { return mAsyncJob.mNode != nullptr; }
+
+    //! Wait for the data being generated asynchronously and swap it in,
+    //! for a deterministic rendering or before releasing the graph
+    //! \note Does nothing when no data is pending
+    void CompleteAsyncGeneration();
+
     //------------------------------------------------------------------------------------
 
     //! callback to implement reading / parsing an asset
@@ -81,6 +122,8 @@ public:
 protected:
 
     //! Destructor
+    //! \warning The derived classes call CompleteAsyncGeneration() in their destructor,
+    //!          so the pending data is swapped in while OnAsyncDataSwapped() can still be called
     virtual ~OutputNode();
 
 
@@ -113,6 +156,12 @@ protected:
     //! \param index Index of the node before it is removed
     virtual void OnRemoveInput(unsigned int index);
 
+    //! Called when the data generated asynchronously replaces the previous data
+    //! \note The override of this function is optional, the default behavior does nothing.
+    //!       Typically used to release the GPU data of the previous data
+    //! \param previousData Previous data of the graph, released after the call
+    virtual void OnAsyncDataSwapped(NodeData* previousData);
+
 #if PEGASUS_ENABLE_PROXIES
     //! Returns the display name of this runtime object
     //! \return string representing the display name of this object
@@ -126,8 +175,44 @@ private:
     // Nodes cannot be copied, only references to them
     PG_DISABLE_COPY(OutputNode)
 
+    //! Test if the asynchronous generation can be used for the next request
+    //! \return True if requested for this node, allowed by the node manager,
+    //!         and if the scheduler has worker threads
+    bool CanGenerateAsync() const;
+
+    //! Swap in the data generated asynchronously, the previous data being released
+    void SwapAsyncData();
+
+    //! Test the state of a node and of its input nodes before an asynchronous generation
+    //! \param node Node to test, with its input nodes
+    //! \param dirty Set to true if any node has dirty data (output parameter, set to false by the caller)
+    //! \param threadSafe Set to false if any node cannot be generated on a worker thread
+    //!                   (output parameter, set to true by the caller)
+    static void InspectGraph(const Node* node, bool& dirty, bool& threadSafe);
+
+    //! Set the asynchronous generation reading a node and its input nodes,
+    //! so the property writes wait for its completion (see Node::OnPropertyGridWrite())
+    //! \param node Node to set, with its input nodes
+    //! \param job Asynchronous generation of the graph, nullptr once the data is swapped in
+    static void SetGraphAsyncJob(Node* node, NodeAsyncJob* job);
+
     //! Node manager reference
     NodeManager* mNodeManager;
+
+    //! True if the asynchronous generation of the graph data is requested
+    bool mAsyncGeneration;
+
+    //! Generation of the input node running on a worker thread
+    NodeAsyncJob mAsyncJob;
+
+    //! Last completed data, returned while the new data is pending
+    NodeDataRef mFrontData;
+
+    //! Frame of the last data request, the pending data is swapped in at the first request of a frame
+    unsigned int mRequestFrameIndex;
+
+    //! Graph of the input node flattened in topological order, evaluated by GetUpdatedData()
+    ExecutionPlan mPlan;
 };
 
 
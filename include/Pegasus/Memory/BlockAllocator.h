@@ -22,17 +22,28 @@ namespace Memory
 
 //! Ast allocator, following decorator pattern, helps recycling memory across BS sessions.
 //! the AstAllocator destroys all memory at once, and only deallocates on a ForceFree call (or on destruction)
+//! Allocations bigger than a page are forwarded to the underlying allocator, and released by Delete or Reset.
+//! Delete of the last allocation gives its memory back, other small allocations are only released by Reset.
+//! Reset keeps the pages for the next session, up to the retained budget.
 class BlockAllocator : public Alloc::IAllocator
 {
 public:
 
+    //! default amount of page memory kept by Reset
+    static const int sDefaultRetainedBudget = 1024 * 1024;
+
     BlockAllocator();
     virtual ~BlockAllocator();
     
     //! decorate the underlying allocator. The 
+    //! \param pageSize size of the pages, allocations up to this size are served from the pages
     //! \param alloc the allocator querying underneath
     void Initialize(int pageSize, Alloc::IAllocator* alloc);
 
+    //! sets the amount of page memory kept by Reset. Pages above the budget are given back to the underlying allocator
+    //! \param budget the budget in bytes, at least one page is always kept
+    void SetRetainedBudget(int budget) { mRetainedBudget = budget; }
+
     //! Allocate a block of memory
     //! \param Size of the allocation, in bytes.
     //! \param flags Allocation flags.
@@ -70,13 +81,20 @@ public:
     );
 
 
-    //! Free a block of memory
+    //! Free a block of memory. Only big allocations and the last allocation are released right away
     //! \param ptr Address of the memory.
     virtual void Delete(void* ptr);
 
     //! Resets the memory counter, but does not destroy the allocated memory. Use this for iteration on recompilation of block scripts
+    //! Big allocations are freed, and the pages above the retained budget are given back
     void Reset();
 
+    //! Moves the allocation point back, releasing every allocation made after it.
+    //! For users allocating as a stack, like the containers
+    //! \param page the page of the new allocation point, must be lower or equal to the current page
+    //! \param offset the offset in the page of the new allocation point
+    void Rewind(int page, int offset);
+
     //! Frees the memory and resets the counters. Use this when doing a garbage collection pass or when memory must be freed
     void FreeMemory();
 
@@ -92,21 +110,52 @@ public:
     //! \return gets the page memory
     char** const GetMemoryPagesConst() const { return mMemoryPages; }
 
-    //! \return gets the memory size
-    int GetMemorySize() const { return mMemorySize; }
+    //! \return gets the memory size, the bytes of the pages up to the allocation point
+    int GetMemorySize() const { return mCurrentPage * mPageSize + mPageOffset; }
 
     int GetPageSize() const { return mPageSize; }
 
+    //! \return the number of pages owned by the allocator, used or retained
+    int GetPageCount() const { return mMemoryPageListSize; }
+
 private:
-    static const int sPageIncrement; 
+    //! initial capacity of the page list, it doubles when full
+    static const int sInitialPageListCount;
+
+    //! Header stored right before every big allocation
+    struct BigAllocation
+    {
+        BigAllocation* mNext;
+        BigAllocation* mPrev;
+        void*          mBlock; //!< memory returned by the underlying allocator
+    };
+
+    //! allocates from the pages
+    //! \return the memory, nullptr if out of memory
+    void* AllocFromPages(int size, int align);
+
+    //! allocates with the underlying allocator, for allocations bigger than a page
+    //! \return the memory, nullptr if out of memory
+    void* AllocBig(size_t size, Alloc::Alignment align);
+
+    //! adds a page at the end of the page list
+    //! \return true if success, false if out of memory
+    bool NewPage();
+
+    //! frees all the big allocations
+    void FreeBigAllocations();
 
     Alloc::IAllocator* mAllocator;
-    size_t mMemorySize;
-    int    mMemoryPageListCount;
-    int    mMemoryPageListSize;
+    int    mMemoryPageListCount; //!< capacity of the page list
+    int    mMemoryPageListSize;  //!< number of pages
     char** mMemoryPages;
     int    mPageSize;
-    
+    int    mCurrentPage;    //!< page being filled, equals mMemoryPageListSize when that page is not allocated yet
+    int    mPageOffset;     //!< allocation point in the current page
+    void*  mLastAllocation; //!< last allocation from the pages, the only one Delete can give back
+    int    mLastOffset;     //!< allocation point before the last allocation
+    int    mRetainedBudget; //!< bytes of pages kept by Reset
+    BigAllocation* mBigAllocations; //!< allocations bigger than a page
 };
 
 
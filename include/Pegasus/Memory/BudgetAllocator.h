@@ -0,0 +1,119 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BudgetAllocator.h
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Allocator decorator enforcing a memory budget, with a soft limit asking the
+//!         owners of the memory to evict their caches, and a hard limit failure policy.
+
+#ifndef PEGASUS_MEMORY_BUDGETALLOCATOR_H
+#define PEGASUS_MEMORY_BUDGETALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include <atomic>
+
+namespace Pegasus {
+namespace Memory {
+
+//! Behavior of an allocation that would exceed the hard limit, once the callback had its chance to free memory
+enum BudgetPolicy
+{
+    BUDGET_POLICY_ASSERT, //!< assert, then allocate anyway
+    BUDGET_POLICY_FAIL,   //!< return nullptr, for the callers able to handle the failure
+    BUDGET_POLICY_ALLOW   //!< allocate anyway, the callback is the only report
+};
+
+//! Events sent to the budget callback
+enum BudgetEvent
+{
+    BUDGET_EVENT_SOFT_LIMIT, //!< the soft limit has been crossed, sent once until the usage goes back under the limit
+    BUDGET_EVENT_HARD_LIMIT  //!< an allocation would exceed the hard limit
+};
+
+//! Callback of a budget, meant to evict cached memory.
+//! Memory can be freed from the callback. Allocations made from the callback do not send events
+//! \param event Event of the budget
+//! \param liveBytes Bytes allocated when the event is sent
+//! \param requestedBytes Size of the allocation sending the event
+//! \param userData User data given with the callback
+typedef void (*BudgetCallback)(BudgetEvent event, size_t liveBytes, size_t requestedBytes, void* userData);
+
+//! Allocator decorator enforcing a memory budget.
+//! A header is stored before every allocation, to know its size when it is deleted.
+//! The limits and the callback are expected to be set at initialization, or while the allocator is idle
+class BudgetAllocator : public Alloc::IAllocator
+{
+public:
+    //! Constructor, without any limit
+    //! \param allocator Allocator to decorate, receiving the allocations with their header
+    BudgetAllocator(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    virtual ~BudgetAllocator();
+
+
+    // IAllocator interface
+    virtual void* Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void* AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void Delete(void* ptr);
+
+    //! Sets the limits of the budget
+    //! \param softLimit Bytes above which the callback is asked to evict memory, 0 for no soft limit
+    //! \param hardLimit Bytes that cannot be exceeded, 0 for no hard limit
+    //! \param policy Behavior of the allocations exceeding the hard limit
+    void SetLimits(size_t softLimit, size_t hardLimit, BudgetPolicy policy);
+
+    //! Sets the callback receiving the events of the budget
+    //! \param callback Callback, nullptr to remove it
+    //! \param userData User data given to the callback
+    void SetCallback(BudgetCallback callback, void* userData);
+
+    //! \return the bytes currently allocated, as requested by the callers
+    size_t GetLiveBytes() const { return mLiveBytes.load(std::memory_order_relaxed); }
+
+    //! \return the soft limit, 0 if none
+    size_t GetSoftLimit() const { return mSoftLimit; }
+
+    //! \return the hard limit, 0 if none
+    size_t GetHardLimit() const { return mHardLimit; }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(BudgetAllocator);
+
+    //! Header stored right before every allocation
+    struct AllocationHeader
+    {
+        unsigned long long mSize;   //!< requested size
+        unsigned long long mOffset; //!< distance from the memory of the decorated allocator to the returned memory
+    };
+
+    //! counts an allocation in the budget, sending the events
+    //! \return true if the allocation can be made, false if the hard limit refuses it
+    bool Charge(size_t size);
+
+    //! removes an allocation from the budget
+    void Discharge(size_t size);
+
+    //! sends an event to the callback, unless the current thread is already in a callback
+    void Notify(BudgetEvent event, size_t size);
+
+    Alloc::IAllocator*  mAllocator;  //!< decorated allocator
+    std::atomic<size_t> mLiveBytes;  //!< bytes allocated, as requested by the callers
+    std::atomic<bool>   mSoftArmed;  //!< true if crossing the soft limit sends an event
+    size_t              mSoftLimit;
+    size_t              mHardLimit;
+    BudgetPolicy        mPolicy;
+    BudgetCallback      mCallback;
+    void*               mUserData;
+};
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_BUDGETALLOCATOR_H
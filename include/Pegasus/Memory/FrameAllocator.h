@@ -0,0 +1,116 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FrameAllocator.h
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Double buffered linear allocator for the temporaries of a frame.
+//!         Allocation is a pointer bump, and the memory is reclaimed in bulk by Flip().
+
+#ifndef PEGASUS_MEMORY_FRAMEALLOCATOR_H
+#define PEGASUS_MEMORY_FRAMEALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include <atomic>
+
+namespace Pegasus {
+namespace Memory {
+
+//! Double buffered linear allocator.
+//! Allocations made during a frame stay valid during the next frame as well,
+//! so data produced by the update can be consumed by the render of the following frame.
+//! Delete() does not release anything, the memory of a buffer is reclaimed when Flip() reuses it.
+//! When a buffer runs out of space, extra pages are chained, and merged into a single bigger page on reset.
+//! When PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS is set, reclaimed memory is poisoned, writes through stale
+//! pointers are detected when the memory is handed out again, and Delete() asserts on stale pointers.
+class FrameAllocator : public Alloc::IAllocator
+{
+public:
+    //! Default size of the first page of each buffer
+    static const size_t sDefaultPageSize = 256 * 1024;
+
+    //! Byte pattern written over the reclaimed memory
+    static const unsigned char sPoisonValue = 0xDD;
+
+    //! Constructor
+    //! \param allocId ID to use for this allocator.  Should be "Unique"
+    //! \param pageSize Size of the first page of each buffer, pages are only reserved on first use
+    FrameAllocator(unsigned int allocId, size_t pageSize = sDefaultPageSize);
+
+    //! Destructor
+    virtual ~FrameAllocator();
+
+
+    // IAllocator interface
+    virtual void* Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void* AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void Delete(void* ptr);
+
+    //! Ends the current frame. The buffer of the previous frame is reset and receives the allocations of the new frame.
+    //! Every pointer allocated two frames ago becomes invalid
+    void Flip();
+
+    //! \return the number of calls to Flip() so far
+    unsigned int GetFrame() const { return mFrame; }
+
+    //! \return the number of bytes allocated in the current frame, alignment padding included
+    size_t GetFrameBytes() const { return mBuffers[mCurrent].mBytes; }
+
+    //! \return the number of allocations made in the current frame
+    unsigned int GetFrameAllocationCount() const { return mBuffers[mCurrent].mAllocationCount; }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(FrameAllocator);
+
+    //! Header of a page, the memory of the page follows it
+    struct Page
+    {
+        Page*  mNext; //!< previous page of the buffer
+        size_t mSize; //!< size of the memory of the page, header excluded
+        size_t mUsed; //!< bytes used so far
+    };
+
+    //! Memory of a frame
+    struct Buffer
+    {
+        Page*        mPages;           //!< page list, the head is the page being filled
+        size_t       mBytes;           //!< bytes allocated, alignment padding included
+        unsigned int mAllocationCount; //!< number of allocations
+    };
+
+    //! Header stored right before every allocation, only with the checks enabled
+    struct AllocationHeader
+    {
+        unsigned int mMagic; //!< sAllocationMagic, to catch pointers not coming from this allocator
+        unsigned int mFrame; //!< frame of the allocation
+        unsigned int mSize;  //!< requested size
+        unsigned int mPad;
+    };
+
+    //! reserves a page with the system heap
+    //! \return the page, nullptr if out of memory
+    static Page* NewPage(size_t size);
+
+    //! reclaims all the allocations of a buffer. When the buffer overflowed, its pages are merged into one
+    void ResetBuffer(Buffer& buffer);
+
+    void Lock()   { while (mLock.test_and_set(std::memory_order_acquire)) {} }
+    void Unlock() { mLock.clear(std::memory_order_release); }
+
+    unsigned int mAllocId;  //!< "Unique" allocator ID
+    size_t       mPageSize; //!< size of the first page of each buffer
+    Buffer       mBuffers[2];
+    int          mCurrent;  //!< index of the buffer of the current frame
+    unsigned int mFrame;    //!< frame counter
+    std::atomic_flag mLock; //!< spin lock, the editor allocates from its own thread
+};
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_FRAMEALLOCATOR_H
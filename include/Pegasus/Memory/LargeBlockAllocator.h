@@ -0,0 +1,149 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LargeBlockAllocator.h
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Arena for the large buffers of the node data (texture layers, mesh streams),
+//!         carved out of 2MB chunks mapped with huge pages when available.
+
+#ifndef PEGASUS_MEMORY_LARGEBLOCKALLOCATOR_H
+#define PEGASUS_MEMORY_LARGEBLOCKALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Memory/PageMapping.h"
+#include <atomic>
+
+namespace Pegasus {
+namespace Memory {
+
+//! Arena for large buffers.
+//! The memory is mapped from the operating system in chunks of sHugePageSize, aligned to their size,
+//! so a chunk fits in a single huge page TLB entry. Blocks are 64 bytes aligned (a cache line and the widest SIMD register),
+//! allocated first fit, split and coalesced with boundary tags. Allocations larger than a chunk get their own mapping.
+//! Allocations under the threshold go to a small allocator, so the arena can serve a whole memory category
+class LargeBlockAllocator : public Alloc::IAllocator
+{
+public:
+    //! Constructor
+    //! \param allocId ID of the allocator for the memory stats
+    //! \param smallAllocator Allocator receiving the allocations under the threshold
+    //! \param threshold Size from which the allocations are served by the arena
+    LargeBlockAllocator(unsigned int allocId, Alloc::IAllocator* smallAllocator, size_t threshold = sDefaultThreshold);
+
+    //! Destructor
+    virtual ~LargeBlockAllocator();
+
+
+    // IAllocator interface
+    virtual void* Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void* AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void Delete(void* ptr);
+
+    //! Unmaps the chunks left empty, kept until now to serve the next allocations
+    void Trim();
+
+    //! \return the number of chunks currently mapped
+    unsigned int GetChunkCount() const { return mChunkCount; }
+
+    //! \return the number of mapped chunks backed by huge pages
+    unsigned int GetHugePageChunkCount() const { return mHugePageChunkCount; }
+
+    //! \return the bytes currently mapped from the operating system
+    size_t GetMappedBytes() const { return mMappedBytes; }
+
+    //! Alignment of the blocks
+    static const size_t sBlockAlignment = 64;
+
+    //! Default size from which the allocations are served by the arena
+    static const size_t sDefaultThreshold = 64 * 1024;
+
+    //! Maximum number of empty chunks kept mapped, the others are given back to the system
+    static const unsigned int sMaxRetainedChunks = 2;
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(LargeBlockAllocator);
+
+    struct Chunk;
+
+    //! Header of a block, right before its memory. The size keeps the memory of the block aligned
+    struct BlockHeader
+    {
+        size_t       mSize;      //!< size of the block, header included
+        size_t       mPrevSize;  //!< size of the previous block of the chunk, 0 for the first block
+        Chunk*       mChunk;     //!< chunk of the block
+        BlockHeader* mNextFree;  //!< next free block, when free
+        BlockHeader* mPrevFree;  //!< previous free block, when free
+        size_t       mRequested; //!< size requested by the caller, when allocated
+        unsigned int mFree;      //!< 1 if the block is free
+        unsigned int mPad[(sBlockAlignment - 6 * sizeof(size_t) - sizeof(unsigned int)) / sizeof(unsigned int)];
+    };
+
+    //! Header of a chunk, at its start and aligned like the blocks
+    struct Chunk
+    {
+        Chunk*       mNext;       //!< next chunk of the arena
+        Chunk*       mPrev;       //!< previous chunk of the arena
+        size_t       mSize;       //!< mapped size
+        unsigned int mHugePages;  //!< 1 if the chunk is backed by huge pages
+        unsigned int mDedicated;  //!< 1 if the chunk holds a single allocation larger than a regular chunk
+        unsigned int mPad[(sBlockAlignment - 3 * sizeof(size_t) - 2 * sizeof(unsigned int)) / sizeof(unsigned int)];
+    };
+
+    //! maps a chunk and adds it to the arena, with a single free block
+    //! \param size mapped size, multiple of sHugePageSize
+    //! \return the chunk, nullptr if out of memory
+    Chunk* NewChunk(size_t size, bool dedicated);
+
+    //! removes a chunk from the arena and unmaps it
+    void ReleaseChunk(Chunk* chunk);
+
+    //! free list management
+    void PushFree(BlockHeader* block);
+    void RemoveFree(BlockHeader* block);
+
+    //! \return the block following a block in its chunk, nullptr for the last block
+    BlockHeader* GetNextBlock(BlockHeader* block) const;
+
+    //! \return true if the block covers its whole chunk
+    bool IsWholeChunk(const BlockHeader* block) const;
+
+    //! marks the huge page of a chunk header in the chunk map, written under the lock
+    //! \return false if out of memory
+    bool MapChunk(const Chunk* chunk, unsigned char value);
+
+    //! \return true if the huge page at an address starts a chunk of the arena, read without the lock
+    bool OwnsChunk(size_t base) const;
+
+    void Lock()   { while (mLock.test_and_set(std::memory_order_acquire)) {} }
+    void Unlock() { mLock.clear(std::memory_order_release); }
+
+    //! Number of huge pages covered by a leaf of the chunk map
+    static const unsigned int sChunkMapLeafBits = 13;
+
+    unsigned int        mAllocId;
+    Alloc::IAllocator*  mSmallAllocator;
+    size_t              mThreshold;
+    std::atomic_flag    mLock;               //!< spin lock, the allocations are large and rare
+    Chunk*              mChunks;             //!< mapped chunks
+    BlockHeader*        mFreeBlocks;         //!< free blocks, of all the regular chunks
+    unsigned int        mChunkCount;
+    unsigned int        mHugePageChunkCount;
+    unsigned int        mEmptyChunkCount;    //!< regular chunks without allocation
+    unsigned int        mLiveBlocks;         //!< blocks currently allocated
+    size_t              mMappedBytes;
+
+    //! Chunk map, two levels indexed by the huge pages of the address space, 1 for the pages starting a chunk.
+    //! Leaves are created on demand and kept until destruction, so the lookups need no lock
+    std::atomic<std::atomic<unsigned char>*>* mChunkMap;
+};
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_LARGEBLOCKALLOCATOR_H
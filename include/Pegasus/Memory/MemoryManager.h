@@ -13,6 +13,8 @@
 #define PEGASUS_MEMORY_MEMORYMANAGER_H
 
 #include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Memory/MemoryStats.h"
+#include "Pegasus/Memory/BudgetAllocator.h"
 
 namespace Pegasus {
 namespace Memory {
@@ -50,6 +52,69 @@ Alloc::IAllocator* GetTimelineAllocator();
 //! \return Window allocator
 Alloc::IAllocator* GetWindowAllocator();
 
+//! Get the frame allocator, for temporaries that do not outlive the next frame.
+//! Allocation is a pointer bump, and Delete() does not need to be called
+//! \return Frame allocator
+Alloc::IAllocator* GetFrameAllocator();
+
+//! End the frame of the frame allocator. Allocations made two frames ago become invalid.
+//! Called once per frame by the application
+void FlipFrameAllocator();
+
+//! Return the slots cached by the calling thread in the allocators of the memory manager.
+//! Called by the worker threads before exiting, so the memory they cached goes back to the allocators
+void ReleaseThreadCaches();
+
+//! Memory categories, one per allocator of the memory manager
+enum MemoryCategory
+{
+    MEMORY_GLOBAL = 0,
+    MEMORY_CORE,
+    MEMORY_RENDER,
+    MEMORY_NODE,
+    MEMORY_NODE_DATA,
+    MEMORY_PROPERTY_POINTER,
+    MEMORY_TIMELINE,
+    MEMORY_WINDOW,
+    MEMORY_FRAME,
+    MEMORY_CATEGORY_COUNT
+};
+
+//! Get the name of a memory category
+//! \param category Memory category
+//! \return Name of the category, for display
+const char* GetMemoryCategoryName(MemoryCategory category);
+
+//! Get the statistics of the allocator of a memory category.
+//! The counters of all the threads are aggregated by this call, so it is not meant to be called per allocation
+//! \param category Memory category
+//! \param stats Receives the statistics, all zeros if PEGASUS_ENABLE_MEMORY_STATS is 0
+void GetMemoryStats(MemoryCategory category, MemoryStats& stats);
+
+//! Set the budget of a memory category. All the categories except the frame allocator support budgets.
+//! Allocations over the soft limit send an event to the callback of the category, so caches can be evicted.
+//! Allocations over the hard limit send an event, then follow the policy if the callback did not free enough memory
+//! \param category Memory category
+//! \param softLimit Bytes above which the callback is asked to evict memory, 0 for no soft limit
+//! \param hardLimit Bytes that cannot be exceeded, 0 for no hard limit
+//! \param policy Behavior of the allocations exceeding the hard limit
+void SetMemoryBudget(MemoryCategory category, size_t softLimit, size_t hardLimit, BudgetPolicy policy = BUDGET_POLICY_ASSERT);
+
+//! Set the callback receiving the budget events of a memory category
+//! \param category Memory category
+//! \param callback Callback, nullptr to remove it
+//! \param userData User data given to the callback
+void SetMemoryBudgetCallback(MemoryCategory category, BudgetCallback callback, void* userData);
+
+//! Get the bytes counted in the budget of a memory category
+//! \param category Memory category
+//! \return the bytes currently allocated, as requested by the callers, 0 for the categories without budget
+size_t GetMemoryBudgetUsage(MemoryCategory category);
+
+//! Start a new frame for the memory statistics of all the categories, and for the allocation sites when tracked.
+//! The frame counters go back to zero, the previous values become the last frame counters
+void ResetMemoryFrameStats();
+
 
 }   // namespace Memory
 }   // namespace Pegasus
@@ -0,0 +1,70 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MemoryStats.h
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Allocator statistics. Counters are written per thread without synchronization,
+//!         and aggregated when they are read.
+
+#ifndef PEGASUS_MEMORY_MEMORYSTATS_H
+#define PEGASUS_MEMORY_MEMORYSTATS_H
+
+namespace Pegasus {
+namespace Memory {
+
+//! Highest allocator ID tracked by the statistics, plus one
+const unsigned int sMaxMemoryStatsIds = 16;
+
+//! Number of buckets of the size histogram.
+//! Bucket 0 counts the allocations under 16 bytes, bucket i the allocations in [2^(i+3), 2^(i+4)),
+//! and the last bucket everything bigger
+const int sMemoryHistogramBucketCount = 16;
+
+//! Statistics of an allocator
+struct MemoryStats
+{
+    long long    mLiveBytes;            //!< bytes currently allocated, as seen by the allocator
+    int          mLiveAllocations;      //!< number of allocations currently alive
+    long long    mPeakBytes;            //!< highest mLiveBytes observed (sampled when the stats are read and on frame reset)
+    unsigned int mFrameAllocations;     //!< allocations since the last frame reset
+    unsigned int mFrameFrees;           //!< frees since the last frame reset
+    unsigned int mLastFrameAllocations; //!< allocations of the last complete frame
+    unsigned int mLastFrameFrees;       //!< frees of the last complete frame
+    unsigned int mHistogram[sMemoryHistogramBucketCount]; //!< number of allocations ever made, per size bucket
+};
+
+//! \param size size of an allocation in bytes
+//! \return the histogram bucket of the size
+int GetMemoryHistogramBucket(size_t size);
+
+//! Records an allocation in the statistics of the calling thread.
+//! Called by the allocators, compiled out when PEGASUS_ENABLE_MEMORY_STATS is 0
+//! \param allocId ID of the allocator
+//! \param bytes bytes taken by the allocation
+//! \param requestedSize size requested by the caller, used for the histogram
+void RecordAllocation(unsigned int allocId, size_t bytes, size_t requestedSize);
+
+//! Records a free in the statistics of the calling thread.
+//! The thread freeing can be different from the thread allocating
+//! \param allocId ID of the allocator
+//! \param bytes bytes taken by the allocations
+//! \param count number of allocations released at once, for allocators freeing in bulk
+void RecordFree(unsigned int allocId, size_t bytes, unsigned int count = 1);
+
+//! Aggregates the counters of all the threads for an allocator
+//! \param allocId ID of the allocator
+//! \param stats Receives the statistics, all zeros if the statistics are disabled
+void GetAllocatorStats(unsigned int allocId, MemoryStats& stats);
+
+//! Starts a new frame for all the allocators, the frame counters go back to zero
+void ResetAllocatorFrameStats();
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_MEMORYSTATS_H
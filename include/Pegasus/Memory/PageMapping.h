@@ -0,0 +1,42 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PageMapping.h
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Mapping of memory pages from the operating system, with huge pages when available.
+
+#ifndef PEGASUS_MEMORY_PAGEMAPPING_H
+#define PEGASUS_MEMORY_PAGEMAPPING_H
+
+namespace Pegasus {
+namespace Memory {
+
+//! Size of a huge page, the granularity and alignment of the mapped memory
+const size_t sHugePageSize = 2 * 1024 * 1024;
+
+//! Maps memory from the operating system, backed by huge pages when the system allows it
+//! (large pages, MAP_HUGETLB or transparent huge pages), regular pages otherwise. The memory is zeroed
+//! \param size Size to map, multiple of sHugePageSize
+//! \param hugePages Receives true if the memory is backed by huge pages. For transparent huge pages,
+//!                  true if the range was accepted for them, the kernel backs it on first touch when it can
+//! \return the memory, aligned to sHugePageSize, nullptr if out of memory
+void* MapPages(size_t size, bool& hugePages);
+
+//! Gives mapped memory back to the operating system
+//! \param ptr Memory returned by MapPages
+//! \param size Size given to MapPages
+//! \param hugePages Value returned by MapPages
+void UnmapPages(void* ptr, size_t size, bool hugePages);
+
+//! \return the number of page faults of the process so far, 0 if unknown
+unsigned long long GetPageFaultCount();
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_PAGEMAPPING_H
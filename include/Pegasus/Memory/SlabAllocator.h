@@ -0,0 +1,210 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SlabAllocator.h
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Size class slab allocator. Small allocations are served from fixed size slots
+//!         of 64KB pages, with O(1) alloc and free. Large allocations go to the system heap.
+
+#ifndef PEGASUS_MEMORY_SLABALLOCATOR_H
+#define PEGASUS_MEMORY_SLABALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Memory/mallocfreeallocator.h"
+#include <atomic>
+
+namespace Pegasus {
+namespace Memory {
+
+//! Size class slab allocator.
+//! Every allocation up to sMaxSlabSize bytes, with an alignment up to sMaxSlabAlignment,
+//! is rounded up to a size class and served from a page holding only slots of that class.
+//! Pages are aligned to their size, so the page header of a slot is found by masking its address.
+//! Bigger allocations fall back to a MallocFreeAllocator.
+//!
+//! Each thread has a magazine cache of free slots per size class in front of the pages,
+//! so allocations and frees take no lock in the common case. Slots move between the caches
+//! and the pages in batches. A thread freeing more than it allocates (cross-thread frees) hands
+//! its full batches to a lock-free depot, where the allocating threads pick them up.
+class SlabAllocator : public Alloc::IAllocator
+{
+public:
+    //! Size of a slab page, pages are aligned to their size
+    static const unsigned int sPageSize = 64 * 1024;
+
+    //! Number of pages reserved at once from the system heap
+    static const int sPagesPerChunk = 16;
+
+    //! Biggest allocation served by the slabs, bigger allocations go to the system heap
+    static const unsigned int sMaxSlabSize = 2048;
+
+    //! Biggest alignment honored by the slabs, bigger alignments go to the system heap
+    static const unsigned int sMaxSlabAlignment = 64;
+
+    //! Number of size classes
+    static const int sSizeClassCount = 14;
+
+    //! Biggest number of slots moved at once between a thread cache and the pages
+    static const int sMaxBatchSize = 32;
+
+    //! Number of full batches the depot of a size class holds before returning them to the pages
+    static const int sMaxDepotBatches = 16;
+
+    //! Constructor
+    //! \param allocId ID to use for this allocator.  Should be "Unique"
+    SlabAllocator(unsigned int allocId);
+
+    //! Destructor
+    virtual ~SlabAllocator();
+
+
+    // IAllocator interface
+    virtual void* Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void* AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void Delete(void* ptr);
+
+    //! \param sizeClass the size class index, between 0 and sSizeClassCount - 1
+    //! \return the size in bytes of the slots of the size class
+    static unsigned int GetSizeClassSize(int sizeClass);
+
+    //! \param sizeClass the size class index, between 0 and sSizeClassCount - 1
+    //! \return the number of slots moved at once between a thread cache and the pages
+    static int GetBatchSize(int sizeClass);
+
+    //! Returns the slots cached by the calling thread and the slots of the depot to the pages,
+    //! so empty pages can be used by other size classes
+    void Trim();
+
+    //! Returns the slots cached by the calling thread to the pages, and hands its cache over
+    //! to the next thread using the allocator. Worker threads call it before exiting,
+    //! otherwise the slots cached by a dead thread stay out of reach until the allocator is destroyed
+    void ReleaseThreadCache();
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(SlabAllocator);
+
+    //! Header at the start of each page
+    struct Page
+    {
+        Page* mNext;       //!< next page in the partial list of the size class, or in the free page list
+        Page* mPrev;       //!< previous page in the partial list of the size class
+        void* mFreeList;   //!< slots freed in this page
+        char* mBump;       //!< first slot never allocated in this page
+        int   mSizeClass;  //!< size class of the slots, -1 if the page is in the free page list
+        int   mUsed;       //!< number of live slots
+        int   mCapacity;   //!< number of slots that fit in the page
+    };
+
+    //! Free slots cached by a thread. Only the owner thread reads and writes it
+    struct ThreadCache
+    {
+        ThreadCache* mNext;      //!< next cache of the allocator
+        const void*  mThreadKey; //!< identifies the owner thread, nullptr once released by its thread
+        int          mLiveDelta; //!< allocations minus frees made by the owner thread
+        void*        mSlots[sSizeClassCount];     //!< free slots, linked through their first word
+        int          mSlotCount[sSizeClassCount]; //!< number of slots in mSlots
+        void*        mBatches[sSizeClassCount];   //!< spare full batches, linked through the second word of their first slot
+    };
+
+    //! Page map, set of the pages reserved by this allocator. Open addressing with linear probing.
+    //! Read without the lock, so a map that grows is replaced and kept alive until destruction
+    struct PageMap
+    {
+        PageMap*     mRetired;    //!< map replaced by this one
+        unsigned int mCapacity;   //!< power of 2
+        unsigned int mCount;      //!< number of pages in the map
+        std::atomic<Page*> mEntries[1];
+    };
+
+    //! \return the cache of the calling thread, nullptr if out of memory
+    ThreadCache* GetThreadCache();
+
+    //! \return the cache of the calling thread, created or taken over if needed. Slow path of GetThreadCache()
+    ThreadCache* FindThreadCache();
+
+    //! fills the cache of a size class with a batch from the cache spares, the depot or the pages
+    //! \return true if success, false if out of memory
+    bool RefillCache(ThreadCache* cache, int sizeClass);
+
+    //! moves a batch of slots out of the cache of a size class, to the cache spares, the depot or the pages
+    void FlushCache(ThreadCache* cache, int sizeClass);
+
+    //! returns all the slots of a cache to the pages. Expects the lock to be held
+    void ReleaseCacheSlots(ThreadCache* cache);
+
+    //! returns a list of slots linked through their first word to the pages. Expects the lock to be held
+    void ReleaseSlots(void* slots);
+
+    //! returns a list of batches linked through the second word of their first slot to the pages. Expects the lock to be held
+    void ReleaseBatches(void* batches);
+
+    //! \return the size class for a size and alignment, -1 if it has to go to the system heap
+    int GetSizeClass(size_t size, Alloc::Alignment align) const;
+
+    //! allocates a slot of a size class. Expects the lock to be held
+    //! \return the slot, nullptr if out of memory
+    void* AllocSlot(int sizeClass);
+
+    //! frees a slot. Expects the lock to be held
+    void FreeSlot(Page* page, void* ptr);
+
+    //! grabs an empty page and sets it up for a size class. Expects the lock to be held
+    //! \return the page, linked in the partial list of the size class. nullptr if out of memory
+    Page* NewPage(int sizeClass);
+
+    //! reserves a new chunk of pages from the system heap, and adds its pages to the free page list
+    //! \return true if success, false if out of memory
+    bool NewChunk();
+
+    //! links a page at the head of the partial list of its size class
+    void LinkPartialPage(Page* page);
+
+    //! unlinks a page from the partial list of its size class
+    void UnlinkPartialPage(Page* page);
+
+    //! looks for a page in the page map, without taking the lock
+    //! \return true if the page belongs to this allocator
+    bool FindPage(const Page* page) const;
+
+    //! grows the page map so it can hold a number of pages
+    //! \return true if success, false if out of memory
+    bool ReservePageMap(unsigned int pageCount);
+
+    //! adds a page to a page map. The map must have been reserved
+    static void InsertPage(PageMap* pageMap, Page* page);
+
+    void Lock()   { while (mLock.test_and_set(std::memory_order_acquire)) {} }
+    void Unlock() { mLock.clear(std::memory_order_release); }
+
+    MallocFreeAllocator mLargeAllocator; //!< allocator for the allocations the slabs cannot serve
+    unsigned int mAllocId;               //!< "Unique" allocator ID, shared with mLargeAllocator
+    std::atomic_flag mLock;              //!< spin lock, the editor allocates from its own thread
+
+    Page*  mPartialPages[sSizeClassCount]; //!< pages with free slots, per size class
+    Page*  mFreePages;                     //!< empty pages, ready to be set up for any size class
+    unsigned char mSizeClassLookup[sMaxSlabSize / 16 + 1]; //!< size class per 16 byte granule
+
+    void** mChunks;           //!< system heap blocks of the page chunks
+    int    mChunkCount;       //!< number of chunks
+    int    mChunkCapacity;    //!< capacity of mChunks
+
+    std::atomic<PageMap*> mPageMap; //!< hash set of the pages of this allocator
+
+    unsigned int mSerial;      //!< unique number of the allocator, identifies it in the thread cache tables
+    ThreadCache* mThreadCaches; //!< caches of all the threads that used the allocator
+    std::atomic<void*> mDepot[sSizeClassCount];     //!< full batches freed by the threads, linked through the second word of their first slot
+    std::atomic<int>   mDepotCount[sSizeClassCount]; //!< approximate number of batches in the depot
+
+    int    mLiveSlots;        //!< number of live slab allocations made without a thread cache
+};
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_SLABALLOCATOR_H
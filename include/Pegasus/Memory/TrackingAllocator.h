@@ -0,0 +1,109 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TrackingAllocator.h
+//! \author David Worsham
+//! \date   October 19th 2026
+//! \brief  Allocator decorator recording the call site of every allocation,
+//!         to find leaks and the sites allocating the most per frame.
+
+#ifndef PEGASUS_MEMORY_TRACKINGALLOCATOR_H
+#define PEGASUS_MEMORY_TRACKINGALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+
+namespace Pegasus {
+namespace Memory {
+
+//! Maximum number of call sites tracked. The allocations of the sites above the limit are grouped into a single site
+const unsigned int sMaxAllocationSites = 4096;
+
+//! Counters of an allocation call site
+struct AllocationSite
+{
+    const char*  mFile;                 //!< file of the call site, nullptr when only the caller address is known
+    const void*  mAddress;              //!< address of the caller when the file is unknown
+    unsigned int mLine;                 //!< line of the call site
+    const char*  mDebugText;            //!< debug text of the first allocation of the site
+    long long    mLiveBytes;            //!< bytes currently allocated by the site, as requested by the caller
+    int          mLiveAllocations;      //!< number of allocations of the site currently alive
+    unsigned int mFrameAllocations;     //!< allocations since the last frame reset
+    unsigned int mLastFrameAllocations; //!< allocations of the last complete frame
+};
+
+//! Sort order of the sites returned by GetAllocationSites
+enum AllocationSiteOrder
+{
+    ALLOCATION_SITE_ORDER_LIVE_BYTES,  //!< most live bytes first, to find leaks
+    ALLOCATION_SITE_ORDER_LAST_FRAME   //!< most allocations during the last frame first, to find the churn
+};
+
+//! Allocator decorator recording the call site of every allocation.
+//! The file and line given to the allocator (by PG_NEW for example) identify the site.
+//! When no file is given, the address of the caller is used instead.
+//! A header is stored before every allocation, to find its site when it is deleted.
+//! The sites are shared by all the tracking allocators, in a lock-free hash table
+class TrackingAllocator : public Alloc::IAllocator
+{
+public:
+    //! Constructor
+    //! \param allocator Allocator to track, receiving the allocations with their header
+    TrackingAllocator(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    virtual ~TrackingAllocator();
+
+
+    // IAllocator interface
+    virtual void* Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void* AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void Delete(void* ptr);
+
+    //! \return the tracked allocator
+    Alloc::IAllocator* GetTrackedAllocator() const { return mAllocator; }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(TrackingAllocator);
+
+    //! Header stored right before every allocation
+    struct AllocationHeader
+    {
+        unsigned int       mSite;   //!< index of the call site
+        unsigned int       mOffset; //!< distance from the memory of the tracked allocator to the returned memory
+        unsigned long long mSize;   //!< requested size
+    };
+
+    //! records an allocation and writes its header
+    //! \return the memory returned to the caller
+    static void* Track(void* block, size_t offset, size_t size, const char* debugText, const char* file, unsigned int line, const void* caller);
+
+    Alloc::IAllocator* mAllocator; //!< tracked allocator
+};
+
+//! Gets the sites with the most live bytes or allocations per frame, sorted
+//! \param sites Receives the sites
+//! \param maxSites Maximum number of sites to return
+//! \param order Sort order of the sites
+//! \return the number of sites written
+unsigned int GetAllocationSites(AllocationSite* sites, unsigned int maxSites, AllocationSiteOrder order);
+
+//! Logs the sites with the most live bytes, with their number of live allocations
+//! \param maxSites Maximum number of sites to log
+void DumpLiveAllocationSites(unsigned int maxSites);
+
+//! Logs the sites with the most allocations during the last frame
+//! \param maxSites Maximum number of sites to log
+void DumpChurnAllocationSites(unsigned int maxSites);
+
+//! Starts a new frame for the sites, the frame counters go back to zero
+void ResetAllocationSiteFrame();
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_TRACKINGALLOCATOR_H
@@ -38,6 +38,14 @@ private:
     // No copies allowed
     PG_DISABLE_COPY(MallocFreeAllocator);
 
+    //! Header stored right before every allocation, 16 bytes to keep the allocations aligned
+    struct ChunkHeader
+    {
+        unsigned long long mSize; //!< size requested for the allocation, for the memory stats
+        unsigned int mOffset;  //!< distance from the start of the malloc chunk to the allocation
+        unsigned int mAllocId; //!< ID of the allocator owning the allocation
+    };
+
     unsigned int mAllocId; //!< "Unique" allocator ID
 };
 
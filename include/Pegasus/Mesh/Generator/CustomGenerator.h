@@ -36,6 +36,14 @@ public:
 
     MeshDataRef EditMeshData();
 
+    //! Test if the data of the generator can be generated on a worker thread of the node scheduler
+    //! \return False, the mesh data is edited by the user code on its own thread
+    virtual bool IsGenerationThreadSafe() const { return false; }
+
+    //! Test if the data of the generator can be stored in the node data cache
+    //! \return False, the mesh data is edited by the user code, not generated from the properties
+    virtual bool IsDataCacheable() const { return false; }
+
 protected:
 
     //! Generate the content of the data associated with the texture generator
@@ -13,7 +13,7 @@
 #define PEGASUS_ICOSPHERE_GENERATOR_H
 
 #include "Pegasus/Mesh/MeshGenerator.h"
-#include "Pegasus/Utils/TesselationTable.h"
+#include "Pegasus/Utils/EdgeTable.h"
 
 namespace Pegasus
 {
@@ -56,7 +56,8 @@ protected:
     //! recursive function that tesselates the icosphere
     void Tesselate(MeshData * meshData, int level, unsigned short a, unsigned short b, unsigned short c);
 
-    Utils::TesselationTable mIdxCache;
+    //! midpoint indices of the split edges, kept allocated for the next generations
+    Utils::EdgeTable mIdxCache;
        
 };
 
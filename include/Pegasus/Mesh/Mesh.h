@@ -77,6 +77,8 @@ public:
     //!         or to one of the input nodes, cannot be a null reference.
     //! \note Calls GetUpdatedData() internally, and regenerate the mesh data
     //!       if any part of the graph is dirty
+    //! \note While new data is generated asynchronously, the last completed data is returned
+    //!       and its GPU data is kept as is
     virtual MeshDataReturn GetUpdatedMeshData();
 
 
@@ -113,6 +115,10 @@ protected:
     //! Destructor
     virtual ~Mesh();
 
+    //! Release the GPU data of the mesh data replaced by the asynchronously generated one
+    //! \param previousData Previous mesh data
+    virtual void OnAsyncDataSwapped(Graph::NodeData* previousData);
+
     //! Set the configuration of the mesh
     //! \warning Can be done only after the constructor has been called, when no input node is connected yet.
     //!          In case of error, the configuration is not set
@@ -93,6 +93,11 @@ public:
         return !(*this == other);
     }
 
+    //! Combine the configuration with a content hash, identical across runs
+    //! \param hash Content hash so far
+    //! \return Hash combined with the flags, the primitive type and the attributes of the input layout
+    unsigned long long Hash(unsigned long long hash) const;
+
 private:
     //! boolean that determines if this mesh is indexed or not
     bool     mIsIndexed;
@@ -100,6 +100,21 @@ public:
 
     //! Destroys all internal data and initializes this mesh data as completely new
     void Clear();
+
+    //! Write the vertex streams and the indices, to store them in the node data cache
+    //! \param stream Stream receiving the content
+    //! \return True if written, false in COMPUTE mode (the mesh has no CPU data)
+    virtual bool Serialize(Utils::ByteStream& stream) const;
+
+    //! Restore the vertex streams and the indices written by Serialize()
+    //! \param buffer Bytes written by Serialize()
+    //! \param size Number of bytes
+    //! \return True if the stream strides match the configuration of the data
+    virtual bool Deserialize(const char* buffer, int size);
+
+    //! Get the memory used by the vertex streams and the indices
+    //! \return Size in bytes of the allocated buffers
+    virtual unsigned int GetMemorySize() const;
     
 protected:
 
@@ -149,6 +164,9 @@ private:
         //! returns the actual buffer of this stream
         void* GetBuffer() { return mBuffer; }
 
+        //! returns the actual buffer of this stream (const version)
+        const void* GetBuffer() const { return mBuffer; }
+
         //! sets the stride of this stream
         void SetStride(int stride) { mStride = stride; }
 
@@ -75,6 +75,14 @@ public:
     //!       Redefine this function in derived classes to change its behavior
     //virtual NodeDataReturn GetUpdatedData(bool & updated);
 
+    //! Test if the data of the operator can be generated on a worker thread of the node scheduler
+    //! \return True unless the operator runs on the GPU
+    virtual bool IsGenerationThreadSafe() const { return GetMode() != Graph::Node::COMPUTE; }
+
+    //! Test if the data of the operator can be stored in the node data cache
+    //! \return True unless the operator runs on the GPU, whose mesh data has no CPU copy
+    virtual bool IsDataCacheable() const { return GetMode() != Graph::Node::COMPUTE; }
+
     //! Append a mesh generator node to the list of input nodes
     virtual void AddGeneratorInput(MeshGeneratorIn gen);
 
@@ -96,6 +104,11 @@ protected:
     //! \return Pointer to the data being allocated
     virtual Graph::NodeData * AllocateData() const;
 
+    //! Combine the configuration of the operator with its content hash
+    //! \param hash Content hash so far
+    //! \return Hash combined with the configuration
+    virtual unsigned long long HashContent(unsigned long long hash) const { return mConfiguration.Hash(hash); }
+
     //! Gets the GPU factory for the mesh
     IMeshFactory* GetFactory() { return mFactory; }
 
@@ -152,6 +152,19 @@
 
 //----------------------------------------------------------------------------------------
 
+// detecting the x86 family of processors (32 and 64 bits), for the SSE2 and AVX2 code paths
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#define PEGASUS_ARCH_X86  1
+
+#else
+
+#define PEGASUS_ARCH_X86  0
+
+#endif
+
+//----------------------------------------------------------------------------------------
+
 // Compiler
 #ifdef _MSC_VER
 #ifdef __INTEL_COMPILER
@@ -259,6 +272,13 @@
 #define PEGASUS_AVOID_EMPTY_FILE_WARNING
 #endif
 
+//! Macro declaring a variable with one instance per thread
+#if PEGASUS_COMPILER_MSVC
+#define PEGASUS_THREAD_LOCAL __declspec(thread)
+#elif PEGASUS_COMPILER_GCC
+#define PEGASUS_THREAD_LOCAL __thread
+#endif
+
 //! Macro combination that sets up struct alignment in c++
 #if PEGASUS_COMPILER_MSVC
 #define PEGASUS_ALIGN_BEGIN(n) __declspec(align(n))
@@ -327,6 +347,17 @@
 // so the user has easy documentation access to the available BlockScript functions
 #define PEGASUS_ENABLE_BS_REFLECTION_INFO               (PEGASUS_ENABLE_PROXIES)
 
+// Enable the allocator statistics (live bytes, peaks, allocations per frame, size histograms).
+// Cheap enough to be kept in profile builds
+#define PEGASUS_ENABLE_MEMORY_STATS                     (PEGASUS_DEBUG || PEGASUS_OPT || PEGASUS_PROFILE)
+
+// Enable the poisoning of the memory reclaimed by the frame allocator, and the detection of pointers surviving a frame reset
+#define PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS           (PEGASUS_DEBUG)
+
+// Enable the tracking of the allocation call sites, to find leaks and the sites with the most allocations per frame.
+// Adds a header to every allocation of the memory manager allocators
+#define PEGASUS_ENABLE_ALLOCATION_TRACKING              (PEGASUS_DEBUG)
+
 //! Enable size checks in the property grid accessors
 #define PEGASUS_ENABLE_PROPERTYGRID_SAFE_ACCESSOR       (PEGASUS_DEBUG)
 
@@ -17,6 +17,7 @@
 #include "Pegasus/PropertyGrid/Proxy/PropertyGridManagerProxy.h"
 #include "Pegasus/Utils/DependsOnStatic.h"
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/HashMap.h"
 #include "Pegasus/PropertyGrid/PropertyGridEnumType.h"
 
 namespace Pegasus {
@@ -77,7 +78,7 @@ public:
     //! \return Information about the registered class, nullptr if not found
     //! \note An assertion is thrown if the class is not found
     //! \note That function is slower than the index-based one,
-    //!       as it has to perform a search
+    //!       as it has to perform a hash lookup
     const PropertyGridClassInfo * GetClassInfo(const char * className) const;
 
     //! Must get called at the initialization of main() once. This will ensure all the metadata of class
@@ -136,6 +137,12 @@ private:
     //! List of information structures of enumerations
     Utils::Vector<EnumTypeInfo> mEnumInfos;
 
+    //! Index in \a mClassInfos of each class name
+    Utils::HashMap<const char*, unsigned int, Utils::StringHashTraits> mClassInfoIndices;
+
+    //! Index in \a mEnumInfos of each enumeration name
+    Utils::HashMap<const char*, unsigned int, Utils::StringHashTraits> mEnumInfoIndices;
+
     //! Class information currently being edited
     //! \note Set by \a BeginDeclareProperties(), unset by \a EndDeclareProperties()
     PropertyGridClassInfo * mCurrentClassInfo;
@@ -193,7 +193,8 @@ namespace PropertyGrid {
         inline PPG::PropertyDefinition<type>::ReturnType Get##name() const                                          \
             { return mProperty##name; }                                                                             \
         inline void Set##name(PPG::PropertyDefinition<type>::ParamType value)                                       \
-            { PPG::PropertyDefinition<type>::CopyProperty(mProperty##name, value);                                  \
+            { PreparePropertyGridWrite();                                                                           \
+              PPG::PropertyDefinition<type>::CopyProperty(mProperty##name, value);                                  \
               PEGASUS_EVENT_DISPATCH(((Pegasus::PropertyGrid::PropertyGridObject*)this), Pegasus::PropertyGrid::ValueChangedEventIndexed, Pegasus::PropertyGrid::PROPERTYCATEGORY_CLASS, mProperty##name##Index ); \
               InvalidatePropertyGrid(); }                                                                           \
     private:                                                                                                        \
@@ -387,6 +388,7 @@ public:
 #if PEGASUS_ENABLE_PROPERTYGRID_SAFE_ACCESSOR
             PG_ASSERTSTR(sizeof(T) == mSize, "Wrong template type when setting the value of a property.");
 #endif
+            PreparePropertyGridWrite();
             *static_cast<T *>(mPtr) = value;
             InvalidatePropertyGrid();
             PEGASUS_EVENT_DISPATCH(mObj, ValueChangedEventIndexed, mCategory, mIndex);
@@ -441,6 +443,10 @@ private:
     //!       since the latter has functions returning PropertyAccessor by value
     inline void InvalidatePropertyGrid() const;
 
+    //! Prepare the attached PropertyGridObject for a write of the property
+    //! \note Defined after PropertyGridObject, for the same reason as InvalidatePropertyGrid()
+    inline void PreparePropertyGridWrite() const;
+
     //! Non-null pointer to the property grid object owning the property
     //! (nullptr only if using the default constructor)
     PropertyGridObject * mObj;
@@ -582,7 +588,13 @@ public:
     
     //! Invalidate the property grid (sets the dirty flag)
     //! \note Called automatically by setters, but can be used to force the dirty flag manually
-    inline void InvalidatePropertyGrid() { mPropertyGridDirty = true; }
+    //! \note Calls \a OnPropertyGridInvalidated()
+    inline void InvalidatePropertyGrid() { mPropertyGridDirty = true; OnPropertyGridInvalidated(); }
+
+    //! Prepare the property grid for a write of a property, before the value changes
+    //! \note Called automatically by setters
+    //! \note Calls \a OnPropertyGridWrite()
+    inline void PreparePropertyGridWrite() { OnPropertyGridWrite(); }
 
     //! Pegasus event function to invalidate the data.
     inline void InvalidateData() { InvalidatePropertyGrid(); }
@@ -639,6 +651,18 @@ protected:
     //!       of declaration/implementation/initialization macros does not match
     inline unsigned int GetNumClassPropertyPointers() const { return mClassPropertyPointers.GetSize(); }
 
+    //! Called each time the property grid is invalidated, typically by a setter,
+    //! to let the owner react to the change rather than polling the dirty flag
+    //! \note The override of this function is optional, the default behavior does nothing
+    //! \warning Can be called from the constructor of the object, before the derived classes are constructed
+    virtual void OnPropertyGridInvalidated() { }
+
+    //! Called each time a property is about to be written, typically by a setter,
+    //! to let the owner wait for the other threads reading the properties
+    //! \note The override of this function is optional, the default behavior does nothing
+    //! \warning Can be called from the constructor of the object, before the derived classes are constructed
+    virtual void OnPropertyGridWrite() { }
+
 
     //------------------------------------------------------------------------------------
     
@@ -695,6 +719,13 @@ inline void PropertyAccessor::InvalidatePropertyGrid() const
 
 //----------------------------------------------------------------------------------------
 
+inline void PropertyAccessor::PreparePropertyGridWrite() const
+{
+    mObj->PreparePropertyGridWrite();
+}
+
+//----------------------------------------------------------------------------------------
+
 template <typename T>
 inline void PropertyGridObject::AddObjectProperty(const char * name, const T * defaultValuePtr)
 {
@@ -48,7 +48,7 @@ public:
     //! Compute mode.
     virtual Graph::Node::Mode GetMode() const { return Graph::Node::COMPUTE; }
 
-    //! Override of Update
+    //! Override of Update, also schedules the node when a terrain program has been reloaded
     virtual bool Update();
 
     //! creates internally render resources if they have not been created.
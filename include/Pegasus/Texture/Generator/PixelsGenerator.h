@@ -41,6 +41,10 @@ public:
     //! \return True if the node data is dirty
     //virtual bool Update();
 
+    //! Test if the data of the generator can be generated on a worker thread of the node scheduler
+    //! \return False, the pixels are located with rand(), whose state is shared by all the generators
+    virtual bool IsGenerationThreadSafe() const { return false; }
+
     //------------------------------------------------------------------------------------
     
 protected:
@@ -93,6 +93,8 @@ public:
     //!         or to one of the input nodes, cannot be a null reference.
     //! \note Calls GetUpdatedData() internally, and regenerate the texture data
     //!       if any part of the graph is dirty
+    //! \note While new data is generated asynchronously, the last completed data is returned
+    //!       and its GPU data is kept as is
     TextureDataReturn GetUpdatedTextureData();
 
     //! Releases the entire graph data. Propagates to its children recursively
@@ -129,6 +131,10 @@ protected:
     //! Destructor
     virtual ~Texture();
 
+    //! Release the GPU data of the texture data replaced by the asynchronously generated one
+    //! \param previousData Previous texture data
+    virtual void OnAsyncDataSwapped(Graph::NodeData* previousData);
+
     //------------------------------------------------------------------------------------
 
 private:
@@ -114,6 +114,11 @@ public:
     //! \return True if the configurations are compatible
     bool IsCompatible(const TextureConfiguration & configuration) const;
 
+    //! Combine the configuration with a content hash, identical across runs
+    //! \param hash Content hash so far
+    //! \return Hash combined with the type, the pixel format and the dimensions
+    unsigned long long Hash(unsigned long long hash) const;
+
 
 #if PEGASUS_ENABLE_PROXIES
 
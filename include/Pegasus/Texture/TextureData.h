@@ -50,6 +50,21 @@ public:
             return mImageData[layer];
         }
 
+    //! Write the image data and its dimensions, to store them in the node data cache
+    //! \param stream Stream receiving the content
+    //! \return True
+    virtual bool Serialize(Utils::ByteStream& stream) const;
+
+    //! Restore the image data written by Serialize()
+    //! \param buffer Bytes written by Serialize()
+    //! \param size Number of bytes
+    //! \return True if the dimensions match the configuration of the data
+    virtual bool Deserialize(const char* buffer, int size);
+
+    //! Get the memory used by the image data
+    //! \return Size in bytes of all the layers
+    virtual unsigned int GetMemorySize() const { return mConfiguration.GetNumBytes(); }
+
     //------------------------------------------------------------------------------------
     
 protected:
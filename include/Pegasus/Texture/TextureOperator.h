@@ -98,6 +98,14 @@ public:
     //!       Redefine this function in derived classes to change its behavior
     //virtual NodeDataReturn GetUpdatedData(bool & updated);
 
+    //! Test if the data of the operator can be generated on a worker thread of the node scheduler
+    //! \return True, the texture operators only read their inputs and write the texture data of the node
+    virtual bool IsGenerationThreadSafe() const { return true; }
+
+    //! Test if the data of the operator can be stored in the node data cache
+    //! \return True, the texture data only depends on the properties, the configuration and the inputs
+    virtual bool IsDataCacheable() const { return true; }
+
 
 #if PEGASUS_ENABLE_PROXIES
 
@@ -125,6 +133,11 @@ protected:
     //! \return Pointer to the data being allocated
     virtual Graph::NodeData * AllocateData() const;
 
+    //! Combine the configuration of the operator with its content hash
+    //! \param hash Content hash so far
+    //! \return Hash combined with the configuration
+    virtual unsigned long long HashContent(unsigned long long hash) const { return mConfiguration.Hash(hash); }
+
 
     //! Generate the content of the data associated with the texture operator
     //! \warning To be redefined by each derived class, to implement its behavior
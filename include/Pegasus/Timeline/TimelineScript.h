@@ -135,6 +135,12 @@ public:
     //! \param errorMessage the actual error message
     virtual void OnCompilationError(const char* compilationUnitTitle, int line, const char* errorMessage, const char* token);
 
+    //! Triggered when there is a compilation warning
+    //! \param compilationUnitTitle
+    //! \param line the actual
+    //! \param warningMessage the actual warning message
+    virtual void OnCompilationWarning(const char* compilationUnitTitle, int line, const char* warningMessage);
+
     //! Called at the end of a compilation
     //! \param success true if it was successful, false otherwise
     virtual void OnCompilationEnd(bool success);
@@ -142,6 +148,9 @@ public:
     //! \return true if the script has a compilation pending, false otherwise
     bool IsDirty() const { return mIsDirty; }
 
+    //! \return true if the script implements Timeline_Destroy, false otherwise
+    bool HasDestroyFunction() const { return IsValidBindPoint(BIND_POINT_DESTROY); }
+
     //! Adds a reference to a header
     void AddHeader(TimelineSourceIn header);
 
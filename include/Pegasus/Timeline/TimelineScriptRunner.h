@@ -125,6 +125,16 @@ protected:
 
 private:
 
+#if PEGASUS_ENABLE_PROXIES
+    //! Captures the globals of the script about to be recompiled, so they can survive the recompilation
+    //! \return true if the globals got captured, false if the script has to be fully reinitialized
+    bool CaptureScriptGlobals();
+
+    //! Swaps the recompiled code under the vm state, restoring the captured globals
+    //! \return true if successful, false if the script has to be fully reinitialized
+    bool HotSwapScript();
+#endif
+
     //! Allocator used for all timeline allocations
     Alloc::IAllocator * mAllocator;
 
@@ -170,6 +180,9 @@ private:
     } mBlockScriptObserver;
 
     bool mWindowIsInitialized[PEGASUS_MAX_WORLD_WINDOW_COUNT];
+
+    //! globals of the script kept alive during a recompilation
+    BlockScript::GlobalStateSnapshot mGlobalSnapshot;
 #endif  // PEGASUS_ENABLE_PROXIES
 };
 
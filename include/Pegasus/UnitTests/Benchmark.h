@@ -0,0 +1,102 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Benchmark.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Microbenchmark harness for the core primitives: warmup runs, repeated timed runs,
+//!         median and 99th percentile per benchmark, printed as a table and written as JSON.
+
+//! ADD HERE YOUR BENCHMARK SUITES
+//! a suite runs its benchmarks with BenchmarkRunner::Run
+
+#ifndef PEGASUS_BENCHMARK_H
+#define PEGASUS_BENCHMARK_H
+
+//! Workload of a benchmark
+//! \param userData the user data given to BenchmarkRunner::Run
+//! \param iterations the number of times the workload has to run
+typedef void (*BenchmarkFunc)(void* userData, int iterations);
+
+//! Statistics of a benchmark, in nanoseconds per iteration
+struct BenchmarkResult
+{
+    char   mName[64];
+    int    mIterations;           //!< iterations of a repetition
+    int    mRepetitions;          //!< timed repetitions, the warmup runs excluded
+    double mMedian;
+    double mP99;
+    double mMin;
+    double mMean;
+    unsigned long long mBytes;    //!< bytes processed by an iteration, 0 if not relevant
+};
+
+//! Runner of the benchmarks, keeping their results
+class BenchmarkRunner
+{
+public:
+    static const int MAX_RESULTS = 256;
+    static const int MAX_REPETITIONS = 1024;
+
+    //! Constructor, 2 warmup runs and 15 repetitions
+    BenchmarkRunner();
+
+    //! Sets the number of runs of every benchmark
+    //! \param warmupRuns untimed runs, filling the caches and the allocators before the timed runs
+    //! \param repetitions timed runs, between 1 and MAX_REPETITIONS
+    void SetRepetitions(int warmupRuns, int repetitions);
+
+    //! Only runs the benchmarks whose name contains a string
+    //! \param filter the string, nullptr to run all the benchmarks
+    void SetFilter(const char* filter) { mFilter = filter; }
+
+    //! Runs a benchmark and prints its statistics
+    //! \param name the name of the benchmark, category first (Memcpy/4096 for example)
+    //! \param func the workload
+    //! \param userData the data given to the workload
+    //! \param iterations the iterations of each run, the statistics are divided by it
+    //! \param bytesPerIteration the bytes processed by an iteration, to print a throughput, 0 if not relevant
+    void Run(const char* name, BenchmarkFunc func, void* userData, int iterations, unsigned long long bytesPerIteration = 0);
+
+    //! \return the number of results
+    int GetResultCount() const { return mResultCount; }
+
+    //! \return a result, in the order of the runs
+    const BenchmarkResult& GetResult(int index) const { return mResults[index]; }
+
+    //! Writes the results as JSON
+    //! \param path the path of the file
+    //! \return true on success
+    bool WriteJson(const char* path) const;
+
+private:
+    int mWarmupRuns;
+    int mRepetitions;
+    const char* mFilter;
+    int mResultCount;
+    BenchmarkResult mResults[MAX_RESULTS];
+    double mSamples[MAX_REPETITIONS];
+};
+
+//! Benchmarks of the Utils package
+void RunUtilsBenchmarks(BenchmarkRunner& runner);
+
+//! Benchmarks of the Memory package
+void RunMemoryBenchmarks(BenchmarkRunner& runner);
+
+//! Benchmarks of the node data cache, cold against warm startup (Windows only, the Core IO is not portable)
+void RunFileCacheBenchmarks(BenchmarkRunner& runner);
+
+//! Benchmarks of the graph evaluation, recursive against execution plan (Windows only, the Graph library depends on the Core IO)
+void RunGraphBenchmarks(BenchmarkRunner& runner);
+
+//! Runs the benchmark suites, command line entry point
+//! Options: --json <path> writes the results, --filter <string> selects the benchmarks,
+//!          --repetitions <count>, --warmup <count>
+//! \return 0 on success
+int RunBenchmarkSuites(int argc, char** argv);
+
+#endif
@@ -0,0 +1,29 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphTests.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Pegasus Unit tests for the Graph package.
+//!         The Graph library depends on the Core IO, which only builds on Windows,
+//!         the tests only run on that platform
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_GRAPH_TESTS_H
+#define PEGASUS_GRAPH_TESTS_H
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+bool UNIT_TEST_GraphIdleFrame();
+bool UNIT_TEST_GraphContentHash();
+bool UNIT_TEST_GraphScheduledFrame();
+bool UNIT_TEST_GraphAsyncFrame();
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
+
+#endif
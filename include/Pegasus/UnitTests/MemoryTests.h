@@ -0,0 +1,44 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MemoryTests.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Pegasus Unit tests for the Memory package
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_MEMORY_TESTS_H
+#define PEGASUS_MEMORY_TESTS_H
+
+bool UNIT_TEST_MallocFreeAlign1();
+
+bool UNIT_TEST_SlabAllocator1();
+
+bool UNIT_TEST_SlabAllocator2();
+
+bool UNIT_TEST_SlabAllocator3();
+
+bool UNIT_TEST_SlabAllocatorReleaseThreadCache();
+
+bool UNIT_TEST_MemoryStats1();
+
+bool UNIT_TEST_FrameAllocator1();
+
+bool UNIT_TEST_FrameAllocator2();
+
+bool UNIT_TEST_BlockAllocator1();
+
+bool UNIT_TEST_BlockAllocatorRecompile();
+
+bool UNIT_TEST_TrackingAllocator1();
+
+bool UNIT_TEST_MemoryBudget1();
+
+bool UNIT_TEST_LargeBlockAllocator1();
+
+#endif
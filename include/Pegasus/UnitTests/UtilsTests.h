@@ -29,6 +29,12 @@ bool UNIT_TEST_Memset3();
 
 bool UNIT_TEST_Memset4();
 
+bool UNIT_TEST_Memcpy4();
+
+bool UNIT_TEST_Memmove1();
+
+bool UNIT_TEST_Memset5();
+
 bool UNIT_TEST_Strcmp1();
 
 bool UNIT_TEST_Strcmp2();
@@ -49,6 +55,10 @@ bool UNIT_TEST_Strlen2();
 
 bool UNIT_TEST_Strlen3();
 
+bool UNIT_TEST_Strlen4();
+
+bool UNIT_TEST_Strcmp5();
+
 bool UNIT_TEST_Strchr1();
 
 bool UNIT_TEST_Strchr2();
@@ -93,16 +103,36 @@ bool UNIT_TEST_TesselationTable3();
 
 bool UNIT_TEST_TesselationTable4();
 
+bool UNIT_TEST_EdgeTable1();
+
+bool UNIT_TEST_EdgeTable2();
+
 bool UNIT_TEST_Vector1();
 
 bool UNIT_TEST_Vector2();
 
+bool UNIT_TEST_Vector3();
+
+bool UNIT_TEST_VectorGrowth();
+
 bool UNIT_TEST_ByteStream1();
 
 bool UNIT_TEST_ByteStream2();
 
 bool UNIT_TEST_ByteStream3();
 
+bool UNIT_TEST_ByteStream4();
+
+bool UNIT_TEST_ByteStream5();
+
 bool UNIT_TEST_HashStr();
 
+bool UNIT_TEST_HashBytes64();
+
+bool UNIT_TEST_HashMap1();
+
+bool UNIT_TEST_HashMap2();
+
+bool UNIT_TEST_InternedString1();
+
 #endif
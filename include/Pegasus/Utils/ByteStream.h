@@ -13,6 +13,8 @@
 #ifndef PEGASUS_BYTE_STREAM_H
 #define PEGASUS_BYTE_STREAM_H
 
+#include "Pegasus/Preprocessor.h"
+
 namespace Pegasus
 {
 
@@ -23,32 +25,53 @@ namespace Alloc
 
 namespace Utils
 {
-    
-    // byte stream class containing byte operations
+
+    //! Destination of the bytes flushed by a byte stream, such as a file
+    class IByteStreamSink
+    {
+    public:
+        //! Destructor
+        virtual ~IByteStreamSink() {}
+
+        //! Writes bytes after the bytes previously written
+        //! \param buffer the bytes to write
+        //! \param size the number of bytes to write
+        //! \return true if all the bytes have been written
+        virtual bool Write(const void* buffer, int size) = 0;
+    };
+
+    // byte stream class containing byte operations.
+    // The bytes are stored in chunks, growing the stream never moves the bytes already appended.
+    // With a sink, the stream only keeps one block in memory and writes the full blocks to the sink.
     class ByteStream
     {
     public:
+        //! Default size of the blocks written to a sink
+        static const int DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
         //! Constructor of byte stream
         explicit ByteStream(Alloc::IAllocator* allocator);
 
         //! Destructor of byte stream
         ~ByteStream();
 
-        //! Gets the raw buffer
-        void* GetBuffer() { return mBuffer; }
+        //! Gets the raw buffer, joining the chunks into a single buffer if the stream has more than one chunk
+        //! \return the contiguous bytes of the stream, nullptr if the stream is empty
+        void* GetBuffer();
 
         //! Gets the raw buffer
-        const void* GetBuffer() const { return mBuffer; }
+        //! \warning The stream must be contiguous, call the non const version first to join its chunks
+        const void* GetBuffer() const;
 
         //! Removes total ownership of the current buffer (it also resets the state of this object). It assumes somebody else will reference it and destroy it.
         //! \warning The buffer must be acquired before calling this function. If this function is called and nobody else destroys the buffer, then it will result in a memory leak.
         void ForgetBuffer();
 
-        //! Gets the total internal buffer size
+        //! Gets the number of bytes held by the stream, bytes already flushed to a sink excluded
         int GetSize() const { return mBufferSize; }
 
         //! Appends an element to the stream
-        void Append(const void* buffer, int size); 
+        void Append(const void* buffer, int size);
 
         //! Appends another buffer stream to this stream
         void Append(const ByteStream* stream);
@@ -56,12 +79,68 @@ namespace Utils
         //! Resets buffer and deletes any accumulated memory
         void Reset();
 
+        //! \return the number of chunks holding the bytes of the stream
+        int GetChunkCount() const { return mChunkCount; }
+
+        //! Gets a chunk of the stream. The chunk stays at the same address until the stream is joined, flushed or reset
+        //! \param index the index of the chunk, in the order of the bytes
+        //! \param outSize receives the number of bytes of the chunk
+        //! \return the bytes of the chunk
+        const void* GetChunk(int index, int& outSize) const;
+
+        //! Copies a range of the stream into a buffer, gathering the bytes of every chunk of the range
+        //! \param offset the offset of the first byte to read
+        //! \param destination the buffer receiving the bytes
+        //! \param size the number of bytes to read
+        //! \return the number of bytes copied, smaller than size if the range ends after the stream
+        int Read(int offset, void* destination, int size) const;
+
+        //! Sets the sink receiving the bytes of the stream. Only valid while the stream is empty
+        //! \param sink the sink, nullptr to keep the bytes in memory
+        //! \param blockSize the size of the blocks written to the sink. Every write but the last one of a flush
+        //!                  is a multiple of the block size, starting at a multiple of the block size
+        void SetSink(IByteStreamSink* sink, int blockSize = DEFAULT_BLOCK_SIZE);
+
+        //! Writes the bytes held by the stream to the sink, including the last incomplete block
+        //! \return true if the sink received every byte since it was set
+        bool Flush();
+
+        //! \return the number of bytes written to the sink
+        unsigned long long GetFlushedSize() const { return mFlushedSize; }
 
     private:
+        // No copies allowed
+        PG_DISABLE_COPY(ByteStream);
+
+        //! Contiguous part of the stream
+        struct Chunk
+        {
+            char* mData;
+            int   mSize;
+            int   mCapacity;
+        };
+
+        //! appends an uninitialized chunk, growing the chunk array when full
+        Chunk& PushChunk();
+
+        //! adds an empty chunk able to receive at least the requested bytes
+        Chunk& AddChunk(int minCapacity);
+
+        //! writes bytes to the sink, remembering any failure
+        void WriteToSink(const void* buffer, int size);
+
+        //! deletes the chunks and their bytes
+        void DeleteChunks();
+
         Alloc::IAllocator* mAllocator;
-        void* mBuffer;
+        Chunk* mChunks;
+        int   mChunkCount;
+        int   mChunkCapacity;
         int   mBufferSize;
-        int   mTotalCount;
+        IByteStreamSink* mSink;
+        int   mBlockSize;
+        unsigned long long mFlushedSize;
+        bool  mSinkFailed;
     };
 }
 
@@ -0,0 +1,39 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CpuFeatures.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Detection of the instruction sets of the processor, selecting the
+//!         implementation of the memory and string routines at runtime.
+
+#ifndef PEGASUS_UTILS_CPUFEATURES_H
+#define PEGASUS_UTILS_CPUFEATURES_H
+
+namespace Pegasus {
+namespace Utils {
+
+//! Instruction sets used by the dispatched routines (Memcpy, Memmove, Memset, Strlen, Strcmp)
+enum CpuFeature
+{
+    CPU_FEATURE_SSE2 = 0x1, //!< 16 bytes vectors
+    CPU_FEATURE_AVX2 = 0x2  //!< 32 bytes vectors, supported by the processor and saved by the operating system
+};
+
+//! \return the CPU_FEATURE flags usable by the dispatched routines,
+//!         detected with CPUID on the first call and restricted by SetCpuFeatureMask
+unsigned int GetCpuFeatures();
+
+//! Restricts the instruction sets used by the dispatched routines, to test and benchmark the slower paths.
+//! The routines pick their implementation again on their next call
+//! \param mask CPU_FEATURE flags allowed, ~0u to allow every detected feature
+void SetCpuFeatureMask(unsigned int mask);
+
+
+}   // namespace Utils
+}   // namespace Pegasus
+
+#endif  // PEGASUS_UTILS_CPUFEATURES_H
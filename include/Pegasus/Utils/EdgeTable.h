@@ -0,0 +1,122 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   EdgeTable.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Open addressing table of values stored on the edges between two vertex indices,
+//!         with a memory linear in the number of edges. Use it instead of the tesselation table
+//!         to cache the midpoints of large meshes.
+
+#ifndef PEGASUS_UTILS_EDGETABLE_H
+#define PEGASUS_UTILS_EDGETABLE_H
+
+#include <atomic>
+
+namespace Pegasus
+{
+
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace Utils
+{
+
+//! Table of 32 bit values stored on edges. The order of the two indices of an edge is irrelevant.
+//! The table is prepared for a generation of edges with Reset, which keeps the memory of the previous
+//! generations when it is large enough. InsertOrGet and Get can be called from several threads at once,
+//! the other functions must not run concurrently with any other call.
+class EdgeTable
+{
+public:
+    //! Largest vertex index supported, the two indices of an edge are packed with a generation in 64 bits
+    static const unsigned int MAX_VERTEX_INDEX = (1u << 28) - 1;
+
+    //! Constructor, the table is empty and without memory
+    //! \param alloc allocator of the slots
+    explicit EdgeTable(Alloc::IAllocator* alloc);
+
+    //! Destructor
+    ~EdgeTable();
+
+    //! Starts a new generation of edges, the edges of the previous generation are forgotten.
+    //! The memory is kept if it holds the expected edges, otherwise it is reallocated
+    //! \param maxEdgeCount the number of edges expected in the generation. Concurrent insertions
+    //!                     cannot exceed it, single threaded insertions grow the table if needed
+    void Reset(unsigned int maxEdgeCount);
+
+    //! Inserts a value, replacing the value of an existing edge. Not thread safe
+    //! \param i the first index
+    //! \param j the second index
+    //! \param value the value to store
+    void Insert(unsigned int i, unsigned int j, unsigned int value);
+
+    //! Inserts a value unless the edge already has one. Thread safe, lock free.
+    //! When several threads insert the same edge, a single value is kept and returned to all of them
+    //! \param i the first index
+    //! \param j the second index
+    //! \param value the value to store
+    //! \param outValue receives the value of the edge, the inserted value or the existing one
+    //! \return true if the value has been inserted, false if the edge already had a value
+    bool InsertOrGet(unsigned int i, unsigned int j, unsigned int value, unsigned int& outValue);
+
+    //! Gets the value of an edge. Thread safe, can run concurrently with InsertOrGet
+    //! \param i the first index
+    //! \param j the second index
+    //! \param outValue receives the value if found
+    //! \return true if the edge has a value
+    bool Get(unsigned int i, unsigned int j, unsigned int& outValue) const;
+
+    //! \return the number of edges of the current generation
+    unsigned int GetSize() const { return mSize.load(std::memory_order_relaxed); }
+
+    //! \return the number of slots of the table
+    unsigned int GetCapacity() const { return mCapacity; }
+
+    //! Frees the memory of the table
+    void Clear();
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(EdgeTable);
+
+    //! Slot of the table
+    struct Slot
+    {
+        std::atomic<unsigned long long> mKey;   //!< generation in the top 8 bits, then the larger index and the smaller index
+        std::atomic<unsigned long long> mValue; //!< generation in the high 32 bits, value in the low 32 bits
+    };
+
+    //! \return the key of an edge in the current generation
+    unsigned long long MakeKey(unsigned int i, unsigned int j) const;
+
+    //! \return the value of a slot holding a key of the current generation, once published
+    unsigned int ReadValue(const Slot& slot) const;
+
+    //! \return the first slot probed for a key
+    unsigned int GetHomeSlot(unsigned long long key) const;
+
+    //! allocates the slots, all of them empty
+    void Allocate(unsigned int capacity);
+
+    //! moves the edges of the current generation into a larger table
+    void Grow();
+
+    Alloc::IAllocator* mAllocator;
+    Slot*        mSlots;
+    unsigned int mCapacity;   //!< power of 2
+    unsigned int mMask;
+    unsigned int mMaxSize;    //!< edges above which the table is too loaded
+    unsigned int mGeneration; //!< 1 to 255, the slots of other generations are empty
+    std::atomic<unsigned int> mSize;
+};
+
+}
+}
+
+#endif
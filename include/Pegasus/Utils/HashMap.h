@@ -0,0 +1,463 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   HashMap.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Pegasus open addressing hash map. The hashes live in their own compact array,
+//!         so probing stays in a few cache lines and keys are only compared on a hash match.
+
+#ifndef PEGASUS_UTILS_HASHMAP_H
+#define PEGASUS_UTILS_HASHMAP_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/String.h"
+#include <new>
+#include <utility>
+
+namespace Pegasus
+{
+namespace Utils
+{
+
+//! Mixes the bits of an integer key into a 32 bit hash
+inline unsigned int HashInt(unsigned long long key)
+{
+    // Finalizer of MurmurHash3, every input bit affects every output bit
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<unsigned int>(key);
+}
+
+//! Seed of HashBytes64, for the first buffer of a combined hash
+static const unsigned long long HASH64_SEED = 14695981039346656037ULL;
+
+//! Hashes bytes into a 64 bit hash (FNV-1a), identical across runs and builds,
+//! so it can key persistent data. Hashes of several buffers are combined by passing
+//! the hash of the previous buffers as the seed of the next one
+//! \param buffer the bytes to hash
+//! \param size the number of bytes to hash
+//! \param seed HASH64_SEED, or the hash of the previous buffers
+//! \return the hash of the bytes
+inline unsigned long long HashBytes64(const void* buffer, int size, unsigned long long seed = HASH64_SEED)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(buffer);
+    unsigned long long hash = seed;
+    for (int i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+//! Hash and comparison of the keys of a hash map. The default version handles integers and enumerations.
+//! A traits class can also look up keys with another type (a string for a string key for example),
+//! by providing Hash(const Q&) and Equal(const K&, const Q&) overloads for that type
+template<class K>
+struct HashTraits
+{
+    static unsigned int Hash(const K& key) { return HashInt(static_cast<unsigned long long>(key)); }
+    static bool Equal(const K& a, const K& b) { return a == b; }
+};
+
+//! Hash traits of the pointers, the address is the key
+template<class T>
+struct HashTraits<T*>
+{
+    static unsigned int Hash(const T* key) { return HashInt(reinterpret_cast<size_t>(key)); }
+    static bool Equal(const T* a, const T* b) { return a == b; }
+};
+
+//! Hash traits of the null terminated strings, the text is the key.
+//! The map only stores the pointers, the owner of the map keeps the strings alive
+struct StringHashTraits
+{
+    static unsigned int Hash(const char* key) { return HashStr(key); }
+    static bool Equal(const char* a, const char* b) { return Strcmp(a, b) == 0; }
+};
+
+//! Open addressing hash map, with linear probing.
+//! The slots are relocated when the map grows or when a key is removed,
+//! so pointers to values are only valid until the next insertion or removal
+template<class K, class V, class Traits = HashTraits<K> >
+class HashMap
+{
+public:
+    //! Constructor
+    explicit HashMap(Alloc::IAllocator* alloc)
+        : mAlloc(alloc), mTags(nullptr), mSlots(nullptr), mCapacity(0), mShift(32), mSize(0) {}
+
+    HashMap()
+        : mAlloc(Memory::GetGlobalAllocator()), mTags(nullptr), mSlots(nullptr), mCapacity(0), mShift(32), mSize(0) {}
+
+    //! Move constructor, takes the slots of the other map
+    HashMap(HashMap&& other)
+        : mAlloc(other.mAlloc), mTags(nullptr), mSlots(nullptr), mCapacity(0), mShift(32), mSize(0)
+    {
+        Swap(other);
+    }
+
+    //! Destructor
+    ~HashMap()
+    {
+        Clear();
+    }
+
+    //! \return the number of keys
+    unsigned int GetSize() const { return mSize; }
+
+    //! \return the number of slots, to iterate with IsSlotUsed
+    unsigned int GetSlotCount() const { return mCapacity; }
+
+    //! \return the allocator
+    Alloc::IAllocator* GetAlloc() const { return mAlloc; }
+
+    //! Sets a separate allocator, only while the map has no slots
+    void SetAlloc(Alloc::IAllocator* alloc)
+    {
+        PG_ASSERTSTR(mTags == nullptr, "Cannot change the allocator of a hash map in use.");
+        mAlloc = alloc;
+    }
+
+    //! Makes sure the map can hold count keys without growing
+    void Reserve(unsigned int count)
+    {
+        unsigned int capacity = mCapacity == 0 ? sMinCapacity : mCapacity;
+        while (count > MaxLoad(capacity))
+        {
+            capacity *= 2;
+        }
+        if (capacity != mCapacity)
+        {
+            Rehash(capacity);
+        }
+    }
+
+    //! Finds the value of a key
+    //! \param key the key, or any type the traits can hash and compare to the keys
+    //! \return the value, nullptr if the key is not in the map
+    template<class Q>
+    V* Find(const Q& key)
+    {
+        const int slot = FindSlot(key);
+        return slot < 0 ? nullptr : &mSlots[slot].mValue;
+    }
+
+    //! Finds the value of a key
+    //! \param key the key, or any type the traits can hash and compare to the keys
+    //! \return the value, nullptr if the key is not in the map
+    template<class Q>
+    const V* Find(const Q& key) const
+    {
+        const int slot = FindSlot(key);
+        return slot < 0 ? nullptr : &mSlots[slot].mValue;
+    }
+
+    //! \return true if the key is in the map
+    template<class Q>
+    bool Contains(const Q& key) const
+    {
+        return FindSlot(key) >= 0;
+    }
+
+    //! Inserts a key, or replaces the value of a key already in the map
+    //! \return the stored value
+    V& Insert(const K& key, const V& value)
+    {
+        const unsigned int tag = GetTag(Traits::Hash(key));
+        const int found = FindSlot(key, tag);
+        if (found >= 0)
+        {
+            return mSlots[found].mValue = value;
+        }
+        Slot& slot = InsertSlot(key, tag);
+        return *new (&slot.mValue) V(value);
+    }
+
+    //! Inserts a key, or replaces the value of a key already in the map
+    //! \return the stored value
+    V& Insert(const K& key, V&& value)
+    {
+        const unsigned int tag = GetTag(Traits::Hash(key));
+        const int found = FindSlot(key, tag);
+        if (found >= 0)
+        {
+            return mSlots[found].mValue = std::move(value);
+        }
+        Slot& slot = InsertSlot(key, tag);
+        return *new (&slot.mValue) V(std::move(value));
+    }
+
+    //! Finds the value of a key, inserting a default constructed value if the key is not in the map
+    //! \param inserted Optional, receives true if the key has been inserted
+    //! \return the stored value
+    V& FindOrInsert(const K& key, bool* inserted = nullptr)
+    {
+        const unsigned int tag = GetTag(Traits::Hash(key));
+        const int found = FindSlot(key, tag);
+        if (inserted != nullptr)
+        {
+            *inserted = found < 0;
+        }
+        if (found >= 0)
+        {
+            return mSlots[found].mValue;
+        }
+        Slot& slot = InsertSlot(key, tag);
+        return *new (&slot.mValue) V();
+    }
+
+    //! Removes a key
+    //! \return true if the key was in the map
+    template<class Q>
+    bool Remove(const Q& key)
+    {
+        const int found = FindSlot(key, GetTag(Traits::Hash(key)));
+        if (found < 0)
+        {
+            return false;
+        }
+
+        // Backward shift deletion, the following keys of the cluster move up so no tombstone is needed
+        const unsigned int mask = mCapacity - 1;
+        unsigned int hole = static_cast<unsigned int>(found);
+        DestroySlot(mSlots[hole]);
+        for (unsigned int i = (hole + 1) & mask; mTags[i] != 0; i = (i + 1) & mask)
+        {
+            const unsigned int home = GetHomeIndex(mTags[i]);
+            if (((i - home) & mask) >= ((i - hole) & mask))
+            {
+                mTags[hole] = mTags[i];
+                MoveSlot(mSlots[hole], mSlots[i]);
+                hole = i;
+            }
+        }
+        mTags[hole] = 0;
+        --mSize;
+        return true;
+    }
+
+    //! Removes all the keys and frees the slots
+    void Clear()
+    {
+        for (unsigned int i = 0; i < mCapacity; ++i)
+        {
+            if (mTags[i] != 0)
+            {
+                DestroySlot(mSlots[i]);
+            }
+        }
+        if (mTags != nullptr)
+        {
+            mAlloc->Delete(mTags);
+        }
+        mTags = nullptr;
+        mSlots = nullptr;
+        mCapacity = 0;
+        mShift = 32;
+        mSize = 0;
+    }
+
+    //! Exchanges the slots and the allocators of two maps
+    void Swap(HashMap& other)
+    {
+        std::swap(mAlloc, other.mAlloc);
+        std::swap(mTags, other.mTags);
+        std::swap(mSlots, other.mSlots);
+        std::swap(mCapacity, other.mCapacity);
+        std::swap(mShift, other.mShift);
+        std::swap(mSize, other.mSize);
+    }
+
+    //! \return true if the slot (< GetSlotCount()) holds a key
+    bool IsSlotUsed(unsigned int slot) const { PG_ASSERT(slot < mCapacity); return mTags[slot] != 0; }
+
+    //! \return the key of a used slot
+    const K& GetSlotKey(unsigned int slot) const { PG_ASSERT(IsSlotUsed(slot)); return mSlots[slot].mKey; }
+
+    //! \return the value of a used slot
+    V& GetSlotValue(unsigned int slot) { PG_ASSERT(IsSlotUsed(slot)); return mSlots[slot].mValue; }
+
+    //! \return the value of a used slot
+    const V& GetSlotValue(unsigned int slot) const { PG_ASSERT(IsSlotUsed(slot)); return mSlots[slot].mValue; }
+
+    HashMap& operator=(HashMap&& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(HashMap);
+
+    //! Key and value of a slot. The slots are raw memory, the key and the value are constructed separately
+    struct Slot
+    {
+        K mKey;
+        V mValue;
+    };
+
+    //! destroys the key and the value of a slot
+    static void DestroySlot(Slot& slot)
+    {
+        slot.mKey.~K();
+        slot.mValue.~V();
+    }
+
+    //! moves the key and the value of a slot into an empty slot
+    static void MoveSlot(Slot& dst, Slot& src)
+    {
+        new (&dst.mKey) K(std::move(src.mKey));
+        new (&dst.mValue) V(std::move(src.mValue));
+        DestroySlot(src);
+    }
+
+    //! Smallest number of slots allocated
+    static const unsigned int sMinCapacity = 16;
+
+    //! Alignment of the slot array, placed after the tag array in the same allocation
+    static const unsigned int sSlotAlignment = 16;
+
+    //! Flag set in every tag, a tag of 0 is an empty slot
+    static const unsigned int sUsedTag = 0x80000000u;
+
+    //! \return the number of keys a capacity holds before growing (3/4 load factor)
+    static unsigned int MaxLoad(unsigned int capacity) { return capacity - capacity / 4; }
+
+    //! \return the tag of a hash
+    static unsigned int GetTag(unsigned int hash) { return hash | sUsedTag; }
+
+    //! \return the first slot to probe for a tag, only valid once slots are allocated.
+    //! Fibonacci hashing spreads the weak low bits of the string hashes
+    unsigned int GetHomeIndex(unsigned int tag) const
+    {
+        return (tag * 2654435769u) >> mShift;
+    }
+
+    //! \return the slot of a key, -1 if the key is not in the map
+    template<class Q>
+    int FindSlot(const Q& key) const
+    {
+        return FindSlot(key, GetTag(Traits::Hash(key)));
+    }
+
+    //! \return the slot of a key with a known tag, -1 if the key is not in the map
+    template<class Q>
+    int FindSlot(const Q& key, unsigned int tag) const
+    {
+        if (mSize == 0)
+        {
+            return -1;
+        }
+
+        // The load factor keeps an empty slot, which ends the probing
+        const unsigned int mask = mCapacity - 1;
+        for (unsigned int i = GetHomeIndex(tag); ; i = (i + 1) & mask)
+        {
+            const unsigned int t = mTags[i];
+            if (t == 0)
+            {
+                return -1;
+            }
+            else if (t == tag && Traits::Equal(mSlots[i].mKey, key))
+            {
+                return static_cast<int>(i);
+            }
+        }
+    }
+
+    //! Inserts a key known to be missing from the map, growing it if needed.
+    //! The caller constructs the value of the returned slot
+    Slot& InsertSlot(const K& key, unsigned int tag)
+    {
+        if (mSize + 1 > MaxLoad(mCapacity))
+        {
+            Rehash(mCapacity == 0 ? sMinCapacity : mCapacity * 2);
+        }
+
+        const unsigned int mask = mCapacity - 1;
+        unsigned int i = GetHomeIndex(tag);
+        while (mTags[i] != 0)
+        {
+            i = (i + 1) & mask;
+        }
+
+        mTags[i] = tag;
+        new (&mSlots[i].mKey) K(key);
+        ++mSize;
+        return mSlots[i];
+    }
+
+    //! moves the keys to a new slot array
+    //! \param capacity number of slots, a power of 2 able to hold the keys
+    void Rehash(unsigned int capacity)
+    {
+        PG_ASSERT((capacity & (capacity - 1)) == 0 && mSize <= MaxLoad(capacity));
+        const size_t tagBytes = (capacity * sizeof(unsigned int) + sSlotAlignment - 1) & ~static_cast<size_t>(sSlotAlignment - 1);
+        char* block = static_cast<char*>(mAlloc->AllocAlign(tagBytes + capacity * sizeof(Slot), sSlotAlignment, Alloc::PG_MEM_PERM, -1, "HashMap", __FILE__, __LINE__));
+
+        unsigned int* oldTags = mTags;
+        Slot* oldSlots = mSlots;
+        const unsigned int oldCapacity = mCapacity;
+
+        mTags = reinterpret_cast<unsigned int*>(block);
+        mSlots = reinterpret_cast<Slot*>(block + tagBytes);
+        mCapacity = capacity;
+        mShift = 32;
+        for (unsigned int c = capacity; c > 1; c >>= 1)
+        {
+            --mShift;
+        }
+        for (unsigned int i = 0; i < capacity; ++i)
+        {
+            mTags[i] = 0;
+        }
+
+        const unsigned int mask = capacity - 1;
+        for (unsigned int s = 0; s < oldCapacity; ++s)
+        {
+            if (oldTags[s] != 0)
+            {
+                unsigned int i = GetHomeIndex(oldTags[s]);
+                while (mTags[i] != 0)
+                {
+                    i = (i + 1) & mask;
+                }
+                mTags[i] = oldTags[s];
+                MoveSlot(mSlots[i], oldSlots[s]);
+            }
+        }
+
+        if (oldTags != nullptr)
+        {
+            mAlloc->Delete(oldTags);
+        }
+    }
+
+    Alloc::IAllocator* mAlloc;
+    unsigned int* mTags;     //!< tag of each slot, the hash with sUsedTag set, 0 when empty
+    Slot*         mSlots;    //!< key and value of each slot, in the allocation of the tags
+    unsigned int  mCapacity; //!< number of slots, always a power of 2
+    unsigned int  mShift;    //!< 32 - log2(mCapacity)
+    unsigned int  mSize;     //!< number of keys
+};
+
+
+}
+}
+
+#endif
@@ -0,0 +1,131 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   InternedString.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Strings interned by a string interner, which keeps a single copy of each text.
+//!         Interned strings compare by pointer and carry their hash, making cheap hash map keys.
+
+#ifndef PEGASUS_UTILS_INTERNEDSTRING_H
+#define PEGASUS_UTILS_INTERNEDSTRING_H
+
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/StringInternTable.h"
+
+namespace Pegasus
+{
+
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace Utils
+{
+
+//! String owned by a string interner. Two strings of the same interner are equal only if they point to the same copy
+class InternedString
+{
+public:
+    //! Constructor, null string
+    InternedString() : mStr(nullptr), mHash(0) {}
+
+    //! \return the text, nullptr for the null string
+    const char* GetStr() const { return mStr; }
+
+    //! \return the hash of the text, equal to Utils::HashStr(GetStr())
+    unsigned int GetHash() const { return mHash; }
+
+    //! \return true for the null string, returned when a lookup fails
+    bool IsNull() const { return mStr == nullptr; }
+
+    bool operator==(const InternedString& other) const { return mStr == other.mStr; }
+    bool operator!=(const InternedString& other) const { return mStr != other.mStr; }
+
+private:
+    friend class StringInterner;
+
+    //! Constructor, only used by the interner
+    InternedString(const char* str, unsigned int hash) : mStr(str), mHash(hash) {}
+
+    const char*  mStr;
+    unsigned int mHash;
+};
+
+//! Hash traits of the interned strings. Interned keys hash and compare in constant time,
+//! and a map can also be searched with the text, without interning it first
+template<>
+struct HashTraits<InternedString>
+{
+    static unsigned int Hash(const InternedString& key) { return key.GetHash(); }
+    static unsigned int Hash(const char* key) { return HashStr(key); }
+    static bool Equal(const InternedString& a, const InternedString& b) { return a == b; }
+    static bool Equal(const InternedString& a, const char* b) { return Strcmp(a.GetStr(), b) == 0; }
+};
+
+//! Owner of interned strings. The copies are packed in pages, released when the interner is cleared.
+//! The interner is not thread safe
+class StringInterner
+{
+public:
+    //! Constructor
+    //! \param allocator the allocator of the pages and of the lookup table
+    explicit StringInterner(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    ~StringInterner();
+
+    //! Sets the allocator of the interner. Only valid when the interner is empty
+    void SetAllocator(Alloc::IAllocator* allocator);
+
+    //! Interns a string, copying it the first time the text is seen
+    //! \param str the null terminated text
+    //! \return the interned string
+    InternedString Intern(const char* str);
+
+    //! Interns a string view, copying it the first time the text is seen
+    //! \param str the text, does not need to be null terminated
+    //! \param length the number of characters of the view
+    //! \return the interned string, with a null terminated copy of the view
+    InternedString Intern(const char* str, int length);
+
+    //! Finds a string without interning it
+    //! \param str the null terminated text
+    //! \return the interned string, the null string if the text has never been interned
+    InternedString Find(const char* str) const;
+
+    //! \return the number of strings interned
+    int GetSize() const { return mTable.GetSize(); }
+
+    //! Removes all the strings and frees the pages. The interned strings become invalid
+    void Clear();
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(StringInterner);
+
+    //! copies a string view into the pages
+    //! \return the null terminated copy
+    char* Store(const char* str, int length);
+
+    //! Header of a page, followed by the characters
+    struct Page
+    {
+        Page* mNext;
+    };
+
+    Alloc::IAllocator* mAllocator;
+    StringInternTable  mTable;
+    Page* mPages;     //!< list of pages, the current page first
+    int   mPageUsed;  //!< characters used in the current page
+};
+
+
+}
+}
+
+#endif
@@ -7,7 +7,7 @@
 //! \file	Memcpy.h
 //! \author	Kleber Garcia
 //! \date	11th January 2014
-//! \brief	Memcpy fast / dirty implementation
+//! \brief	Memcpy and Memmove, with SSE2 / AVX2 implementations selected at runtime
 
 #ifndef PEGASUS_STDC_MEMCPY_H
 #define PEGASUS_STDC_MEMCPY_H
@@ -18,11 +18,15 @@ namespace Utils
 {
 
 //! Standard STD C based lite memcpy function
-//! \brief Does not support intersecting memory like the actual std function does
-//!        it also does not do memory alignment check, since recent processors handle this on
-//!        the medal.
+//! \brief Only supports intersecting memory when copying forward (destination before source),
+//!        use Memmove for the other cases. Any alignment is supported, the implementation is picked for the processor (see CpuFeatures.h)
+//! \return destination
 void * Memcpy(void* destination, const void* source, unsigned count);
 
+//! Standard STD C memmove function, the source and destination can intersect
+//! \return destination
+void * Memmove(void* destination, const void* source, unsigned count);
+
 }
 }
 
@@ -7,7 +7,7 @@
 //! \file	Memset.h
 //! \author Kleber Garcia/Karolyn Boulanger
 //! \date	5th May 2014
-//! \brief	Memset (all its flavors)
+//! \brief	Memset (all its flavors), with SSE2 / AVX2 implementations selected at runtime
 
 namespace Pegasus {
 namespace Utils {
@@ -19,13 +19,19 @@ namespace Utils {
 //! \return Destination buffer
 void * Memset8(void * destination, char value, unsigned int size);
 
+//! Fill memory with a constant value in chunks of 16 bits
+//! \param destination Memory destination, any alignment
+//! \param value Value to set (16 bits)
+//! \param size Total size of destination, in bytes, multiple of 2
+//! \return Destination buffer
+void * Memset16(void * destination, unsigned short value, unsigned int size);
+
 //! Fill memory with a constant value in chunks of 32 bits
-//! \warning size must be a multiple of 4. If not, the last few bytes will be missing
-//! \param destination Memory destination
+//! \param destination Memory destination, any alignment
 //! \param value Value to set (32 bits)
 //! \param size Total size of destination, in bytes, multiple of 4
 //! \return Destination buffer
-void * Memset32(void * destination, unsigned long value, unsigned int size);
+void * Memset32(void * destination, unsigned int value, unsigned int size);
 
 }   // namespace Utils
 }   // namespace Pegasus
@@ -47,12 +47,26 @@ namespace Utils
 
     //! convert a string to int
     int Atoi(const char * str);
+
+    //! convert a non null terminated string view of length characters to int
+    int Atoi(const char * str, int length);
     
     //! convert a string to a float
     float Atof(const char * str);
 
+    //! convert a non null terminated string view of length characters to a float
+    float Atof(const char * str, int length);
+
     //! returns a hash of the string
     unsigned int HashStr(const char* str);
+
+    //! returns a hash of a non null terminated string view of length characters.
+    //! Matches HashStr for the null terminated version of the same string
+    unsigned int HashStr(const char* str, int length);
+
+    //! compares length characters of two strings
+    //! \return true if the first length characters are the same, false otherwise
+    bool Strneq(const char* str1, const char* str2, int length);
     
 }
 }
@@ -0,0 +1,82 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   StringInternTable.h
+//! \author Kleber Garcia
+//! \date   October 19th 2026
+//! \brief  Open addressing hash table mapping string views to a single stored copy.
+//!         The table does not own the strings, the owner (string pool, asset) stores them
+//!         and registers them once, so repeated lookups of the same text never copy.
+
+#ifndef PEGASUS_STRING_INTERN_TABLE_H
+#define PEGASUS_STRING_INTERN_TABLE_H
+
+namespace Pegasus
+{
+
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace Utils
+{
+    
+    //! Table of interned strings, keyed by a hash of the string view.
+    class StringInternTable
+    {
+    public:
+        //! Constructor
+        //! \param allocator the allocator used for the hash buckets
+        explicit StringInternTable(Alloc::IAllocator* allocator);
+
+        //! Destructor
+        ~StringInternTable();
+
+        //! Sets the allocator used for the hash buckets. Only valid when the table is empty
+        void SetAllocator(Alloc::IAllocator* allocator);
+
+        //! Finds a string previously inserted
+        //! \param str pointer to the first character of the string view (does not need to be null terminated)
+        //! \param length the number of characters of the view
+        //! \param hash the hash of the view, computed with Utils::HashStr(str, length)
+        //! \return the stored string, nullptr if the string has not been inserted
+        const char* Find(const char* str, int length, unsigned int hash) const;
+
+        //! Inserts a stored string. The string must remain valid until Reset is called
+        //! \param storedStr the stored string
+        //! \param length the number of characters of the stored string
+        //! \param hash the hash of the string, computed with Utils::HashStr(str, length)
+        void Insert(const char* storedStr, int length, unsigned int hash);
+
+        //! Gets the number of strings inserted
+        int GetSize() const { return mCount; }
+
+        //! Removes all the strings and deletes the buckets
+        void Reset();
+
+    private:
+        //! Bucket of the table. An empty bucket has a null string
+        struct Entry
+        {
+            const char*  mStr;
+            unsigned int mHash;
+            int          mLength;
+        };
+
+        //! Doubles the number of buckets and reinserts all the entries
+        void Grow();
+
+        Alloc::IAllocator* mAllocator;
+        Entry* mEntries;
+        int    mCapacity; //always a power of 2
+        int    mCount;
+    };
+}
+
+}
+
+#endif
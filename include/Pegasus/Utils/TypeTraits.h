@@ -49,64 +49,67 @@ class TypeTraits
 {
 private:
 
+    // The Dummy parameters make the specializations partial, explicit specializations
+    // are not allowed in class scope by GCC and Clang
+
     //! Structure to test if an unqualified type is void
-    template <typename U> struct IsVoidStruct
+    template <typename U, bool Dummy = true> struct IsVoidStruct
         {   static bool const Result = false;   };
-    template <> struct IsVoidStruct<void>
+    template <bool Dummy> struct IsVoidStruct<void, Dummy>
         {   static bool const Result = true;    };
 
     //! Structure to test if an unqualified type is an unsigned integer
-    template <typename U> struct IsUnsignedIntStruct
+    template <typename U, bool Dummy = true> struct IsUnsignedIntStruct
         {   static bool const Result = false;   };
-    template <> struct IsUnsignedIntStruct<Math::PUInt8>
+    template <bool Dummy> struct IsUnsignedIntStruct<Math::PUInt8, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsUnsignedIntStruct<Math::PUInt16>
+    template <bool Dummy> struct IsUnsignedIntStruct<Math::PUInt16, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsUnsignedIntStruct<Math::PUInt32>
+    template <bool Dummy> struct IsUnsignedIntStruct<Math::PUInt32, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsUnsignedIntStruct<Math::PUInt64>
+    template <bool Dummy> struct IsUnsignedIntStruct<Math::PUInt64, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsUnsignedIntStruct<unsigned int>
+    template <bool Dummy> struct IsUnsignedIntStruct<unsigned int, Dummy>
         {   static bool const Result = true;    };
 
     //! Structure to test if an unqualified type is a signed integer
-    template <typename U> struct IsSignedIntStruct
+    template <typename U, bool Dummy = true> struct IsSignedIntStruct
         {   static bool const Result = false;   };
-    template <> struct IsSignedIntStruct<Math::PInt8>
+    template <bool Dummy> struct IsSignedIntStruct<Math::PInt8, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsSignedIntStruct<Math::PInt16>
+    template <bool Dummy> struct IsSignedIntStruct<Math::PInt16, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsSignedIntStruct<Math::PInt32>
+    template <bool Dummy> struct IsSignedIntStruct<Math::PInt32, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsSignedIntStruct<Math::PInt64>
+    template <bool Dummy> struct IsSignedIntStruct<Math::PInt64, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsSignedIntStruct<int>
+    template <bool Dummy> struct IsSignedIntStruct<int, Dummy>
         {   static bool const Result = true;    };
 
     //! Structure to test if an unqualified type is a float
-    template <typename U> struct IsFloatStruct
+    template <typename U, bool Dummy = true> struct IsFloatStruct
         {   static bool const Result = false;   };
-    template <> struct IsFloatStruct<Math::PFloat32>
+    template <bool Dummy> struct IsFloatStruct<Math::PFloat32, Dummy>
         {   static bool const Result = true;    };
-    template <> struct IsFloatStruct<Math::PFloat64>
+    template <bool Dummy> struct IsFloatStruct<Math::PFloat64, Dummy>
         {   static bool const Result = true;    };
 
     //! Structure to test if an unqualified type is a boolean
-    template <typename U> struct IsBooleanStruct
+    template <typename U, bool Dummy = true> struct IsBooleanStruct
         {   static bool const Result = false;   };
-    template <> struct IsBooleanStruct<bool>
+    template <bool Dummy> struct IsBooleanStruct<bool, Dummy>
         {   static bool const Result = true;    };
     
     //! Structure to test if an unqualified type is a character
-    template <typename U> struct IsCharStruct
+    template <typename U, bool Dummy = true> struct IsCharStruct
         {   static bool const Result = false;   };
-    template <> struct IsCharStruct<char>
+    template <bool Dummy> struct IsCharStruct<char, Dummy>
         {   static bool const Result = true;    };
 
     //! Structure to test if an unqualified type is null
-    template <typename U> struct IsNullStruct
+    template <typename U, bool Dummy = true> struct IsNullStruct
         {   static bool const Result = false;   };
-    template <> struct IsNullStruct<NullType>
+    template <bool Dummy> struct IsNullStruct<NullType, Dummy>
         {   static bool const Result = true;    };
 
     //! Structure to test if an unqualified type is a pointer
@@ -172,43 +175,43 @@ public:
                                                     ::NonVolatileType UnqualifiedType;
 
     //! True if T is void
-    static bool const IsVoid = IsVoidStruct<TypeTraits<T>::UnqualifiedType>::Result;
+    static bool const IsVoid = IsVoidStruct<typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is an unsigned integer
     static bool const IsUnsignedInteger = IsUnsignedIntStruct<
-                                            TypeTraits<T>::UnqualifiedType>::Result;
+                                            typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is a signed integer
     static bool const IsSignedInteger = IsSignedIntStruct<
-                                            TypeTraits<T>::UnqualifiedType>::Result;
+                                            typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is an integer (unsigned or signed)
     static bool const IsInteger = IsUnsignedInteger || IsSignedInteger;
 
     //! True if T is a float
-    static bool const IsFloat = IsFloatStruct<TypeTraits<T>::UnqualifiedType>::Result;
+    static bool const IsFloat = IsFloatStruct<typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is a number (integer or float)
     static bool const IsNumber = IsInteger || IsFloat;
 
     //! True if T is a boolean
-    static bool const IsBoolean = IsBooleanStruct<TypeTraits<T>::UnqualifiedType>::Result;
+    static bool const IsBoolean = IsBooleanStruct<typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is a character
-    static bool const IsChar = IsCharStruct<TypeTraits<T>::UnqualifiedType>::Result;
+    static bool const IsChar = IsCharStruct<typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is a null type (NullType)
-    static bool const IsNull = IsNullStruct<TypeTraits<T>::UnqualifiedType>::Result;
+    static bool const IsNull = IsNullStruct<typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is a pointer type
-    static bool const IsPointer = IsPointerStruct<TypeTraits<T>::UnqualifiedType>::Result;
+    static bool const IsPointer = IsPointerStruct<typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! Type of the pointee, NullType if T is not a pointer type
     typedef typename IsPointerStruct<typename TypeTraits<T>::UnqualifiedType>
                                                             ::PointeeType PointeeType;
 
     //! True if T is a reference type
-    static bool const IsReference = IsReferenceStruct<TypeTraits<T>::UnqualifiedType>::Result;
+    static bool const IsReference = IsReferenceStruct<typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! Type of the referred type
     typedef typename IsReferenceStruct<typename TypeTraits<T>::UnqualifiedType>
@@ -216,7 +219,7 @@ public:
 
     //! True if T is a pointer to member type
     static bool const IsPointerToMember = IsPointerToMemberStruct<
-                                            TypeTraits<T>::UnqualifiedType>::Result;
+                                            typename TypeTraits<T>::UnqualifiedType>::Result;
 
     //! True if T is a base type (that can be passed by value with a function)
     static bool const IsBaseType = IsNumber || IsBoolean || IsChar || IsPointer || IsReference || IsPointerToMember;
@@ -228,8 +231,8 @@ public:
 #if PEGASUS_COMPILER_MSVC
     static bool const IsPOD = IsVoid || IsBaseType || (__is_pod(T) && __has_trivial_constructor(T));
 #else
-    // Compilation fail until we have a proper implementation
-    static bool const IsPOD = UN-DEFINED
+    // GCC and Clang provide the same intrinsics
+    static bool const IsPOD = IsVoid || IsBaseType || (__is_pod(T) && __has_trivial_constructor(T));
 #endif
 
     //! True if T is a const type
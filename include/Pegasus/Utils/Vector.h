@@ -16,6 +16,7 @@
 #include "Pegasus/Core/Assertion.h"
 #include "Pegasus/Utils/TypeTraits.h"
 #include "Pegasus/Memory/MemoryManager.h"
+#include <utility>
 
 
 namespace Pegasus
@@ -29,7 +30,9 @@ namespace Alloc
 namespace Utils
 {
 
-//!The vector container class
+//!The vector container class.
+//!The capacity doubles when full, and elements are relocated with a plain copy of their bytes,
+//!so elements must not keep pointers to themselves
 class BaseVector
 {
 public:
@@ -42,6 +45,9 @@ public:
     //! \return size of elements
     unsigned int GetSize() const { return mDataSize; }
 
+    //! \return number of elements that fit before the next reallocation
+    unsigned int GetCapacity() const { return mDataCount; }
+
     //! \return the allocator
     Alloc::IAllocator* GetAlloc() const { return mAlloc; }
 
@@ -63,6 +69,17 @@ public:
     //! Pushes an empty object and returns its pointer
     void* PushEmpty();
 
+    //! Makes sure the vector can hold count elements without reallocating
+    //! \param count the number of elements
+    void Reserve(unsigned int count);
+
+    //! Reallocates the vector to the exact number of elements, or frees it when empty
+    void ShrinkToFit();
+
+    //! Exchanges the elements and the allocators of two vectors, without copying any element
+    //! \param other the other vector, its elements must have the same size
+    void Swap(BaseVector& other);
+
     //! Deletes all data
     void Clear();
 
@@ -76,6 +93,10 @@ public:
     void SetAlloc(Alloc::IAllocator* other) { mAlloc = other; }
     
 private:
+    //! moves the elements to a new buffer
+    //! \param count capacity of the new buffer, at least the size of the vector
+    void Reallocate(unsigned int count);
+
     //! master data pointer
     void* mData;
 
@@ -104,6 +125,9 @@ public:
 
     Vector(const Vector<T>& other) : mBase(nullptr, sizeof(T)) { *this = other; }
 
+    //! Move constructor, takes the buffer of the other vector
+    Vector(Vector<T>&& other) : mBase(other.mBase.GetAlloc(), sizeof(T)) { mBase.Swap(other.mBase); }
+
     //! Destructor
     ~Vector()
     {
@@ -114,6 +138,15 @@ public:
     //! Gets the size
     inline unsigned int GetSize() const { return mBase.GetSize(); }
 
+    //! Gets the number of elements that fit before the next reallocation
+    inline unsigned int GetCapacity() const { return mBase.GetCapacity(); }
+
+    //! Makes sure the vector can hold count elements without reallocating
+    void Reserve(unsigned int count) { mBase.Reserve(count); }
+
+    //! Reallocates the vector to its exact size, or frees it when empty
+    void ShrinkToFit() { mBase.ShrinkToFit(); }
+
     //! [] operator, just like an array
     inline T& operator[](unsigned int index) 
     {
@@ -149,10 +182,58 @@ public:
         return *v;
     }
 
+    //! copies an element at the end of the vector
+    T& Push(const T& value)
+    {
+        if (GetSize() == GetCapacity())
+        {
+            // value can be an element of this vector, copy it before the buffer moves
+            T copy(value);
+            return *new (mBase.PushEmpty()) T(std::move(copy));
+        }
+        return *new (mBase.PushEmpty()) T(value);
+    }
+
+    //! moves an element at the end of the vector
+    T& Push(T&& value)
+    {
+        if (GetSize() == GetCapacity())
+        {
+            // value can be an element of this vector, move it out before the buffer moves
+            T copy(std::move(value));
+            return *new (mBase.PushEmpty()) T(std::move(copy));
+        }
+        return *new (mBase.PushEmpty()) T(std::move(value));
+    }
+
+    //! constructs an element in place at the end of the vector.
+    //! The arguments must not refer to elements of this vector
+    template<class A0>
+    T& Emplace(A0&& a0)
+    {
+        return *new (mBase.PushEmpty()) T(std::forward<A0>(a0));
+    }
+
+    //! constructs an element in place at the end of the vector.
+    //! The arguments must not refer to elements of this vector
+    template<class A0, class A1>
+    T& Emplace(A0&& a0, A1&& a1)
+    {
+        return *new (mBase.PushEmpty()) T(std::forward<A0>(a0), std::forward<A1>(a1));
+    }
+
+    //! constructs an element in place at the end of the vector.
+    //! The arguments must not refer to elements of this vector
+    template<class A0, class A1, class A2>
+    T& Emplace(A0&& a0, A1&& a1, A2&& a2)
+    {
+        return *new (mBase.PushEmpty()) T(std::forward<A0>(a0), std::forward<A1>(a1), std::forward<A2>(a2));
+    }
+
     T Pop()
     {
-        // Use a reference to avoid creating a local copy, which then gets copied again when returned.
-        T& val = (*this)[GetSize() - 1];
+        // Move the value out before its destructor is called
+        T val(std::move((*this)[GetSize() - 1]));
         Delete(GetSize() - 1);
         return val;
     }
@@ -194,11 +275,25 @@ public:
 
     Vector<T>& operator=(const Vector<T>& other)
     {
-        Clear();
-        mBase.SetAlloc(other.mBase.GetAlloc());
-        for (unsigned i = 0; i < other.GetSize(); ++i)
+        if (this != &other)
+        {
+            Clear();
+            mBase.SetAlloc(other.mBase.GetAlloc());
+            mBase.Reserve(other.GetSize());
+            for (unsigned i = 0; i < other.GetSize(); ++i)
+            {
+                Push(other[i]);
+            }
+        }
+        return *this;
+    }
+
+    Vector<T>& operator=(Vector<T>&& other)
+    {
+        if (this != &other)
         {
-            PushEmpty() = other[i];
+            Clear();
+            mBase.Swap(other.mBase);
         }
         return *this;
     }